@@ -0,0 +1,134 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	AsyncLog.cs -   A C# wrapper class for the native asynchronous log
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		AsyncLog()
+--					Start()
+--					AddTemplate(string format)
+--					Write(String s)
+--					Event(Int32 id, Int64 a0, Int64 a1, Int64 a2, Int64 a3)
+--					GetStats()
+--					Stop()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Logging from the game, send and receive threads goes through here instead of the
+--		console. A call copies the message into a ring owned by the calling thread and returns;
+--		a native writer thread timestamps, formats and prints it. Write takes a finished string.
+--		Event takes a template id from AddTemplate and up to four integers, so a hot path can log
+--		without building a string. Messages are dropped rather than waited on, and repeats past
+--		a per-second limit are suppressed; both show up in GetStats and in the log itself.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct LogStats
+	{
+		public UInt64 Written;
+		public UInt64 Dropped;
+		public UInt64 Suppressed;
+	}
+
+	public unsafe class AsyncLog
+	{
+		private const Int32 STDOUT = 1;
+
+		private IntPtr log;
+
+		public AsyncLog()
+		{
+			log = ServerLibrary.AsyncLog_Create();
+		}
+
+		public Int32 Start()
+		{
+			return ServerLibrary.AsyncLog_start(log, STDOUT);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: AddTemplate
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 AddTemplate(string format)
+--								format: message text with {} where each event argument goes
+--
+-- RETURNS: The id to pass to Event.
+--
+-- NOTES:
+-- 		Takes a lock in the library; add templates at startup.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 AddTemplate(string format)
+		{
+			return ServerLibrary.AsyncLog_addTemplate(log, format);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Write
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Write(String s)
+--								s: the message
+--
+-- RETURNS: 0 if the message was queued, or -1 if it was suppressed or dropped.
+--
+-- NOTES:
+-- 		The string's characters are passed in place; nothing is allocated for the call.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Write(String s)
+		{
+			fixed (char* text = s)
+			{
+				return ServerLibrary.AsyncLog_write(log, text, Convert.ToUInt32(s.Length));
+			}
+		}
+
+		public Int32 Event(Int32 id, Int64 a0 = 0, Int64 a1 = 0, Int64 a2 = 0, Int64 a3 = 0)
+		{
+			return ServerLibrary.AsyncLog_event(log, id, a0, a1, a2, a3);
+		}
+
+		public LogStats GetStats()
+		{
+			LogStats stats = new LogStats();
+			ServerLibrary.AsyncLog_getStats(log, &stats);
+			return stats;
+		}
+
+		public void Stop()
+		{
+			ServerLibrary.AsyncLog_stop(log);
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.AsyncLog_Destroy(log);
+			log = IntPtr.Zero;
+		}
+	}
+}
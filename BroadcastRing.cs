@@ -0,0 +1,81 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	BroadcastRing.cs -   A C# wrapper class for the native spectator broadcast ring
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		BroadcastRing()
+--					Create(string name, UInt32 slots, Int32 slotSize)
+--					Publish(UInt32 tick, byte* snapshot, Int32 len)
+--					Head()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The send thread publishes each tick's snapshot once into a shared memory ring, and
+--		spectatorrelay processes on the same host send it on to spectators. Publishing is one
+--		copy and never waits on a relay, so spectators cost the match nothing per tick.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class BroadcastRing
+	{
+		private IntPtr ring;
+
+		public BroadcastRing()
+		{
+			ring = ServerLibrary.BroadcastRing_Create();
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Create
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Create(string name, UInt32 slots, Int32 slotSize)
+--								name: the shared memory object relays open, "/" and up to 62 characters
+--								slots: snapshots kept for relays that fall behind
+--								slotSize: largest snapshot that will be published
+--
+-- RETURNS: 0 on success, or -1 if the ring could not be made.
+--
+-- NOTES:
+-- 		A ring of the same name left by an earlier match is replaced. Destroy removes it again.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Create(string name, UInt32 slots, Int32 slotSize)
+		{
+			return ServerLibrary.BroadcastRing_createRing(ring, name, slots, Convert.ToUInt32(slotSize));
+		}
+
+		public bool Publish(UInt32 tick, byte* snapshot, Int32 len)
+		{
+			return ServerLibrary.BroadcastRing_publish(ring, tick, snapshot, Convert.ToUInt32(len)) > 0;
+		}
+
+		// Snapshots published so far
+		public UInt64 Head()
+		{
+			return ServerLibrary.BroadcastRing_head(ring);
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.BroadcastRing_Destroy(ring);
+			ring = IntPtr.Zero;
+		}
+	}
+}
@@ -0,0 +1,117 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	BufferPool.cs -   A C# wrapper class for the unmanaged packet buffer pool
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		Init(Int32 bufferSize, Int32 count, UInt32 flags)
+--					Lease()
+--					Release(Int32 handle)
+--					Address(Int32 handle)
+--					Available()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		BufferPool.cs wraps a pool of fixed-size buffers that live in unmanaged, page-aligned memory.
+--		A buffer is leased by handle, read and written through the pointer returned by Address, and
+--		passed by handle to Server.SendBuffer, QueueBuffer and RecvBuffer. The memory never moves, so
+--		nothing has to be pinned, and none of it is on the managed heap, so the garbage collector
+--		never sees it.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class BufferPool
+	{
+		public const Int32 NONE = -1;
+		public const UInt32 HUGEPAGES = 1;
+		public const UInt32 LOCKED = 2;
+
+		private IntPtr pool;
+
+		public BufferPool()
+		{
+			pool = ServerLibrary.BufferPool_CreatePool();
+		}
+
+		internal IntPtr Pointer
+		{
+			get { return pool; }
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Init(Int32 bufferSize, Int32 count, UInt32 flags)
+--								bufferSize: usable bytes in each buffer
+--								count: number of buffers
+--								flags: HUGEPAGES and/or LOCKED, both best effort
+--
+-- RETURNS: 0 on success, or -1 if the memory could not be mapped.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Init(Int32 bufferSize, Int32 count, UInt32 flags)
+		{
+			return ServerLibrary.BufferPool_initPool(pool, Convert.ToUInt32(bufferSize), Convert.ToUInt32(count), flags);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Lease
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Lease()
+--
+-- RETURNS: a buffer handle, or NONE if the pool is empty.
+--
+-- NOTES:
+-- 		Thread safe. The buffer is not cleared; it holds whatever its last holder wrote.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Lease()
+		{
+			return ServerLibrary.BufferPool_lease(pool);
+		}
+
+		public Int32 Release(Int32 handle)
+		{
+			return ServerLibrary.BufferPool_release(pool, handle);
+		}
+
+		public byte* Address(Int32 handle)
+		{
+			return (byte*)ServerLibrary.BufferPool_address(pool, handle);
+		}
+
+		public Int32 Available()
+		{
+			return Convert.ToInt32(ServerLibrary.BufferPool_available(pool));
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.BufferPool_DestroyPool(pool);
+			pool = IntPtr.Zero;
+		}
+	}
+}
@@ -9,7 +9,8 @@ FUNCTIONS:		Bullet (int id, byte type, Player player)
 
 DATE:			Mar. 14, 2018
 
-REVISIONS:
+REVISIONS:		Oct. 19, 2026 - Bullets carry the snapshot tick their shooter was seeing
+				Oct. 19, 2026 - Movement per tick is exposed for the swept collision test
 
 DESIGNER:		Benny Wang
 
@@ -38,8 +39,16 @@ public class Bullet
     private float deltaX;
     private float deltaZ;
 
+    // Movement per tick, the segment the bullet is swept along
+    public float DeltaX { get { return deltaX; } }
+    public float DeltaZ { get { return deltaZ; } }
+
     public byte Event { get; set; }
 
+    // Snapshot tick the shooter saw when firing, advanced with the bullet; used to rewind
+    // player positions for hit detection
+    public UInt32 Tick { get; set; }
+
     /************************************************************************************
     FUNCTION:	Bullet
 
@@ -117,7 +126,7 @@ public class Bullet
 
     DATE:		Mar. 14, 2018
 
-    REVISIONS:
+    REVISIONS:  Oct. 19, 2026 - Advances Tick along with the position
 
     DESIGNER:	Benny Wang
 
@@ -141,6 +150,7 @@ public class Bullet
 
         this.X += this.deltaX;
         this.Z += this.deltaZ;
+        this.Tick++;
 
         return true;
     }
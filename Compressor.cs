@@ -0,0 +1,101 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	Compressor.cs -   A C# wrapper for the native chunked compressor
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		Compress(byte[] data)
+--					Decompress(byte[] data)
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Replaces GZipStream for the terrain and weapon payloads sent before a match. The data is split
+--		into R.Net.COMPRESS_CHUNK_SIZE chunks that the library compresses and decompresses on every
+--		core at once. Clients must decompress with Decompress; the output is not gzip.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public static unsafe class Compressor
+	{
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Compress
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: byte[] Compress(byte[] data)
+--								data: the bytes to compress
+--
+-- RETURNS: the compressed bytes.
+--------------------------------------------------------------------------------------------------------------*/
+		public static byte[] Compress(byte[] data)
+		{
+			UInt32 chunk = R.Net.COMPRESS_CHUNK_SIZE;
+			byte[] output = new byte[ServerLibrary.Compressor_bound(Convert.ToUInt32(data.Length), chunk)];
+			Int32 len;
+
+			fixed (byte* src = data, dst = output)
+			{
+				len = ServerLibrary.Compressor_compress(src, Convert.ToUInt32(data.Length), dst, Convert.ToUInt32(output.Length), chunk, 0);
+			}
+			if (len < 0)
+			{
+				throw new InvalidOperationException("Compressor_compress failed");
+			}
+
+			Array.Resize(ref output, len);
+			return output;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Decompress
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: byte[] Decompress(byte[] data)
+--								data: bytes produced by Compress, possibly followed by padding
+--
+-- RETURNS: the original bytes, or null if data is not a valid compressed stream.
+--------------------------------------------------------------------------------------------------------------*/
+		public static byte[] Decompress(byte[] data)
+		{
+			fixed (byte* src = data)
+			{
+				Int32 size = ServerLibrary.Compressor_size(src, Convert.ToUInt32(data.Length));
+				if (size < 0)
+				{
+					return null;
+				}
+
+				byte[] output = new byte[size];
+				fixed (byte* dst = output)
+				{
+					if (ServerLibrary.Compressor_decompress(src, Convert.ToUInt32(data.Length), dst, Convert.ToUInt32(size), 0) < 0)
+					{
+						return null;
+					}
+				}
+				return output;
+			}
+		}
+	}
+}
@@ -0,0 +1,211 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	ConnStats.cs -   A C# wrapper class for per-player link quality and send rate
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		ConnStats(Int32 tickRate)
+--					Reset(byte id)
+--					OnSend(byte id, UInt32 tick)
+--					OnAck(byte id, UInt32 ack, UInt32 ackBits)
+--					ShouldSend(byte id, UInt64 tick)
+--					GetInfo(byte id)
+--					AckedTick(byte id, out UInt32 tick)
+--					OnClock(byte id, UInt32 ack, UInt32 clientTimeUs, UInt32 ackDelayUs)
+--					GetClock(byte id, out ClockInfo info)
+--					ClientTick(byte id, UInt32 clientTimeUs, out UInt32 tick)
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - snapshot ticks for lag compensation
+--					October 19th, 2026 - client clock offset and tick estimation
+--					October 19th, 2026 - a packed byte budget per rate level, from Budget
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		ConnStats.cs wraps the unmanaged ConnStats. The send thread stamps each snapshot with the
+--		sequence returned by OnSend, and the receive thread feeds the ack fields of every client tick
+--		to OnAck. From those the library estimates RTT and loss per player and decides through
+--		ShouldSend whether a player is due a snapshot on the current tick (64, 32 or 16 Hz). Budget
+--		gives the packed bytes a snapshot may take at that rate; events past it wait in the player's
+--		EventBacklog for their next snapshot.
+--
+--		Ticks that carry the clock fields also go to OnClock, which estimates each player's clock
+--		offset from the lowest RTT sample of the last second. GetClock and ClientTick turn that into
+--		server ticks: the one the player is looking at, the one their input lands on, and the one
+--		running at any time the player stamps.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct ConnInfo
+	{
+		public UInt32 SrttUs;
+		public UInt32 RttVarUs;
+		public UInt32 LossPerMille;
+		public UInt32 RateHz;
+		public UInt32 Budget;
+		public UInt32 Sent;
+		public UInt32 Acked;
+		public UInt32 Lost;
+	}
+
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct ClockInfo
+	{
+		public UInt32 OffsetUs;
+		public UInt32 MinRttUs;
+		public UInt32 Samples;
+		public UInt32 ViewTick;
+		public UInt32 ArrivalTick;
+	}
+
+	public unsafe class ConnStats
+	{
+		private IntPtr stats;
+
+		public ConnStats(Int32 tickRate)
+		{
+			stats = ServerLibrary.ConnStats_Create(Convert.ToUInt32(tickRate));
+		}
+
+		public void Reset(byte id)
+		{
+			ServerLibrary.ConnStats_reset(stats, id);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: OnSend
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: UInt32 OnSend(byte id, UInt32 tick)
+--								id: the player the snapshot is going to
+--								tick: the server tick the snapshot was built on
+--
+-- RETURNS: the sequence number to write at R.Net.Offset.SEQ.
+--------------------------------------------------------------------------------------------------------------*/
+		public UInt32 OnSend(byte id, UInt32 tick)
+		{
+			return ServerLibrary.ConnStats_onSend(stats, id, tick);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: OnAck
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void OnAck(byte id, UInt32 ack, UInt32 ackBits)
+--								id: the player the tick came from
+--								ack: the newest snapshot sequence the player received
+--								ackBits: the 32 snapshots before ack, bit 0 being ack - 1
+--------------------------------------------------------------------------------------------------------------*/
+		public void OnAck(byte id, UInt32 ack, UInt32 ackBits)
+		{
+			ServerLibrary.ConnStats_onAck(stats, id, ack, ackBits);
+		}
+
+		public bool ShouldSend(byte id, UInt64 tick)
+		{
+			return ServerLibrary.ConnStats_shouldSend(stats, id, tick) != 0;
+		}
+
+		public UInt32 Budget(byte id)
+		{
+			return ServerLibrary.ConnStats_budget(stats, id);
+		}
+
+		public ConnInfo GetInfo(byte id)
+		{
+			ConnInfo info = new ConnInfo();
+			ServerLibrary.ConnStats_getInfo(stats, id, &info);
+			return info;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: AckedTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool AckedTick(byte id, out UInt32 tick)
+--								id: the player
+--								tick: the server tick of the newest snapshot the player acknowledged
+--
+-- RETURNS: false if the player has not acknowledged a recent snapshot.
+--------------------------------------------------------------------------------------------------------------*/
+		public bool AckedTick(byte id, out UInt32 tick)
+		{
+			UInt32 t = 0;
+			bool ok = ServerLibrary.ConnStats_ackedTick(stats, id, &t) == 0;
+			tick = t;
+			return ok;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: OnClock
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void OnClock(byte id, UInt32 ack, UInt32 clientTimeUs, UInt32 ackDelayUs)
+--								id: the player the tick came from
+--								ack: the tick's ack field
+--								clientTimeUs: the tick's client time field
+--								ackDelayUs: the tick's ack delay field
+--
+-- NOTES:
+-- 		Call as soon as the tick is received; the time it is called is the sample's arrival time.
+--------------------------------------------------------------------------------------------------------------*/
+		public void OnClock(byte id, UInt32 ack, UInt32 clientTimeUs, UInt32 ackDelayUs)
+		{
+			ServerLibrary.ConnStats_onClock(stats, id, ack, clientTimeUs, ackDelayUs);
+		}
+
+		// False until the player has an RTT; Samples is 0 if it is only the smoothed one
+		public bool GetClock(byte id, out ClockInfo info)
+		{
+			ClockInfo i = new ClockInfo();
+			bool ok = ServerLibrary.ConnStats_getClock(stats, id, &i) == 0;
+			info = i;
+			return ok;
+		}
+
+		// The server tick running at a time on the player's clock; false until they send the clock fields
+		public bool ClientTick(byte id, UInt32 clientTimeUs, out UInt32 tick)
+		{
+			UInt32 t = 0;
+			bool ok = ServerLibrary.ConnStats_clientTick(stats, id, clientTimeUs, &t) == 0;
+			tick = t;
+			return ok;
+		}
+	}
+}
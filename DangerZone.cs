@@ -9,6 +9,7 @@
 --              public void Update(void)
 --              public void HandlePlayer(Player player)
 --              public byte[] ToBytes(void)
+--              public void WriteTo(byte* snapshot)
 --
 -- DATE:		April 11, 2018
 --
@@ -27,7 +28,7 @@
 ----------------------------------------------------------------------*/
 using System;
 
-public class DangerZone
+public unsafe class DangerZone
 {
     private float fullRad = 0;
     private float zoneCenterPoolWidth = R.Game.DangerZone.ZONE_CENTER_POOL_WIDTH;
@@ -246,4 +247,32 @@ public class DangerZone
 
         return tmp;
     }
+
+    /*------------------------------------------------------------------
+    -- FUNCTION:	WriteTo
+    --
+    -- DATE:		October 19, 2026
+    --
+    -- DESIGNER:	agent
+    --
+    -- PROGRAMMER:	agent
+    --
+    -- INTERFACE:	public void WriteTo(byte* snapshot)
+    --
+    -- ARGUMENT:    byte* snapshot          - the snapshot buffer to
+    --                                        write into.
+    --
+    -- RETURNS:	    void
+    --
+    -- NOTES:
+    -- Writes the same 16 bytes as ToBytes directly into the zone and
+    -- time fields of a native snapshot, without the temporary arrays.
+    ------------------------------------------------------------------*/
+    public void WriteTo(byte* snapshot)
+    {
+        R.Packet.ServerTick.SetZoneX(snapshot, dangerZoneX);
+        R.Packet.ServerTick.SetZoneZ(snapshot, dangerZoneZ);
+        R.Packet.ServerTick.SetZoneRadius(snapshot, dangerZoneRadius);
+        R.Packet.ServerTick.SetTime(snapshot, gameTimer);
+    }
 }
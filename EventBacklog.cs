@@ -0,0 +1,134 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	EventBacklog.cs -   One player's bullet or weapon events not yet sent to them
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		EventBacklog(byte* records, Int32 capacity, Int32 recordSize)
+--					Append(byte* records, Int32 count)
+--					Peek(byte* output, Int32 maxRecords)
+--					Consume(Int32 count)
+--					Count()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - The records live in memory handed in, from the match's arena
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Every tick's events are appended to each player's backlog, and each snapshot a player is
+--		sent takes as many from the front as their byte budget allows. A player on a reduced rate or
+--		a tight budget so gets every event, later, instead of a full section every time. The records
+--		live in unmanaged memory the match hands in, used as a ring; only the match's tick touches it.
+--		Once it holds capacity records the oldest are dropped to make room.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class EventBacklog
+	{
+		private byte* records;
+		private Int32 recordSize;
+		private Int32 capacity;
+		private Int32 head;
+		private Int32 count;
+
+		// records must have room for capacity records of recordSize bytes and outlive the backlog
+		public EventBacklog(byte* records, Int32 capacity, Int32 recordSize)
+		{
+			this.records = records;
+			this.recordSize = recordSize;
+			this.capacity = capacity;
+			this.head = 0;
+			this.count = 0;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Append
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Append(byte* source, Int32 n)
+--								source: n records back to back
+--								n: how many to append
+--
+-- RETURNS: the number of old records dropped to make room.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Append(byte* source, Int32 n)
+		{
+			Int32 dropped = 0;
+			for (Int32 i = 0; i < n; i++)
+			{
+				if (count == capacity)
+				{
+					head = (head + 1) % capacity;
+					count--;
+					dropped++;
+				}
+				byte* cell = records + ((head + count) % capacity) * recordSize;
+				for (Int32 b = 0; b < recordSize; b++)
+				{
+					cell[b] = source[i * recordSize + b];
+				}
+				count++;
+			}
+			return dropped;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Peek
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Peek(byte* output, Int32 maxRecords)
+--								output: room for maxRecords records, written back to back
+--								maxRecords: the most to copy
+--
+-- RETURNS: the number of records copied, oldest first.
+--
+-- NOTES:
+-- 		The records stay in the backlog until Consume() says how many of them were sent.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Peek(byte* output, Int32 maxRecords)
+		{
+			Int32 n = count < maxRecords ? count : maxRecords;
+			for (Int32 i = 0; i < n; i++)
+			{
+				byte* cell = records + ((head + i) % capacity) * recordSize;
+				for (Int32 b = 0; b < recordSize; b++)
+				{
+					output[i * recordSize + b] = cell[b];
+				}
+			}
+			return n;
+		}
+
+		public void Consume(Int32 n)
+		{
+			n = n < count ? n : count;
+			head = (head + n) % capacity;
+			count -= n;
+		}
+
+		public Int32 Count()
+		{
+			return count;
+		}
+	}
+}
@@ -0,0 +1,103 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	EventQueue.cs -   A C# wrapper class for the native lock-free event queue
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		EventQueue(UInt32 capacity, Int32 recordSize)
+--					Push(byte* record)
+--					Drain(byte* output, Int32 maxRecords)
+--					Dropped()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A bounded queue of fixed-size records that any number of threads may Push to while one
+--		thread Drains. Records come out in the order they went in. The cells are allocated once,
+--		in the library, so pushing a record built in a stackalloc buffer allocates nothing, and no
+--		thread ever waits on another. A full queue refuses the record and counts it in Dropped.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class EventQueue
+	{
+		private IntPtr queue;
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: EventQueue
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: EventQueue(UInt32 capacity, Int32 recordSize)
+--								capacity: records held at once, a power of two
+--								recordSize: bytes per record
+--
+-- NOTES:
+-- 		Throws if the library rejects the sizes.
+--------------------------------------------------------------------------------------------------------------*/
+		public EventQueue(UInt32 capacity, Int32 recordSize)
+		{
+			queue = ServerLibrary.EventQueue_Create();
+			if (ServerLibrary.EventQueue_init(queue, capacity, Convert.ToUInt32(recordSize)) != 0)
+			{
+				ServerLibrary.EventQueue_Destroy(queue);
+				throw new ArgumentException("invalid event queue size");
+			}
+		}
+
+		public bool Push(byte* record)
+		{
+			return ServerLibrary.EventQueue_push(queue, record) == 0;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Drain
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Drain(byte* output, Int32 maxRecords)
+--								output: room for maxRecords records, written back to back
+--								maxRecords: the most to take
+--
+-- RETURNS: the number of records written, oldest first.
+--
+-- NOTES:
+-- 		Only one thread may drain a queue. Anything past maxRecords waits for the next call.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Drain(byte* output, Int32 maxRecords)
+		{
+			return (Int32)ServerLibrary.EventQueue_drain(queue, output, Convert.ToUInt32(maxRecords));
+		}
+
+		public UInt64 Dropped()
+		{
+			return ServerLibrary.EventQueue_dropped(queue);
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.EventQueue_Destroy(queue);
+			queue = IntPtr.Zero;
+		}
+	}
+}
@@ -0,0 +1,132 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	IngressFilter.cs -   A C# wrapper class for the native receive-path filter
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		IngressFilter()
+--					Allow(byte header, Int32 size, Int32 idOffset)
+--					SetRates(UInt32 rate, UInt32 burst, UInt32 unknownRate, UInt32 unknownBurst)
+--					AddEndpoint(EndPoint ep, byte id)
+--					RemoveEndpoint(EndPoint ep)
+--					GetStats()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Set on a Server with Server.SetFilter. Every received datagram must match an allowed
+--		header and size, headers with an id offset must come from a registered endpoint carrying
+--		its own player id, and each sender is held to a token-bucket packet rate. Anything else is
+--		dropped in the library and only shows up as a count in GetStats.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct IngressStats
+	{
+		public UInt64 Accepted;
+		public UInt64 BadHeader;
+		public UInt64 BadSize;
+		public UInt64 UnknownSource;
+		public UInt64 BadId;
+		public UInt64 RateLimited;
+
+		public UInt64 Rejected
+		{
+			get { return BadHeader + BadSize + UnknownSource + BadId + RateLimited; }
+		}
+	}
+
+	public unsafe class IngressFilter
+	{
+		public const Int32 ANY_SOURCE = -1;
+
+		private IntPtr filter;
+
+		public IngressFilter()
+		{
+			filter = ServerLibrary.IngressFilter_Create();
+		}
+
+		internal IntPtr Pointer
+		{
+			get { return filter; }
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Allow
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Allow(byte header, Int32 size, Int32 idOffset)
+--								header: first byte of the datagram
+--								size: a length accepted for that header; call once per length
+--								idOffset: offset of the sender's player id, or ANY_SOURCE for
+--										  headers anyone may send
+--
+-- RETURNS: 0 on success, or -1 if the header has no room for another size.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Allow(byte header, Int32 size, Int32 idOffset)
+		{
+			return ServerLibrary.IngressFilter_allow(filter, header, Convert.ToUInt32(size), idOffset);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: SetRates
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void SetRates(UInt32 rate, UInt32 burst, UInt32 unknownRate, UInt32 unknownBurst)
+--								rate, burst: packets per second and bucket size for each registered endpoint
+--								unknownRate, unknownBurst: the same, shared by every unregistered sender
+--------------------------------------------------------------------------------------------------------------*/
+		public void SetRates(UInt32 rate, UInt32 burst, UInt32 unknownRate, UInt32 unknownBurst)
+		{
+			ServerLibrary.IngressFilter_setRates(filter, rate, burst, unknownRate, unknownBurst);
+		}
+
+		public Int32 AddEndpoint(EndPoint ep, byte id)
+		{
+			return ServerLibrary.IngressFilter_addEndpoint(filter, ep, id);
+		}
+
+		public Int32 RemoveEndpoint(EndPoint ep)
+		{
+			return ServerLibrary.IngressFilter_removeEndpoint(filter, ep);
+		}
+
+		public IngressStats GetStats()
+		{
+			IngressStats stats = new IngressStats();
+			ServerLibrary.IngressFilter_getStats(filter, &stats);
+			return stats;
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.IngressFilter_Destroy(filter);
+			filter = IntPtr.Zero;
+		}
+	}
+}
@@ -6,6 +6,7 @@
 -- FUNCTIONS:
 -- InitRandomGuns()
 -- InitRandomGuns(int NumPlayers)
+-- InitRandomGuns(int NumPlayers, byte[,] tiles)
 -- void printCoordinates()
 -- void printExpandedCoordinates()
 -- void fromByteArrayToList(byte[] transmittedBytes)
@@ -18,14 +19,14 @@
 -- void BasicString()
 -- string ExtendedString()
 -- byte GenGunType()
--- bool OccupiedCheck(WeaponSpell genC, list<WeaponSpell> Occupied)
 -- byte[] PutWeaponIntoBytes(WeaponSpell Weapon)
 -- WeaponSpell GetWeaponFromBytes(byte[] weaponinbytes)
 -- int numberOfWeapons(int players)
 --
 -- DATE: April 11th 2018
 --
--- REVISIONS: April 9 2018
+-- REVISIONS: October 19 2026
+--		 April 9 2018
 --		 April 5 2018
 --                      March 29 2018
 --                      March 26 2018
@@ -49,8 +50,6 @@
 
 
 using System;
-using System.IO;
-using System.IO.Compression;
 using System.Collections.Generic;
 
 namespace InitGuns
@@ -62,9 +61,6 @@ namespace InitGuns
         // Valid Coordinates in town
         List<WeaponSpell> TownCoords = new List<WeaponSpell>();
 
-        // Spaces Occupied By other Objects
-        List<WeaponSpell> OccupiedSpaces = new List<WeaponSpell>();
-
         // The array of coordinates for each weapon
         List<WeaponSpell> SpawnedGuns = new List<WeaponSpell>();
 
@@ -111,9 +107,32 @@ namespace InitGuns
         -- around hotspots/ areas of interest and puts them into a public accessible local byte array that can be sent to -- the clients.
         --
         -------------------------------------------------------------------------------------------------*/
-        public InitRandomGuns(int NumPlayers)
+        public InitRandomGuns(int NumPlayers) : this(NumPlayers, null)
         {
+        }
 
+        /*-------------------------------------------------------------------------------------------------
+        -- FUNCTION: InitRandomGuns(int Numplayers, byte[,] tiles)
+        --
+        -- DATE: October 19 2026
+        --
+        -- DESIGNER: agent
+        --
+        -- PROGRAMMER: agent
+        --
+        -- INTERFACE: InitRandomGuns(int Numplayers, byte[,] tiles)
+        --			Numplayers: the number of players in the game
+        --			tiles: the terrain grid weapons must stay clear of, or null to ignore terrain
+        --
+        -- NOTES:
+        -- Places the guns with the native SpawnSampler, which keeps the town, hotspot and spacing rules
+        -- (QUOTIENTTOWNGUNS, PERCENTHOTSPOT, CLUSTERING, OCCURANCESQUARE) but checks spacing against a grid
+        -- instead of a list, and also keeps guns off buildings, cacti and bushes. The sampler writes the
+        -- packed weapon records directly into pcktarray, and SpawnedGuns is filled back from them so
+        -- printCoordinates and printExpandedCoordinates list what was placed.
+        -------------------------------------------------------------------------------------------------*/
+        public InitRandomGuns(int NumPlayers, byte[,] tiles)
+        {
             // Add some dummy hotspots NOTE MUST BE AT LEAST clustering AWAY FROM EDGE IN EACH DIRECTION
             HotSpots.Add(new WeaponSpell(250, 250));
             HotSpots.Add(new WeaponSpell(800, 550));
@@ -144,66 +163,39 @@ namespace InitGuns
             TownCoords.Add(new WeaponSpell(2 + R.Init.TOWNWIDTH, -15 + R.Init.TOWNHEIGHT));
             TownCoords.Add(new WeaponSpell(-144 + R.Init.TOWNWIDTH, 70 + R.Init.TOWNHEIGHT));
 
-            WeaponSpell Weapon;
-            int counter = 0;
-            int interestTracker = 0;
+            int total = numberOfWeapons(NumPlayers);
+            int width = tiles != null ? tiles.GetLength(0) : R.Init.MAPEND;
+            int length = tiles != null ? tiles.GetLength(1) : R.Init.MAPEND;
 
-            // Keep generating guns depending on number of players
-            while (counter < numberOfWeapons(NumPlayers))
+            Networking.SpawnSampler sampler = new Networking.SpawnSampler(width, length, R.Init.OCCURANCESQUARE,
+                (UInt64)rand.Next() << 32 | (UInt32)rand.Next());
+            if (tiles != null)
             {
-                if (counter < numberOfWeapons(NumPlayers) / R.Init.QUOTIENTTOWNGUNS)
-                {
-                    if (TownCoords.Count > 0)
-                    {
-                        int getT = rand.Next(TownCoords.Count);
-                        Weapon = new WeaponSpell(TownCoords[getT].X, TownCoords[getT].Z, true);
-                        TownCoords.RemoveAt(getT);
-                    }
-                    else
-                    {
-                        Weapon = new WeaponSpell(rand.Next(0, R.Init.MAPEND),
-                            rand.Next(0, R.Init.MAPEND), true);
-                    }
-                }
-                else
-                {
-                    if (rand.NextDouble() > R.Init.PERCENTHOTSPOT)
-                    {
-                        Weapon = new WeaponSpell(rand.Next(0, R.Init.MAPEND),
-                            rand.Next(0, R.Init.MAPEND), true);
-                    }
-                    else
-                    {
-                        // Choose a Hotspot at Random
-                        interestTracker = rand.Next(0, HotSpots.Count);
+                sampler.BlockTerrain(tiles);
+            }
+            sampler.SetHotspots(toPairs(HotSpots), R.Init.CLUSTERING);
+            sampler.SetTown(toPairs(TownCoords));
 
-                        int a = rand.Next(HotSpots[interestTracker].X - R.Init.CLUSTERING, HotSpots[interestTracker].X + R.Init.CLUSTERING);
-                        int b = rand.Next(HotSpots[interestTracker].Z - R.Init.CLUSTERING, HotSpots[interestTracker].Z + R.Init.CLUSTERING);
+            pcktarray = new byte[R.Init.INDWPNPCKT * total];
+            int placed = sampler.Sample(total, total / R.Init.QUOTIENTTOWNGUNS, (float)R.Init.PERCENTHOTSPOT,
+                WeaponSpell.inc, pcktarray);
+            sampler.Destroy();
 
-                        Weapon = new WeaponSpell(a, b, true);
-                    }
-                }
-
-                // Check if the generated coordinate is already occupied
-                // if no add to coordinate array
-                if (!OccupiedCheck(Weapon, OccupiedSpaces))
-                {
-                    counter++;
-                    SpawnedGuns.Add(Weapon);
+            WeaponSpell.inc += placed;
+            Array.Resize(ref pcktarray, R.Init.INDWPNPCKT * placed);
+            fromByteArrayToList(pcktarray);
+            compressedpcktarray = compressByteArray(pcktarray);
+        }
 
-                    // Add a 12x12 box of around the spawned point to prevent weapons spawning inside/near
-                    for (int i = Weapon.X - R.Init.OCCURANCESQUARE; i < Weapon.X + R.Init.OCCURANCESQUARE; i++)
-                    {
-                        for (int j = Weapon.Z - R.Init.OCCURANCESQUARE; j < Weapon.Z + R.Init.OCCURANCESQUARE; j++)
-                        {
-                            OccupiedSpaces.Add(new WeaponSpell(i, j));
-                        }
-                    }
-                }
+        private static int[] toPairs(List<WeaponSpell> spots)
+        {
+            int[] xz = new int[spots.Count * 2];
+            for (int i = 0; i < spots.Count; i++)
+            {
+                xz[i * 2] = spots[i].X;
+                xz[i * 2 + 1] = spots[i].Z;
             }
-
-            // Create a byte array with those coordinates
-            getByteArray();
+            return xz;
         }
 
         /*-------------------------------------------------------------------------------------------------
@@ -341,16 +333,12 @@ namespace InitGuns
         -- NOTES:
         -- This function simply takes a byte array and compresses it so that less data needs to be sent across the 
         -- network.
+        --
+        -- Oct 19 2026: uses the native chunked compressor instead of GZipStream.
         -------------------------------------------------------------------------------------------------*/
         public static byte[] compressByteArray(byte[] data)
         {
-            using (var compressedStream = new MemoryStream())
-            using (var zipStream = new GZipStream(compressedStream, CompressionMode.Compress))
-            {
-                zipStream.Write(data, 0, data.Length);
-                zipStream.Close();
-                return compressedStream.ToArray();
-            }
+            return Networking.Compressor.Compress(data);
         }
 
         public class WeaponSpell
@@ -587,29 +575,6 @@ namespace InitGuns
             }
         }
 
-        /*-------------------------------------------------------------------------------------------------
-        -- FUNCTION: OccupiedCheck
-        --
-        -- DATE: April 11 2018
-        --
-        -- DESIGNER: Alfred Swinton
-        --
-        -- PROGRAMMER: Alfred Swinton
-        --
-        -- INTERFACE: bool OccupiedCheck(WeaponSpell genC, list<WeaponSpell> Occupied)	 	
-        --			WeaponSpell genC: an individual weapon, list<WeaponSpell> Occupied : a list of 
-        --				weapons that occupy spaces
-        --
-        -- RETURNS: bool
-        -- 		a boolean value whether or not the weapon which was inputed values have been occupied. 	
-        -- NOTES:
-        -- This function takes a weapon and return true or false based on whether the coordinates of that weapon are --  already occupied in an occupiedspaces list.
-        -------------------------------------------------------------------------------------------------*/
-        public static bool OccupiedCheck(WeaponSpell genC, List<WeaponSpell> Occupied)
-        {
-            return Occupied.Contains(genC);
-        }
-
         /*-------------------------------------------------------------------------------------------------
         -- FUNCTION: PutWeaponIntoBytes(WeaponSpell Weapon)
         --
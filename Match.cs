@@ -0,0 +1,1840 @@
+/*---------------------------------------------------------------------------------------
+--    SOURCE FILE:    Match.cs
+--
+--    PROGRAM:        server
+--
+--    FUNCTIONS:
+--                    public static void Init(AsyncLog sharedLog, Tuning sharedTuning, MatchHost sharedHost, IngressFilter sharedIngress)
+--                    public Match(Int32 index, ushort tcpPort)
+--                    public Int32 Create()
+--                    public void Run()
+--                    public void Stop()
+--                    private void pregame()
+--                    private bool startGame()
+--                    private void tick(Int32 id, IntPtr arena, IntPtr context)
+--                    private void allocateBuffers(IntPtr matchArena)
+--                    private byte* allocate(Int32 size)
+--                    private void receive()
+--                    private void updateWorld()
+--                    private void sendSnapshots()
+--                    private byte generateTickPacketHeader(bool hasPlayer, bool hasBullet, bool hasWeapon, int players)
+--                    private void updateHealthPacket(Player player, byte* snapshot)
+--                    private void fillEvents(Player player, byte* snapshot)
+--                    private void setEventCounts(byte* snapshot, int bulletCount, int weaponCount)
+--                    private void buildSendPacket(byte* snapshot)
+--                    private void handleBuffer(byte* inBuffer, int n, EndPoint ep)
+--                    private void updateExistingPlayer(byte* inBuffer, int n)
+--                    private void handleIncomingBullet(byte playerId, int bulletId, byte bulletType)
+--                    private void handleIncomingWeapon(byte playerId, int weaponId, byte weaponType)
+--                    private void queueBulletEvent(Bullet bullet)
+--                    private void addNewPlayer(EndPoint ep)
+--                    private void attachBacklogs(Player player)
+--                    private void serviceTimers()
+--                    private void evictPlayer(byte id)
+--                    private void sendInitPacket(Player newPlayer)
+--                    private void initTCPServer()
+--                    private void generateInitData()
+--                    private void loadTerrain()
+--                    private void listenThreadFunc()
+--                    private void transmitThreadFunc(object clientsockfd)
+--                    private void openRecorder()
+--                    private void openBroadcast()
+--                    private string perMatch(string name)
+--                    private void initGovernor()
+--                    private void reportGovernor()
+--                    private bool hasNearbyPlayer(Player player)
+--                    private void LogError(String s)
+--                    private string prefixed(string s)
+--
+--    DATE:           Oct 19, 2026
+--
+--    REVISIONS:
+--
+--    DESIGNERS:      Benny Wang, Tim Bruecker, Haley Booker, Alfred Swinton, agent
+--
+--    PROGRAMMER:     Benny Wang, Tim Bruecker, Haley Booker, Alfred Swinton, agent
+--
+-- NOTES:
+-- One match: its players, bullets, danger zone and terrain, and its pregame. Most of this was
+-- the static state of server.cs, which could only ever run one match per process.
+--
+-- Every match in the process is ticked by the MatchHost the server starts, on its shared pool
+-- of workers, and receives its players' datagrams from the host's shared UDP socket through
+-- MatchHost.Recv. A match's tick receives, runs the game and sends the snapshots in turn, on
+-- one worker at a time, so nothing the tick touches needs a lock; the pregame threads only
+-- write the danger zone and terrain before the match is started.
+--
+-- The match's snapshot, packed and receive buffers and its players' event backlogs live in
+-- the arena the host gives the match. The game objects themselves stay on the managed heap.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Collections;
+using System.Collections.Generic;
+using System.Threading;
+using Networking;
+using InitGuns;
+
+unsafe class Match
+{
+    // Shared by every match in the process
+    private static AsyncLog log;
+    private static Tuning tuning;
+    private static MatchHost host;
+    private static IngressFilter ingress;
+    private static object initDataLock = new object();
+
+    private Int32 index;
+    private ushort tcpPort;
+    private Int32 matchId = MatchHost.MATCH_INVALID;
+    private volatile bool started;
+
+    // In the match's arena
+    private IntPtr arena;
+    private byte* snapshot;
+    private byte* packed;
+    private byte* recvBuffer;
+    private EventBacklog[] bulletBacklogs = new EventBacklog[256];
+    private EventBacklog[] weaponBacklogs = new EventBacklog[256];
+
+    private ConnStats connStats;
+    private PositionHistory history;
+    private MatchRecorder recorder;
+    private bool recording;
+    private BroadcastRing broadcast;
+    private bool broadcasting;
+    private UInt32 snapshotTick;
+    private Int32 acceptErrorEvent;
+    private Int32 weaponSwapEvent;
+    private Int32 backlogEvent;
+    private TickGovernor governor;
+    private Int32 engageEvent;
+    private Int32 releaseEvent;
+    private Int32 resyncEvent;
+    private Int32 recvPhase;
+    private Int32 zonePhase;
+    private Int32 hitPhase;
+    private Int32 bulletPhase;
+    private Int32 buildPhase;
+    private Int32 fanOutPhase;
+    private Int32 flushPhase;
+    private Int32 deferStep;
+    private Int32 farRateStep;
+    private Int32 bulletCapStep;
+    private Int32 hitCursor;
+    private SweepBullet[] sweepBullets = new SweepBullet[R.Game.Bullet.SWEEP_CAPACITY];
+    private SweepHit[] sweepHits = new SweepHit[R.Game.Bullet.SWEEP_CAPACITY];
+    private int[] sweepIds = new int[R.Game.Bullet.SWEEP_CAPACITY];
+
+    private byte nextPlayerId = 1;
+    private Dictionary<byte, Player> players = new Dictionary<byte, Player>();
+    private HashSet<byte> deadPlayers = new HashSet<byte>();
+    private EventQueue bulletEvents;
+    private Dictionary<int, Bullet> bullets = new Dictionary<int, Bullet>();
+    private EventQueue weaponEvents;
+    private TimerWheel timers;
+    private byte[] keepAlive = new byte[R.Net.Size.KEEP_ALIVE];
+    private TerrainController tc = new TerrainController();
+
+    // Game generation variables
+    private Int32[] clientSockFdArr = new Int32[R.Net.MAX_PLAYERS];
+    private Thread[] transmitThreadArr = new Thread[R.Net.MAX_PLAYERS];
+    private Thread listenThread;
+    private Thread initDataThread;
+    private ManualResetEvent initDataReady = new ManualResetEvent(false);
+    private bool initDataFailed = false;
+    private byte[] itemData = new byte[R.Net.TCP_BUFFER_SIZE];
+    private byte[] mapData = new byte[R.Net.TCP_BUFFER_SIZE];
+    private Int32 numClients = 0;
+    private bool accepting = false;
+    private TCPServer tcpServer;
+
+    private DangerZone dangerZone;
+    private SpawnPointGenerator spawnPointGenerator = new SpawnPointGenerator();
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         Init
+    --
+    -- DATE:             Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         agent
+    --
+    -- PROGRAMMER:       agent
+    --
+    -- INTERFACE:        public static void Init(AsyncLog sharedLog, Tuning sharedTuning, MatchHost sharedHost, IngressFilter sharedIngress)
+    --                      AsyncLog sharedLog: the process's log
+    --                      Tuning sharedTuning: the process's tuning profile
+    --                      MatchHost sharedHost: the host every match is ticked and sends through
+    --                      IngressFilter sharedIngress: the filter on the host's socket
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- Called once by the server before any match is created.
+    -------------------------------------------------------------------------------------------------*/
+    public static void Init(AsyncLog sharedLog, Tuning sharedTuning, MatchHost sharedHost, IngressFilter sharedIngress)
+    {
+        log = sharedLog;
+        tuning = sharedTuning;
+        host = sharedHost;
+        ingress = sharedIngress;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         Match
+    --
+    -- DATE:             Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         agent
+    --
+    -- PROGRAMMER:       agent
+    --
+    -- INTERFACE:        public Match(Int32 index, ushort tcpPort)
+    --                      Int32 index: the match's place in the process, from 0
+    --                      ushort tcpPort: the port its pregame accepts clients on
+    --
+    -- NOTES:
+    -- Log lines of every match but the first are prefixed with its index.
+    -------------------------------------------------------------------------------------------------*/
+    public Match(Int32 index, ushort tcpPort)
+    {
+        this.index = index;
+        this.tcpPort = tcpPort;
+        acceptErrorEvent = log.AddTemplate(prefixed("Accept error: {}"));
+        weaponSwapEvent = log.AddTemplate(prefixed("Player {} changed weapon to -> Weapon: ID - {}, Type - {}"));
+        backlogEvent = log.AddTemplate(prefixed("Event backlog: dropped {} events players were too far behind on, tick {}"));
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         Create
+    --
+    -- DATE:             Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         agent
+    --
+    -- PROGRAMMER:       agent
+    --
+    -- INTERFACE:        public Int32 Create()
+    --
+    -- RETURNS:          The match's id on the host, or MatchHost.MATCH_INVALID if the host is full
+    --
+    -- NOTES:
+    -- Adds the match to the host. Its ticks do nothing until Run has started the game, but the host
+    -- already routes joins to it, and those wait in its queue. Matches created in order on a fresh
+    -- host get ids in the same order, so a client joins match i with the token i + 1.
+    -------------------------------------------------------------------------------------------------*/
+    public Int32 Create()
+    {
+        matchId = host.CreateMatch(tick, IntPtr.Zero, R.Game.TICK_INTERVAL, R.Net.MATCH_ARENA_SIZE);
+        return matchId;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         Run
+    --
+    -- DATE:             Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         agent
+    --
+    -- PROGRAMMER:       agent
+    --
+    -- INTERFACE:        public void Run()
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- Runs the pregame, then starts the game, which the host's workers run from then on. Returns
+    -- once the game has started, or has been abandoned; see Started.
+    -------------------------------------------------------------------------------------------------*/
+    public void Run()
+    {
+        pregame();
+        if (!startGame())
+        {
+            Stop();
+        }
+    }
+
+    // True once the game runs on the host
+    public bool Started
+    {
+        get { return started; }
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         Stop
+    --
+    -- DATE:             Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         agent
+    --
+    -- PROGRAMMER:       agent
+    --
+    -- INTERFACE:        public void Stop()
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- Takes the match off the host, which waits for a running tick and frees the arena, then closes
+    -- the recording and the spectator ring and frees the rest of the native state.
+    -------------------------------------------------------------------------------------------------*/
+    public void Stop()
+    {
+        if (matchId == MatchHost.MATCH_INVALID)
+        {
+            return;
+        }
+        host.DestroyMatch(matchId);
+        matchId = MatchHost.MATCH_INVALID;
+
+        if (!started)
+        {
+            return;
+        }
+        started = false;
+        if (recording)
+        {
+            recorder.Close();
+        }
+        recorder.Destroy();
+        if (broadcasting)
+        {
+            broadcast.Destroy();
+        }
+        timers.Destroy();
+        weaponEvents.Destroy();
+        bulletEvents.Destroy();
+        history.Destroy();
+        governor.Destroy();
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         pregame
+    --
+    -- DATE:             Feb 18, 2018
+    --
+    -- REVISIONS:        Oct 19, 2026 - Moved into Match
+    --
+    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER:       Benny Wang
+    --
+    -- INTERFACE:        private void pregame()
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- Creates everything needed before the game can start.
+    -------------------------------------------------------------------------------------------------*/
+    private void pregame()
+    {
+        initTCPServer();
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         startGame
+    --
+    -- DATE:             Feb 18, 2018
+    --
+    -- REVISIONS:        Oct 19, 2026 - Abandons the match if the init data could not be generated
+    --                   Oct 19, 2026 - Moved into Match; the host's workers tick the game instead of its own threads
+    --
+    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER:       Benny Wang, Haley Booker
+    --
+    -- INTERFACE:        private bool startGame()
+    --
+    -- RETURNS:          true if the game started
+    --
+    -- NOTES:
+    -- Creates the game's native state and lets the host's ticks run it.
+    --
+    -- If every attempt at the terrain and weapons failed, no client was sent a map, so there is no
+    -- match to run and it is abandoned; the other matches in the process carry on.
+    -------------------------------------------------------------------------------------------------*/
+    private bool startGame()
+    {
+        if (initDataFailed)
+        {
+            LogError("Init data could not be generated, abandoning the match");
+            return false;
+        }
+
+        connStats = new ConnStats(R.Game.TICK_RATE);
+        history = new PositionHistory();
+        openRecorder();
+        openBroadcast();
+        bulletEvents = new EventQueue(R.Net.EVENT_QUEUE_CAPACITY, R.Net.Size.BULLET_EVENT);
+        weaponEvents = new EventQueue(R.Net.EVENT_QUEUE_CAPACITY, R.Net.Size.WEAPON_EVENT);
+        timers = new TimerWheel(R.Net.TIMER_CAPACITY);
+        initGovernor();
+
+        started = true;
+        LogError("Started as match " + matchId + ", join token " + (matchId + 1));
+        return true;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         tick
+    --
+    -- DATE:             Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         agent
+    --
+    -- PROGRAMMER:       agent
+    --
+    -- INTERFACE:        private void tick(Int32 id, IntPtr arena, IntPtr context)
+    --                      Int32 id: the match's id on the host
+    --                      IntPtr arena: the match's arena
+    --                      IntPtr context: unused
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- The host's TickCallback, called on a worker once per R.Game.TICK_INTERVAL. Before the game
+    -- has started it returns straight away. Otherwise it takes everything queued for the match,
+    -- runs the game and sends the snapshots, timing all of it as one governor lane; the host keeps
+    -- the schedule, so the governor only measures.
+    --
+    -- This is called from native code, so nothing may be thrown out of it: an exception is logged
+    -- and the rest of that tick is lost.
+    -------------------------------------------------------------------------------------------------*/
+    private void tick(Int32 id, IntPtr arena, IntPtr context)
+    {
+        if (!started)
+        {
+            return;
+        }
+
+        try
+        {
+            if (snapshot == null)
+            {
+                allocateBuffers(arena);
+            }
+
+            governor.BeginTick(R.Game.Governor.LANE_MATCH);
+            receive();
+            governor.Mark(recvPhase);
+            updateWorld();
+            sendSnapshots();
+        }
+        catch (Exception e)
+        {
+            LogError("Tick Exception");
+            LogError(e.ToString());
+        }
+    }
+
+    // The tick's buffers, taken from the arena on the first tick
+    private void allocateBuffers(IntPtr matchArena)
+    {
+        arena = matchArena;
+        recvBuffer = allocate(R.Net.POOL_BUFFER_SIZE);
+        packed = allocate(R.Net.POOL_BUFFER_SIZE);
+        snapshot = allocate(R.Net.POOL_BUFFER_SIZE);
+    }
+
+    // Zeroed memory from the match's arena, which is only given back when the match is destroyed
+    private byte* allocate(Int32 size)
+    {
+        IntPtr memory = MatchHost.Allocate(arena, (UInt32)size);
+        if (memory == IntPtr.Zero)
+        {
+            throw new OutOfMemoryException("Match arena exhausted, R.Net.MATCH_ARENA_SIZE is too small");
+        }
+        return (byte*)memory;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		receive
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Oct 19, 2026 - An exception is logged and the loop carries on
+    --                  Oct 19, 2026 - Takes the match's queue from the host at the start of each tick,
+    --                                 instead of a thread polling the socket
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER: 	    Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- INTERFACE:	 	private void receive()
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Handles every datagram the host has queued for the match since its last tick. Size, sender
+    -- and rate are checked by the ingress filter before a datagram is queued; rejections are
+    -- reported by the server.
+    --
+    -- An exception while handling a datagram is logged and only that datagram is lost.
+    -------------------------------------------------------------------------------------------------*/
+    private void receive()
+    {
+        EndPoint ep = new EndPoint();
+        int n;
+
+        while ((n = host.Recv(matchId, ref ep, recvBuffer, R.Net.POOL_BUFFER_SIZE)) > 0)
+        {
+            try
+            {
+                handleBuffer(recvBuffer, n, ep);
+            }
+            catch (Exception e)
+            {
+                LogError("Receive Exception");
+                LogError(e.ToString());
+            }
+        }
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         updateWorld
+    --
+    -- DATE:             Feb 18, 2018
+    --
+    -- REVISIONS:        Oct 19, 2026 - One native sweep per tick replaces the end point terrain and hit tests
+    --                   Oct 19, 2026 - The body of the old game thread, run by each tick
+    --
+    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER:       Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- INTERFACE:        private void updateWorld()
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- Updates the the players based on collisions and the danger zone. The systems handles
+    -- players outside the danger zone, collisions between bullets and players and expired bullets.
+    --
+    -- Each bullet is swept along the movement it is about to make this tick, against the terrain
+    -- and against the player positions recorded in history for the bullet's tick, so a hit lands
+    -- where the shooter saw the target rather than where the server has it now, and a fast bullet
+    -- cannot step over a player or an obstacle. Only the first thing a bullet meets is hit.
+    --
+    -- Each phase is marked with the governor. While the bullet cap step is engaged only
+    -- R.Game.Governor.BULLET_CAP bullets are tested against players a tick, in turns starting from
+    -- hitCursor; the rest are still stopped by the terrain.
+    -------------------------------------------------------------------------------------------------*/
+    private void updateWorld()
+    {
+        dangerZone.Update();
+        governor.Mark(zonePhase);
+
+        Dictionary<int, int> bulletIds = new Dictionary<int, int>();
+
+        foreach (KeyValuePair<byte, Player> player in players)
+        {
+            dangerZone.HandlePlayer(player.Value);
+        }
+        governor.Mark(zonePhase);
+
+        // Sweep every bullet along this tick's movement against the terrain and the players
+        // as its shooter saw them
+        if (sweepBullets.Length < bullets.Count)
+        {
+            sweepBullets = new SweepBullet[bullets.Count * 2];
+            sweepHits = new SweepHit[bullets.Count * 2];
+            sweepIds = new int[bullets.Count * 2];
+        }
+        int cap = governor.Engaged(bulletCapStep) ? R.Game.Governor.BULLET_CAP : bullets.Count;
+        int first = bullets.Count > cap ? hitCursor % bullets.Count : 0;
+        int index = 0;
+        foreach (KeyValuePair<int, Bullet> bullet in bullets)
+        {
+            bool capped = (index - first + bullets.Count) % bullets.Count >= cap;
+            sweepIds[index] = bullet.Key;
+            sweepBullets[index].X = bullet.Value.X;
+            sweepBullets[index].Z = bullet.Value.Z;
+            sweepBullets[index].DeltaX = bullet.Value.DeltaX;
+            sweepBullets[index].DeltaZ = bullet.Value.DeltaZ;
+            sweepBullets[index].Radius = bullet.Value.Size + R.Game.Players.RADIUS;
+            sweepBullets[index].Tick = bullet.Value.Tick;
+            sweepBullets[index].Shooter = bullet.Value.PlayerId;
+            sweepBullets[index].Targets = capped ? Sweep.TERRAIN : Sweep.PLAYER | Sweep.TERRAIN;
+            index++;
+        }
+        fixed (SweepBullet* swept = sweepBullets)
+        fixed (SweepHit* hits = sweepHits)
+        {
+            Sweep.Run(history, tc.Pack, swept, hits, index);
+        }
+        for (int i = 0; i < index; i++)
+        {
+            if (sweepHits[i].Kind == Sweep.NONE)
+            {
+                continue;
+            }
+            // Signal delete
+            bulletIds[sweepIds[i]] = sweepIds[i];
+
+            Player player;
+            if (sweepHits[i].Kind != Sweep.PLAYER || !players.TryGetValue((byte)sweepHits[i].Id, out player))
+            {
+                continue;
+            }
+            // Subtract health
+            Bullet hit = bullets[sweepIds[i]];
+            if (player.h < hit.Damage)
+            {
+                player.h = 0;
+            }
+            else
+            {
+                player.TakeDamage(hit.Damage);
+            }
+        }
+        hitCursor = first + cap;
+        governor.Mark(hitPhase);
+
+        foreach (KeyValuePair<int, Bullet> pair in bullets)
+        {
+            // Update bullet positions
+            if (!pair.Value.Update())
+            {
+                // Remove expired bullets
+                bulletIds[pair.Key] = pair.Key;
+            }
+        }
+
+        // Remove bullets
+        foreach (KeyValuePair<int, int> pair in bulletIds)
+        {
+            bullets[pair.Key].Event = R.Game.Bullet.REMOVE;
+            queueBulletEvent(bullets[pair.Key]);
+            bullets.Remove(pair.Key);
+        }
+        governor.Mark(bulletPhase);
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         sendSnapshots
+    --
+    -- DATE:             Feb 18, 2018
+    --
+    -- REVISIONS:        Oct 19, 2026 - Events wait in each player's backlog instead of forcing a send
+    --                   Oct 19, 2026 - The body of the old send thread, run by each tick; the buffers are
+    --                                  the match's and the sends are queued on the host
+    --
+    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER:       Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- INTERFACE:        private void sendSnapshots()
+    --
+    -- RETURNS:          void
+    --
+    -- NOTES:
+    -- Sends and packet to each connected player. The system sends each players
+    -- health out after updating it.
+    --
+    -- The snapshot is built in the match's snapshot buffer. Queued sends copy it, so each player's
+    -- health can be patched in place before their copy is queued.
+    --
+    -- Players on a poor link are sent every second or fourth snapshot, as decided by connStats.
+    -- Each tick's bullet and weapon events go into every player's backlog whether or not they are
+    -- sent a snapshot this tick, and each snapshot a player is sent carries as many of their waiting
+    -- events as fit the packed byte budget connStats gives their rate; the rest wait for the next one.
+    --
+    -- The buffer still holds the last player's health and sequence number from the previous tick,
+    -- so both are reset to no health and the snapshot tick before the recorder or the spectator relays see
+    -- it. The recorder gets it before any per-player fields are patched; when broadcasting, one copy is
+    -- published for the spectator relays.
+    --
+    -- With R.Net.PACK_SNAPSHOTS each player's copy is packed into the packed buffer and only the
+    -- packed length goes on the wire.
+    --
+    -- Connection timers are serviced after the snapshots are queued, so a player is only ever
+    -- removed between one tick's sends and the next.
+    --
+    -- Under load the governor's steps thin this out: with the defer step engaged, spectator publishing
+    -- and the connection timers only run every R.Game.Governor.DEFER_INTERVAL ticks, and with the far
+    -- rate step engaged a player with nobody near them is skipped on odd ticks; their events wait.
+    -- Governor events are reported after each tick's sends are flushed.
+    -------------------------------------------------------------------------------------------------*/
+    private void sendSnapshots()
+    {
+        bool deferred = governor.Engaged(deferStep) && snapshotTick % R.Game.Governor.DEFER_INTERVAL != 0;
+        bool farRate = governor.Engaged(farRateStep) && (snapshotTick & 1) != 0;
+
+        buildSendPacket(snapshot);
+        snapshot[R.Net.Offset.HEALTH] = 0;
+        *(UInt32*)(snapshot + R.Net.Offset.SEQ) = snapshotTick;
+        if (recording)
+        {
+            recorder.Record(snapshotTick, snapshot);
+        }
+        if (broadcasting && !deferred)
+        {
+            Int32 spectatorLen = R.Net.PACK_SNAPSHOTS ? Snapshot.Pack(snapshot, packed, R.Net.POOL_BUFFER_SIZE) : -1;
+            if (spectatorLen > 0)
+            {
+                broadcast.Publish(snapshotTick, packed, spectatorLen);
+            }
+            else
+            {
+                broadcast.Publish(snapshotTick, snapshot, R.Net.Size.SERVER_TICK);
+            }
+        }
+        governor.Mark(buildPhase);
+
+        Int32 backlogDropped = 0;
+        foreach (KeyValuePair<byte, Player> pair in players)
+        {
+            backlogDropped += pair.Value.bulletBacklog.Append(snapshot + R.Net.Offset.BULLETS + 1, snapshot[R.Net.Offset.BULLETS]);
+            backlogDropped += pair.Value.weaponBacklog.Append(snapshot + R.Net.Offset.WEAPONS + 1, snapshot[R.Net.Offset.WEAPONS]);
+        }
+        if (backlogDropped > 0)
+        {
+            log.Event(backlogEvent, backlogDropped, snapshotTick);
+        }
+
+        foreach (KeyValuePair<byte, Player> pair in players)
+        {
+            if (!connStats.ShouldSend(pair.Key, snapshotTick))
+            {
+                continue;
+            }
+            if (farRate && !hasNearbyPlayer(pair.Value))
+            {
+                continue;
+            }
+
+            updateHealthPacket(pair.Value, snapshot);
+            fillEvents(pair.Value, snapshot);
+            *(UInt32*)(snapshot + R.Net.Offset.SEQ) = connStats.OnSend(pair.Key, snapshotTick);
+
+            Int32 packedLen = R.Net.PACK_SNAPSHOTS ? Snapshot.Pack(snapshot, packed, R.Net.POOL_BUFFER_SIZE) : -1;
+            if (packedLen > 0)
+            {
+                host.QueueSend(pair.Value.ep, packed, packedLen);
+            }
+            else
+            {
+                host.QueueSend(pair.Value.ep, snapshot, R.Net.Size.SERVER_TICK);
+            }
+            pair.Value.lastSent = TimerWheel.Now();
+        }
+        governor.Mark(fanOutPhase);
+        if (!deferred)
+        {
+            serviceTimers();
+        }
+        host.FlushSends();
+        governor.Mark(flushPhase);
+        reportGovernor();
+        snapshotTick++;
+    }
+
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:         generateTickPacketHeader
+    --
+    -- DATE:             Feb 18, 2018
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER:       Benny Wang
+    --
+    -- INTERFACE:        private byte generateTickPacketHeader(bool hasPlayer, bool hasBullet, bool hasWeapon, int players)
+    --                      bool hasPlayer: True if the packet is sending players
+    --                      bool hasBullet: True if the packet is sending bullets
+    --                      bool hasWeapon: True if the packet is sending weapons
+    --                      int players: The number of players in the game
+    --
+    -- RETURNS:          The header byte generated
+    --
+    -- NOTES:
+    -- Generates a byte for the header based on what it needs to send. The byte value will
+    -- depend on the number of players and whether the packet will have players, bullets and/or
+    -- weapons.
+    -------------------------------------------------------------------------------------------------*/
+    private byte generateTickPacketHeader(bool hasPlayer, bool hasBullet, bool hasWeapon, int players)
+    {
+        byte tmp = 0;
+
+        if (hasPlayer)
+        {
+            tmp += 128;
+        }
+
+        if (hasBullet)
+        {
+            tmp += 64;
+        }
+
+        if (hasWeapon)
+        {
+            tmp += 32;
+        }
+
+        tmp += Convert.ToByte(players);
+
+        return tmp;
+    }
+
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		updateHealthPacket
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    --
+    -- PROGRAMMER: 	    Benny Wang, Tim Bruecker
+    --
+    -- INTERFACE:	 	private void updateHealthPacket(Player player, byte* snapshot)
+    --				        Player player: The player object
+    --				        byte* snapshot: The snapshot buffer to be written to
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Takes a players health value and copies it into a byte array. Used to update player’s health
+    -------------------------------------------------------------------------------------------------*/
+    private void updateHealthPacket(Player player, byte* snapshot)
+    {
+        int offset = R.Net.Offset.HEALTH;
+        snapshot[offset] = player.h;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		fillEvents
+    --
+    -- DATE: 			Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: 		agent
+    --
+    -- PROGRAMMER: 	    agent
+    --
+    -- INTERFACE:	 	private void fillEvents(Player player, byte* snapshot)
+    --				        Player player: The player the snapshot is about to be queued for
+    --				        byte* snapshot: The snapshot buffer, built for this tick
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Replaces the snapshot's event sections with the oldest events in the player's backlog, then,
+    -- when snapshots are packed, trims them to what fits the budget connStats gives the player's
+    -- rate. What went out is taken off the backlog. Without R.Net.PACK_SNAPSHOTS every snapshot is
+    -- R.Net.Size.SERVER_TICK bytes whatever it carries, so the sections are only capped by their size.
+    -------------------------------------------------------------------------------------------------*/
+    private void fillEvents(Player player, byte* snapshot)
+    {
+        int bulletCount = player.bulletBacklog.Peek(snapshot + R.Net.Offset.BULLETS + 1, R.Net.MAX_BULLET_EVENTS);
+        int weaponCount = player.weaponBacklog.Peek(snapshot + R.Net.Offset.WEAPONS + 1, R.Net.MAX_WEAPON_EVENTS);
+        setEventCounts(snapshot, bulletCount, weaponCount);
+
+        Int32 fitBullets;
+        Int32 fitWeapons;
+        if (R.Net.PACK_SNAPSHOTS && Snapshot.Fit(snapshot, connStats.Budget(player.id), out fitBullets, out fitWeapons))
+        {
+            bulletCount = fitBullets;
+            weaponCount = fitWeapons;
+            setEventCounts(snapshot, bulletCount, weaponCount);
+        }
+
+        player.bulletBacklog.Consume(bulletCount);
+        player.weaponBacklog.Consume(weaponCount);
+    }
+
+    // Writes both section counts and sets the header's event flags to match
+    private void setEventCounts(byte* snapshot, int bulletCount, int weaponCount)
+    {
+        snapshot[R.Net.Offset.BULLETS] = (byte)bulletCount;
+        snapshot[R.Net.Offset.WEAPONS] = (byte)weaponCount;
+        snapshot[0] = (byte)((snapshot[0] & ~(64 | 32)) | (bulletCount > 0 ? 64 : 0) | (weaponCount > 0 ? 32 : 0));
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		buildSendPacket
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
+    --                  Oct 19, 2026 - Writes straight into a pooled buffer
+    --                  Oct 19, 2026 - Drains the event queues in arrival order
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER: 	    Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- INTERFACE:	 	private void buildSendPacket(byte* snapshot)
+    --				        byte* snapshot: The snapshot buffer to be written to
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Builds the send packet with the players ids and coordinates. For any new bullets it adds
+    -- them to the packet.The offset of the bullets is based on which player fired the bullet. If a
+    -- player’s inventory has changed. The weapons on the map will be updated.
+    --
+    -- Bullet and weapon swap events are drained from their queues straight into their sections,
+    -- oldest first. Events beyond what a section holds go out next tick.
+    -------------------------------------------------------------------------------------------------*/
+    private void buildSendPacket(byte* snapshot)
+    {
+        int offset = R.Net.Offset.PLAYERS;
+
+        // Events
+        int bulletCount = bulletEvents.Drain(snapshot + R.Net.Offset.BULLETS + 1, R.Net.MAX_BULLET_EVENTS);
+        snapshot[R.Net.Offset.BULLETS] = (byte)bulletCount;
+        int weaponCount = weaponEvents.Drain(snapshot + R.Net.Offset.WEAPONS + 1, R.Net.MAX_WEAPON_EVENTS);
+        snapshot[R.Net.Offset.WEAPONS] = (byte)weaponCount;
+
+        // Header
+        snapshot[0] = generateTickPacketHeader(true, bulletCount > 0, weaponCount > 0, players.Count - deadPlayers.Count);
+
+        // Danger zone
+        dangerZone.WriteTo(snapshot);
+
+        // Player data, also recorded in history under this snapshot's tick
+        history.BeginTick(snapshotTick);
+        foreach (KeyValuePair<byte, Player> pair in players)
+        {
+            byte id = pair.Key;
+            Player player = pair.Value;
+            history.Store(id, player.x, player.z, player.r);
+
+            byte* record = snapshot + offset;
+            R.Packet.PlayerRecord.SetId(record, id);
+            R.Packet.PlayerRecord.SetX(record, player.x);
+            R.Packet.PlayerRecord.SetZ(record, player.z);
+            R.Packet.PlayerRecord.SetR(record, player.r);
+            offset += R.Net.Size.PLAYER_DATA;
+        }
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		handleBuffer
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    --
+    -- PROGRAMMER: 	    Benny Wang
+    --
+    -- INTERFACE:	 	private void handleBuffer(byte* inBuffer, int n, EndPoint ep)
+    --				        byte* inBuffer: The buffer of recieved data
+    --				        int n: The number of bytes received
+    --				        EndPoint ep: The end point of who sent the data
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Checks to see if the data recieved is from a new or existing client. Keepalives only mark the
+    -- player as heard from; a disconnect has the player dropped at the end of the next tick.
+    -------------------------------------------------------------------------------------------------*/
+    private void handleBuffer(byte* inBuffer, int n, EndPoint ep)
+    {
+        switch (inBuffer[0])
+        {
+            case R.Net.Header.ACK:
+                LogError("ACK from " + ep.ToString());
+                addNewPlayer(ep);
+                break;
+
+            case R.Net.Header.TICK:
+                updateExistingPlayer(inBuffer, n);
+                break;
+
+            case R.Net.Header.KEEP_ALIVE:
+            case R.Net.Header.DISCONNECT:
+                Player player;
+                if (players.TryGetValue(inBuffer[R.Net.Offset.PID], out player))
+                {
+                    if (inBuffer[0] == R.Net.Header.DISCONNECT)
+                    {
+                        // Dropped when the idle timer fires
+                        player.lastHeard = 0;
+                        timers.Reschedule(player.idleTimer, 0);
+                    }
+                    else
+                    {
+                        player.lastHeard = TimerWheel.Now();
+                    }
+                }
+                break;
+
+            default:
+                LogError("Server received a valid amount of data but the header is incorrect.");
+                break;
+        }
+    }
+
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		updateExistingPlayer
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Oct 19, 2026 - Clock fields go to connStats
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER: 	    Benny Wang, Haley Booker
+    --
+    -- INTERFACE:	 	private void updateExistingPlayer(byte* inBuffer, int n)
+    --				        byte* inBuffer: The buffer of recieved data
+    --				        int n: The number of bytes received
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Updates the coordinates of a player and handles bullets or weapons switching.
+    -- If the tick carries the ack fields they are passed on to connStats, and so are the clock
+    -- fields if it carries those too.
+    -------------------------------------------------------------------------------------------------*/
+    private void updateExistingPlayer(byte* inBuffer, int n)
+    {
+        byte id = R.Packet.ClientTick.GetPid(inBuffer);
+        if (n == R.Net.Size.CLIENT_TICK)
+        {
+            connStats.OnClock(id, R.Packet.ClientTick.GetAck(inBuffer), R.Packet.ClientTick.GetClientTime(inBuffer),
+                R.Packet.ClientTick.GetAckDelay(inBuffer));
+        }
+        if (n >= R.Net.Size.CLIENT_TICK_NO_CLOCK)
+        {
+            connStats.OnAck(id, R.Packet.ClientTick.GetAck(inBuffer), R.Packet.ClientTick.GetAckBits(inBuffer));
+        }
+
+        float x = R.Packet.ClientTick.GetX(inBuffer);
+        float z = R.Packet.ClientTick.GetZ(inBuffer);
+        float r = R.Packet.ClientTick.GetR(inBuffer);
+
+        handleIncomingWeapon(id, R.Packet.ClientTick.GetWeaponId(inBuffer), R.Packet.ClientTick.GetWeaponType(inBuffer));
+        handleIncomingBullet(id, R.Packet.ClientTick.GetBulletId(inBuffer), R.Packet.ClientTick.GetBulletType(inBuffer));
+
+        Player player;
+        if (!players.TryGetValue(id, out player))
+        {
+            // Dropped while this tick was in flight
+            return;
+        }
+
+        if (player.IsDead())
+        {
+            deadPlayers.Add(id);
+        }
+
+        player.x = x;
+        player.z = z;
+        player.r = r;
+        player.lastHeard = TimerWheel.Now();
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		handleIncomingBullet
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Oct 19, 2026 - Event goes to the lock-free bullet event queue
+    --                  Oct 19, 2026 - Ignored if the player was dropped while the tick was in flight
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    --
+    -- PROGRAMMER: 	    Benny Wang
+    --
+    -- INTERFACE:	 	private void handleIncomingBullet(byte playerId, int bulletId, byte bulletType)
+    --				        byte playerId: The id of the player
+    --				        int bulletId: The id of the bullet
+    --				        byte bulletType: The type of bullet
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Creates a new bullet and adds it to the bullet array. The bullet is stamped with the tick of
+    -- the newest snapshot the shooter has acknowledged, or the newest recorded tick if none.
+    -------------------------------------------------------------------------------------------------*/
+    private void handleIncomingBullet(byte playerId, int bulletId, byte bulletType)
+    {
+        if (bulletType != 0)
+        {
+            Player player;
+            if (!players.TryGetValue(playerId, out player))
+            {
+                // Dropped while this tick was in flight
+                return;
+            }
+
+            Bullet bullet = new Bullet(bulletId, bulletType, player);
+            bullet.Event = R.Game.Bullet.ADD;
+            UInt32 tick;
+            bullet.Tick = connStats.AckedTick(playerId, out tick) ? tick : history.Latest();
+            bullets[bulletId] = bullet;
+            queueBulletEvent(bullet);
+        }
+    }
+
+/*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		handleIncomingWeapon
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Oct 19, 2026 - Event goes to the lock-free weapon event queue
+    --                  Oct 19, 2026 - Ignored if the player was dropped while the tick was in flight
+    --                  Oct 19, 2026 - Swaps are logged through the asynchronous log, off the receive thread
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    --
+    -- PROGRAMMER: 	    Benny Wang
+    --
+    -- INTERFACE:	 	private void handleIncomingWeapon(byte playerId, int weaponId, byte weaponType)
+    --				        byte playerId: The id of the player
+    --				        int weaponId: The id of the weapon
+    --				        byte weaponType: The type of weapon
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Handles a player picking up a weapon and updating the player’s inventory.
+    -------------------------------------------------------------------------------------------------*/
+    private void handleIncomingWeapon(byte playerId, int weaponId, byte weaponType)
+    {
+        if (weaponId != 0)
+        {
+            Player player;
+            if (!players.TryGetValue(playerId, out player) || player.currentWeaponId == weaponId)
+            {
+                // Dropped while this tick was in flight, or no change
+                return;
+            }
+
+            player.currentWeaponId = weaponId;
+            player.currentWeaponType = weaponType;
+
+            byte* record = stackalloc byte[R.Net.Size.WEAPON_EVENT];
+            record[0] = playerId;
+            *(int*)(record + 1) = weaponId;
+            weaponEvents.Push(record);
+
+            log.Event(weaponSwapEvent, playerId, weaponId, weaponType);
+        }
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		queueBulletEvent
+    --
+    -- DATE: 			Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: 		agent
+    --
+    -- PROGRAMMER: 	    agent
+    --
+    -- INTERFACE:	 	private void queueBulletEvent(Bullet bullet)
+    --				        Bullet bullet: The bullet whose current event goes in the next tick
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Builds the bullet's tick packet record on the stack and pushes it to the bullet event queue.
+    -- Safe from any thread; if the queue is full the event is counted as dropped and lost.
+    -------------------------------------------------------------------------------------------------*/
+    private void queueBulletEvent(Bullet bullet)
+    {
+        byte* record = stackalloc byte[R.Net.Size.BULLET_EVENT];
+        record[R.Net.Offset.Bullet.OWNER] = bullet.PlayerId;
+        *(int*)(record + R.Net.Offset.Bullet.ID) = bullet.BulletId;
+        record[R.Net.Offset.Bullet.TYPE] = bullet.Type;
+        record[R.Net.Offset.Bullet.CHANGE] = bullet.Event;
+        bulletEvents.Push(record);
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		addNewPlayer
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
+    -- 				    Mar 30, 2018 - Implemented better spawn points
+    --                  Oct 19, 2026 - The player's event backlogs come from the match's arena
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER: 	    Benny Wang, Haley Booker
+    --
+    -- INTERFACE:	 	private void addNewPlayer(EndPoint ep)
+    --				        EndPoint ep: The end point of a new connection
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Creates a new player and adds it to the player array. The endpoint is registered with the
+    -- ingress filter so its ticks are let through, and the player's keepalive and idle timers start.
+    -------------------------------------------------------------------------------------------------*/
+    private void addNewPlayer(EndPoint ep)
+    {
+        List<float> spawnPoint = spawnPointGenerator.GetNextSpawnPoint();
+        Player newPlayer = new Player(ep, nextPlayerId, spawnPoint[0], spawnPoint[1]);
+        attachBacklogs(newPlayer);
+        newPlayer.keepAliveTimer = timers.Schedule(R.Net.Timer.KEEP_ALIVE, newPlayer.id, R.Net.KEEPALIVE_MS);
+        newPlayer.idleTimer = timers.Schedule(R.Net.Timer.IDLE, newPlayer.id, R.Net.IDLE_TIMEOUT_MS);
+
+        nextPlayerId++;
+        players[newPlayer.id] = newPlayer;
+        connStats.Reset(newPlayer.id);
+        ingress.AddEndpoint(ep, newPlayer.id);
+
+        sendInitPacket(newPlayer);
+    }
+
+    // Gives the player its id's backlogs, allocated from the arena the first time the id is used and emptied after
+    private void attachBacklogs(Player player)
+    {
+        byte id = player.id;
+        if (bulletBacklogs[id] == null)
+        {
+            bulletBacklogs[id] = new EventBacklog(allocate(R.Net.EVENT_BACKLOG * R.Net.Size.BULLET_EVENT),
+                R.Net.EVENT_BACKLOG, R.Net.Size.BULLET_EVENT);
+            weaponBacklogs[id] = new EventBacklog(allocate(R.Net.EVENT_BACKLOG * R.Net.Size.WEAPON_EVENT),
+                R.Net.EVENT_BACKLOG, R.Net.Size.WEAPON_EVENT);
+        }
+        bulletBacklogs[id].Consume(bulletBacklogs[id].Count());
+        weaponBacklogs[id].Consume(weaponBacklogs[id].Count());
+        player.bulletBacklog = bulletBacklogs[id];
+        player.weaponBacklog = weaponBacklogs[id];
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		serviceTimers
+    --
+    -- DATE: 			Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: 		agent
+    --
+    -- PROGRAMMER: 	    agent
+    --
+    -- INTERFACE:	 	private void serviceTimers()
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Handles every connection timer that has expired. Timers are not pushed back on every packet;
+    -- instead one that fires checks when the player was last heard from or sent to and, if that is
+    -- recent enough, is scheduled again for the time remaining. So a keepalive only goes to a player
+    -- that has had no snapshot for R.Net.KEEPALIVE_MS, and a player is only dropped after
+    -- R.Net.IDLE_TIMEOUT_MS of silence or a disconnect.
+    -------------------------------------------------------------------------------------------------*/
+    private void serviceTimers()
+    {
+        const Int32 batch = 32;
+        TimerFired* fired = stackalloc TimerFired[batch];
+        Int32 n;
+
+        do
+        {
+            n = timers.Advance(fired, batch);
+            for (Int32 i = 0; i < n; i++)
+            {
+                byte id = (byte)fired[i].Key;
+                Player player;
+                if (!players.TryGetValue(id, out player))
+                {
+                    continue;
+                }
+
+                long now = TimerWheel.Now();
+                if (fired[i].Kind == R.Net.Timer.IDLE)
+                {
+                    long quiet = now - player.lastHeard;
+                    if (quiet >= R.Net.IDLE_TIMEOUT_MS)
+                    {
+                        evictPlayer(id);
+                        continue;
+                    }
+                    player.idleTimer = timers.Schedule(R.Net.Timer.IDLE, id, (UInt32)(R.Net.IDLE_TIMEOUT_MS - quiet));
+                }
+                else if (fired[i].Kind == R.Net.Timer.KEEP_ALIVE)
+                {
+                    long idle = now - player.lastSent;
+                    if (idle >= R.Net.KEEPALIVE_MS)
+                    {
+                        keepAlive[0] = R.Net.Header.KEEP_ALIVE;
+                        keepAlive[R.Net.Offset.PID] = id;
+                        host.QueueSend(player.ep, keepAlive, keepAlive.Length);
+                        player.lastSent = now;
+                        idle = 0;
+                    }
+                    player.keepAliveTimer = timers.Schedule(R.Net.Timer.KEEP_ALIVE, id, (UInt32)(R.Net.KEEPALIVE_MS - idle));
+                }
+            }
+        } while (n == batch);
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		evictPlayer
+    --
+    -- DATE: 			Oct 19, 2026
+    --
+    -- REVISIONS:		Oct 19, 2026 - The endpoint is unbound from the match on the host
+    --
+    -- DESIGNER: 		agent
+    --
+    -- PROGRAMMER: 	    agent
+    --
+    -- INTERFACE:	 	private void evictPlayer(byte id)
+    --				        byte id: The player to drop
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Removes a player that left or went quiet: no more snapshots go to it, its datagrams are refused
+    -- by the ingress filter and no longer routed to this match, and its remaining timer is cancelled.
+    -- Its next join is routed afresh.
+    -------------------------------------------------------------------------------------------------*/
+    private void evictPlayer(byte id)
+    {
+        Player player;
+        if (!players.TryGetValue(id, out player))
+        {
+            return;
+        }
+        players.Remove(id);
+        deadPlayers.Remove(id);
+
+        ingress.RemoveEndpoint(player.ep);
+        host.Unbind(player.ep);
+        timers.Cancel(player.keepAliveTimer);
+        timers.Cancel(player.idleTimer);
+        LogError("Dropped player " + id + " at " + player.ep.ToString());
+    }
+
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		sendInitPacket
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
+    --                  Oct 19, 2026 - Written through the generated InitPlayer accessors
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    --
+    -- PROGRAMMER: 	    Haley Booker
+    --
+    -- INTERFACE:	 	private void sendInitPacket(Player newPlayer)
+    --				        Player newPlayer: The new player to be sent
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Sends an initial packet to client on connection. The packet contains the client’s
+    -- player id.
+    -------------------------------------------------------------------------------------------------*/
+    private void sendInitPacket(Player newPlayer)
+    {
+        byte[] buffer = new byte[R.Net.Size.SERVER_TICK];
+
+        fixed (byte* packet = buffer)
+        {
+            R.Packet.InitPlayer.SetHeader(packet, R.Net.Header.INIT_PLAYER);
+            R.Packet.InitPlayer.SetId(packet, newPlayer.id);
+
+            // sets the coordinates for the new player
+            R.Packet.InitPlayer.SetX(packet, newPlayer.x);
+            R.Packet.InitPlayer.SetZ(packet, newPlayer.z);
+        }
+
+        host.Send(newPlayer.ep, buffer, buffer.Length);
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    initTCPServer
+    --
+    -- DATE:        Mar. 28, 2018
+    --
+    -- REVISIONS:   Oct 19, 2026 - Listens on the match's own port
+    --
+    -- DESIGNER:    Benny Wang
+    --
+    -- PROGRAMMER:  Benny Wang
+    --
+    -- INTERFACE:   private void initTCPServer()
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- This function is called to initialize a TCPServer object which handles TCP connections.
+    -- After creating the TCPServer object, it creates a thread which executes listenThreadFunc
+    -- and joins on the thread's termination.
+    --
+    -- The terrain and weapons are generated on their own thread from the start, so the work is
+    -- done while the server is still waiting for players rather than after.
+    -------------------------------------------------------------------------------------------------*/
+    private void initTCPServer()
+    {
+        tcpServer = new TCPServer();
+        Int32 listenfd = tcpServer.Init(tcpPort, R.Net.TIMEOUT);
+        tuning.ApplySocket(Tuning.SOCKET_TCP, listenfd);
+        if (Server.requestedEngine() == Networking.Server.ENGINE_URING)
+        {
+            tcpServer.SetEngine(TCPServer.ENGINE_URING);
+        }
+        initDataThread = new Thread(generateInitData);
+        initDataThread.Start();
+        listenThread = new Thread(listenThreadFunc);
+        listenThread.Start();
+        listenThread.Join();
+        initDataThread.Join();
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		generateInitData
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
+    --                  Oct 19, 2026 - Terrain first, so weapon placement can avoid it
+    --                  Oct 19, 2026 - Runs on its own thread and signals initDataReady
+    --                  Oct 19, 2026 - Terrain comes from loadTerrain, which may map a terrain pack
+    --                  Oct 19, 2026 - Retried on failure, and a final failure is recorded in initDataFailed
+    --                  Oct 19, 2026 - One match generates at a time
+    --
+    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    --
+    -- PROGRAMMER: 	    Benny Wang
+    --				    Roger Zhang
+    -- 				    Alfred Swinton
+    --
+    -- INTERFACE:	 	private void generateInitData()
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- This function generates the valid initialization for the terrain and weapons.
+    -- The compressed blobs are left in mapData and itemData, and initDataReady is set once they
+    -- are complete; transmit threads wait on it before sending.
+    --
+    -- Generation is random, so a failed attempt is retried from scratch, up to
+    -- R.Game.INIT_DATA_ATTEMPTS times. If none succeeds initDataFailed is set before initDataReady,
+    -- so no client thread waits forever and none sends the zeroed blobs.
+    --
+    -- The weapon generator's random numbers and weapon ids are static, and the first match to
+    -- generate may save the terrain pack the others load, so the matches in a process take turns.
+    -------------------------------------------------------------------------------------------------*/
+    private void generateInitData()
+    {
+        for (int attempt = 1; attempt <= R.Game.INIT_DATA_ATTEMPTS; attempt++)
+        {
+            try
+            {
+                Array.Clear(mapData, 0, mapData.Length);
+                Array.Clear(itemData, 0, itemData.Length);
+                dangerZone = new DangerZone();
+
+                lock (initDataLock)
+                {
+                    loadTerrain();
+                    int terrainDataLength = tc.CompressedData.Length;
+                    Array.Copy(tc.CompressedData, 0, mapData, 0, terrainDataLength);
+
+                    // Weapons go down after the terrain so they can stay clear of it
+                    InitRandomGuns getItems = new InitRandomGuns(R.Net.MAX_PLAYERS, tc.Data.tiles);
+                    Array.Copy(getItems.compressedpcktarray, 0, itemData, 0, getItems.compressedpcktarray.Length);
+                }
+                LogError("Init data ready");
+                initDataReady.Set();
+                return;
+            }
+            catch (Exception e)
+            {
+                LogError("Init Data Thread Exception, attempt " + attempt + " of " + R.Game.INIT_DATA_ATTEMPTS);
+                LogError(e.ToString());
+            }
+        }
+
+        initDataFailed = true;
+        initDataReady.Set();
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    loadTerrain
+    --
+    -- DATE:        Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:    agent
+    --
+    -- PROGRAMMER:  agent
+    --
+    -- INTERFACE:   private void loadTerrain()
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- TERRAIN_PACK names a terrain pack to play on. If it opens, the match is ready in the time it
+    -- takes to map it, sharing its pages with every other match on the host using the same pack.
+    -- If it is missing or invalid a map is generated as before and saved there for the next match.
+    -- Without TERRAIN_PACK every match generates its own map.
+    -------------------------------------------------------------------------------------------------*/
+    private void loadTerrain()
+    {
+        string path = Environment.GetEnvironmentVariable("TERRAIN_PACK");
+        if (path != null && tc.LoadPack(path))
+        {
+            LogError("Terrain pack " + path + " loaded");
+            return;
+        }
+
+        while (!tc.GenerateEncoding()) ;
+        if (path != null)
+        {
+            LogError("Terrain pack " + path + (tc.SavePack(path) ? " saved" : " could not be saved"));
+        }
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    listenThreadFunc
+    --
+    -- DATE:        Mar. 28, 2018
+    --
+    -- REVISIONS:   Apr. 9, 2018
+    --                  - Added timeout to listen loop, hard coded to 30s
+    --              Apr. 11, 2018
+    --                  - Modified timeout to accept a value passed down from
+    --                    R.Net.TIMEOUT
+    --
+    -- DESIGNER:    Wilson Hu, Angus Lam, Benny Wang
+    --
+    -- PROGRAMMER:  Wilson Hu, Angus Lam, Benny Wang
+    --
+    -- INTERFACE:   private void listenThreadFunc()
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- This thread function performs a listen loop that continuously accepts up to
+    -- 30 clients.
+    --
+    -- Each accepted client gets its own transmit thread straight away, which sends the game
+    -- initialization data as soon as the background generation has finished. The loop ends on
+    -- timing out or receiving the max number of clients, and then joins on every transmit thread,
+    -- so it only gates the start of the game.
+    -------------------------------------------------------------------------------------------------*/
+    private void listenThreadFunc()
+    {
+        Int32 clientsockfd;
+        accepting = true;
+		Networking.EndPoint ep = new Networking.EndPoint();
+
+        // Accept loop, accepts incoming client requests if there are <30 clients or loop is broken
+        while (accepting && numClients < R.Net.MAX_PLAYERS)
+        {
+			clientsockfd = tcpServer.AcceptConnection(ref ep);
+
+            // Breaks loop only if there are >1 clients and AcceptConnection call times out
+            if (clientsockfd == R.Net.TIMEOUT_ERRNO && numClients > 1)
+            {
+                LogError("Accept timeout: Breaking out of listen loop");
+                accepting = false;
+            }
+            // If AcceptConnection call returns an error
+            if (clientsockfd <= 0)
+            {
+                log.Event(acceptErrorEvent, clientsockfd);
+            }
+            // AcceptConnection call passes
+            else
+            {
+                clientSockFdArr[numClients] = clientsockfd;
+                LogError("Connected client: " + ep.ToString()); //Add toString() for EndPoint
+
+                // Start sending to this client now rather than after the accept window
+                transmitThreadArr[numClients] = new Thread(transmitThreadFunc);
+                transmitThreadArr[numClients].Start(clientsockfd);
+                numClients++;
+            }
+        }
+
+        // Join each transmitThread
+        foreach (Thread t in transmitThreadArr)
+        {
+            if (t != null)
+            {
+                t.Join();
+            }
+        }
+
+        LogError(tuning.DescribeThread(Tuning.THREAD_TCP));
+        LogError(tuning.DescribeSocket(Tuning.SOCKET_TCP));
+        LogError("All threads joined, Starting game");
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    transmitThreadFunc
+    --
+    -- DATE:        Mar. 28, 2018
+    --
+    -- REVISIONS:   Oct 19, 2026
+    --                  - Closes the client without sending if the init data could not be generated
+    --
+    -- DESIGNER:    Wilson Hu, Angus Lam, Benny Wang
+    --
+    -- PROGRAMMER:  Angus Lam, Wilson Hu, Benny Wang
+    --
+    -- INTERFACE:   private void transmitThreadFunc(object clientsockfd)
+    --                  object clientsockfd: a socket descriptor value which is cast to an Int32
+                                             within the function
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- This thread function sends the game initialization data to its input client socket descriptor.
+    -- It is started as soon as the client connects and blocks on initDataReady until the data exists.
+    -- If generation failed the client is disconnected with nothing sent.
+    -------------------------------------------------------------------------------------------------*/
+    private void transmitThreadFunc(object clientsockfd)
+    {
+        Int32 numSentMap;
+        Int32 numSentItem;
+        Int32 sockfd = (Int32)clientsockfd;
+
+        tuning.ApplyThread(Tuning.THREAD_TCP);
+        tuning.ApplySocket(Tuning.SOCKET_TCP, sockfd);
+
+        // The blobs are shared by every client, wait until generation has filled them
+        initDataReady.WaitOne();
+        if (initDataFailed)
+        {
+            LogError("No init data to send, closing client socket " + sockfd);
+            tcpServer.CloseClientSocket(sockfd);
+            return;
+        }
+
+        // Send item spawn data to the client
+        numSentItem = tcpServer.Send(sockfd, itemData, R.Net.TCP_BUFFER_SIZE);
+        LogError("Num Item Bytes Sent: " + numSentItem);
+
+        // Send map data to the client
+        numSentMap = tcpServer.Send(sockfd, mapData, R.Net.TCP_BUFFER_SIZE);
+        LogError("Num Map Bytes Sent: " + numSentMap);
+
+        // Close client TCP socket
+        tcpServer.CloseClientSocket(sockfd);
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    openRecorder
+    --
+    -- DATE:        Oct 19, 2026
+    --
+    -- REVISIONS:   Oct 19, 2026 - Each match after the first records to its own file
+    --
+    -- DESIGNER:    agent
+    --
+    -- PROGRAMMER:  agent
+    --
+    -- INTERFACE:   private void openRecorder()
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- MATCH_RECORD names the file to record the match to; without it nothing is recorded. The
+    -- header is kept current as ticks are written, so the file can be read while the match runs
+    -- or after the server is killed. See perMatch for the names of the other matches' files.
+    -------------------------------------------------------------------------------------------------*/
+    private void openRecorder()
+    {
+        recorder = new MatchRecorder();
+        string path = Environment.GetEnvironmentVariable("MATCH_RECORD");
+        if (path == null)
+        {
+            return;
+        }
+        path = perMatch(path);
+        recording = recorder.Open(path, R.Net.RECORD_CAPACITY, R.Net.Size.SERVER_TICK, R.Net.RECORD_KEYFRAME_INTERVAL) == 0;
+        LogError("Recording match to " + path + ": " + (recording ? "on" : "failed"));
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    openBroadcast
+    --
+    -- DATE:        Oct 19, 2026
+    --
+    -- REVISIONS:   Oct 19, 2026 - Each match after the first publishes to its own ring
+    --
+    -- DESIGNER:    agent
+    --
+    -- PROGRAMMER:  agent
+    --
+    -- INTERFACE:   private void openBroadcast()
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- SPECTATOR_RING names the shared memory ring, e.g. /match1, that spectatorrelay processes on
+    -- this host read from; without it nothing is published. Each match on a host needs its own name,
+    -- so within a process the matches after the first add their index, e.g. /match1.1.
+    -------------------------------------------------------------------------------------------------*/
+    private void openBroadcast()
+    {
+        broadcast = new BroadcastRing();
+        string name = Environment.GetEnvironmentVariable("SPECTATOR_RING");
+        if (name == null)
+        {
+            return;
+        }
+        name = perMatch(name);
+        broadcasting = broadcast.Create(name, R.Net.BROADCAST_SLOTS, R.Net.POOL_BUFFER_SIZE) == 0;
+        LogError("Spectator ring " + name + ": " + (broadcasting ? "on" : "failed"));
+    }
+
+    // The first match keeps a configured name as it is, and the others add their index to it
+    private string perMatch(string name)
+    {
+        return index == 0 ? name : name + "." + index;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    initGovernor
+    --
+    -- DATE:        Oct 19, 2026
+    --
+    -- REVISIONS:   Oct 19, 2026 - One lane for the whole tick, which now receives first
+    --
+    -- DESIGNER:    agent
+    --
+    -- PROGRAMMER:  agent
+    --
+    -- INTERFACE:   private void initGovernor()
+    --
+    -- RETURNS:     void
+    --
+    -- NOTES:
+    -- Registers the phases of the tick and the degradation steps, cheapest to the game first:
+    -- deferring spectator publishing and connection timers, halving the snapshot rate of players
+    -- with nobody near them, then capping the bullets hit tested per tick.
+    -------------------------------------------------------------------------------------------------*/
+    private void initGovernor()
+    {
+        governor = new TickGovernor(R.Game.TICK_INTERVAL);
+        recvPhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        zonePhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        hitPhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        bulletPhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        buildPhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        fanOutPhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        flushPhase = governor.AddPhase(R.Game.Governor.LANE_MATCH);
+        deferStep = governor.AddStep(R.Game.Governor.DEFER_ENGAGE, R.Game.Governor.DEFER_RELEASE);
+        farRateStep = governor.AddStep(R.Game.Governor.FAR_RATE_ENGAGE, R.Game.Governor.FAR_RATE_RELEASE);
+        bulletCapStep = governor.AddStep(R.Game.Governor.BULLET_CAP_ENGAGE, R.Game.Governor.BULLET_CAP_RELEASE);
+        engageEvent = log.AddTemplate(prefixed("Tick governor: applied step {} at {}% load on tick {}, {} steps applied"));
+        releaseEvent = log.AddTemplate(prefixed("Tick governor: lifted step {} at {}% load on tick {}, {} steps applied"));
+        resyncEvent = log.AddTemplate(prefixed("Tick governor: lane {} skipped {} late ticks on tick {}"));
+    }
+
+    // Logs every step the governor applied or lifted and every resync since the last tick
+    private void reportGovernor()
+    {
+        GovernorEvent* events = stackalloc GovernorEvent[R.Game.Governor.REPORT_EVENTS];
+        Int32 count = governor.DrainEvents(events, R.Game.Governor.REPORT_EVENTS);
+        for (int i = 0; i < count; i++)
+        {
+            if (events[i].Kind == TickGovernor.RESYNC)
+            {
+                log.Event(resyncEvent, events[i].Step, events[i].Value, events[i].Tick);
+            }
+            else
+            {
+                log.Event(events[i].Kind == TickGovernor.ENGAGE ? engageEvent : releaseEvent,
+                          events[i].Step, events[i].Value, events[i].Tick, events[i].Level);
+            }
+        }
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION:    hasNearbyPlayer
+    --
+    -- DATE:        Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER:    agent
+    --
+    -- PROGRAMMER:  agent
+    --
+    -- INTERFACE:   private bool hasNearbyPlayer(Player player)
+    --                  Player player: the player about to be sent a snapshot
+    --
+    -- RETURNS:     true if another player is within R.Game.Governor.NEAR_DISTANCE
+    --
+    -- NOTES:
+    -- Everything a player with nobody near them sees moving is far away, so a lower snapshot rate
+    -- costs them the least when the far rate step has to drop some.
+    -------------------------------------------------------------------------------------------------*/
+    private bool hasNearbyPlayer(Player player)
+    {
+        foreach (KeyValuePair<byte, Player> pair in players)
+        {
+            if (pair.Value == player)
+            {
+                continue;
+            }
+            float dx = pair.Value.x - player.x;
+            float dz = pair.Value.z - player.z;
+            if (dx * dx + dz * dz < R.Game.Governor.NEAR_DISTANCE * R.Game.Governor.NEAR_DISTANCE)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: 		LogError
+    --
+    -- DATE: 			Feb 18, 2018
+    --
+    -- REVISIONS:		Oct 19, 2026 - Queues to the native asynchronous log
+    --                  Oct 19, 2026 - Prefixed with the match's index after the first
+    --
+    -- DESIGNER: 		Benny Wang
+    --
+    -- PROGRAMMER: 	    Benny Wang
+    --
+    -- INTERFACE:	 	private void LogError()
+    --
+    -- RETURNS: 		void
+    --
+    -- NOTES:
+    -- Queues a message for the log writer thread, which prints it with the timestamp prepended.
+    -- Never blocks the calling thread; a message that cannot be queued is counted and dropped.
+    -------------------------------------------------------------------------------------------------*/
+    private void LogError(String s)
+    {
+        log.Write(prefixed(s));
+    }
+
+    // Log text of every match but the first starts with its index
+    private string prefixed(string s)
+    {
+        return index == 0 ? s : "Match " + index + ": " + s;
+    }
+}
@@ -0,0 +1,315 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	MatchHost.cs -   A C# wrapper class for hosting many matches on one UDP socket
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		Init(ushort port)
+--					Transport()
+--					SetJoin(byte header, UInt32 tokenOffset)
+--					SetTuning(Tuning tuning)
+--					Start(Int32 workers)
+--					CreateMatch(TickCallback tick, IntPtr context, double tickIntervalMs, UInt32 arenaSize)
+--					DestroyMatch(Int32 matchId)
+--					Bind(EndPoint ep, Int32 matchId)
+--					Unbind(EndPoint ep)
+--					Recv(Int32 matchId, ref EndPoint ep, byte[] buffer, Int32 len)
+--					Recv(Int32 matchId, ref EndPoint ep, byte* buffer, Int32 len)
+--					Send(EndPoint ep, byte[] buffer, Int32 len)
+--					QueueSend(EndPoint ep, byte[] buffer, Int32 len)
+--					QueueSend(EndPoint ep, byte* buffer, Int32 len)
+--					FlushSends()
+--					Allocate(IntPtr arena, UInt32 size)
+--					GetStats()
+--					Stop()
+--					Dispose()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - Start separate from Init so the transport can be set up first,
+--						queued sends, and Dispose to free the unmanaged host
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		MatchHost.cs wraps the unmanaged MatchHost. The library owns the shared socket, routes each
+--		datagram to the match its sender is bound to and calls every match's TickCallback on a
+--		shared pool of worker threads. The callback receives the match's arena; world state for the
+--		match should be allocated from it with Allocate so it lives outside the managed heap.
+--
+--		The shared socket is set up like a single match's: Transport() wraps it for the engine,
+--		filter, pacing and upstream, and all of that and the join are set between Init and Start.
+--		Ticks run on several workers at once, so sends go through the host, which serializes them.
+--
+--		Delegates passed to CreateMatch are kept alive here for as long as the match exists, since
+--		the unmanaged side only holds a function pointer. Dispose stops the threads and frees the
+--		host; no callback runs after it returns.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Collections.Generic;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct MatchStats
+	{
+		public UInt64 Routed;
+		public UInt64 Unrouted;
+		public UInt64 QueueDrops;
+		public UInt64 Ticks;
+	}
+
+	public unsafe class MatchHost : IDisposable
+	{
+		public const Int32 MATCH_INVALID = -1;
+
+		[UnmanagedFunctionPointer(CallingConvention.Cdecl)]
+		public delegate void TickCallback(Int32 matchId, IntPtr arena, IntPtr context);
+
+		private IntPtr host;
+		private Dictionary<Int32, TickCallback> callbacks = new Dictionary<Int32, TickCallback>();
+
+		public MatchHost()
+		{
+			host = ServerLibrary.MatchHost_CreateHost();
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: opens the socket only, Start starts the threads - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Init(ushort port)
+--								port: the UDP port shared by every match
+--
+-- RETURNS: 0 on success, or -1 if the socket could not be opened.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Init(ushort port)
+		{
+			return ServerLibrary.MatchHost_initHost(host, port);
+		}
+
+		// The shared socket, to set the engine, filter, pacing and upstream on before Start
+		public Server Transport()
+		{
+			return new Server(ServerLibrary.MatchHost_transport(host));
+		}
+
+		// Datagrams with this header bind an unknown sender, to the match id plus one read at tokenOffset, 0 for any
+		public void SetJoin(byte header, UInt32 tokenOffset)
+		{
+			ServerLibrary.MatchHost_setJoin(host, header, tokenOffset);
+		}
+
+		// The receive thread applies the profile's recv section and each worker its game section
+		public void SetTuning(Tuning tuning)
+		{
+			ServerLibrary.MatchHost_setTuning(host, tuning.Pointer);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Start
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Start(Int32 workers)
+--								workers: number of tick worker threads, 0 for one per core
+--
+-- RETURNS: the number of workers started, or -1 if the host was already started.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Start(Int32 workers)
+		{
+			return ServerLibrary.MatchHost_start(host, workers);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: CreateMatch
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 CreateMatch(TickCallback tick, IntPtr context, double tickIntervalMs, UInt32 arenaSize)
+--								tick: called once per tick of the match on a worker thread
+--								context: passed back to the callback untouched
+--								tickIntervalMs: the match's tick interval, usually R.Game.TICK_INTERVAL
+--								arenaSize: bytes reserved for the match's world state
+--
+-- RETURNS: the match id, or MATCH_INVALID if the host is full.
+--
+-- NOTES:
+-- 		Clients join a match by sending the join set with SetJoin carrying this id plus one, or are bound
+--		to it explicitly with Bind.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 CreateMatch(TickCallback tick, IntPtr context, double tickIntervalMs, UInt32 arenaSize)
+		{
+			UInt32 intervalUs = Convert.ToUInt32(tickIntervalMs * 1000);
+			Int32 matchId = ServerLibrary.MatchHost_createMatch(host, tick, context, intervalUs, arenaSize);
+			if (matchId != MATCH_INVALID)
+			{
+				lock (callbacks)
+				{
+					callbacks[matchId] = tick;
+				}
+			}
+			return matchId;
+		}
+
+		public Int32 DestroyMatch(Int32 matchId)
+		{
+			Int32 result = ServerLibrary.MatchHost_destroyMatch(host, matchId);
+			lock (callbacks)
+			{
+				callbacks.Remove(matchId);
+			}
+			return result;
+		}
+
+		public Int32 Bind(EndPoint ep, Int32 matchId)
+		{
+			return ServerLibrary.MatchHost_bindEndPoint(host, ep, matchId);
+		}
+
+		public Int32 Unbind(EndPoint ep)
+		{
+			return ServerLibrary.MatchHost_unbindEndPoint(host, ep);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Recv
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Recv(Int32 matchId, ref EndPoint ep, byte[] buffer, Int32 len)
+--								matchId: the match whose queue is read
+--								ep: filled with the sender
+--								buffer: the byte array to write the datagram into
+--								len: the length of buffer
+--
+-- RETURNS: the number of bytes received, or 0 once the match's queue is empty.
+--
+-- NOTES:
+-- 		Only call this from the match's own TickCallback.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Recv(Int32 matchId, ref EndPoint ep, byte[] buffer, Int32 len)
+		{
+			fixed (byte* tmpBuf = buffer)
+			{
+				return Recv(matchId, ref ep, tmpBuf, len);
+			}
+		}
+
+		// As above, into unmanaged memory such as the match's arena
+		public Int32 Recv(Int32 matchId, ref EndPoint ep, byte* buffer, Int32 len)
+		{
+			fixed (EndPoint* p = &ep)
+			{
+				return ServerLibrary.MatchHost_recvBytes(host, matchId, p, new IntPtr(buffer), Convert.ToUInt32(len));
+			}
+		}
+
+		public Int32 Send(EndPoint ep, byte[] buffer, Int32 len)
+		{
+			fixed (byte* tmpBuf = buffer)
+			{
+				return ServerLibrary.MatchHost_sendBytes(host, ep, new IntPtr(tmpBuf), Convert.ToUInt32(len));
+			}
+		}
+
+		// Copies the datagram into the shared socket's next batch; FlushSends sends it
+		public Int32 QueueSend(EndPoint ep, byte[] buffer, Int32 len)
+		{
+			fixed (byte* tmpBuf = buffer)
+			{
+				return QueueSend(ep, tmpBuf, len);
+			}
+		}
+
+		public Int32 QueueSend(EndPoint ep, byte* buffer, Int32 len)
+		{
+			return ServerLibrary.MatchHost_queueSend(host, ep, new IntPtr(buffer), Convert.ToUInt32(len));
+		}
+
+		public Int32 FlushSends()
+		{
+			return ServerLibrary.MatchHost_flushSends(host);
+		}
+
+		public static IntPtr Allocate(IntPtr arena, UInt32 size)
+		{
+			return ServerLibrary.Arena_allocate(arena, size, 0);
+		}
+
+		public MatchStats GetStats()
+		{
+			MatchStats stats = new MatchStats();
+			ServerLibrary.MatchHost_getStats(host, &stats);
+			return stats;
+		}
+
+		public void Stop()
+		{
+			ServerLibrary.MatchHost_stop(host);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Dispose
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void Dispose()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Joins the receive thread and the workers, so no tick is running or will run, then frees the
+--		unmanaged host with its socket, queues and arenas, and lets go of the callbacks. Safe to call twice.
+--------------------------------------------------------------------------------------------------------------*/
+		public void Dispose()
+		{
+			if (host == IntPtr.Zero)
+			{
+				return;
+			}
+			ServerLibrary.MatchHost_stop(host);
+			ServerLibrary.MatchHost_DestroyHost(host);
+			host = IntPtr.Zero;
+			lock (callbacks)
+			{
+				callbacks.Clear();
+			}
+		}
+	}
+}
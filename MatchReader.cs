@@ -0,0 +1,102 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	MatchReader.cs -   A C# wrapper class for reading recorded matches
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		MatchReader()
+--					Open(string path)
+--					FirstTick()
+--					LastTick()
+--					StateSize()
+--					Seek(UInt32 tick, byte[] state, out UInt32 found)
+--					Close()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Opens a file written by MatchRecorder, including one that is still being recorded, and
+--		rebuilds the world state of any tick from the nearest keyframe before it. Each state is
+--		laid out as a SERVER_TICK snapshot, as the server records them.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class MatchReader
+	{
+		private IntPtr reader;
+
+		public MatchReader()
+		{
+			reader = ServerLibrary.MatchReader_Create();
+		}
+
+		public Int32 Open(string path)
+		{
+			return ServerLibrary.MatchReader_open(reader, path);
+		}
+
+		public UInt32 FirstTick()
+		{
+			return ServerLibrary.MatchReader_firstTick(reader);
+		}
+
+		public UInt32 LastTick()
+		{
+			return ServerLibrary.MatchReader_lastTick(reader);
+		}
+
+		public Int32 StateSize()
+		{
+			return Convert.ToInt32(ServerLibrary.MatchReader_stateSize(reader));
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Seek
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool Seek(UInt32 tick, byte[] state, out UInt32 found)
+--								tick: the tick wanted
+--								state: receives the world state, at least StateSize() bytes
+--								found: the tick returned, the last one recorded at or before tick
+--
+-- RETURNS: false if tick is before the recording started or the file is damaged.
+--------------------------------------------------------------------------------------------------------------*/
+		public bool Seek(UInt32 tick, byte[] state, out UInt32 found)
+		{
+			UInt32 at = 0;
+			Int32 result;
+			fixed (byte* p = state)
+			{
+				result = ServerLibrary.MatchReader_seek(reader, tick, p, Convert.ToUInt32(state.Length), &at);
+			}
+			found = at;
+			return result == 0;
+		}
+
+		public void Close()
+		{
+			ServerLibrary.MatchReader_close(reader);
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.MatchReader_Destroy(reader);
+			reader = IntPtr.Zero;
+		}
+	}
+}
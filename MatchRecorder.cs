@@ -0,0 +1,105 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	MatchRecorder.cs -   A C# wrapper class for the native match recorder
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		MatchRecorder()
+--					Open(string path, UInt64 capacity, Int32 stateSize, UInt32 keyInterval)
+--					Record(UInt32 tick, byte* state)
+--					Dropped()
+--					Close()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The send thread hands each tick's world state to Record, which copies it into a staging
+--		ring and returns. A native writer thread appends keyframes and deltas to a memory-mapped
+--		file that MatchReader can seek through, during or after the match. If the writer falls
+--		behind, ticks are dropped and counted rather than holding up the tick.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class MatchRecorder
+	{
+		private IntPtr recorder;
+
+		public MatchRecorder()
+		{
+			recorder = ServerLibrary.MatchRecorder_Create();
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Open
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Open(string path, UInt64 capacity, Int32 stateSize, UInt32 keyInterval)
+--								path: the file to record to, replaced if it exists
+--								capacity: bytes to pre-allocate; the file grows beyond this if needed
+--								stateSize: bytes passed to each Record call
+--								keyInterval: ticks between keyframes
+--
+-- RETURNS: 0 on success, or -1 if the file could not be created.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Open(string path, UInt64 capacity, Int32 stateSize, UInt32 keyInterval)
+		{
+			return ServerLibrary.MatchRecorder_open(recorder, path, capacity, Convert.ToUInt32(stateSize), keyInterval);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Record
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool Record(UInt32 tick, byte* state)
+--								tick: the server tick, increasing from call to call
+--								state: stateSize bytes of world state
+--
+-- RETURNS: false if the tick was dropped.
+--
+-- NOTES:
+-- 		Never blocks. Only one thread may record.
+--------------------------------------------------------------------------------------------------------------*/
+		public bool Record(UInt32 tick, byte* state)
+		{
+			return ServerLibrary.MatchRecorder_record(recorder, tick, state) == 0;
+		}
+
+		public UInt32 Dropped()
+		{
+			return ServerLibrary.MatchRecorder_dropped(recorder);
+		}
+
+		public void Close()
+		{
+			ServerLibrary.MatchRecorder_close(recorder);
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.MatchRecorder_Destroy(recorder);
+			recorder = IntPtr.Zero;
+		}
+	}
+}
@@ -0,0 +1,237 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	Packets.cs -   Packet layouts generated from src/packets.def
+--
+--	PROGRAM:		server
+--
+--	NOTES:
+--		Written by src/schemagen (make schema). Do not edit; change src/packets.def and
+--		regenerate. The accessors read and write in place through a byte pointer, so they
+--		work straight on pooled receive and send buffers.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace R
+{
+    public static unsafe class Packet
+    {
+        public static class ClientTick
+        {
+            public const int SIZE = 40;
+
+            public const int HEADER = 0;
+            public static byte GetHeader(byte* packet) { return *(byte*)(packet + HEADER); }
+            public static void SetHeader(byte* packet, byte value) { *(byte*)(packet + HEADER) = value; }
+
+            public const int PID = 1;
+            public static byte GetPid(byte* packet) { return *(byte*)(packet + PID); }
+            public static void SetPid(byte* packet, byte value) { *(byte*)(packet + PID) = value; }
+
+            public const int X = 2;
+            public static float GetX(byte* packet) { return *(float*)(packet + X); }
+            public static void SetX(byte* packet, float value) { *(float*)(packet + X) = value; }
+
+            public const int Z = 6;
+            public static float GetZ(byte* packet) { return *(float*)(packet + Z); }
+            public static void SetZ(byte* packet, float value) { *(float*)(packet + Z) = value; }
+
+            public const int R = 10;
+            public static float GetR(byte* packet) { return *(float*)(packet + R); }
+            public static void SetR(byte* packet, float value) { *(float*)(packet + R) = value; }
+
+            public const int WEAPON_ID = 14;
+            public static Int32 GetWeaponId(byte* packet) { return *(Int32*)(packet + WEAPON_ID); }
+            public static void SetWeaponId(byte* packet, Int32 value) { *(Int32*)(packet + WEAPON_ID) = value; }
+
+            public const int WEAPON_TYPE = 18;
+            public static byte GetWeaponType(byte* packet) { return *(byte*)(packet + WEAPON_TYPE); }
+            public static void SetWeaponType(byte* packet, byte value) { *(byte*)(packet + WEAPON_TYPE) = value; }
+
+            public const int BULLET_ID = 19;
+            public static Int32 GetBulletId(byte* packet) { return *(Int32*)(packet + BULLET_ID); }
+            public static void SetBulletId(byte* packet, Int32 value) { *(Int32*)(packet + BULLET_ID) = value; }
+
+            public const int BULLET_TYPE = 23;
+            public static byte GetBulletType(byte* packet) { return *(byte*)(packet + BULLET_TYPE); }
+            public static void SetBulletType(byte* packet, byte value) { *(byte*)(packet + BULLET_TYPE) = value; }
+
+            public const int ACK = 24;
+            public static UInt32 GetAck(byte* packet) { return *(UInt32*)(packet + ACK); }
+            public static void SetAck(byte* packet, UInt32 value) { *(UInt32*)(packet + ACK) = value; }
+
+            public const int ACK_BITS = 28;
+            public static UInt32 GetAckBits(byte* packet) { return *(UInt32*)(packet + ACK_BITS); }
+            public static void SetAckBits(byte* packet, UInt32 value) { *(UInt32*)(packet + ACK_BITS) = value; }
+
+            public const int CLIENT_TIME = 32;
+            public static UInt32 GetClientTime(byte* packet) { return *(UInt32*)(packet + CLIENT_TIME); }
+            public static void SetClientTime(byte* packet, UInt32 value) { *(UInt32*)(packet + CLIENT_TIME) = value; }
+
+            public const int ACK_DELAY = 36;
+            public static UInt32 GetAckDelay(byte* packet) { return *(UInt32*)(packet + ACK_DELAY); }
+            public static void SetAckDelay(byte* packet, UInt32 value) { *(UInt32*)(packet + ACK_DELAY) = value; }
+        }
+
+        public static class ServerTick
+        {
+            public const int SIZE = 869;
+
+            public const int HEADER = 0;
+            public static byte GetHeader(byte* packet) { return *(byte*)(packet + HEADER); }
+            public static void SetHeader(byte* packet, byte value) { *(byte*)(packet + HEADER) = value; }
+
+            public const int ZONE_X = 1;
+            public static float GetZoneX(byte* packet) { return *(float*)(packet + ZONE_X); }
+            public static void SetZoneX(byte* packet, float value) { *(float*)(packet + ZONE_X) = value; }
+
+            public const int ZONE_Z = 5;
+            public static float GetZoneZ(byte* packet) { return *(float*)(packet + ZONE_Z); }
+            public static void SetZoneZ(byte* packet, float value) { *(float*)(packet + ZONE_Z) = value; }
+
+            public const int ZONE_RADIUS = 9;
+            public static float GetZoneRadius(byte* packet) { return *(float*)(packet + ZONE_RADIUS); }
+            public static void SetZoneRadius(byte* packet, float value) { *(float*)(packet + ZONE_RADIUS) = value; }
+
+            public const int TIME = 13;
+            public static float GetTime(byte* packet) { return *(float*)(packet + TIME); }
+            public static void SetTime(byte* packet, float value) { *(float*)(packet + TIME) = value; }
+
+            public const int HEALTH = 17;
+            public static byte GetHealth(byte* packet) { return *(byte*)(packet + HEALTH); }
+            public static void SetHealth(byte* packet, byte value) { *(byte*)(packet + HEALTH) = value; }
+
+            public const int INVENTORY = 18;
+            public const int INVENTORY_COUNT = 5;
+            public static byte* Inventory(byte* packet) { return (byte*)(packet + INVENTORY); }
+
+            public const int PLAYERS = 23;
+            public const int PLAYERS_COUNT = 420;
+            public static byte* Players(byte* packet) { return (byte*)(packet + PLAYERS); }
+
+            public const int BULLETS = 443;
+            public const int BULLETS_COUNT = 210;
+            public static byte* Bullets(byte* packet) { return (byte*)(packet + BULLETS); }
+
+            public const int WEAPONS = 653;
+            public const int WEAPONS_COUNT = 212;
+            public static byte* Weapons(byte* packet) { return (byte*)(packet + WEAPONS); }
+
+            public const int SEQ = 865;
+            public static UInt32 GetSeq(byte* packet) { return *(UInt32*)(packet + SEQ); }
+            public static void SetSeq(byte* packet, UInt32 value) { *(UInt32*)(packet + SEQ) = value; }
+        }
+
+        public static class PlayerRecord
+        {
+            public const int SIZE = 14;
+
+            public const int ID = 0;
+            public static byte GetId(byte* packet) { return *(byte*)(packet + ID); }
+            public static void SetId(byte* packet, byte value) { *(byte*)(packet + ID) = value; }
+
+            public const int X = 1;
+            public static float GetX(byte* packet) { return *(float*)(packet + X); }
+            public static void SetX(byte* packet, float value) { *(float*)(packet + X) = value; }
+
+            public const int Z = 5;
+            public static float GetZ(byte* packet) { return *(float*)(packet + Z); }
+            public static void SetZ(byte* packet, float value) { *(float*)(packet + Z) = value; }
+
+            public const int R = 9;
+            public static float GetR(byte* packet) { return *(float*)(packet + R); }
+            public static void SetR(byte* packet, float value) { *(float*)(packet + R) = value; }
+
+            public const int WEAPON = 13;
+            public static byte GetWeapon(byte* packet) { return *(byte*)(packet + WEAPON); }
+            public static void SetWeapon(byte* packet, byte value) { *(byte*)(packet + WEAPON) = value; }
+        }
+
+        public static class BulletRecord
+        {
+            public const int SIZE = 7;
+
+            public const int OWNER = 0;
+            public static byte GetOwner(byte* packet) { return *(byte*)(packet + OWNER); }
+            public static void SetOwner(byte* packet, byte value) { *(byte*)(packet + OWNER) = value; }
+
+            public const int ID = 1;
+            public static Int32 GetId(byte* packet) { return *(Int32*)(packet + ID); }
+            public static void SetId(byte* packet, Int32 value) { *(Int32*)(packet + ID) = value; }
+
+            public const int TYPE = 5;
+            public static byte GetType(byte* packet) { return *(byte*)(packet + TYPE); }
+            public static void SetType(byte* packet, byte value) { *(byte*)(packet + TYPE) = value; }
+
+            public const int CHANGE = 6;
+            public static byte GetChange(byte* packet) { return *(byte*)(packet + CHANGE); }
+            public static void SetChange(byte* packet, byte value) { *(byte*)(packet + CHANGE) = value; }
+        }
+
+        public static class WeaponRecord
+        {
+            public const int SIZE = 5;
+
+            public const int ID = 0;
+            public static Int32 GetId(byte* packet) { return *(Int32*)(packet + ID); }
+            public static void SetId(byte* packet, Int32 value) { *(Int32*)(packet + ID) = value; }
+
+            public const int CHANGE = 4;
+            public static byte GetChange(byte* packet) { return *(byte*)(packet + CHANGE); }
+            public static void SetChange(byte* packet, byte value) { *(byte*)(packet + CHANGE) = value; }
+        }
+
+        public static class InitPlayer
+        {
+            public const int SIZE = 10;
+
+            public const int HEADER = 0;
+            public static byte GetHeader(byte* packet) { return *(byte*)(packet + HEADER); }
+            public static void SetHeader(byte* packet, byte value) { *(byte*)(packet + HEADER) = value; }
+
+            public const int ID = 1;
+            public static byte GetId(byte* packet) { return *(byte*)(packet + ID); }
+            public static void SetId(byte* packet, byte value) { *(byte*)(packet + ID) = value; }
+
+            public const int X = 2;
+            public static float GetX(byte* packet) { return *(float*)(packet + X); }
+            public static void SetX(byte* packet, float value) { *(float*)(packet + X) = value; }
+
+            public const int Z = 6;
+            public static float GetZ(byte* packet) { return *(float*)(packet + Z); }
+            public static void SetZ(byte* packet, float value) { *(float*)(packet + Z) = value; }
+        }
+
+        public static class KeepAlive
+        {
+            public const int SIZE = 2;
+
+            public const int HEADER = 0;
+            public static byte GetHeader(byte* packet) { return *(byte*)(packet + HEADER); }
+            public static void SetHeader(byte* packet, byte value) { *(byte*)(packet + HEADER) = value; }
+
+            public const int PID = 1;
+            public static byte GetPid(byte* packet) { return *(byte*)(packet + PID); }
+            public static void SetPid(byte* packet, byte value) { *(byte*)(packet + PID) = value; }
+        }
+
+        public static class Fragment
+        {
+            public const int SIZE = 7;
+
+            public const int HEADER = 0;
+            public static byte GetHeader(byte* packet) { return *(byte*)(packet + HEADER); }
+            public static void SetHeader(byte* packet, byte value) { *(byte*)(packet + HEADER) = value; }
+
+            public const int ID = 1;
+            public static UInt32 GetId(byte* packet) { return *(UInt32*)(packet + ID); }
+            public static void SetId(byte* packet, UInt32 value) { *(UInt32*)(packet + ID) = value; }
+
+            public const int INDEX = 5;
+            public static byte GetIndex(byte* packet) { return *(byte*)(packet + INDEX); }
+            public static void SetIndex(byte* packet, byte value) { *(byte*)(packet + INDEX) = value; }
+
+            public const int COUNT = 6;
+            public static byte GetCount(byte* packet) { return *(byte*)(packet + COUNT); }
+            public static void SetCount(byte* packet, byte value) { *(byte*)(packet + COUNT) = value; }
+        }
+    }
+}
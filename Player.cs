@@ -9,7 +9,9 @@ FUNCTIONS:		Player(EndPoint ep, byte id, float x, float z)
 
 DATE:			Mar. 14, 2018
 
-REVISIONS:
+REVISIONS:		Oct. 19, 2026 - Connection timer fields
+				Oct. 19, 2026 - Bullet and weapon events not yet sent to the player
+				Oct. 19, 2026 - The event backlogs are set by the match, in its arena
 
 DESIGNER:		Benny Wang
 
@@ -36,6 +38,16 @@ public class Player
 	public int currentWeaponId { get; set; }
 	public byte currentWeaponType { get; set; }
 
+	// Connection timers, in TimerWheel.Now() milliseconds
+	public long lastHeard { get; set; }
+	public long lastSent { get; set; }
+	public int keepAliveTimer { get; set; }
+	public int idleTimer { get; set; }
+
+	// Events waiting for the player's next snapshot, see EventBacklog.cs; set by the match
+	public EventBacklog bulletBacklog { get; set; }
+	public EventBacklog weaponBacklog { get; set; }
+
     /************************************************************************************
     FUNCTION:	Player
 
@@ -66,6 +78,10 @@ public class Player
 		this.h = 100;
 		this.currentWeaponId = 0;
 		this.currentWeaponType = 0;
+		this.lastHeard = TimerWheel.Now();
+		this.lastSent = this.lastHeard;
+		this.keepAliveTimer = TimerWheel.NO_TIMER;
+		this.idleTimer = TimerWheel.NO_TIMER;
 	}
 
     /************************************************************************************
@@ -0,0 +1,93 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	PositionHistory.cs -   A C# wrapper class for the native position history
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		PositionHistory()
+--					BeginTick(UInt32 tick)
+--					Store(byte id, float x, float z, float r)
+--					Latest()
+--					Hits(UInt32 tick, float x, float z, float radius, byte exclude, byte[] ids)
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The send thread records every player's position under the tick of each snapshot it builds.
+--		Bullets carry the tick their shooter was looking at, and the game thread tests them against
+--		the players as they were at that tick, so hits are not off by the shooter's latency.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class PositionHistory
+	{
+		private IntPtr history;
+
+		public PositionHistory()
+		{
+			history = ServerLibrary.PositionHistory_Create();
+		}
+
+		internal IntPtr Pointer
+		{
+			get { return history; }
+		}
+
+		public void BeginTick(UInt32 tick)
+		{
+			ServerLibrary.PositionHistory_beginTick(history, tick);
+		}
+
+		public void Store(byte id, float x, float z, float r)
+		{
+			ServerLibrary.PositionHistory_store(history, id, x, z, r);
+		}
+
+		public UInt32 Latest()
+		{
+			return ServerLibrary.PositionHistory_latest(history);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Hits
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Hits(UInt32 tick, float x, float z, float radius, byte exclude, byte[] ids)
+--								tick: the tick to rewind to; clamped to the ticks still recorded
+--								x, z: the bullet's position
+--								radius: bullet size plus player radius
+--								exclude: the shooter, never reported
+--								ids: receives the ids of the players hit
+--
+-- RETURNS: the number of ids written.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Hits(UInt32 tick, float x, float z, float radius, byte exclude, byte[] ids)
+		{
+			fixed (byte* p = ids)
+			{
+				return ServerLibrary.PositionHistory_hits(history, tick, x, z, radius, exclude, p, Convert.ToUInt32(ids.Length));
+			}
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.PositionHistory_Destroy(history);
+			history = IntPtr.Zero;
+		}
+	}
+}
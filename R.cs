@@ -6,6 +6,22 @@
 --	DATE:			Feb 18, 2018
 --
 --	REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
+--					Oct 19, 2026 - Buffer pool sizing
+--					Oct 19, 2026 - Event section types returned by Client_recvLatest
+--					Oct 19, 2026 - Snapshot sequence and client ack fields
+--					Oct 19, 2026 - Packed snapshot header
+--					Oct 19, 2026 - Compression chunk size
+--					Oct 19, 2026 - Event queue capacity and per-tick event limits
+--					Oct 19, 2026 - Fragment header and wide snapshot layout
+--					Oct 19, 2026 - Keepalive and disconnect packets, connection timers
+--					Oct 19, 2026 - Spectator broadcast ring size and relay subscribe header
+--					Oct 19, 2026 - Relay subscribe cookie challenge
+--					Oct 19, 2026 - Offsets and sizes come from the generated Packet layouts
+--					Oct 19, 2026 - Tick governor lanes, degradation steps and their limits
+--					Oct 19, 2026 - Client tick size without the clock fields
+--					Oct 19, 2026 - Initial size of the bullet sweep arrays
+--					Oct 19, 2026 - Per-player event backlog size
+--					Oct 19, 2026 - Matches per process and their arena size, one governor lane per match
 --
 --	DESIGNERS:		Alfred Swinton, Benny Wang
 --
@@ -27,61 +43,149 @@ namespace R
         public const ushort TIMEOUT = 30;
         public const short TIMEOUT_ERRNO = -11;
 
+        // Snapshot and receive buffers, and spectator ring slots
+        public const Int32 POOL_BUFFER_SIZE = 1024;
+
+        // Matches one process can host, MAX_MATCHES in matchhost.h
+        public const Int32 MAX_MATCHES = 64;
+
+        // Each match's arena: its snapshot, packed and receive buffers and every player id's event backlogs
+        public const UInt32 MATCH_ARENA_SIZE = 1024 * 1024;
+
+        // Send snapshots bit-packed (Header.PACKED_TICK) instead of the fixed SERVER_TICK layout
+        public const bool PACK_SNAPSHOTS = true;
+
+        // Input bytes per independently compressed chunk of the pregame payloads
+        public const UInt32 COMPRESS_CHUNK_SIZE = 65536;
+
+        // Match recording: bytes pre-allocated for the file, and ticks between keyframes
+        public const UInt64 RECORD_CAPACITY = 64 * 1024 * 1024;
+        public const UInt32 RECORD_KEYFRAME_INTERVAL = 64;
+
+        // Ingress filter packet rates: per player (twice the tick rate), and shared by unknown senders
+        public const UInt32 INGRESS_RATE = 128;
+        public const UInt32 INGRESS_BURST = 64;
+        public const UInt32 INGRESS_UNKNOWN_RATE = 64;
+        public const UInt32 INGRESS_UNKNOWN_BURST = 32;
+        public const Int32 INGRESS_REPORT_SECONDS = 10;
+
+        // Paced sends: share of the tick interval one tick's snapshots are spread across
+        public const UInt32 PACING_PERCENT = 50;
+
+        // Bullet and weapon swap events waiting for a tick, and how many fit in one tick's sections
+        public const UInt32 EVENT_QUEUE_CAPACITY = 1024;
+        public const int MAX_BULLET_EVENTS = (Offset.WEAPONS - Offset.BULLETS - 1) / Size.BULLET_EVENT;
+        public const int MAX_WEAPON_EVENTS = (Offset.SEQ - Offset.WEAPONS - 1) / Size.WEAPON_EVENT;
+
+        // Events each player can fall behind by, per section, before the oldest are dropped
+        public const int EVENT_BACKLOG = 256;
+
+        // Connection timers: a keepalive goes to a player the server has sent nothing for KEEPALIVE_MS,
+        // and a player heard nothing from for IDLE_TIMEOUT_MS is dropped
+        public const UInt32 TIMER_CAPACITY = 1024;
+        public const UInt32 KEEPALIVE_MS = 1000;
+        public const UInt32 IDLE_TIMEOUT_MS = 10000;
+
+        // Spectator broadcast ring: snapshots kept for relays that fall behind (two seconds), each up to a pool buffer
+        public const UInt32 BROADCAST_SLOTS = 128;
+
+        // Kinds of connection timer, keyed by player id
+        public static class Timer
+        {
+            public const UInt32 KEEP_ALIVE = 1;
+            public const UInt32 IDLE = 2;
+        }
+
         // Contains constants associated with the header type of the packet
         public static class Header
         {
             public const byte INIT_PLAYER = 0;
             public const byte TICK = 85;
+            public const byte PACKED_TICK = 86;
             public const byte NEW_CLIENT = 69;
             public const byte ACK = 170;
 
+            // [header][player id], either way; a client leaving says DISCONNECT instead of timing out
+            public const byte KEEP_ALIVE = 6;
+            public const byte DISCONNECT = 7;
+
+            // [header][8 byte cookie], sent to a spectatorrelay every few seconds to keep watching;
+            // DISCONNECT with the cookie stops. The first one carries zeroes and the relay answers
+            // [SPECTATE_CHALLENGE][cookie] to any without its current cookie
+            public const byte SPECTATE = 88;
+            public const byte SPECTATE_CHALLENGE = 89;
+
+            // A fragment of a message longer than one datagram; the client library reassembles them
+            public const byte FRAGMENT = 87;
+
+            // Player count in a tick header marking the wide layout, see Offset.WIDE_COUNT
+            public const byte WIDE = 0x1F;
+
 			public const byte TERRAIN_DATA = 55;
 			public const byte SPAWN_DATA = 56;
         }
 
-        // Contains constants associated with the packet offset or distance into the packet
+        // Section types in the events buffer filled by Client_recvLatest, each laid out as
+        // [type][count][count records] using the BULLETS / WEAPONS record layouts of the tick packet
+        public static class Event
+        {
+            public const byte BULLETS = 1;
+            public const byte WEAPONS = 2;
+        }
+
+        // Contains constants associated with the packet offset or distance into the packet.
+        // The layouts are defined in src/packets.def; see Packets.cs for accessors.
         public static class Offset
         {
             // Offsets for client to server packet
-            public const int PID = 1;
-            public const int X = PID + 1;
-            public const int Z = X + 4;
-            public const int R = Z + 4;
-            public const int WEAPON_ID = R + 4;
-            public const int WEAPON_TYPE = WEAPON_ID + 4;
-            public const int BULLET_ID = WEAPON_TYPE + 1;
-            public const int BULLET_TYPE = BULLET_ID + 4;
+            public const int PID = Packet.ClientTick.PID;
+            public const int X = Packet.ClientTick.X;
+            public const int Z = Packet.ClientTick.Z;
+            public const int R = Packet.ClientTick.R;
+            public const int WEAPON_ID = Packet.ClientTick.WEAPON_ID;
+            public const int WEAPON_TYPE = Packet.ClientTick.WEAPON_TYPE;
+            public const int BULLET_ID = Packet.ClientTick.BULLET_ID;
+            public const int BULLET_TYPE = Packet.ClientTick.BULLET_TYPE;
+            public const int ACK = Packet.ClientTick.ACK;
+            public const int ACK_BITS = Packet.ClientTick.ACK_BITS;
 
             // Offsets for server to client packet
-            public const int DANGER_ZONE = 1;
-            public const int TIME = 13;
-            public const int HEALTH = 17;
-            public const int INVENTORY = 18;
-            public const int PLAYERS = 23;
-            public const int BULLETS = 443;
-            public const int WEAPONS = 653;
+            public const int DANGER_ZONE = Packet.ServerTick.ZONE_X;
+            public const int TIME = Packet.ServerTick.TIME;
+            public const int HEALTH = Packet.ServerTick.HEALTH;
+            public const int INVENTORY = Packet.ServerTick.INVENTORY;
+            public const int PLAYERS = Packet.ServerTick.PLAYERS;
+            public const int BULLETS = Packet.ServerTick.BULLETS;
+            public const int WEAPONS = Packet.ServerTick.WEAPONS;
+            public const int SEQ = Packet.ServerTick.SEQ;
+
+            // Wide snapshots match the above up to PLAYERS, then hold a ushort player count and size
+            // each section to its contents: players, bullet count and bullets, weapon count and
+            // weapons, sequence number
+            public const int WIDE_COUNT = PLAYERS;
+            public const int WIDE_PLAYERS = WIDE_COUNT + 2;
 
             public static class Player
             {
-                public const int ID = 0;
-                public const int X = 1;
-                public const int Z = 5;
-                public const int R = 9;
-                public const int W = 13;
+                public const int ID = Packet.PlayerRecord.ID;
+                public const int X = Packet.PlayerRecord.X;
+                public const int Z = Packet.PlayerRecord.Z;
+                public const int R = Packet.PlayerRecord.R;
+                public const int W = Packet.PlayerRecord.WEAPON;
             }
 
             public static class Bullet
             {
-                public const int OWNER = 0;
-                public const int ID = 1;
-                public const int TYPE = 5;
-                public const int CHANGE = 6;
+                public const int OWNER = Packet.BulletRecord.OWNER;
+                public const int ID = Packet.BulletRecord.ID;
+                public const int TYPE = Packet.BulletRecord.TYPE;
+                public const int CHANGE = Packet.BulletRecord.CHANGE;
             }
 
             public static class Weapon
             {
-                public const int ID = 0;
-                public const int CHANGE = 4;
+                public const int ID = Packet.WeaponRecord.ID;
+                public const int CHANGE = Packet.WeaponRecord.CHANGE;
             }
         }
 
@@ -89,9 +193,14 @@ namespace R
         public static class Size
         {
             // Packet sizes
-            public const int SERVER_TICK = 865;
-            public const int CLIENT_TICK = 24;
-            public const int PLAYER_DATA = 14;
+            public const int SERVER_TICK = Packet.ServerTick.SIZE;
+            public const int CLIENT_TICK = Packet.ClientTick.SIZE;
+            public const int CLIENT_TICK_NO_ACK = Packet.ClientTick.ACK;
+            public const int CLIENT_TICK_NO_CLOCK = Packet.ClientTick.CLIENT_TIME;
+            public const int PLAYER_DATA = Packet.PlayerRecord.SIZE;
+            public const int BULLET_EVENT = Packet.BulletRecord.SIZE;
+            public const int WEAPON_EVENT = Packet.WeaponRecord.SIZE;
+            public const int KEEP_ALIVE = Packet.KeepAlive.SIZE;
         }
 
     }
@@ -103,6 +212,35 @@ namespace R
         public const double TICK_INTERVAL = (double)1000 / (double)TICK_RATE;
         public const float GAME_TIMER_INIT = 900000f; // 15 mins
 
+        // Terrain and weapon generation is tried this many times before the match is abandoned
+        public const int INIT_DATA_ATTEMPTS = 3;
+
+        // Tick governor: a match's whole tick is one lane, and the degradation steps applied in this order
+        // when a tick's work stays at the engage load, a percentage of TICK_INTERVAL, until it falls
+        // back under the release load
+        public static class Governor
+        {
+            public const UInt32 LANE_MATCH = 0;
+
+            // Spectator publishing and connection timers run every DEFER_INTERVAL ticks
+            public const UInt32 DEFER_ENGAGE = 75;
+            public const UInt32 DEFER_RELEASE = 50;
+            public const int DEFER_INTERVAL = 4;
+
+            // A player with nobody within NEAR_DISTANCE gets every second snapshot that has no events
+            public const UInt32 FAR_RATE_ENGAGE = 85;
+            public const UInt32 FAR_RATE_RELEASE = 60;
+            public const float NEAR_DISTANCE = 200f;
+
+            // Only BULLET_CAP bullets are hit tested a tick, taking turns
+            public const UInt32 BULLET_CAP_ENGAGE = 95;
+            public const UInt32 BULLET_CAP_RELEASE = 70;
+            public const int BULLET_CAP = 64;
+
+            // Governor events reported per tick
+            public const int REPORT_EVENTS = 8;
+        }
+
         // Terrain Constants
         public static class Terrain
         {
@@ -142,6 +280,8 @@ namespace R
             public const byte ADD = 1;
             public const byte REMOVE = 0;
             public const byte IGNORE = 255;
+            // Bullets the game thread sweeps a tick before its sweep arrays grow
+            public const int SWEEP_CAPACITY = 256;
         }
 
         // Danger zone constant
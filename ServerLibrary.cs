@@ -24,6 +24,39 @@ namespace Networking {
         [DllImport ("Network")]
         public static extern Int32 Server_initServer (IntPtr serverPtr, ushort port);
 
+        [DllImport ("Network")]
+        public static extern Int32 Server_setEngine (IntPtr serverPtr, Int32 engine);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_queueSend (IntPtr serverPtr, EndPoint ep, IntPtr buffer, UInt32 len);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_flushSends (IntPtr serverPtr);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_sendBuffer (IntPtr serverPtr, IntPtr poolPtr, Int32 handle, EndPoint ep, UInt32 len);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_queueBuffer (IntPtr serverPtr, IntPtr poolPtr, Int32 handle, EndPoint ep, UInt32 len);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_recvBuffer (IntPtr serverPtr, IntPtr poolPtr, Int32 handle, EndPoint * ep);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_getSocket (IntPtr serverPtr);
+
+        [DllImport ("Network")]
+        public static extern void Server_setFilter (IntPtr serverPtr, IntPtr filterPtr);
+
+        [DllImport ("Network")]
+        public static extern Int32 Server_setPacing (IntPtr serverPtr, Int32 mode, UInt32 intervalUs, UInt32 percent);
+
+        [DllImport ("Network")]
+        public static extern void Server_getPacerStats (IntPtr serverPtr, PacerStats * stats);
+
+        [DllImport ("Network")]
+        public static extern void Server_setUpstream (IntPtr serverPtr, EndPoint proxy);
+
         [DllImport ("Network")]
         public static extern IntPtr Client_CreateClient ();
 
@@ -42,6 +75,12 @@ namespace Networking {
         [DllImport ("Network")]
         public static extern Int32 Client_initClient (IntPtr clientPtr, EndPoint ep);
 
+        [DllImport ("Network")]
+        public static extern Int32 Client_recvLatest (IntPtr clientPtr, IntPtr buffer, UInt32 size, IntPtr events, UInt32 eventsSize, UInt32 * eventsLen);
+
+        [DllImport ("Network")]
+        public static extern Int32 Client_sendTick (IntPtr clientPtr, IntPtr buffer, UInt32 len);
+
         [DllImport("Network")]
         public static extern IntPtr TCPServer_CreateServer();
 
@@ -58,10 +97,13 @@ namespace Networking {
         public static extern Int32 TCPServer_recvBytes(IntPtr serverPtr, Int32 clientSocket, IntPtr data, UInt32 len);
 
         [DllImport("Network")]
-        public static extern Int32 TCPServer_closeClientSocket(Int32 clientSocket);
+        public static extern Int32 TCPServer_closeClientSocket(IntPtr serverPtr, Int32 clientSocket);
 
         [DllImport("Network")]
-        public static extern Int32 TCPServer_closeListenSocket(Int32 sockfd);
+        public static extern Int32 TCPServer_closeListenSocket(IntPtr serverPtr, Int32 sockfd);
+
+        [DllImport("Network")]
+        public static extern Int32 TCPServer_setEngine(IntPtr serverPtr, Int32 engine);
 
         [DllImport("Network")]
         public static extern IntPtr TCPClient_CreateClient();
@@ -78,6 +120,418 @@ namespace Networking {
         [DllImport("Network")]
         public static extern Int32 TCPClient_closeConnection(Int32 sockfd);
 
+        [DllImport("Network")]
+        public static extern IntPtr MatchHost_CreateHost();
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_initHost(IntPtr hostPtr, ushort port);
+
+        [DllImport("Network")]
+        public static extern IntPtr MatchHost_transport(IntPtr hostPtr);
+
+        [DllImport("Network")]
+        public static extern void MatchHost_setJoin(IntPtr hostPtr, byte header, UInt32 tokenOffset);
+
+        [DllImport("Network")]
+        public static extern void MatchHost_setTuning(IntPtr hostPtr, IntPtr tuningPtr);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_start(IntPtr hostPtr, Int32 workers);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_createMatch(IntPtr hostPtr, MatchHost.TickCallback tick, IntPtr context, UInt32 tickIntervalUs, UInt32 arenaSize);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_destroyMatch(IntPtr hostPtr, Int32 matchId);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_bindEndPoint(IntPtr hostPtr, EndPoint ep, Int32 matchId);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_unbindEndPoint(IntPtr hostPtr, EndPoint ep);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_recvBytes(IntPtr hostPtr, Int32 matchId, EndPoint * ep, IntPtr buffer, UInt32 len);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_sendBytes(IntPtr hostPtr, EndPoint ep, IntPtr buffer, UInt32 len);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_queueSend(IntPtr hostPtr, EndPoint ep, IntPtr buffer, UInt32 len);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchHost_flushSends(IntPtr hostPtr);
+
+        [DllImport("Network")]
+        public static extern void MatchHost_getStats(IntPtr hostPtr, MatchStats * stats);
+
+        [DllImport("Network")]
+        public static extern void MatchHost_stop(IntPtr hostPtr);
+
+        [DllImport("Network")]
+        public static extern void MatchHost_DestroyHost(IntPtr hostPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr Arena_allocate(IntPtr arenaPtr, UInt32 size, UInt32 align);
+
+        [DllImport("Network")]
+        public static extern void Arena_reset(IntPtr arenaPtr);
+
+        [DllImport("Network")]
+        public static extern UInt32 Arena_used(IntPtr arenaPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr BufferPool_CreatePool();
+
+        [DllImport("Network")]
+        public static extern Int32 BufferPool_initPool(IntPtr poolPtr, UInt32 bufferSize, UInt32 count, UInt32 flags);
+
+        [DllImport("Network")]
+        public static extern Int32 BufferPool_lease(IntPtr poolPtr);
+
+        [DllImport("Network")]
+        public static extern Int32 BufferPool_release(IntPtr poolPtr, Int32 handle);
+
+        [DllImport("Network")]
+        public static extern IntPtr BufferPool_address(IntPtr poolPtr, Int32 handle);
+
+        [DllImport("Network")]
+        public static extern UInt32 BufferPool_available(IntPtr poolPtr);
+
+        [DllImport("Network")]
+        public static extern void BufferPool_DestroyPool(IntPtr poolPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr ConnStats_Create(UInt32 tickRate);
+
+        [DllImport("Network")]
+        public static extern void ConnStats_reset(IntPtr statsPtr, Int32 id);
+
+        [DllImport("Network")]
+        public static extern UInt32 ConnStats_onSend(IntPtr statsPtr, Int32 id, UInt32 tick);
+
+        [DllImport("Network")]
+        public static extern void ConnStats_onAck(IntPtr statsPtr, Int32 id, UInt32 ack, UInt32 ackBits);
+
+        [DllImport("Network")]
+        public static extern Int32 ConnStats_shouldSend(IntPtr statsPtr, Int32 id, UInt64 tick);
+
+        [DllImport("Network")]
+        public static extern UInt32 ConnStats_budget(IntPtr statsPtr, Int32 id);
+
+        [DllImport("Network")]
+        public static extern void ConnStats_getInfo(IntPtr statsPtr, Int32 id, ConnInfo * info);
+
+        [DllImport("Network")]
+        public static extern Int32 ConnStats_ackedTick(IntPtr statsPtr, Int32 id, UInt32 * tick);
+
+        [DllImport("Network")]
+        public static extern void ConnStats_onClock(IntPtr statsPtr, Int32 id, UInt32 ack, UInt32 clientTimeUs, UInt32 ackDelayUs);
+
+        [DllImport("Network")]
+        public static extern Int32 ConnStats_getClock(IntPtr statsPtr, Int32 id, ClockInfo * info);
+
+        [DllImport("Network")]
+        public static extern Int32 ConnStats_clientTick(IntPtr statsPtr, Int32 id, UInt32 clientTimeUs, UInt32 * tick);
+
+        [DllImport("Network")]
+        public static extern void ConnStats_Destroy(IntPtr statsPtr);
+
+        [DllImport("Network")]
+        public static extern Int32 Snapshot_pack(byte * tick, UInt32 len, byte * output, UInt32 outSize);
+
+        [DllImport("Network")]
+        public static extern Int32 Snapshot_unpack(byte * packed, UInt32 len, byte * tick, UInt32 tickSize);
+
+        [DllImport("Network")]
+        public static extern Int32 Snapshot_fit(byte * tick, UInt32 len, UInt32 budget, UInt32 * bullets, UInt32 * weapons);
+
+        [DllImport("Network")]
+        public static extern UInt32 Compressor_bound(UInt32 len, UInt32 chunkSize);
+
+        [DllImport("Network")]
+        public static extern Int32 Compressor_compress(byte * src, UInt32 len, byte * dst, UInt32 dstSize, UInt32 chunkSize, Int32 threads);
+
+        [DllImport("Network")]
+        public static extern Int32 Compressor_size(byte * src, UInt32 len);
+
+        [DllImport("Network")]
+        public static extern Int32 Compressor_decompress(byte * src, UInt32 len, byte * dst, UInt32 dstSize, Int32 threads);
+
+        [DllImport("Network")]
+        public static extern IntPtr SpawnSampler_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 SpawnSampler_init(IntPtr samplerPtr, UInt32 width, UInt32 length, UInt32 spacing, UInt64 seed);
+
+        [DllImport("Network")]
+        public static extern void SpawnSampler_blockTerrain(IntPtr samplerPtr, byte * tiles);
+
+        [DllImport("Network")]
+        public static extern void SpawnSampler_setHotspots(IntPtr samplerPtr, Int32 * xz, UInt32 count, UInt32 cluster);
+
+        [DllImport("Network")]
+        public static extern void SpawnSampler_setTown(IntPtr samplerPtr, Int32 * xz, UInt32 count);
+
+        [DllImport("Network")]
+        public static extern Int32 SpawnSampler_sample(IntPtr samplerPtr, UInt32 count, UInt32 townCount, float hotspotChance, Int32 firstId, byte * output, UInt32 outSize);
+
+        [DllImport("Network")]
+        public static extern void SpawnSampler_Destroy(IntPtr samplerPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr PositionHistory_Create();
+
+        [DllImport("Network")]
+        public static extern void PositionHistory_beginTick(IntPtr historyPtr, UInt32 tick);
+
+        [DllImport("Network")]
+        public static extern void PositionHistory_store(IntPtr historyPtr, Int32 id, float x, float z, float r);
+
+        [DllImport("Network")]
+        public static extern UInt32 PositionHistory_latest(IntPtr historyPtr);
+
+        [DllImport("Network")]
+        public static extern Int32 PositionHistory_positionAt(IntPtr historyPtr, UInt32 tick, Int32 id, float * x, float * z, float * r);
+
+        [DllImport("Network")]
+        public static extern Int32 PositionHistory_hits(IntPtr historyPtr, UInt32 tick, float x, float z, float radius, Int32 exclude, byte * ids, UInt32 maxIds);
+
+        [DllImport("Network")]
+        public static extern void PositionHistory_Destroy(IntPtr historyPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr Tuning_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 Tuning_load(IntPtr tuningPtr, string path);
+
+        [DllImport("Network")]
+        public static extern UInt32 Tuning_applyThread(IntPtr tuningPtr, Int32 role);
+
+        [DllImport("Network")]
+        public static extern UInt32 Tuning_applySocket(IntPtr tuningPtr, Int32 kind, Int32 fd);
+
+        [DllImport("Network")]
+        public static extern Int32 Tuning_describeThread(IntPtr tuningPtr, Int32 role, byte * output, UInt32 size);
+
+        [DllImport("Network")]
+        public static extern Int32 Tuning_describeSocket(IntPtr tuningPtr, Int32 kind, byte * output, UInt32 size);
+
+        [DllImport("Network")]
+        public static extern void Tuning_Destroy(IntPtr tuningPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr MatchRecorder_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 MatchRecorder_open(IntPtr recorderPtr, string path, UInt64 capacity, UInt32 stateSize, UInt32 keyInterval);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchRecorder_record(IntPtr recorderPtr, UInt32 tick, byte * state);
+
+        [DllImport("Network")]
+        public static extern UInt32 MatchRecorder_dropped(IntPtr recorderPtr);
+
+        [DllImport("Network")]
+        public static extern void MatchRecorder_close(IntPtr recorderPtr);
+
+        [DllImport("Network")]
+        public static extern void MatchRecorder_Destroy(IntPtr recorderPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr MatchReader_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 MatchReader_open(IntPtr readerPtr, string path);
+
+        [DllImport("Network")]
+        public static extern UInt32 MatchReader_firstTick(IntPtr readerPtr);
+
+        [DllImport("Network")]
+        public static extern UInt32 MatchReader_lastTick(IntPtr readerPtr);
+
+        [DllImport("Network")]
+        public static extern UInt32 MatchReader_stateSize(IntPtr readerPtr);
+
+        [DllImport("Network")]
+        public static extern Int32 MatchReader_seek(IntPtr readerPtr, UInt32 tick, byte * state, UInt32 size, UInt32 * found);
+
+        [DllImport("Network")]
+        public static extern void MatchReader_close(IntPtr readerPtr);
+
+        [DllImport("Network")]
+        public static extern void MatchReader_Destroy(IntPtr readerPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr IngressFilter_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 IngressFilter_allow(IntPtr filterPtr, byte header, UInt32 size, Int32 idOffset);
+
+        [DllImport("Network")]
+        public static extern void IngressFilter_setRates(IntPtr filterPtr, UInt32 rate, UInt32 burst, UInt32 unknownRate, UInt32 unknownBurst);
+
+        [DllImport("Network")]
+        public static extern Int32 IngressFilter_addEndpoint(IntPtr filterPtr, EndPoint ep, byte id);
+
+        [DllImport("Network")]
+        public static extern Int32 IngressFilter_removeEndpoint(IntPtr filterPtr, EndPoint ep);
+
+        [DllImport("Network")]
+        public static extern void IngressFilter_getStats(IntPtr filterPtr, IngressStats * stats);
+
+        [DllImport("Network")]
+        public static extern void IngressFilter_Destroy(IntPtr filterPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr AsyncLog_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 AsyncLog_start(IntPtr logPtr, Int32 fd);
+
+        [DllImport("Network")]
+        public static extern Int32 AsyncLog_addTemplate(IntPtr logPtr, string format);
+
+        [DllImport("Network")]
+        public static extern Int32 AsyncLog_write(IntPtr logPtr, char * text, UInt32 len);
+
+        [DllImport("Network")]
+        public static extern Int32 AsyncLog_event(IntPtr logPtr, Int32 id, Int64 a0, Int64 a1, Int64 a2, Int64 a3);
+
+        [DllImport("Network")]
+        public static extern void AsyncLog_getStats(IntPtr logPtr, LogStats * stats);
+
+        [DllImport("Network")]
+        public static extern void AsyncLog_stop(IntPtr logPtr);
+
+        [DllImport("Network")]
+        public static extern void AsyncLog_Destroy(IntPtr logPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr EventQueue_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 EventQueue_init(IntPtr queuePtr, UInt32 capacity, UInt32 recordSize);
+
+        [DllImport("Network")]
+        public static extern Int32 EventQueue_push(IntPtr queuePtr, byte * record);
+
+        [DllImport("Network")]
+        public static extern UInt32 EventQueue_drain(IntPtr queuePtr, byte * output, UInt32 maxRecords);
+
+        [DllImport("Network")]
+        public static extern UInt64 EventQueue_dropped(IntPtr queuePtr);
+
+        [DllImport("Network")]
+        public static extern void EventQueue_Destroy(IntPtr queuePtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr TimerWheel_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 TimerWheel_init(IntPtr wheelPtr, UInt32 capacity);
+
+        [DllImport("Network")]
+        public static extern Int32 TimerWheel_schedule(IntPtr wheelPtr, UInt32 kind, UInt32 key, UInt32 delayMs);
+
+        [DllImport("Network")]
+        public static extern Int32 TimerWheel_reschedule(IntPtr wheelPtr, Int32 handle, UInt32 delayMs);
+
+        [DllImport("Network")]
+        public static extern Int32 TimerWheel_cancel(IntPtr wheelPtr, Int32 handle);
+
+        [DllImport("Network")]
+        public static extern Int32 TimerWheel_advance(IntPtr wheelPtr, TimerFired * output, UInt32 max);
+
+        [DllImport("Network")]
+        public static extern UInt32 TimerWheel_pending(IntPtr wheelPtr);
+
+        [DllImport("Network")]
+        public static extern UInt64 TimerWheel_now();
+
+        [DllImport("Network")]
+        public static extern void TimerWheel_Destroy(IntPtr wheelPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr BroadcastRing_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 BroadcastRing_createRing(IntPtr ringPtr, string name, UInt32 slots, UInt32 slotSize);
+
+        [DllImport("Network")]
+        public static extern Int32 BroadcastRing_publish(IntPtr ringPtr, UInt32 tick, byte * data, UInt32 len);
+
+        [DllImport("Network")]
+        public static extern UInt64 BroadcastRing_head(IntPtr ringPtr);
+
+        [DllImport("Network")]
+        public static extern void BroadcastRing_Destroy(IntPtr ringPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr TickGovernor_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 TickGovernor_init(IntPtr governorPtr, UInt32 budgetUs);
+
+        [DllImport("Network")]
+        public static extern Int32 TickGovernor_addPhase(IntPtr governorPtr, UInt32 lane);
+
+        [DllImport("Network")]
+        public static extern Int32 TickGovernor_addStep(IntPtr governorPtr, UInt32 engagePercent, UInt32 releasePercent);
+
+        [DllImport("Network")]
+        public static extern Int32 TickGovernor_waitTick(IntPtr governorPtr, UInt32 lane);
+
+        [DllImport("Network")]
+        public static extern Int32 TickGovernor_beginTick(IntPtr governorPtr, UInt32 lane);
+
+        [DllImport("Network")]
+        public static extern void TickGovernor_mark(IntPtr governorPtr, UInt32 phase);
+
+        [DllImport("Network")]
+        public static extern UInt32 TickGovernor_level(IntPtr governorPtr);
+
+        [DllImport("Network")]
+        public static extern UInt32 TickGovernor_drainEvents(IntPtr governorPtr, GovernorEvent * output, UInt32 max);
+
+        [DllImport("Network")]
+        public static extern void TickGovernor_getStats(IntPtr governorPtr, GovernorStats * stats);
+
+        [DllImport("Network")]
+        public static extern void TickGovernor_Destroy(IntPtr governorPtr);
+
+        [DllImport("Network")]
+        public static extern IntPtr TerrainPack_Create();
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_build(IntPtr packPtr, byte * tiles, UInt32 width, UInt32 length,
+                                                     Int32 * fixedXZ, UInt32 fixedCount, byte * payload, UInt32 payloadSize);
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_save(IntPtr packPtr, string path);
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_open(IntPtr packPtr, string path);
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_occupied(IntPtr packPtr, Int32 x, Int32 z);
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_expandTiles(IntPtr packPtr, byte * tiles, UInt64 size);
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_getInfo(IntPtr packPtr, TerrainPackInfo * info);
+
+        [DllImport("Network")]
+        public static extern Int32 TerrainPack_copyPayload(IntPtr packPtr, byte * output, UInt32 size);
+
+        [DllImport("Network")]
+        public static extern void TerrainPack_Destroy(IntPtr packPtr);
+
+        [DllImport("Network")]
+        public static extern Int32 Sweep_bullets(IntPtr historyPtr, IntPtr packPtr, SweepBullet * bullets, SweepHit * hits, UInt32 count);
+
     }
 
 }
@@ -0,0 +1,91 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	Snapshot.cs -   A C# wrapper for the native packed snapshot codec
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		Pack(byte* tick, byte* output, Int32 outSize)
+--					Unpack(byte* packed, Int32 len, byte* tick, Int32 tickSize)
+--					Fit(byte* tick, UInt32 budget, out Int32 bullets, out Int32 weapons)
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - Fit, the events that keep a snapshot within a byte budget
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The server builds every snapshot in the fixed R.Net.Offset layout and packs it just before it
+--		is queued. A packed snapshot starts with R.Net.Header.PACKED_TICK, carries only the sections
+--		the header flags, and stores positions and rotation quantized. The native Client expands it
+--		back into the fixed layout on receive.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public static unsafe class Snapshot
+	{
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Pack
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Pack(byte* tick, byte* output, Int32 outSize)
+--								tick: a snapshot in the fixed layout, R.Net.Size.SERVER_TICK bytes
+--								output: receives the packed snapshot
+--								outSize: size of output; R.Net.Size.SERVER_TICK is always enough
+--
+-- RETURNS: the length to send, or -1 if tick is not a snapshot.
+--------------------------------------------------------------------------------------------------------------*/
+		public static Int32 Pack(byte* tick, byte* output, Int32 outSize)
+		{
+			return ServerLibrary.Snapshot_pack(tick, R.Net.Size.SERVER_TICK, output, Convert.ToUInt32(outSize));
+		}
+
+		public static Int32 Unpack(byte* packed, Int32 len, byte* tick, Int32 tickSize)
+		{
+			return ServerLibrary.Snapshot_unpack(packed, Convert.ToUInt32(len), tick, Convert.ToUInt32(tickSize));
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Fit
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool Fit(byte* tick, UInt32 budget, out Int32 bullets, out Int32 weapons)
+--								tick: a snapshot in the fixed layout, R.Net.Size.SERVER_TICK bytes
+--								budget: the most bytes it may pack to
+--								bullets: how many of its bullet events fit, oldest first
+--								weapons: how many of its weapon events fit, oldest first
+--
+-- RETURNS: false if tick is not a snapshot.
+--
+-- NOTES:
+-- 		The first event always fits, so a player's backlog drains however small their budget.
+--------------------------------------------------------------------------------------------------------------*/
+		public static bool Fit(byte* tick, UInt32 budget, out Int32 bullets, out Int32 weapons)
+		{
+			UInt32 fitBullets;
+			UInt32 fitWeapons;
+			Int32 result = ServerLibrary.Snapshot_fit(tick, R.Net.Size.SERVER_TICK, budget, &fitBullets, &fitWeapons);
+			bullets = (Int32)fitBullets;
+			weapons = (Int32)fitWeapons;
+			return result == 0;
+		}
+	}
+}
@@ -9,7 +9,7 @@ FUNCTIONS:		SpawnPointGenerator()
 
 DATE:			Mar. 14, 2018
 
-REVISIONS:
+REVISIONS:		Oct. 19, 2026 - One random generator per match, matches tick on several threads
 
 DESIGNER:		Benny Wang
 
@@ -24,7 +24,7 @@ using System.Collections.Generic;
 
 class SpawnPointGenerator
 {
-    private static Random rng = new Random();
+    private Random rng = new Random();
     private Stack<List<float>> spawnPoints;
 
     /************************************************************************************
@@ -0,0 +1,117 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	SpawnSampler.cs -   A C# wrapper class for the native weapon spawn sampler
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		SpawnSampler(Int32 width, Int32 length, Int32 spacing, UInt64 seed)
+--					BlockTerrain(byte[,] tiles)
+--					SetHotspots(Int32[] xz, Int32 cluster)
+--					SetTown(Int32[] xz)
+--					Sample(Int32 count, Int32 townCount, float hotspotChance, Int32 firstId, byte[] output)
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		SpawnSampler.cs wraps the native sampler InitRandomGuns uses to place weapons. Spots are
+--		passed as flat x, z pairs. Sample writes R.Init.INDWPNPCKT byte weapon records straight into
+--		the output array, in the layout GetWeaponFromBytes reads.
+---------------------------------------------------------------------------------------*/
+using System;
+
+namespace Networking
+{
+	public unsafe class SpawnSampler
+	{
+		private IntPtr sampler;
+
+		public SpawnSampler(Int32 width, Int32 length, Int32 spacing, UInt64 seed)
+		{
+			sampler = ServerLibrary.SpawnSampler_Create();
+			ServerLibrary.SpawnSampler_init(sampler, Convert.ToUInt32(width), Convert.ToUInt32(length), Convert.ToUInt32(spacing), seed);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: BlockTerrain
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void BlockTerrain(byte[,] tiles)
+--								tiles: TerrainController's tile grid, the same width and length as the sampler
+--
+-- NOTES:
+-- 		Buildings, cacti and bushes, plus the clearance TerrainController keeps around them, become off
+--		limits to weapons.
+--------------------------------------------------------------------------------------------------------------*/
+		public void BlockTerrain(byte[,] tiles)
+		{
+			fixed (byte* p = tiles)
+			{
+				ServerLibrary.SpawnSampler_blockTerrain(sampler, p);
+			}
+		}
+
+		public void SetHotspots(Int32[] xz, Int32 cluster)
+		{
+			fixed (Int32* p = xz)
+			{
+				ServerLibrary.SpawnSampler_setHotspots(sampler, p, Convert.ToUInt32(xz.Length / 2), Convert.ToUInt32(cluster));
+			}
+		}
+
+		public void SetTown(Int32[] xz)
+		{
+			fixed (Int32* p = xz)
+			{
+				ServerLibrary.SpawnSampler_setTown(sampler, p, Convert.ToUInt32(xz.Length / 2));
+			}
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Sample
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Sample(Int32 count, Int32 townCount, float hotspotChance, Int32 firstId, byte[] output)
+--								count: weapons to place
+--								townCount: how many to try on town spots first
+--								hotspotChance: chance each other weapon clusters around a hotspot
+--								firstId: id of the first weapon
+--								output: receives count * R.Init.INDWPNPCKT bytes
+--
+-- RETURNS: the number of weapons placed.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Sample(Int32 count, Int32 townCount, float hotspotChance, Int32 firstId, byte[] output)
+		{
+			fixed (byte* p = output)
+			{
+				return ServerLibrary.SpawnSampler_sample(sampler, Convert.ToUInt32(count), Convert.ToUInt32(townCount),
+					hotspotChance, firstId, p, Convert.ToUInt32(output.Length));
+			}
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.SpawnSampler_Destroy(sampler);
+			sampler = IntPtr.Zero;
+		}
+	}
+}
@@ -0,0 +1,87 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	Sweep.cs -   A C# wrapper for the native swept bullet collision
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		Run(PositionHistory history, TerrainPack pack, SweepBullet* bullets, SweepHit* hits,
+--						Int32 count)
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Each tick the game thread describes every bullet's movement over the tick and has it tested
+--		in one call: along the whole segment, against the players as the shooter saw them and against
+--		the terrain pack. A fast bullet can no longer pass through a player or an obstacle between
+--		two ticks, whatever the tick rate.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct SweepBullet
+	{
+		public float X;
+		public float Z;
+		public float DeltaX;
+		public float DeltaZ;
+		public float Radius;
+		public UInt32 Tick;
+		public Int32 Shooter;
+		public UInt32 Targets;
+	}
+
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct SweepHit
+	{
+		public UInt32 Kind;
+		public Int32 Id;
+		public float T;
+		public float X;
+		public float Z;
+	}
+
+	public static unsafe class Sweep
+	{
+		// SweepHit kinds, and the bits of SweepBullet.Targets
+		public const UInt32 NONE = 0;
+		public const UInt32 PLAYER = 1;
+		public const UInt32 TERRAIN = 2;
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Run
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Run(PositionHistory history, TerrainPack pack, SweepBullet* bullets, SweepHit* hits, Int32 count)
+--								history: player positions by snapshot tick
+--								pack: the match's terrain, or null to skip terrain
+--								bullets: each bullet's position, its movement this tick and what to test it against
+--								hits: receives each bullet's first hit, in the same order
+--								count: entries in bullets and hits
+--
+-- RETURNS: the number of bullets that hit something.
+--
+-- NOTES:
+-- 		A bullet that hits nothing has Kind NONE and its position at the end of the movement.
+--------------------------------------------------------------------------------------------------------------*/
+		public static Int32 Run(PositionHistory history, TerrainPack pack, SweepBullet* bullets, SweepHit* hits, Int32 count)
+		{
+			return ServerLibrary.Sweep_bullets(history.Pointer, pack == null ? IntPtr.Zero : pack.Pointer, bullets, hits,
+				Convert.ToUInt32(count));
+		}
+	}
+}
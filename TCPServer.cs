@@ -10,10 +10,11 @@ FUNCTIONS:		TCPServer()
 				Send()
 				CloseClientSocket()
 				CloseListenSocket()
+				SetEngine()
 
 DATE:			Mar. 14, 2018
 
-REVISIONS:
+REVISIONS:		Oct. 19, 2026 - SetEngine, close calls now pass the server pointer
 
 DESIGNER:		Delan Elliot, Wilson Hu, Jeremy Lee, Jeff Chou
 
@@ -31,6 +32,9 @@ namespace Networking
 	public unsafe class TCPServer
     {
 
+		public const Int32 ENGINE_SYSCALL = 0;
+		public const Int32 ENGINE_URING = 2;
+
 		private IntPtr tcpServer;
         private Int32 serverSocket;
 
@@ -210,7 +214,7 @@ namespace Networking
 		**********************************************************************************/
 		public Int32 CloseClientSocket(Int32 sockfd)
 		{
-				return ServerLibrary.TCPServer_closeClientSocket(sockfd);
+				return ServerLibrary.TCPServer_closeClientSocket(tcpServer, sockfd);
 		}
 
 		/************************************************************************************
@@ -237,9 +241,34 @@ namespace Networking
 		**********************************************************************************/
 		public Int32 CloseListenSocket(Int32 sockfd)
 		{
-            Int32 result = ServerLibrary.TCPServer_closeListenSocket(serverSocket);
+            Int32 result = ServerLibrary.TCPServer_closeListenSocket(tcpServer, serverSocket);
             return result;
 		}
 
+		/************************************************************************************
+		FUNCTION:	SetEngine
+
+		DATE:		Oct. 19, 2026
+
+		REVISIONS:
+
+		DESIGNER:	agent
+
+		PROGRAMMER:	agent
+
+		INTERFACE:	public Int32 SetEngine(Int32 engine)
+						Int32 engine: ENGINE_SYSCALL or ENGINE_URING
+
+		RETURNS:	Returns the engine actually in use.
+
+		NOTES:
+		This function is the C# wrapper for the library's TCPServer::setEngine
+		function. It must be called before the first AcceptConnection.
+		**********************************************************************************/
+		public Int32 SetEngine(Int32 engine)
+		{
+			return ServerLibrary.TCPServer_setEngine(tcpServer, engine);
+		}
+
 	}
 }
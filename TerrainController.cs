@@ -1,7 +1,5 @@
 using System;
 using System.Collections;
-using System.IO;
-using System.IO.Compression;
 using System.Collections.Generic;
 
 /*---------------------------------------------------------------------------------------
@@ -16,10 +14,15 @@ using System.Collections.Generic;
 --                  public byte[] decompressByteArray()
 --                  public void compressData()
 --                  public void LoadByteArray()
+--                  public bool IsOccupied(Bullet b)
+--                  public bool LoadPack(string path)
+--                  public bool SavePack(string path)
 --
 --	DATE:			Feb 16th, 2018
 --
 --	REVISIONS:		Feb 24th, 2018
+--					Oct 19th, 2026 - Native chunked compression in place of GZipStream
+--					Oct 19th, 2026 - Occupancy and the client payload live in a native terrain pack
 --
 --	DESIGNERS:		Angus Lam, Benny Wang, Roger Zhang
 --
@@ -76,7 +79,11 @@ public class TerrainController
     // Bush appearing percent
     public float BushPerc { get; set; }
 
-    private Dictionary<String, bool> occupiedPosition = new Dictionary<String, bool>();
+    // Obstacles, occupancy grid and compressed payload of the current map
+    private Networking.TerrainPack pack;
+
+    // The current map's terrain pack, for the bullet sweep
+    public Networking.TerrainPack Pack { get { return pack; } }
 
     /*-------------------------------------------------------------------------------------------------
     -- FUNCTION: TerrainController()
@@ -111,7 +118,7 @@ public class TerrainController
     --
     -- DATE: Feb 18, 2018
     --
-    -- REVISIONS: N/A
+    -- REVISIONS: Oct 19, 2026 - Builds a terrain pack instead of a dictionary of occupied positions
     --
     -- DESIGNER: Roger Zhang
     --
@@ -124,6 +131,8 @@ public class TerrainController
     -- NOTES:
     -- Generates an encoded 2D array with given width and height.
     -- Populates the map array with tile types based on given coefficients.
+    -- The map is compressed for clients and built into a terrain pack, which SavePack can keep for
+    -- later matches.
     -------------------------------------------------------------------------------------------------*/
     public bool GenerateEncoding()
     {
@@ -174,10 +183,9 @@ public class TerrainController
         }
 
         this.Data = new Encoding() { tiles = map };
-        populateOccupiedPosition();
         this.compressData();
 
-        return true;
+        return buildPack();
     }
 
     /*-------------------------------------------------------------------------------------------------
@@ -185,7 +193,7 @@ public class TerrainController
     --
     -- DATE: Jan 23, 2018
     --
-    -- REVISIONS: N/A
+    -- REVISIONS: Oct 19, 2026 - Copies the grid in one block instead of a byte at a time
     --
     -- DESIGNER: Benny Wang
     --
@@ -197,33 +205,19 @@ public class TerrainController
     --
     -- NOTES:
     -- Compresses whatever is inside the Data member variable of this class and places it into the
-    -- CompressedData member of this class.
+    -- CompressedData member of this class. The layout is the width and length as longs followed by
+    -- the tiles in row order.
     -------------------------------------------------------------------------------------------------*/
     private void compressData()
     {
-        byte[] tmp = { };
-        List<byte> compressed = new List<byte>();
+        int header = 2 * sizeof(long);
+        byte[] raw = new byte[header + this.Data.tiles.Length];
 
-        tmp = System.BitConverter.GetBytes(this.Width);
-        foreach (byte t in tmp)
-        {
-            compressed.Add(t);
-        }
-        tmp = System.BitConverter.GetBytes(this.Length);
-        foreach (byte t in tmp)
-        {
-            compressed.Add(t);
-        }
+        Buffer.BlockCopy(System.BitConverter.GetBytes(this.Width), 0, raw, 0, sizeof(long));
+        Buffer.BlockCopy(System.BitConverter.GetBytes(this.Length), 0, raw, sizeof(long), sizeof(long));
+        Buffer.BlockCopy(this.Data.tiles, 0, raw, header, this.Data.tiles.Length);
 
-        for (int i = 0; i < this.Data.tiles.GetLength(0); i++)
-        {
-            for (int j = 0; j < this.Data.tiles.GetLength(1); j++)
-            {
-                compressed.Add(this.Data.tiles[i, j]);
-            }
-        }
-
-        this.CompressedData = compressByteArray(compressed.ToArray());
+        this.CompressedData = compressByteArray(raw);
     }
 
     /*-------------------------------------------------------------------------------------------------
@@ -231,7 +225,7 @@ public class TerrainController
     --
     -- DATE: Feb 28, 2018
     --
-    -- REVISIONS: N/A
+    -- REVISIONS: Oct 19, 2026 - Native chunked compressor instead of GZipStream
     --
     -- DESIGNER: Roger Zhang
     --
@@ -243,17 +237,12 @@ public class TerrainController
     -- RETURNS: byte array of compressed data
     --
     -- NOTES:
-    -- Compress the byteArrayData to a smaller size using system I/O.
+    -- Compress the byteArrayData to a smaller size. The grid is mostly GROUND, which the chunked
+    -- compressor in libNetwork turns into a few bytes per run, on every core at once.
     -------------------------------------------------------------------------------------------------*/
     public static byte[] compressByteArray(byte[] data)
     {
-        using (var compressedStream = new MemoryStream())
-        using (var zipStream = new GZipStream(compressedStream, CompressionMode.Compress))
-        {
-            zipStream.Write(data, 0, data.Length);
-            zipStream.Close();
-            return compressedStream.ToArray();
-        }
+        return Networking.Compressor.Compress(data);
     }
 
     /*-------------------------------------------------------------------------------------------------
@@ -261,5499 +250,638 @@ public class TerrainController
     --
     -- DATE: April 10, 2018
     --
-    -- REVISIONS: N/A
+    -- REVISIONS: Oct 19, 2026 - One bit lookup in the terrain pack instead of a string key per call
     --
     -- DESIGNER: Angus Lam
     --
     -- PROGRAMMER: Angus Lam
     --
-    -- INTERFACE: IsOccupied(String coordinates)
-    --              String coordinates : The coordinates
+    -- INTERFACE: IsOccupied(Bullet b)
+    --              Bullet b : The bullet whose position is checked
     --
     -- RETURNS: Whether or not the position is occupied by a game object
     -------------------------------------------------------------------------------------------------*/
     public bool IsOccupied(Bullet b)
     {
-        return occupiedPosition.ContainsKey((int)b.X + "," + (int)b.Z);
+        return pack.Occupied((int)b.X, (int)b.Z);
     }
 
-    //This populates the occupied positions array using hard coded town coords and the map encoding
-    private void populateOccupiedPosition()
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: buildPack()
+    --
+    -- DATE: Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: agent
+    --
+    -- PROGRAMMER: agent
+    --
+    -- INTERFACE: buildPack()
+    --
+    -- RETURNS: true if the pack was built
+    --
+    -- NOTES:
+    -- Builds a terrain pack from the generated map: the occupancy grid covers the clearance around
+    -- every building, cactus and bush (5, 1 and 2 tiles) and the town, as occupiedPosition did.
+    -------------------------------------------------------------------------------------------------*/
+    private bool buildPack()
     {
-        int buildingRadius = 5;
-        int cactusRadius = 1;
-        int rockRadius = 2;
+        pack = new Networking.TerrainPack();
+        return pack.Build(this.Data.tiles, townOccupied, this.CompressedData);
+    }
 
-        for (int i = 0; i < R.Game.Terrain.DEFAULT_WIDTH; i++)
+    /*-------------------------------------------------------------------------------------------------
+    -- FUNCTION: LoadPack()
+    --
+    -- DATE: Oct 19, 2026
+    --
+    -- REVISIONS:
+    --
+    -- DESIGNER: agent
+    --
+    -- PROGRAMMER: agent
+    --
+    -- INTERFACE: LoadPack(string path)
+    --              string path : A pack written by SavePack
+    --
+    -- RETURNS: true if the pack was opened; false if it is missing or invalid, leaving nothing loaded
+    --
+    -- NOTES:
+    -- Takes the place of GenerateEncoding. The pack is mapped from disk, shared with every other match
+    -- on the host that opens it; only the tile grid and the payload are copied out, for weapon
+    -- placement and the clients.
+    -------------------------------------------------------------------------------------------------*/
+    public bool LoadPack(string path)
+    {
+        Networking.TerrainPack opened = new Networking.TerrainPack();
+        if (!opened.Open(path))
         {
-            for (int j = 0; j < R.Game.Terrain.DEFAULT_LENGTH; j++)
-            {
-                if (this.Data.tiles[i, j] == (byte)TileTypes.BUILDINGS)
-                {
-                    for (int k = i - buildingRadius; k <= i + buildingRadius; k++)
-                    {
-                        for (int m = j - buildingRadius; m <= j + buildingRadius; m++)
-                        {
-                            occupiedPosition[(k - 500) + "," + (m - 500)] = true;
-                        }
-                    }
-                }
-                else if (this.Data.tiles[i, j] == (byte)TileTypes.CACTUS)
-                {
-                    for (int k = i - cactusRadius; k <= i + cactusRadius; k++)
-                    {
-                        for (int m = j - cactusRadius; m <= j + cactusRadius; m++)
-                        {
-                            occupiedPosition[(k - 500) + "," + (m - 500)] = true;
-                        }
-                    }
-                }
-                else if (this.Data.tiles[i, j] == (byte)TileTypes.BUSH)
-                {
-                    for (int k = i - rockRadius; k <= i + rockRadius; k++)
-                    {
-                        for (int m = j - rockRadius; m <= j + rockRadius; m++)
-                        {
-                            occupiedPosition[(k - 500) + "," + (m - 500)] = true;
-                        }
-                    }
-                }
-            }
+            opened.Destroy();
+            return false;
         }
 
-        //Add the occupied positions from encoding
-        //Add the town
-        occupiedPosition["-65,-54"] = true;
-        occupiedPosition["-65,-53"] = true;
-        occupiedPosition["-65,-52"] = true;
-        occupiedPosition["-65,-51"] = true;
-        occupiedPosition["-65,-50"] = true;
-        occupiedPosition["-65,-49"] = true;
-        occupiedPosition["-65,-48"] = true;
-        occupiedPosition["-65,-46"] = true;
-        occupiedPosition["-65,-45"] = true;
-        occupiedPosition["-65,-44"] = true;
-        occupiedPosition["-65,-43"] = true;
-        occupiedPosition["-65,-42"] = true;
-        occupiedPosition["-65,-41"] = true;
-        occupiedPosition["-65,-40"] = true;
-        occupiedPosition["-65,-38"] = true;
-        occupiedPosition["-65,-36"] = true;
-        occupiedPosition["-65,-35"] = true;
-        occupiedPosition["-65,-34"] = true;
-        occupiedPosition["-65,-21"] = true;
-        occupiedPosition["-65,-20"] = true;
-        occupiedPosition["-65,-19"] = true;
-        occupiedPosition["-65,-18"] = true;
-        occupiedPosition["-65,-17"] = true;
-        occupiedPosition["-65,-16"] = true;
-        occupiedPosition["-65,-15"] = true;
-        occupiedPosition["-65,-14"] = true;
-        occupiedPosition["-65,-13"] = true;
-        occupiedPosition["-65,-12"] = true;
-        occupiedPosition["-65,-9"] = true;
-        occupiedPosition["-65,-7"] = true;
-        occupiedPosition["-65,-6"] = true;
-        occupiedPosition["-65,-5"] = true;
-        occupiedPosition["-65,-4"] = true;
-        occupiedPosition["-65,-3"] = true;
-        occupiedPosition["-65,-1"] = true;
-        occupiedPosition["-65,0"] = true;
-        occupiedPosition["-65,1"] = true;
-        occupiedPosition["-65,2"] = true;
-        occupiedPosition["-65,3"] = true;
-        occupiedPosition["-65,4"] = true;
-        occupiedPosition["-65,5"] = true;
-        occupiedPosition["-65,6"] = true;
-        occupiedPosition["-65,7"] = true;
-        occupiedPosition["-65,8"] = true;
-        occupiedPosition["-65,9"] = true;
-        occupiedPosition["-65,10"] = true;
-        occupiedPosition["-65,11"] = true;
-        occupiedPosition["-65,12"] = true;
-        occupiedPosition["-65,13"] = true;
-        occupiedPosition["-65,14"] = true;
-        occupiedPosition["-65,15"] = true;
-        occupiedPosition["-65,16"] = true;
-        occupiedPosition["-65,17"] = true;
-        occupiedPosition["-65,18"] = true;
-        occupiedPosition["-65,19"] = true;
-        occupiedPosition["-65,20"] = true;
-        occupiedPosition["-65,21"] = true;
-        occupiedPosition["-65,22"] = true;
-        occupiedPosition["-65,23"] = true;
-        occupiedPosition["-65,24"] = true;
-        occupiedPosition["-65,25"] = true;
-        occupiedPosition["-65,26"] = true;
-        occupiedPosition["-65,27"] = true;
-        occupiedPosition["-65,43"] = true;
-        occupiedPosition["-65,44"] = true;
-        occupiedPosition["-65,45"] = true;
-        occupiedPosition["-65,46"] = true;
-        occupiedPosition["-65,47"] = true;
-        occupiedPosition["-65,48"] = true;
-        occupiedPosition["-65,49"] = true;
-        occupiedPosition["-65,50"] = true;
-        occupiedPosition["-65,51"] = true;
-        occupiedPosition["-65,52"] = true;
-        occupiedPosition["-65,53"] = true;
-        occupiedPosition["-65,54"] = true;
-        occupiedPosition["-65,55"] = true;
-        occupiedPosition["-65,56"] = true;
-        occupiedPosition["-65,57"] = true;
-        occupiedPosition["-65,58"] = true;
-        occupiedPosition["-65,59"] = true;
-        occupiedPosition["-65,60"] = true;
-        occupiedPosition["-65,61"] = true;
-        occupiedPosition["-65,62"] = true;
-        occupiedPosition["-65,63"] = true;
-        occupiedPosition["-65,64"] = true;
-        occupiedPosition["-64,-56"] = true;
-        occupiedPosition["-64,-55"] = true;
-        occupiedPosition["-64,-54"] = true;
-        occupiedPosition["-64,-53"] = true;
-        occupiedPosition["-64,-51"] = true;
-        occupiedPosition["-64,-50"] = true;
-        occupiedPosition["-64,-49"] = true;
-        occupiedPosition["-64,-48"] = true;
-        occupiedPosition["-64,-46"] = true;
-        occupiedPosition["-64,-45"] = true;
-        occupiedPosition["-64,-43"] = true;
-        occupiedPosition["-64,-41"] = true;
-        occupiedPosition["-64,-40"] = true;
-        occupiedPosition["-64,-38"] = true;
-        occupiedPosition["-64,-35"] = true;
-        occupiedPosition["-64,-21"] = true;
-        occupiedPosition["-64,-20"] = true;
-        occupiedPosition["-64,-18"] = true;
-        occupiedPosition["-64,-17"] = true;
-        occupiedPosition["-64,-15"] = true;
-        occupiedPosition["-64,-13"] = true;
-        occupiedPosition["-64,-12"] = true;
-        occupiedPosition["-64,-6"] = true;
-        occupiedPosition["-64,-4"] = true;
-        occupiedPosition["-64,-3"] = true;
-        occupiedPosition["-64,-1"] = true;
-        occupiedPosition["-64,0"] = true;
-        occupiedPosition["-64,1"] = true;
-        occupiedPosition["-64,2"] = true;
-        occupiedPosition["-64,3"] = true;
-        occupiedPosition["-64,4"] = true;
-        occupiedPosition["-64,5"] = true;
-        occupiedPosition["-64,6"] = true;
-        occupiedPosition["-64,7"] = true;
-        occupiedPosition["-64,8"] = true;
-        occupiedPosition["-64,9"] = true;
-        occupiedPosition["-64,10"] = true;
-        occupiedPosition["-64,11"] = true;
-        occupiedPosition["-64,12"] = true;
-        occupiedPosition["-64,13"] = true;
-        occupiedPosition["-64,14"] = true;
-        occupiedPosition["-64,15"] = true;
-        occupiedPosition["-64,16"] = true;
-        occupiedPosition["-64,17"] = true;
-        occupiedPosition["-64,18"] = true;
-        occupiedPosition["-64,19"] = true;
-        occupiedPosition["-64,20"] = true;
-        occupiedPosition["-64,21"] = true;
-        occupiedPosition["-64,22"] = true;
-        occupiedPosition["-64,23"] = true;
-        occupiedPosition["-64,24"] = true;
-        occupiedPosition["-64,25"] = true;
-        occupiedPosition["-64,26"] = true;
-        occupiedPosition["-64,27"] = true;
-        occupiedPosition["-64,28"] = true;
-        occupiedPosition["-64,38"] = true;
-        occupiedPosition["-64,39"] = true;
-        occupiedPosition["-64,43"] = true;
-        occupiedPosition["-64,44"] = true;
-        occupiedPosition["-64,45"] = true;
-        occupiedPosition["-64,46"] = true;
-        occupiedPosition["-64,47"] = true;
-        occupiedPosition["-64,48"] = true;
-        occupiedPosition["-64,49"] = true;
-        occupiedPosition["-64,50"] = true;
-        occupiedPosition["-64,51"] = true;
-        occupiedPosition["-64,52"] = true;
-        occupiedPosition["-64,53"] = true;
-        occupiedPosition["-64,54"] = true;
-        occupiedPosition["-64,55"] = true;
-        occupiedPosition["-64,56"] = true;
-        occupiedPosition["-64,57"] = true;
-        occupiedPosition["-64,58"] = true;
-        occupiedPosition["-64,59"] = true;
-        occupiedPosition["-64,60"] = true;
-        occupiedPosition["-64,61"] = true;
-        occupiedPosition["-64,62"] = true;
-        occupiedPosition["-64,63"] = true;
-        occupiedPosition["-64,64"] = true;
-        occupiedPosition["-63,-1"] = true;
-        occupiedPosition["-63,0"] = true;
-        occupiedPosition["-63,25"] = true;
-        occupiedPosition["-63,26"] = true;
-        occupiedPosition["-63,37"] = true;
-        occupiedPosition["-63,38"] = true;
-        occupiedPosition["-63,39"] = true;
-        occupiedPosition["-63,43"] = true;
-        occupiedPosition["-63,44"] = true;
-        occupiedPosition["-63,64"] = true;
-        occupiedPosition["-62,-1"] = true;
-        occupiedPosition["-62,0"] = true;
-        occupiedPosition["-62,1"] = true;
-        occupiedPosition["-62,6"] = true;
-        occupiedPosition["-62,7"] = true;
-        occupiedPosition["-62,26"] = true;
-        occupiedPosition["-62,38"] = true;
-        occupiedPosition["-62,39"] = true;
-        occupiedPosition["-62,42"] = true;
-        occupiedPosition["-62,43"] = true;
-        occupiedPosition["-62,44"] = true;
-        occupiedPosition["-62,45"] = true;
-        occupiedPosition["-62,48"] = true;
-        occupiedPosition["-62,49"] = true;
-        occupiedPosition["-62,50"] = true;
-        occupiedPosition["-62,63"] = true;
-        occupiedPosition["-62,64"] = true;
-        occupiedPosition["-61,-56"] = true;
-        occupiedPosition["-61,-55"] = true;
-        occupiedPosition["-61,-53"] = true;
-        occupiedPosition["-61,-52"] = true;
-        occupiedPosition["-61,-51"] = true;
-        occupiedPosition["-61,-40"] = true;
-        occupiedPosition["-61,-39"] = true;
-        occupiedPosition["-61,-38"] = true;
-        occupiedPosition["-61,-37"] = true;
-        occupiedPosition["-61,-30"] = true;
-        occupiedPosition["-61,-29"] = true;
-        occupiedPosition["-61,-28"] = true;
-        occupiedPosition["-61,-27"] = true;
-        occupiedPosition["-61,-24"] = true;
-        occupiedPosition["-61,-23"] = true;
-        occupiedPosition["-61,-22"] = true;
-        occupiedPosition["-61,-1"] = true;
-        occupiedPosition["-61,0"] = true;
-        occupiedPosition["-61,1"] = true;
-        occupiedPosition["-61,5"] = true;
-        occupiedPosition["-61,6"] = true;
-        occupiedPosition["-61,7"] = true;
-        occupiedPosition["-61,8"] = true;
-        occupiedPosition["-61,11"] = true;
-        occupiedPosition["-61,12"] = true;
-        occupiedPosition["-61,13"] = true;
-        occupiedPosition["-61,14"] = true;
-        occupiedPosition["-61,15"] = true;
-        occupiedPosition["-61,16"] = true;
-        occupiedPosition["-61,17"] = true;
-        occupiedPosition["-61,18"] = true;
-        occupiedPosition["-61,19"] = true;
-        occupiedPosition["-61,20"] = true;
-        occupiedPosition["-61,21"] = true;
-        occupiedPosition["-61,22"] = true;
-        occupiedPosition["-61,23"] = true;
-        occupiedPosition["-61,24"] = true;
-        occupiedPosition["-61,42"] = true;
-        occupiedPosition["-61,43"] = true;
-        occupiedPosition["-61,44"] = true;
-        occupiedPosition["-61,45"] = true;
-        occupiedPosition["-61,48"] = true;
-        occupiedPosition["-61,49"] = true;
-        occupiedPosition["-61,50"] = true;
-        occupiedPosition["-61,51"] = true;
-        occupiedPosition["-61,52"] = true;
-        occupiedPosition["-61,53"] = true;
-        occupiedPosition["-61,54"] = true;
-        occupiedPosition["-61,55"] = true;
-        occupiedPosition["-61,56"] = true;
-        occupiedPosition["-61,57"] = true;
-        occupiedPosition["-61,58"] = true;
-        occupiedPosition["-61,63"] = true;
-        occupiedPosition["-61,64"] = true;
-        occupiedPosition["-60,-56"] = true;
-        occupiedPosition["-60,-55"] = true;
-        occupiedPosition["-60,-40"] = true;
-        occupiedPosition["-60,-39"] = true;
-        occupiedPosition["-60,-38"] = true;
-        occupiedPosition["-60,-37"] = true;
-        occupiedPosition["-60,-29"] = true;
-        occupiedPosition["-60,-28"] = true;
-        occupiedPosition["-60,-24"] = true;
-        occupiedPosition["-60,-23"] = true;
-        occupiedPosition["-60,-22"] = true;
-        occupiedPosition["-60,-5"] = true;
-        occupiedPosition["-60,-4"] = true;
-        occupiedPosition["-60,-1"] = true;
-        occupiedPosition["-60,0"] = true;
-        occupiedPosition["-60,1"] = true;
-        occupiedPosition["-60,5"] = true;
-        occupiedPosition["-60,6"] = true;
-        occupiedPosition["-60,7"] = true;
-        occupiedPosition["-60,8"] = true;
-        occupiedPosition["-60,11"] = true;
-        occupiedPosition["-60,12"] = true;
-        occupiedPosition["-60,13"] = true;
-        occupiedPosition["-60,14"] = true;
-        occupiedPosition["-60,15"] = true;
-        occupiedPosition["-60,16"] = true;
-        occupiedPosition["-60,17"] = true;
-        occupiedPosition["-60,18"] = true;
-        occupiedPosition["-60,19"] = true;
-        occupiedPosition["-60,20"] = true;
-        occupiedPosition["-60,21"] = true;
-        occupiedPosition["-60,22"] = true;
-        occupiedPosition["-60,23"] = true;
-        occupiedPosition["-60,24"] = true;
-        occupiedPosition["-60,43"] = true;
-        occupiedPosition["-60,44"] = true;
-        occupiedPosition["-60,48"] = true;
-        occupiedPosition["-60,49"] = true;
-        occupiedPosition["-60,50"] = true;
-        occupiedPosition["-60,51"] = true;
-        occupiedPosition["-60,52"] = true;
-        occupiedPosition["-60,53"] = true;
-        occupiedPosition["-60,54"] = true;
-        occupiedPosition["-60,55"] = true;
-        occupiedPosition["-60,56"] = true;
-        occupiedPosition["-60,57"] = true;
-        occupiedPosition["-60,58"] = true;
-        occupiedPosition["-60,64"] = true;
-        occupiedPosition["-59,-56"] = true;
-        occupiedPosition["-59,-55"] = true;
-        occupiedPosition["-59,-39"] = true;
-        occupiedPosition["-59,-6"] = true;
-        occupiedPosition["-59,-5"] = true;
-        occupiedPosition["-59,-4"] = true;
-        occupiedPosition["-59,-3"] = true;
-        occupiedPosition["-59,-1"] = true;
-        occupiedPosition["-59,0"] = true;
-        occupiedPosition["-59,1"] = true;
-        occupiedPosition["-59,6"] = true;
-        occupiedPosition["-59,7"] = true;
-        occupiedPosition["-59,11"] = true;
-        occupiedPosition["-59,12"] = true;
-        occupiedPosition["-59,23"] = true;
-        occupiedPosition["-59,24"] = true;
-        occupiedPosition["-59,51"] = true;
-        occupiedPosition["-59,52"] = true;
-        occupiedPosition["-59,57"] = true;
-        occupiedPosition["-59,58"] = true;
-        occupiedPosition["-59,63"] = true;
-        occupiedPosition["-59,64"] = true;
-        occupiedPosition["-58,-56"] = true;
-        occupiedPosition["-58,-55"] = true;
-        occupiedPosition["-58,-6"] = true;
-        occupiedPosition["-58,-5"] = true;
-        occupiedPosition["-58,-4"] = true;
-        occupiedPosition["-58,-3"] = true;
-        occupiedPosition["-58,-1"] = true;
-        occupiedPosition["-58,0"] = true;
-        occupiedPosition["-58,1"] = true;
-        occupiedPosition["-58,11"] = true;
-        occupiedPosition["-58,12"] = true;
-        occupiedPosition["-58,23"] = true;
-        occupiedPosition["-58,24"] = true;
-        occupiedPosition["-58,50"] = true;
-        occupiedPosition["-58,51"] = true;
-        occupiedPosition["-58,57"] = true;
-        occupiedPosition["-58,58"] = true;
-        occupiedPosition["-58,64"] = true;
-        occupiedPosition["-57,-56"] = true;
-        occupiedPosition["-57,-55"] = true;
-        occupiedPosition["-57,-5"] = true;
-        occupiedPosition["-57,-4"] = true;
-        occupiedPosition["-57,-1"] = true;
-        occupiedPosition["-57,0"] = true;
-        occupiedPosition["-57,1"] = true;
-        occupiedPosition["-57,11"] = true;
-        occupiedPosition["-57,12"] = true;
-        occupiedPosition["-57,23"] = true;
-        occupiedPosition["-57,24"] = true;
-        occupiedPosition["-57,47"] = true;
-        occupiedPosition["-57,48"] = true;
-        occupiedPosition["-57,49"] = true;
-        occupiedPosition["-57,50"] = true;
-        occupiedPosition["-57,51"] = true;
-        occupiedPosition["-57,57"] = true;
-        occupiedPosition["-57,58"] = true;
-        occupiedPosition["-57,63"] = true;
-        occupiedPosition["-57,64"] = true;
-        occupiedPosition["-56,-56"] = true;
-        occupiedPosition["-56,-55"] = true;
-        occupiedPosition["-56,-51"] = true;
-        occupiedPosition["-56,-50"] = true;
-        occupiedPosition["-56,-49"] = true;
-        occupiedPosition["-56,-48"] = true;
-        occupiedPosition["-56,-47"] = true;
-        occupiedPosition["-56,-46"] = true;
-        occupiedPosition["-56,-45"] = true;
-        occupiedPosition["-56,-44"] = true;
-        occupiedPosition["-56,-43"] = true;
-        occupiedPosition["-56,-42"] = true;
-        occupiedPosition["-56,-41"] = true;
-        occupiedPosition["-56,-40"] = true;
-        occupiedPosition["-56,-39"] = true;
-        occupiedPosition["-56,-38"] = true;
-        occupiedPosition["-56,-37"] = true;
-        occupiedPosition["-56,-1"] = true;
-        occupiedPosition["-56,0"] = true;
-        occupiedPosition["-56,1"] = true;
-        occupiedPosition["-56,11"] = true;
-        occupiedPosition["-56,12"] = true;
-        occupiedPosition["-56,23"] = true;
-        occupiedPosition["-56,24"] = true;
-        occupiedPosition["-56,47"] = true;
-        occupiedPosition["-56,48"] = true;
-        occupiedPosition["-56,49"] = true;
-        occupiedPosition["-56,50"] = true;
-        occupiedPosition["-56,51"] = true;
-        occupiedPosition["-56,57"] = true;
-        occupiedPosition["-56,58"] = true;
-        occupiedPosition["-56,63"] = true;
-        occupiedPosition["-56,64"] = true;
-        occupiedPosition["-55,-56"] = true;
-        occupiedPosition["-55,-55"] = true;
-        occupiedPosition["-55,-51"] = true;
-        occupiedPosition["-55,-50"] = true;
-        occupiedPosition["-55,-49"] = true;
-        occupiedPosition["-55,-48"] = true;
-        occupiedPosition["-55,-47"] = true;
-        occupiedPosition["-55,-46"] = true;
-        occupiedPosition["-55,-45"] = true;
-        occupiedPosition["-55,-44"] = true;
-        occupiedPosition["-55,-43"] = true;
-        occupiedPosition["-55,-42"] = true;
-        occupiedPosition["-55,-41"] = true;
-        occupiedPosition["-55,-40"] = true;
-        occupiedPosition["-55,-39"] = true;
-        occupiedPosition["-55,-38"] = true;
-        occupiedPosition["-55,-37"] = true;
-        occupiedPosition["-55,-29"] = true;
-        occupiedPosition["-55,-28"] = true;
-        occupiedPosition["-55,-27"] = true;
-        occupiedPosition["-55,-26"] = true;
-        occupiedPosition["-55,-25"] = true;
-        occupiedPosition["-55,-24"] = true;
-        occupiedPosition["-55,-23"] = true;
-        occupiedPosition["-55,-22"] = true;
-        occupiedPosition["-55,-21"] = true;
-        occupiedPosition["-55,-20"] = true;
-        occupiedPosition["-55,-19"] = true;
-        occupiedPosition["-55,-18"] = true;
-        occupiedPosition["-55,-15"] = true;
-        occupiedPosition["-55,-14"] = true;
-        occupiedPosition["-55,-13"] = true;
-        occupiedPosition["-55,-1"] = true;
-        occupiedPosition["-55,0"] = true;
-        occupiedPosition["-55,1"] = true;
-        occupiedPosition["-55,11"] = true;
-        occupiedPosition["-55,12"] = true;
-        occupiedPosition["-55,23"] = true;
-        occupiedPosition["-55,24"] = true;
-        occupiedPosition["-55,47"] = true;
-        occupiedPosition["-55,48"] = true;
-        occupiedPosition["-55,50"] = true;
-        occupiedPosition["-55,51"] = true;
-        occupiedPosition["-55,57"] = true;
-        occupiedPosition["-55,58"] = true;
-        occupiedPosition["-55,64"] = true;
-        occupiedPosition["-54,-56"] = true;
-        occupiedPosition["-54,-55"] = true;
-        occupiedPosition["-54,-51"] = true;
-        occupiedPosition["-54,-50"] = true;
-        occupiedPosition["-54,-38"] = true;
-        occupiedPosition["-54,-37"] = true;
-        occupiedPosition["-54,-29"] = true;
-        occupiedPosition["-54,-28"] = true;
-        occupiedPosition["-54,-27"] = true;
-        occupiedPosition["-54,-26"] = true;
-        occupiedPosition["-54,-25"] = true;
-        occupiedPosition["-54,-24"] = true;
-        occupiedPosition["-54,-23"] = true;
-        occupiedPosition["-54,-22"] = true;
-        occupiedPosition["-54,-21"] = true;
-        occupiedPosition["-54,-20"] = true;
-        occupiedPosition["-54,-19"] = true;
-        occupiedPosition["-54,-18"] = true;
-        occupiedPosition["-54,-15"] = true;
-        occupiedPosition["-54,-14"] = true;
-        occupiedPosition["-54,-13"] = true;
-        occupiedPosition["-54,-12"] = true;
-        occupiedPosition["-54,-11"] = true;
-        occupiedPosition["-54,-10"] = true;
-        occupiedPosition["-54,-9"] = true;
-        occupiedPosition["-54,-8"] = true;
-        occupiedPosition["-54,-7"] = true;
-        occupiedPosition["-54,-6"] = true;
-        occupiedPosition["-54,-5"] = true;
-        occupiedPosition["-54,-4"] = true;
-        occupiedPosition["-54,-1"] = true;
-        occupiedPosition["-54,0"] = true;
-        occupiedPosition["-54,1"] = true;
-        occupiedPosition["-54,11"] = true;
-        occupiedPosition["-54,12"] = true;
-        occupiedPosition["-54,13"] = true;
-        occupiedPosition["-54,14"] = true;
-        occupiedPosition["-54,15"] = true;
-        occupiedPosition["-54,16"] = true;
-        occupiedPosition["-54,17"] = true;
-        occupiedPosition["-54,18"] = true;
-        occupiedPosition["-54,19"] = true;
-        occupiedPosition["-54,20"] = true;
-        occupiedPosition["-54,23"] = true;
-        occupiedPosition["-54,24"] = true;
-        occupiedPosition["-54,47"] = true;
-        occupiedPosition["-54,48"] = true;
-        occupiedPosition["-54,50"] = true;
-        occupiedPosition["-54,51"] = true;
-        occupiedPosition["-54,57"] = true;
-        occupiedPosition["-54,58"] = true;
-        occupiedPosition["-54,64"] = true;
-        occupiedPosition["-53,-56"] = true;
-        occupiedPosition["-53,-55"] = true;
-        occupiedPosition["-53,-51"] = true;
-        occupiedPosition["-53,-50"] = true;
-        occupiedPosition["-53,-38"] = true;
-        occupiedPosition["-53,-37"] = true;
-        occupiedPosition["-53,-29"] = true;
-        occupiedPosition["-53,-28"] = true;
-        occupiedPosition["-53,-19"] = true;
-        occupiedPosition["-53,-18"] = true;
-        occupiedPosition["-53,-14"] = true;
-        occupiedPosition["-53,-13"] = true;
-        occupiedPosition["-53,-12"] = true;
-        occupiedPosition["-53,-11"] = true;
-        occupiedPosition["-53,-10"] = true;
-        occupiedPosition["-53,-9"] = true;
-        occupiedPosition["-53,-8"] = true;
-        occupiedPosition["-53,-7"] = true;
-        occupiedPosition["-53,-6"] = true;
-        occupiedPosition["-53,-5"] = true;
-        occupiedPosition["-53,-4"] = true;
-        occupiedPosition["-53,-1"] = true;
-        occupiedPosition["-53,0"] = true;
-        occupiedPosition["-53,1"] = true;
-        occupiedPosition["-53,11"] = true;
-        occupiedPosition["-53,12"] = true;
-        occupiedPosition["-53,13"] = true;
-        occupiedPosition["-53,14"] = true;
-        occupiedPosition["-53,15"] = true;
-        occupiedPosition["-53,16"] = true;
-        occupiedPosition["-53,17"] = true;
-        occupiedPosition["-53,18"] = true;
-        occupiedPosition["-53,19"] = true;
-        occupiedPosition["-53,20"] = true;
-        occupiedPosition["-53,23"] = true;
-        occupiedPosition["-53,24"] = true;
-        occupiedPosition["-53,47"] = true;
-        occupiedPosition["-53,48"] = true;
-        occupiedPosition["-53,49"] = true;
-        occupiedPosition["-53,50"] = true;
-        occupiedPosition["-53,51"] = true;
-        occupiedPosition["-53,57"] = true;
-        occupiedPosition["-53,58"] = true;
-        occupiedPosition["-53,63"] = true;
-        occupiedPosition["-53,64"] = true;
-        occupiedPosition["-52,-56"] = true;
-        occupiedPosition["-52,-55"] = true;
-        occupiedPosition["-52,-51"] = true;
-        occupiedPosition["-52,-50"] = true;
-        occupiedPosition["-52,-38"] = true;
-        occupiedPosition["-52,-37"] = true;
-        occupiedPosition["-52,-29"] = true;
-        occupiedPosition["-52,-28"] = true;
-        occupiedPosition["-52,-19"] = true;
-        occupiedPosition["-52,-18"] = true;
-        occupiedPosition["-52,-14"] = true;
-        occupiedPosition["-52,-13"] = true;
-        occupiedPosition["-52,-12"] = true;
-        occupiedPosition["-52,-11"] = true;
-        occupiedPosition["-52,-5"] = true;
-        occupiedPosition["-52,-4"] = true;
-        occupiedPosition["-52,-1"] = true;
-        occupiedPosition["-52,0"] = true;
-        occupiedPosition["-52,1"] = true;
-        occupiedPosition["-52,10"] = true;
-        occupiedPosition["-52,11"] = true;
-        occupiedPosition["-52,12"] = true;
-        occupiedPosition["-52,13"] = true;
-        occupiedPosition["-52,15"] = true;
-        occupiedPosition["-52,16"] = true;
-        occupiedPosition["-52,19"] = true;
-        occupiedPosition["-52,20"] = true;
-        occupiedPosition["-52,23"] = true;
-        occupiedPosition["-52,24"] = true;
-        occupiedPosition["-52,47"] = true;
-        occupiedPosition["-52,48"] = true;
-        occupiedPosition["-52,49"] = true;
-        occupiedPosition["-52,50"] = true;
-        occupiedPosition["-52,51"] = true;
-        occupiedPosition["-52,57"] = true;
-        occupiedPosition["-52,58"] = true;
-        occupiedPosition["-52,63"] = true;
-        occupiedPosition["-52,64"] = true;
-        occupiedPosition["-51,-56"] = true;
-        occupiedPosition["-51,-55"] = true;
-        occupiedPosition["-51,-51"] = true;
-        occupiedPosition["-51,-50"] = true;
-        occupiedPosition["-51,-38"] = true;
-        occupiedPosition["-51,-37"] = true;
-        occupiedPosition["-51,-29"] = true;
-        occupiedPosition["-51,-28"] = true;
-        occupiedPosition["-51,-27"] = true;
-        occupiedPosition["-51,-26"] = true;
-        occupiedPosition["-51,-25"] = true;
-        occupiedPosition["-51,-19"] = true;
-        occupiedPosition["-51,-18"] = true;
-        occupiedPosition["-51,-12"] = true;
-        occupiedPosition["-51,-11"] = true;
-        occupiedPosition["-51,-5"] = true;
-        occupiedPosition["-51,-4"] = true;
-        occupiedPosition["-51,-1"] = true;
-        occupiedPosition["-51,0"] = true;
-        occupiedPosition["-51,1"] = true;
-        occupiedPosition["-51,10"] = true;
-        occupiedPosition["-51,11"] = true;
-        occupiedPosition["-51,12"] = true;
-        occupiedPosition["-51,13"] = true;
-        occupiedPosition["-51,15"] = true;
-        occupiedPosition["-51,16"] = true;
-        occupiedPosition["-51,19"] = true;
-        occupiedPosition["-51,20"] = true;
-        occupiedPosition["-51,21"] = true;
-        occupiedPosition["-51,22"] = true;
-        occupiedPosition["-51,23"] = true;
-        occupiedPosition["-51,24"] = true;
-        occupiedPosition["-51,50"] = true;
-        occupiedPosition["-51,51"] = true;
-        occupiedPosition["-51,57"] = true;
-        occupiedPosition["-51,58"] = true;
-        occupiedPosition["-51,59"] = true;
-        occupiedPosition["-51,60"] = true;
-        occupiedPosition["-51,61"] = true;
-        occupiedPosition["-51,64"] = true;
-        occupiedPosition["-50,-56"] = true;
-        occupiedPosition["-50,-55"] = true;
-        occupiedPosition["-50,-51"] = true;
-        occupiedPosition["-50,-50"] = true;
-        occupiedPosition["-50,-38"] = true;
-        occupiedPosition["-50,-37"] = true;
-        occupiedPosition["-50,-29"] = true;
-        occupiedPosition["-50,-28"] = true;
-        occupiedPosition["-50,-27"] = true;
-        occupiedPosition["-50,-26"] = true;
-        occupiedPosition["-50,-25"] = true;
-        occupiedPosition["-50,-19"] = true;
-        occupiedPosition["-50,-18"] = true;
-        occupiedPosition["-50,-14"] = true;
-        occupiedPosition["-50,-13"] = true;
-        occupiedPosition["-50,-12"] = true;
-        occupiedPosition["-50,-11"] = true;
-        occupiedPosition["-50,-5"] = true;
-        occupiedPosition["-50,-4"] = true;
-        occupiedPosition["-50,-1"] = true;
-        occupiedPosition["-50,0"] = true;
-        occupiedPosition["-50,1"] = true;
-        occupiedPosition["-50,10"] = true;
-        occupiedPosition["-50,11"] = true;
-        occupiedPosition["-50,19"] = true;
-        occupiedPosition["-50,20"] = true;
-        occupiedPosition["-50,21"] = true;
-        occupiedPosition["-50,22"] = true;
-        occupiedPosition["-50,23"] = true;
-        occupiedPosition["-50,24"] = true;
-        occupiedPosition["-50,41"] = true;
-        occupiedPosition["-50,42"] = true;
-        occupiedPosition["-50,43"] = true;
-        occupiedPosition["-50,50"] = true;
-        occupiedPosition["-50,51"] = true;
-        occupiedPosition["-50,57"] = true;
-        occupiedPosition["-50,58"] = true;
-        occupiedPosition["-50,59"] = true;
-        occupiedPosition["-50,60"] = true;
-        occupiedPosition["-50,61"] = true;
-        occupiedPosition["-50,63"] = true;
-        occupiedPosition["-50,64"] = true;
-        occupiedPosition["-49,-56"] = true;
-        occupiedPosition["-49,-55"] = true;
-        occupiedPosition["-49,-51"] = true;
-        occupiedPosition["-49,-50"] = true;
-        occupiedPosition["-49,-38"] = true;
-        occupiedPosition["-49,-37"] = true;
-        occupiedPosition["-49,-26"] = true;
-        occupiedPosition["-49,-25"] = true;
-        occupiedPosition["-49,-19"] = true;
-        occupiedPosition["-49,-18"] = true;
-        occupiedPosition["-49,-14"] = true;
-        occupiedPosition["-49,-13"] = true;
-        occupiedPosition["-49,-12"] = true;
-        occupiedPosition["-49,-11"] = true;
-        occupiedPosition["-49,-5"] = true;
-        occupiedPosition["-49,-4"] = true;
-        occupiedPosition["-49,-1"] = true;
-        occupiedPosition["-49,0"] = true;
-        occupiedPosition["-49,1"] = true;
-        occupiedPosition["-49,40"] = true;
-        occupiedPosition["-49,41"] = true;
-        occupiedPosition["-49,42"] = true;
-        occupiedPosition["-49,43"] = true;
-        occupiedPosition["-49,50"] = true;
-        occupiedPosition["-49,51"] = true;
-        occupiedPosition["-49,52"] = true;
-        occupiedPosition["-49,53"] = true;
-        occupiedPosition["-49,54"] = true;
-        occupiedPosition["-49,55"] = true;
-        occupiedPosition["-49,56"] = true;
-        occupiedPosition["-49,57"] = true;
-        occupiedPosition["-49,58"] = true;
-        occupiedPosition["-49,59"] = true;
-        occupiedPosition["-49,60"] = true;
-        occupiedPosition["-49,61"] = true;
-        occupiedPosition["-49,64"] = true;
-        occupiedPosition["-48,-56"] = true;
-        occupiedPosition["-48,-55"] = true;
-        occupiedPosition["-48,-51"] = true;
-        occupiedPosition["-48,-50"] = true;
-        occupiedPosition["-48,-38"] = true;
-        occupiedPosition["-48,-37"] = true;
-        occupiedPosition["-48,-26"] = true;
-        occupiedPosition["-48,-25"] = true;
-        occupiedPosition["-48,-19"] = true;
-        occupiedPosition["-48,-18"] = true;
-        occupiedPosition["-48,-12"] = true;
-        occupiedPosition["-48,-11"] = true;
-        occupiedPosition["-48,-5"] = true;
-        occupiedPosition["-48,-4"] = true;
-        occupiedPosition["-48,-1"] = true;
-        occupiedPosition["-48,0"] = true;
-        occupiedPosition["-48,1"] = true;
-        occupiedPosition["-48,41"] = true;
-        occupiedPosition["-48,42"] = true;
-        occupiedPosition["-48,43"] = true;
-        occupiedPosition["-48,50"] = true;
-        occupiedPosition["-48,51"] = true;
-        occupiedPosition["-48,52"] = true;
-        occupiedPosition["-48,53"] = true;
-        occupiedPosition["-48,54"] = true;
-        occupiedPosition["-48,55"] = true;
-        occupiedPosition["-48,56"] = true;
-        occupiedPosition["-48,57"] = true;
-        occupiedPosition["-48,58"] = true;
-        occupiedPosition["-48,63"] = true;
-        occupiedPosition["-48,64"] = true;
-        occupiedPosition["-47,-56"] = true;
-        occupiedPosition["-47,-55"] = true;
-        occupiedPosition["-47,-51"] = true;
-        occupiedPosition["-47,-50"] = true;
-        occupiedPosition["-47,-38"] = true;
-        occupiedPosition["-47,-37"] = true;
-        occupiedPosition["-47,-26"] = true;
-        occupiedPosition["-47,-25"] = true;
-        occupiedPosition["-47,-19"] = true;
-        occupiedPosition["-47,-18"] = true;
-        occupiedPosition["-47,-12"] = true;
-        occupiedPosition["-47,-11"] = true;
-        occupiedPosition["-47,-5"] = true;
-        occupiedPosition["-47,-4"] = true;
-        occupiedPosition["-47,-1"] = true;
-        occupiedPosition["-47,0"] = true;
-        occupiedPosition["-47,1"] = true;
-        occupiedPosition["-47,10"] = true;
-        occupiedPosition["-47,11"] = true;
-        occupiedPosition["-47,12"] = true;
-        occupiedPosition["-47,13"] = true;
-        occupiedPosition["-47,14"] = true;
-        occupiedPosition["-47,15"] = true;
-        occupiedPosition["-47,16"] = true;
-        occupiedPosition["-47,17"] = true;
-        occupiedPosition["-47,18"] = true;
-        occupiedPosition["-47,19"] = true;
-        occupiedPosition["-47,20"] = true;
-        occupiedPosition["-47,21"] = true;
-        occupiedPosition["-47,22"] = true;
-        occupiedPosition["-47,23"] = true;
-        occupiedPosition["-47,24"] = true;
-        occupiedPosition["-47,52"] = true;
-        occupiedPosition["-47,53"] = true;
-        occupiedPosition["-47,54"] = true;
-        occupiedPosition["-47,63"] = true;
-        occupiedPosition["-47,64"] = true;
-        occupiedPosition["-46,-56"] = true;
-        occupiedPosition["-46,-55"] = true;
-        occupiedPosition["-46,-54"] = true;
-        occupiedPosition["-46,-53"] = true;
-        occupiedPosition["-46,-52"] = true;
-        occupiedPosition["-46,-51"] = true;
-        occupiedPosition["-46,-50"] = true;
-        occupiedPosition["-46,-38"] = true;
-        occupiedPosition["-46,-37"] = true;
-        occupiedPosition["-46,-26"] = true;
-        occupiedPosition["-46,-25"] = true;
-        occupiedPosition["-46,-19"] = true;
-        occupiedPosition["-46,-18"] = true;
-        occupiedPosition["-46,-15"] = true;
-        occupiedPosition["-46,-14"] = true;
-        occupiedPosition["-46,-13"] = true;
-        occupiedPosition["-46,-12"] = true;
-        occupiedPosition["-46,-11"] = true;
-        occupiedPosition["-46,-5"] = true;
-        occupiedPosition["-46,-4"] = true;
-        occupiedPosition["-46,-1"] = true;
-        occupiedPosition["-46,0"] = true;
-        occupiedPosition["-46,1"] = true;
-        occupiedPosition["-46,10"] = true;
-        occupiedPosition["-46,11"] = true;
-        occupiedPosition["-46,12"] = true;
-        occupiedPosition["-46,13"] = true;
-        occupiedPosition["-46,14"] = true;
-        occupiedPosition["-46,15"] = true;
-        occupiedPosition["-46,16"] = true;
-        occupiedPosition["-46,17"] = true;
-        occupiedPosition["-46,18"] = true;
-        occupiedPosition["-46,19"] = true;
-        occupiedPosition["-46,20"] = true;
-        occupiedPosition["-46,21"] = true;
-        occupiedPosition["-46,22"] = true;
-        occupiedPosition["-46,23"] = true;
-        occupiedPosition["-46,24"] = true;
-        occupiedPosition["-46,52"] = true;
-        occupiedPosition["-46,53"] = true;
-        occupiedPosition["-46,54"] = true;
-        occupiedPosition["-46,64"] = true;
-        occupiedPosition["-45,-56"] = true;
-        occupiedPosition["-45,-55"] = true;
-        occupiedPosition["-45,-54"] = true;
-        occupiedPosition["-45,-53"] = true;
-        occupiedPosition["-45,-52"] = true;
-        occupiedPosition["-45,-51"] = true;
-        occupiedPosition["-45,-50"] = true;
-        occupiedPosition["-45,-49"] = true;
-        occupiedPosition["-45,-38"] = true;
-        occupiedPosition["-45,-37"] = true;
-        occupiedPosition["-45,-32"] = true;
-        occupiedPosition["-45,-31"] = true;
-        occupiedPosition["-45,-30"] = true;
-        occupiedPosition["-45,-26"] = true;
-        occupiedPosition["-45,-25"] = true;
-        occupiedPosition["-45,-19"] = true;
-        occupiedPosition["-45,-18"] = true;
-        occupiedPosition["-45,-15"] = true;
-        occupiedPosition["-45,-14"] = true;
-        occupiedPosition["-45,-13"] = true;
-        occupiedPosition["-45,-12"] = true;
-        occupiedPosition["-45,-11"] = true;
-        occupiedPosition["-45,-5"] = true;
-        occupiedPosition["-45,-4"] = true;
-        occupiedPosition["-45,-1"] = true;
-        occupiedPosition["-45,0"] = true;
-        occupiedPosition["-45,1"] = true;
-        occupiedPosition["-45,10"] = true;
-        occupiedPosition["-45,11"] = true;
-        occupiedPosition["-45,23"] = true;
-        occupiedPosition["-45,24"] = true;
-        occupiedPosition["-45,50"] = true;
-        occupiedPosition["-45,51"] = true;
-        occupiedPosition["-45,52"] = true;
-        occupiedPosition["-45,53"] = true;
-        occupiedPosition["-45,54"] = true;
-        occupiedPosition["-45,55"] = true;
-        occupiedPosition["-45,56"] = true;
-        occupiedPosition["-45,57"] = true;
-        occupiedPosition["-45,58"] = true;
-        occupiedPosition["-45,63"] = true;
-        occupiedPosition["-45,64"] = true;
-        occupiedPosition["-44,-56"] = true;
-        occupiedPosition["-44,-55"] = true;
-        occupiedPosition["-44,-54"] = true;
-        occupiedPosition["-44,-53"] = true;
-        occupiedPosition["-44,-51"] = true;
-        occupiedPosition["-44,-50"] = true;
-        occupiedPosition["-44,-49"] = true;
-        occupiedPosition["-44,-38"] = true;
-        occupiedPosition["-44,-37"] = true;
-        occupiedPosition["-44,-32"] = true;
-        occupiedPosition["-44,-31"] = true;
-        occupiedPosition["-44,-30"] = true;
-        occupiedPosition["-44,-29"] = true;
-        occupiedPosition["-44,-26"] = true;
-        occupiedPosition["-44,-25"] = true;
-        occupiedPosition["-44,-19"] = true;
-        occupiedPosition["-44,-18"] = true;
-        occupiedPosition["-44,-15"] = true;
-        occupiedPosition["-44,-14"] = true;
-        occupiedPosition["-44,-5"] = true;
-        occupiedPosition["-44,-4"] = true;
-        occupiedPosition["-44,-1"] = true;
-        occupiedPosition["-44,0"] = true;
-        occupiedPosition["-44,1"] = true;
-        occupiedPosition["-44,10"] = true;
-        occupiedPosition["-44,11"] = true;
-        occupiedPosition["-44,23"] = true;
-        occupiedPosition["-44,24"] = true;
-        occupiedPosition["-44,50"] = true;
-        occupiedPosition["-44,51"] = true;
-        occupiedPosition["-44,52"] = true;
-        occupiedPosition["-44,53"] = true;
-        occupiedPosition["-44,54"] = true;
-        occupiedPosition["-44,55"] = true;
-        occupiedPosition["-44,56"] = true;
-        occupiedPosition["-44,57"] = true;
-        occupiedPosition["-44,58"] = true;
-        occupiedPosition["-44,64"] = true;
-        occupiedPosition["-43,-56"] = true;
-        occupiedPosition["-43,-55"] = true;
-        occupiedPosition["-43,-54"] = true;
-        occupiedPosition["-43,-53"] = true;
-        occupiedPosition["-43,-51"] = true;
-        occupiedPosition["-43,-50"] = true;
-        occupiedPosition["-43,-49"] = true;
-        occupiedPosition["-43,-38"] = true;
-        occupiedPosition["-43,-37"] = true;
-        occupiedPosition["-43,-35"] = true;
-        occupiedPosition["-43,-34"] = true;
-        occupiedPosition["-43,-33"] = true;
-        occupiedPosition["-43,-32"] = true;
-        occupiedPosition["-43,-31"] = true;
-        occupiedPosition["-43,-30"] = true;
-        occupiedPosition["-43,-29"] = true;
-        occupiedPosition["-43,-26"] = true;
-        occupiedPosition["-43,-25"] = true;
-        occupiedPosition["-43,-19"] = true;
-        occupiedPosition["-43,-18"] = true;
-        occupiedPosition["-43,-15"] = true;
-        occupiedPosition["-43,-14"] = true;
-        occupiedPosition["-43,-5"] = true;
-        occupiedPosition["-43,-4"] = true;
-        occupiedPosition["-43,-1"] = true;
-        occupiedPosition["-43,0"] = true;
-        occupiedPosition["-43,1"] = true;
-        occupiedPosition["-43,4"] = true;
-        occupiedPosition["-43,5"] = true;
-        occupiedPosition["-43,10"] = true;
-        occupiedPosition["-43,11"] = true;
-        occupiedPosition["-43,23"] = true;
-        occupiedPosition["-43,24"] = true;
-        occupiedPosition["-43,26"] = true;
-        occupiedPosition["-43,27"] = true;
-        occupiedPosition["-43,28"] = true;
-        occupiedPosition["-43,33"] = true;
-        occupiedPosition["-43,34"] = true;
-        occupiedPosition["-43,35"] = true;
-        occupiedPosition["-43,36"] = true;
-        occupiedPosition["-43,37"] = true;
-        occupiedPosition["-43,38"] = true;
-        occupiedPosition["-43,50"] = true;
-        occupiedPosition["-43,51"] = true;
-        occupiedPosition["-43,57"] = true;
-        occupiedPosition["-43,58"] = true;
-        occupiedPosition["-43,63"] = true;
-        occupiedPosition["-43,64"] = true;
-        occupiedPosition["-42,-56"] = true;
-        occupiedPosition["-42,-55"] = true;
-        occupiedPosition["-42,-54"] = true;
-        occupiedPosition["-42,-53"] = true;
-        occupiedPosition["-42,-52"] = true;
-        occupiedPosition["-42,-51"] = true;
-        occupiedPosition["-42,-50"] = true;
-        occupiedPosition["-42,-49"] = true;
-        occupiedPosition["-42,-38"] = true;
-        occupiedPosition["-42,-37"] = true;
-        occupiedPosition["-42,-35"] = true;
-        occupiedPosition["-42,-34"] = true;
-        occupiedPosition["-42,-33"] = true;
-        occupiedPosition["-42,-32"] = true;
-        occupiedPosition["-42,-31"] = true;
-        occupiedPosition["-42,-30"] = true;
-        occupiedPosition["-42,-29"] = true;
-        occupiedPosition["-42,-26"] = true;
-        occupiedPosition["-42,-25"] = true;
-        occupiedPosition["-42,-24"] = true;
-        occupiedPosition["-42,-23"] = true;
-        occupiedPosition["-42,-22"] = true;
-        occupiedPosition["-42,-21"] = true;
-        occupiedPosition["-42,-20"] = true;
-        occupiedPosition["-42,-19"] = true;
-        occupiedPosition["-42,-18"] = true;
-        occupiedPosition["-42,-15"] = true;
-        occupiedPosition["-42,-14"] = true;
-        occupiedPosition["-42,-13"] = true;
-        occupiedPosition["-42,-12"] = true;
-        occupiedPosition["-42,-11"] = true;
-        occupiedPosition["-42,-10"] = true;
-        occupiedPosition["-42,-9"] = true;
-        occupiedPosition["-42,-8"] = true;
-        occupiedPosition["-42,-7"] = true;
-        occupiedPosition["-42,-6"] = true;
-        occupiedPosition["-42,-5"] = true;
-        occupiedPosition["-42,-4"] = true;
-        occupiedPosition["-42,-1"] = true;
-        occupiedPosition["-42,0"] = true;
-        occupiedPosition["-42,1"] = true;
-        occupiedPosition["-42,4"] = true;
-        occupiedPosition["-42,5"] = true;
-        occupiedPosition["-42,10"] = true;
-        occupiedPosition["-42,11"] = true;
-        occupiedPosition["-42,23"] = true;
-        occupiedPosition["-42,24"] = true;
-        occupiedPosition["-42,25"] = true;
-        occupiedPosition["-42,26"] = true;
-        occupiedPosition["-42,27"] = true;
-        occupiedPosition["-42,28"] = true;
-        occupiedPosition["-42,33"] = true;
-        occupiedPosition["-42,34"] = true;
-        occupiedPosition["-42,35"] = true;
-        occupiedPosition["-42,36"] = true;
-        occupiedPosition["-42,37"] = true;
-        occupiedPosition["-42,38"] = true;
-        occupiedPosition["-42,50"] = true;
-        occupiedPosition["-42,51"] = true;
-        occupiedPosition["-42,57"] = true;
-        occupiedPosition["-42,58"] = true;
-        occupiedPosition["-42,63"] = true;
-        occupiedPosition["-42,64"] = true;
-        occupiedPosition["-41,-56"] = true;
-        occupiedPosition["-41,-55"] = true;
-        occupiedPosition["-41,-54"] = true;
-        occupiedPosition["-41,-53"] = true;
-        occupiedPosition["-41,-52"] = true;
-        occupiedPosition["-41,-51"] = true;
-        occupiedPosition["-41,-50"] = true;
-        occupiedPosition["-41,-49"] = true;
-        occupiedPosition["-41,-38"] = true;
-        occupiedPosition["-41,-37"] = true;
-        occupiedPosition["-41,-35"] = true;
-        occupiedPosition["-41,-34"] = true;
-        occupiedPosition["-41,-33"] = true;
-        occupiedPosition["-41,-32"] = true;
-        occupiedPosition["-41,-31"] = true;
-        occupiedPosition["-41,-30"] = true;
-        occupiedPosition["-41,-29"] = true;
-        occupiedPosition["-41,-27"] = true;
-        occupiedPosition["-41,-26"] = true;
-        occupiedPosition["-41,-25"] = true;
-        occupiedPosition["-41,-24"] = true;
-        occupiedPosition["-41,-23"] = true;
-        occupiedPosition["-41,-22"] = true;
-        occupiedPosition["-41,-21"] = true;
-        occupiedPosition["-41,-20"] = true;
-        occupiedPosition["-41,-19"] = true;
-        occupiedPosition["-41,-18"] = true;
-        occupiedPosition["-41,-15"] = true;
-        occupiedPosition["-41,-14"] = true;
-        occupiedPosition["-41,-13"] = true;
-        occupiedPosition["-41,-12"] = true;
-        occupiedPosition["-41,-11"] = true;
-        occupiedPosition["-41,-10"] = true;
-        occupiedPosition["-41,-9"] = true;
-        occupiedPosition["-41,-8"] = true;
-        occupiedPosition["-41,-7"] = true;
-        occupiedPosition["-41,-6"] = true;
-        occupiedPosition["-41,-5"] = true;
-        occupiedPosition["-41,-4"] = true;
-        occupiedPosition["-41,-1"] = true;
-        occupiedPosition["-41,0"] = true;
-        occupiedPosition["-41,1"] = true;
-        occupiedPosition["-41,4"] = true;
-        occupiedPosition["-41,5"] = true;
-        occupiedPosition["-41,10"] = true;
-        occupiedPosition["-41,11"] = true;
-        occupiedPosition["-41,23"] = true;
-        occupiedPosition["-41,24"] = true;
-        occupiedPosition["-41,25"] = true;
-        occupiedPosition["-41,26"] = true;
-        occupiedPosition["-41,27"] = true;
-        occupiedPosition["-41,28"] = true;
-        occupiedPosition["-41,33"] = true;
-        occupiedPosition["-41,34"] = true;
-        occupiedPosition["-41,35"] = true;
-        occupiedPosition["-41,36"] = true;
-        occupiedPosition["-41,37"] = true;
-        occupiedPosition["-41,38"] = true;
-        occupiedPosition["-41,47"] = true;
-        occupiedPosition["-41,48"] = true;
-        occupiedPosition["-41,49"] = true;
-        occupiedPosition["-41,50"] = true;
-        occupiedPosition["-41,51"] = true;
-        occupiedPosition["-41,57"] = true;
-        occupiedPosition["-41,58"] = true;
-        occupiedPosition["-41,64"] = true;
-        occupiedPosition["-40,-56"] = true;
-        occupiedPosition["-40,-55"] = true;
-        occupiedPosition["-40,-51"] = true;
-        occupiedPosition["-40,-50"] = true;
-        occupiedPosition["-40,-38"] = true;
-        occupiedPosition["-40,-37"] = true;
-        occupiedPosition["-40,-35"] = true;
-        occupiedPosition["-40,-34"] = true;
-        occupiedPosition["-40,-33"] = true;
-        occupiedPosition["-40,-32"] = true;
-        occupiedPosition["-40,-31"] = true;
-        occupiedPosition["-40,-30"] = true;
-        occupiedPosition["-40,-29"] = true;
-        occupiedPosition["-40,-27"] = true;
-        occupiedPosition["-40,-26"] = true;
-        occupiedPosition["-40,-25"] = true;
-        occupiedPosition["-40,-24"] = true;
-        occupiedPosition["-40,-23"] = true;
-        occupiedPosition["-40,-2"] = true;
-        occupiedPosition["-40,-1"] = true;
-        occupiedPosition["-40,0"] = true;
-        occupiedPosition["-40,1"] = true;
-        occupiedPosition["-40,10"] = true;
-        occupiedPosition["-40,11"] = true;
-        occupiedPosition["-40,14"] = true;
-        occupiedPosition["-40,15"] = true;
-        occupiedPosition["-40,16"] = true;
-        occupiedPosition["-40,17"] = true;
-        occupiedPosition["-40,18"] = true;
-        occupiedPosition["-40,19"] = true;
-        occupiedPosition["-40,20"] = true;
-        occupiedPosition["-40,21"] = true;
-        occupiedPosition["-40,22"] = true;
-        occupiedPosition["-40,23"] = true;
-        occupiedPosition["-40,24"] = true;
-        occupiedPosition["-40,25"] = true;
-        occupiedPosition["-40,26"] = true;
-        occupiedPosition["-40,27"] = true;
-        occupiedPosition["-40,33"] = true;
-        occupiedPosition["-40,34"] = true;
-        occupiedPosition["-40,35"] = true;
-        occupiedPosition["-40,36"] = true;
-        occupiedPosition["-40,37"] = true;
-        occupiedPosition["-40,38"] = true;
-        occupiedPosition["-40,47"] = true;
-        occupiedPosition["-40,48"] = true;
-        occupiedPosition["-40,49"] = true;
-        occupiedPosition["-40,50"] = true;
-        occupiedPosition["-40,51"] = true;
-        occupiedPosition["-40,57"] = true;
-        occupiedPosition["-40,58"] = true;
-        occupiedPosition["-40,63"] = true;
-        occupiedPosition["-40,64"] = true;
-        occupiedPosition["-39,-56"] = true;
-        occupiedPosition["-39,-51"] = true;
-        occupiedPosition["-39,-50"] = true;
-        occupiedPosition["-39,-38"] = true;
-        occupiedPosition["-39,-37"] = true;
-        occupiedPosition["-39,-35"] = true;
-        occupiedPosition["-39,-34"] = true;
-        occupiedPosition["-39,-33"] = true;
-        occupiedPosition["-39,-32"] = true;
-        occupiedPosition["-39,-31"] = true;
-        occupiedPosition["-39,-30"] = true;
-        occupiedPosition["-39,-25"] = true;
-        occupiedPosition["-39,-24"] = true;
-        occupiedPosition["-39,-23"] = true;
-        occupiedPosition["-39,-22"] = true;
-        occupiedPosition["-39,-3"] = true;
-        occupiedPosition["-39,-2"] = true;
-        occupiedPosition["-39,-1"] = true;
-        occupiedPosition["-39,0"] = true;
-        occupiedPosition["-39,1"] = true;
-        occupiedPosition["-39,10"] = true;
-        occupiedPosition["-39,11"] = true;
-        occupiedPosition["-39,14"] = true;
-        occupiedPosition["-39,15"] = true;
-        occupiedPosition["-39,16"] = true;
-        occupiedPosition["-39,17"] = true;
-        occupiedPosition["-39,18"] = true;
-        occupiedPosition["-39,19"] = true;
-        occupiedPosition["-39,20"] = true;
-        occupiedPosition["-39,21"] = true;
-        occupiedPosition["-39,22"] = true;
-        occupiedPosition["-39,23"] = true;
-        occupiedPosition["-39,24"] = true;
-        occupiedPosition["-39,25"] = true;
-        occupiedPosition["-39,33"] = true;
-        occupiedPosition["-39,34"] = true;
-        occupiedPosition["-39,35"] = true;
-        occupiedPosition["-39,36"] = true;
-        occupiedPosition["-39,37"] = true;
-        occupiedPosition["-39,38"] = true;
-        occupiedPosition["-39,46"] = true;
-        occupiedPosition["-39,47"] = true;
-        occupiedPosition["-39,48"] = true;
-        occupiedPosition["-39,50"] = true;
-        occupiedPosition["-39,51"] = true;
-        occupiedPosition["-39,57"] = true;
-        occupiedPosition["-39,58"] = true;
-        occupiedPosition["-39,64"] = true;
-        occupiedPosition["-38,-51"] = true;
-        occupiedPosition["-38,-50"] = true;
-        occupiedPosition["-38,-38"] = true;
-        occupiedPosition["-38,-37"] = true;
-        occupiedPosition["-38,-35"] = true;
-        occupiedPosition["-38,-34"] = true;
-        occupiedPosition["-38,-25"] = true;
-        occupiedPosition["-38,-24"] = true;
-        occupiedPosition["-38,-23"] = true;
-        occupiedPosition["-38,-22"] = true;
-        occupiedPosition["-38,4"] = true;
-        occupiedPosition["-38,10"] = true;
-        occupiedPosition["-38,11"] = true;
-        occupiedPosition["-38,14"] = true;
-        occupiedPosition["-38,15"] = true;
-        occupiedPosition["-38,24"] = true;
-        occupiedPosition["-38,25"] = true;
-        occupiedPosition["-38,33"] = true;
-        occupiedPosition["-38,34"] = true;
-        occupiedPosition["-38,35"] = true;
-        occupiedPosition["-38,36"] = true;
-        occupiedPosition["-38,37"] = true;
-        occupiedPosition["-38,38"] = true;
-        occupiedPosition["-38,45"] = true;
-        occupiedPosition["-38,46"] = true;
-        occupiedPosition["-38,47"] = true;
-        occupiedPosition["-38,48"] = true;
-        occupiedPosition["-38,50"] = true;
-        occupiedPosition["-38,51"] = true;
-        occupiedPosition["-38,57"] = true;
-        occupiedPosition["-38,58"] = true;
-        occupiedPosition["-37,-51"] = true;
-        occupiedPosition["-37,-50"] = true;
-        occupiedPosition["-37,-38"] = true;
-        occupiedPosition["-37,-37"] = true;
-        occupiedPosition["-37,-36"] = true;
-        occupiedPosition["-37,-35"] = true;
-        occupiedPosition["-37,-24"] = true;
-        occupiedPosition["-37,-23"] = true;
-        occupiedPosition["-37,-22"] = true;
-        occupiedPosition["-37,4"] = true;
-        occupiedPosition["-37,5"] = true;
-        occupiedPosition["-37,10"] = true;
-        occupiedPosition["-37,11"] = true;
-        occupiedPosition["-37,12"] = true;
-        occupiedPosition["-37,13"] = true;
-        occupiedPosition["-37,14"] = true;
-        occupiedPosition["-37,15"] = true;
-        occupiedPosition["-37,33"] = true;
-        occupiedPosition["-37,34"] = true;
-        occupiedPosition["-37,35"] = true;
-        occupiedPosition["-37,36"] = true;
-        occupiedPosition["-37,37"] = true;
-        occupiedPosition["-37,38"] = true;
-        occupiedPosition["-37,45"] = true;
-        occupiedPosition["-37,46"] = true;
-        occupiedPosition["-37,47"] = true;
-        occupiedPosition["-37,48"] = true;
-        occupiedPosition["-37,49"] = true;
-        occupiedPosition["-37,50"] = true;
-        occupiedPosition["-37,51"] = true;
-        occupiedPosition["-37,57"] = true;
-        occupiedPosition["-37,58"] = true;
-        occupiedPosition["-36,-51"] = true;
-        occupiedPosition["-36,-50"] = true;
-        occupiedPosition["-36,-38"] = true;
-        occupiedPosition["-36,-37"] = true;
-        occupiedPosition["-36,-36"] = true;
-        occupiedPosition["-36,-35"] = true;
-        occupiedPosition["-36,-34"] = true;
-        occupiedPosition["-36,4"] = true;
-        occupiedPosition["-36,5"] = true;
-        occupiedPosition["-36,10"] = true;
-        occupiedPosition["-36,11"] = true;
-        occupiedPosition["-36,12"] = true;
-        occupiedPosition["-36,13"] = true;
-        occupiedPosition["-36,14"] = true;
-        occupiedPosition["-36,15"] = true;
-        occupiedPosition["-36,21"] = true;
-        occupiedPosition["-36,22"] = true;
-        occupiedPosition["-36,23"] = true;
-        occupiedPosition["-36,24"] = true;
-        occupiedPosition["-36,25"] = true;
-        occupiedPosition["-36,47"] = true;
-        occupiedPosition["-36,48"] = true;
-        occupiedPosition["-36,49"] = true;
-        occupiedPosition["-36,50"] = true;
-        occupiedPosition["-36,51"] = true;
-        occupiedPosition["-36,57"] = true;
-        occupiedPosition["-36,58"] = true;
-        occupiedPosition["-35,-51"] = true;
-        occupiedPosition["-35,-50"] = true;
-        occupiedPosition["-35,-38"] = true;
-        occupiedPosition["-35,-37"] = true;
-        occupiedPosition["-35,-36"] = true;
-        occupiedPosition["-35,-35"] = true;
-        occupiedPosition["-35,-34"] = true;
-        occupiedPosition["-35,4"] = true;
-        occupiedPosition["-35,20"] = true;
-        occupiedPosition["-35,21"] = true;
-        occupiedPosition["-35,22"] = true;
-        occupiedPosition["-35,23"] = true;
-        occupiedPosition["-35,24"] = true;
-        occupiedPosition["-35,25"] = true;
-        occupiedPosition["-35,26"] = true;
-        occupiedPosition["-35,47"] = true;
-        occupiedPosition["-35,48"] = true;
-        occupiedPosition["-35,49"] = true;
-        occupiedPosition["-35,50"] = true;
-        occupiedPosition["-35,51"] = true;
-        occupiedPosition["-35,57"] = true;
-        occupiedPosition["-35,58"] = true;
-        occupiedPosition["-35,60"] = true;
-        occupiedPosition["-35,61"] = true;
-        occupiedPosition["-34,-51"] = true;
-        occupiedPosition["-34,-50"] = true;
-        occupiedPosition["-34,-38"] = true;
-        occupiedPosition["-34,-37"] = true;
-        occupiedPosition["-34,-36"] = true;
-        occupiedPosition["-34,-35"] = true;
-        occupiedPosition["-34,-34"] = true;
-        occupiedPosition["-34,20"] = true;
-        occupiedPosition["-34,21"] = true;
-        occupiedPosition["-34,22"] = true;
-        occupiedPosition["-34,23"] = true;
-        occupiedPosition["-34,24"] = true;
-        occupiedPosition["-34,25"] = true;
-        occupiedPosition["-34,26"] = true;
-        occupiedPosition["-34,47"] = true;
-        occupiedPosition["-34,48"] = true;
-        occupiedPosition["-34,49"] = true;
-        occupiedPosition["-34,50"] = true;
-        occupiedPosition["-34,51"] = true;
-        occupiedPosition["-34,57"] = true;
-        occupiedPosition["-34,58"] = true;
-        occupiedPosition["-34,59"] = true;
-        occupiedPosition["-34,60"] = true;
-        occupiedPosition["-34,61"] = true;
-        occupiedPosition["-34,62"] = true;
-        occupiedPosition["-33,-51"] = true;
-        occupiedPosition["-33,-50"] = true;
-        occupiedPosition["-33,-38"] = true;
-        occupiedPosition["-33,-37"] = true;
-        occupiedPosition["-33,-36"] = true;
-        occupiedPosition["-33,-35"] = true;
-        occupiedPosition["-33,-34"] = true;
-        occupiedPosition["-33,20"] = true;
-        occupiedPosition["-33,21"] = true;
-        occupiedPosition["-33,22"] = true;
-        occupiedPosition["-33,23"] = true;
-        occupiedPosition["-33,24"] = true;
-        occupiedPosition["-33,25"] = true;
-        occupiedPosition["-33,26"] = true;
-        occupiedPosition["-33,49"] = true;
-        occupiedPosition["-33,50"] = true;
-        occupiedPosition["-33,51"] = true;
-        occupiedPosition["-33,52"] = true;
-        occupiedPosition["-33,53"] = true;
-        occupiedPosition["-33,54"] = true;
-        occupiedPosition["-33,55"] = true;
-        occupiedPosition["-33,56"] = true;
-        occupiedPosition["-33,57"] = true;
-        occupiedPosition["-33,58"] = true;
-        occupiedPosition["-33,59"] = true;
-        occupiedPosition["-33,60"] = true;
-        occupiedPosition["-33,61"] = true;
-        occupiedPosition["-33,62"] = true;
-        occupiedPosition["-32,-51"] = true;
-        occupiedPosition["-32,-50"] = true;
-        occupiedPosition["-32,-38"] = true;
-        occupiedPosition["-32,-37"] = true;
-        occupiedPosition["-32,-36"] = true;
-        occupiedPosition["-32,-35"] = true;
-        occupiedPosition["-32,-28"] = true;
-        occupiedPosition["-32,-27"] = true;
-        occupiedPosition["-32,-26"] = true;
-        occupiedPosition["-32,-25"] = true;
-        occupiedPosition["-32,-24"] = true;
-        occupiedPosition["-32,-23"] = true;
-        occupiedPosition["-32,-22"] = true;
-        occupiedPosition["-32,22"] = true;
-        occupiedPosition["-32,23"] = true;
-        occupiedPosition["-32,24"] = true;
-        occupiedPosition["-32,25"] = true;
-        occupiedPosition["-32,26"] = true;
-        occupiedPosition["-32,50"] = true;
-        occupiedPosition["-32,51"] = true;
-        occupiedPosition["-32,52"] = true;
-        occupiedPosition["-32,53"] = true;
-        occupiedPosition["-32,54"] = true;
-        occupiedPosition["-32,55"] = true;
-        occupiedPosition["-32,56"] = true;
-        occupiedPosition["-32,57"] = true;
-        occupiedPosition["-32,58"] = true;
-        occupiedPosition["-32,60"] = true;
-        occupiedPosition["-32,61"] = true;
-        occupiedPosition["-31,-51"] = true;
-        occupiedPosition["-31,-50"] = true;
-        occupiedPosition["-31,-49"] = true;
-        occupiedPosition["-31,-48"] = true;
-        occupiedPosition["-31,-47"] = true;
-        occupiedPosition["-31,-46"] = true;
-        occupiedPosition["-31,-45"] = true;
-        occupiedPosition["-31,-44"] = true;
-        occupiedPosition["-31,-43"] = true;
-        occupiedPosition["-31,-42"] = true;
-        occupiedPosition["-31,-41"] = true;
-        occupiedPosition["-31,-40"] = true;
-        occupiedPosition["-31,-39"] = true;
-        occupiedPosition["-31,-38"] = true;
-        occupiedPosition["-31,-37"] = true;
-        occupiedPosition["-31,-28"] = true;
-        occupiedPosition["-31,-27"] = true;
-        occupiedPosition["-31,-26"] = true;
-        occupiedPosition["-31,-25"] = true;
-        occupiedPosition["-31,-24"] = true;
-        occupiedPosition["-31,-23"] = true;
-        occupiedPosition["-31,-22"] = true;
-        occupiedPosition["-31,22"] = true;
-        occupiedPosition["-31,23"] = true;
-        occupiedPosition["-31,24"] = true;
-        occupiedPosition["-31,25"] = true;
-        occupiedPosition["-31,26"] = true;
-        occupiedPosition["-31,27"] = true;
-        occupiedPosition["-31,29"] = true;
-        occupiedPosition["-31,30"] = true;
-        occupiedPosition["-31,31"] = true;
-        occupiedPosition["-31,32"] = true;
-        occupiedPosition["-31,45"] = true;
-        occupiedPosition["-31,46"] = true;
-        occupiedPosition["-31,48"] = true;
-        occupiedPosition["-31,49"] = true;
-        occupiedPosition["-31,50"] = true;
-        occupiedPosition["-30,-50"] = true;
-        occupiedPosition["-30,-49"] = true;
-        occupiedPosition["-30,-48"] = true;
-        occupiedPosition["-30,-47"] = true;
-        occupiedPosition["-30,-46"] = true;
-        occupiedPosition["-30,-45"] = true;
-        occupiedPosition["-30,-44"] = true;
-        occupiedPosition["-30,-43"] = true;
-        occupiedPosition["-30,-42"] = true;
-        occupiedPosition["-30,-41"] = true;
-        occupiedPosition["-30,-40"] = true;
-        occupiedPosition["-30,-39"] = true;
-        occupiedPosition["-30,-38"] = true;
-        occupiedPosition["-30,-37"] = true;
-        occupiedPosition["-30,-28"] = true;
-        occupiedPosition["-30,-27"] = true;
-        occupiedPosition["-30,-26"] = true;
-        occupiedPosition["-30,-25"] = true;
-        occupiedPosition["-30,-24"] = true;
-        occupiedPosition["-30,-23"] = true;
-        occupiedPosition["-30,-22"] = true;
-        occupiedPosition["-30,22"] = true;
-        occupiedPosition["-30,23"] = true;
-        occupiedPosition["-30,24"] = true;
-        occupiedPosition["-30,25"] = true;
-        occupiedPosition["-30,26"] = true;
-        occupiedPosition["-30,27"] = true;
-        occupiedPosition["-30,28"] = true;
-        occupiedPosition["-30,29"] = true;
-        occupiedPosition["-30,30"] = true;
-        occupiedPosition["-30,31"] = true;
-        occupiedPosition["-30,32"] = true;
-        occupiedPosition["-30,33"] = true;
-        occupiedPosition["-30,45"] = true;
-        occupiedPosition["-30,46"] = true;
-        occupiedPosition["-30,47"] = true;
-        occupiedPosition["-30,48"] = true;
-        occupiedPosition["-30,49"] = true;
-        occupiedPosition["-30,50"] = true;
-        occupiedPosition["-30,51"] = true;
-        occupiedPosition["-30,52"] = true;
-        occupiedPosition["-30,53"] = true;
-        occupiedPosition["-30,54"] = true;
-        occupiedPosition["-30,55"] = true;
-        occupiedPosition["-30,56"] = true;
-        occupiedPosition["-29,-51"] = true;
-        occupiedPosition["-29,-50"] = true;
-        occupiedPosition["-29,-43"] = true;
-        occupiedPosition["-29,-42"] = true;
-        occupiedPosition["-29,-41"] = true;
-        occupiedPosition["-29,-40"] = true;
-        occupiedPosition["-29,-39"] = true;
-        occupiedPosition["-29,-28"] = true;
-        occupiedPosition["-29,-27"] = true;
-        occupiedPosition["-29,-26"] = true;
-        occupiedPosition["-29,-25"] = true;
-        occupiedPosition["-29,-24"] = true;
-        occupiedPosition["-29,-23"] = true;
-        occupiedPosition["-29,-22"] = true;
-        occupiedPosition["-29,28"] = true;
-        occupiedPosition["-29,29"] = true;
-        occupiedPosition["-29,30"] = true;
-        occupiedPosition["-29,31"] = true;
-        occupiedPosition["-29,32"] = true;
-        occupiedPosition["-29,33"] = true;
-        occupiedPosition["-29,44"] = true;
-        occupiedPosition["-29,45"] = true;
-        occupiedPosition["-29,46"] = true;
-        occupiedPosition["-29,47"] = true;
-        occupiedPosition["-29,48"] = true;
-        occupiedPosition["-29,49"] = true;
-        occupiedPosition["-29,50"] = true;
-        occupiedPosition["-29,51"] = true;
-        occupiedPosition["-29,52"] = true;
-        occupiedPosition["-29,53"] = true;
-        occupiedPosition["-29,54"] = true;
-        occupiedPosition["-29,55"] = true;
-        occupiedPosition["-29,56"] = true;
-        occupiedPosition["-28,-51"] = true;
-        occupiedPosition["-28,-50"] = true;
-        occupiedPosition["-28,-49"] = true;
-        occupiedPosition["-28,-28"] = true;
-        occupiedPosition["-28,-27"] = true;
-        occupiedPosition["-28,-26"] = true;
-        occupiedPosition["-28,-25"] = true;
-        occupiedPosition["-28,-24"] = true;
-        occupiedPosition["-28,-23"] = true;
-        occupiedPosition["-28,-22"] = true;
-        occupiedPosition["-28,-2"] = true;
-        occupiedPosition["-28,4"] = true;
-        occupiedPosition["-28,5"] = true;
-        occupiedPosition["-28,9"] = true;
-        occupiedPosition["-28,10"] = true;
-        occupiedPosition["-28,11"] = true;
-        occupiedPosition["-28,12"] = true;
-        occupiedPosition["-28,13"] = true;
-        occupiedPosition["-28,14"] = true;
-        occupiedPosition["-28,15"] = true;
-        occupiedPosition["-28,16"] = true;
-        occupiedPosition["-28,17"] = true;
-        occupiedPosition["-28,18"] = true;
-        occupiedPosition["-28,19"] = true;
-        occupiedPosition["-28,20"] = true;
-        occupiedPosition["-28,21"] = true;
-        occupiedPosition["-28,22"] = true;
-        occupiedPosition["-28,23"] = true;
-        occupiedPosition["-28,24"] = true;
-        occupiedPosition["-28,25"] = true;
-        occupiedPosition["-28,26"] = true;
-        occupiedPosition["-28,27"] = true;
-        occupiedPosition["-28,28"] = true;
-        occupiedPosition["-28,29"] = true;
-        occupiedPosition["-28,30"] = true;
-        occupiedPosition["-28,31"] = true;
-        occupiedPosition["-28,32"] = true;
-        occupiedPosition["-28,33"] = true;
-        occupiedPosition["-28,34"] = true;
-        occupiedPosition["-28,35"] = true;
-        occupiedPosition["-28,44"] = true;
-        occupiedPosition["-28,45"] = true;
-        occupiedPosition["-28,46"] = true;
-        occupiedPosition["-28,47"] = true;
-        occupiedPosition["-28,48"] = true;
-        occupiedPosition["-28,49"] = true;
-        occupiedPosition["-28,50"] = true;
-        occupiedPosition["-28,51"] = true;
-        occupiedPosition["-28,52"] = true;
-        occupiedPosition["-28,55"] = true;
-        occupiedPosition["-28,56"] = true;
-        occupiedPosition["-27,-51"] = true;
-        occupiedPosition["-27,-50"] = true;
-        occupiedPosition["-27,-49"] = true;
-        occupiedPosition["-27,-28"] = true;
-        occupiedPosition["-27,-27"] = true;
-        occupiedPosition["-27,-26"] = true;
-        occupiedPosition["-27,-25"] = true;
-        occupiedPosition["-27,-24"] = true;
-        occupiedPosition["-27,-23"] = true;
-        occupiedPosition["-27,-22"] = true;
-        occupiedPosition["-27,-3"] = true;
-        occupiedPosition["-27,-2"] = true;
-        occupiedPosition["-27,-1"] = true;
-        occupiedPosition["-27,0"] = true;
-        occupiedPosition["-27,1"] = true;
-        occupiedPosition["-27,4"] = true;
-        occupiedPosition["-27,5"] = true;
-        occupiedPosition["-27,9"] = true;
-        occupiedPosition["-27,10"] = true;
-        occupiedPosition["-27,11"] = true;
-        occupiedPosition["-27,12"] = true;
-        occupiedPosition["-27,13"] = true;
-        occupiedPosition["-27,14"] = true;
-        occupiedPosition["-27,15"] = true;
-        occupiedPosition["-27,16"] = true;
-        occupiedPosition["-27,17"] = true;
-        occupiedPosition["-27,18"] = true;
-        occupiedPosition["-27,19"] = true;
-        occupiedPosition["-27,20"] = true;
-        occupiedPosition["-27,21"] = true;
-        occupiedPosition["-27,22"] = true;
-        occupiedPosition["-27,23"] = true;
-        occupiedPosition["-27,24"] = true;
-        occupiedPosition["-27,25"] = true;
-        occupiedPosition["-27,26"] = true;
-        occupiedPosition["-27,27"] = true;
-        occupiedPosition["-27,28"] = true;
-        occupiedPosition["-27,29"] = true;
-        occupiedPosition["-27,30"] = true;
-        occupiedPosition["-27,31"] = true;
-        occupiedPosition["-27,32"] = true;
-        occupiedPosition["-27,33"] = true;
-        occupiedPosition["-27,34"] = true;
-        occupiedPosition["-27,35"] = true;
-        occupiedPosition["-27,44"] = true;
-        occupiedPosition["-27,45"] = true;
-        occupiedPosition["-27,46"] = true;
-        occupiedPosition["-27,47"] = true;
-        occupiedPosition["-27,48"] = true;
-        occupiedPosition["-27,49"] = true;
-        occupiedPosition["-27,50"] = true;
-        occupiedPosition["-27,51"] = true;
-        occupiedPosition["-27,52"] = true;
-        occupiedPosition["-27,55"] = true;
-        occupiedPosition["-27,56"] = true;
-        occupiedPosition["-27,64"] = true;
-        occupiedPosition["-26,-51"] = true;
-        occupiedPosition["-26,-50"] = true;
-        occupiedPosition["-26,-49"] = true;
-        occupiedPosition["-26,-3"] = true;
-        occupiedPosition["-26,-2"] = true;
-        occupiedPosition["-26,-1"] = true;
-        occupiedPosition["-26,0"] = true;
-        occupiedPosition["-26,1"] = true;
-        occupiedPosition["-26,4"] = true;
-        occupiedPosition["-26,5"] = true;
-        occupiedPosition["-26,6"] = true;
-        occupiedPosition["-26,9"] = true;
-        occupiedPosition["-26,10"] = true;
-        occupiedPosition["-26,34"] = true;
-        occupiedPosition["-26,35"] = true;
-        occupiedPosition["-26,36"] = true;
-        occupiedPosition["-26,44"] = true;
-        occupiedPosition["-26,45"] = true;
-        occupiedPosition["-26,46"] = true;
-        occupiedPosition["-26,47"] = true;
-        occupiedPosition["-26,49"] = true;
-        occupiedPosition["-26,50"] = true;
-        occupiedPosition["-26,51"] = true;
-        occupiedPosition["-26,52"] = true;
-        occupiedPosition["-26,53"] = true;
-        occupiedPosition["-26,54"] = true;
-        occupiedPosition["-26,55"] = true;
-        occupiedPosition["-26,56"] = true;
-        occupiedPosition["-26,64"] = true;
-        occupiedPosition["-25,-16"] = true;
-        occupiedPosition["-25,0"] = true;
-        occupiedPosition["-25,1"] = true;
-        occupiedPosition["-25,4"] = true;
-        occupiedPosition["-25,5"] = true;
-        occupiedPosition["-25,9"] = true;
-        occupiedPosition["-25,10"] = true;
-        occupiedPosition["-25,34"] = true;
-        occupiedPosition["-25,35"] = true;
-        occupiedPosition["-25,36"] = true;
-        occupiedPosition["-25,49"] = true;
-        occupiedPosition["-25,50"] = true;
-        occupiedPosition["-25,51"] = true;
-        occupiedPosition["-25,52"] = true;
-        occupiedPosition["-25,53"] = true;
-        occupiedPosition["-25,54"] = true;
-        occupiedPosition["-25,55"] = true;
-        occupiedPosition["-25,56"] = true;
-        occupiedPosition["-25,57"] = true;
-        occupiedPosition["-25,64"] = true;
-        occupiedPosition["-24,-17"] = true;
-        occupiedPosition["-24,-16"] = true;
-        occupiedPosition["-24,-15"] = true;
-        occupiedPosition["-24,-1"] = true;
-        occupiedPosition["-24,0"] = true;
-        occupiedPosition["-24,1"] = true;
-        occupiedPosition["-24,9"] = true;
-        occupiedPosition["-24,10"] = true;
-        occupiedPosition["-24,34"] = true;
-        occupiedPosition["-24,35"] = true;
-        occupiedPosition["-24,36"] = true;
-        occupiedPosition["-24,49"] = true;
-        occupiedPosition["-24,50"] = true;
-        occupiedPosition["-24,51"] = true;
-        occupiedPosition["-24,52"] = true;
-        occupiedPosition["-24,53"] = true;
-        occupiedPosition["-24,54"] = true;
-        occupiedPosition["-24,55"] = true;
-        occupiedPosition["-24,56"] = true;
-        occupiedPosition["-24,63"] = true;
-        occupiedPosition["-24,64"] = true;
-        occupiedPosition["-23,-17"] = true;
-        occupiedPosition["-23,-16"] = true;
-        occupiedPosition["-23,-15"] = true;
-        occupiedPosition["-23,-4"] = true;
-        occupiedPosition["-23,-3"] = true;
-        occupiedPosition["-23,0"] = true;
-        occupiedPosition["-23,1"] = true;
-        occupiedPosition["-23,9"] = true;
-        occupiedPosition["-23,10"] = true;
-        occupiedPosition["-23,34"] = true;
-        occupiedPosition["-23,35"] = true;
-        occupiedPosition["-23,36"] = true;
-        occupiedPosition["-23,64"] = true;
-        occupiedPosition["-22,-56"] = true;
-        occupiedPosition["-22,-54"] = true;
-        occupiedPosition["-22,-53"] = true;
-        occupiedPosition["-22,-52"] = true;
-        occupiedPosition["-22,-51"] = true;
-        occupiedPosition["-22,-50"] = true;
-        occupiedPosition["-22,-49"] = true;
-        occupiedPosition["-22,-45"] = true;
-        occupiedPosition["-22,-44"] = true;
-        occupiedPosition["-22,-43"] = true;
-        occupiedPosition["-22,-17"] = true;
-        occupiedPosition["-22,-16"] = true;
-        occupiedPosition["-22,-15"] = true;
-        occupiedPosition["-22,-5"] = true;
-        occupiedPosition["-22,-4"] = true;
-        occupiedPosition["-22,-3"] = true;
-        occupiedPosition["-22,-2"] = true;
-        occupiedPosition["-22,-1"] = true;
-        occupiedPosition["-22,0"] = true;
-        occupiedPosition["-22,1"] = true;
-        occupiedPosition["-22,9"] = true;
-        occupiedPosition["-22,10"] = true;
-        occupiedPosition["-22,34"] = true;
-        occupiedPosition["-22,35"] = true;
-        occupiedPosition["-22,36"] = true;
-        occupiedPosition["-22,43"] = true;
-        occupiedPosition["-22,44"] = true;
-        occupiedPosition["-22,45"] = true;
-        occupiedPosition["-22,63"] = true;
-        occupiedPosition["-22,64"] = true;
-        occupiedPosition["-21,-56"] = true;
-        occupiedPosition["-21,-55"] = true;
-        occupiedPosition["-21,-54"] = true;
-        occupiedPosition["-21,-53"] = true;
-        occupiedPosition["-21,-52"] = true;
-        occupiedPosition["-21,-51"] = true;
-        occupiedPosition["-21,-50"] = true;
-        occupiedPosition["-21,-49"] = true;
-        occupiedPosition["-21,-45"] = true;
-        occupiedPosition["-21,-44"] = true;
-        occupiedPosition["-21,-43"] = true;
-        occupiedPosition["-21,-39"] = true;
-        occupiedPosition["-21,-38"] = true;
-        occupiedPosition["-21,-37"] = true;
-        occupiedPosition["-21,-36"] = true;
-        occupiedPosition["-21,-5"] = true;
-        occupiedPosition["-21,-4"] = true;
-        occupiedPosition["-21,-3"] = true;
-        occupiedPosition["-21,-2"] = true;
-        occupiedPosition["-21,-1"] = true;
-        occupiedPosition["-21,0"] = true;
-        occupiedPosition["-21,1"] = true;
-        occupiedPosition["-21,9"] = true;
-        occupiedPosition["-21,10"] = true;
-        occupiedPosition["-21,34"] = true;
-        occupiedPosition["-21,35"] = true;
-        occupiedPosition["-21,43"] = true;
-        occupiedPosition["-21,44"] = true;
-        occupiedPosition["-21,45"] = true;
-        occupiedPosition["-21,46"] = true;
-        occupiedPosition["-21,63"] = true;
-        occupiedPosition["-21,64"] = true;
-        occupiedPosition["-20,-56"] = true;
-        occupiedPosition["-20,-55"] = true;
-        occupiedPosition["-20,-54"] = true;
-        occupiedPosition["-20,-53"] = true;
-        occupiedPosition["-20,-50"] = true;
-        occupiedPosition["-20,-49"] = true;
-        occupiedPosition["-20,-45"] = true;
-        occupiedPosition["-20,-44"] = true;
-        occupiedPosition["-20,-43"] = true;
-        occupiedPosition["-20,-39"] = true;
-        occupiedPosition["-20,-38"] = true;
-        occupiedPosition["-20,-37"] = true;
-        occupiedPosition["-20,-36"] = true;
-        occupiedPosition["-20,-35"] = true;
-        occupiedPosition["-20,-34"] = true;
-        occupiedPosition["-20,-28"] = true;
-        occupiedPosition["-20,-27"] = true;
-        occupiedPosition["-20,-4"] = true;
-        occupiedPosition["-20,-3"] = true;
-        occupiedPosition["-20,-2"] = true;
-        occupiedPosition["-20,-1"] = true;
-        occupiedPosition["-20,0"] = true;
-        occupiedPosition["-20,1"] = true;
-        occupiedPosition["-20,9"] = true;
-        occupiedPosition["-20,10"] = true;
-        occupiedPosition["-20,34"] = true;
-        occupiedPosition["-20,35"] = true;
-        occupiedPosition["-20,43"] = true;
-        occupiedPosition["-20,44"] = true;
-        occupiedPosition["-20,45"] = true;
-        occupiedPosition["-20,64"] = true;
-        occupiedPosition["-19,-56"] = true;
-        occupiedPosition["-19,-55"] = true;
-        occupiedPosition["-19,-54"] = true;
-        occupiedPosition["-19,-53"] = true;
-        occupiedPosition["-19,-50"] = true;
-        occupiedPosition["-19,-49"] = true;
-        occupiedPosition["-19,-44"] = true;
-        occupiedPosition["-19,-39"] = true;
-        occupiedPosition["-19,-38"] = true;
-        occupiedPosition["-19,-37"] = true;
-        occupiedPosition["-19,-36"] = true;
-        occupiedPosition["-19,-35"] = true;
-        occupiedPosition["-19,-34"] = true;
-        occupiedPosition["-19,-28"] = true;
-        occupiedPosition["-19,-27"] = true;
-        occupiedPosition["-19,-26"] = true;
-        occupiedPosition["-19,-1"] = true;
-        occupiedPosition["-19,0"] = true;
-        occupiedPosition["-19,1"] = true;
-        occupiedPosition["-19,9"] = true;
-        occupiedPosition["-19,10"] = true;
-        occupiedPosition["-19,34"] = true;
-        occupiedPosition["-19,35"] = true;
-        occupiedPosition["-19,63"] = true;
-        occupiedPosition["-19,64"] = true;
-        occupiedPosition["-18,-56"] = true;
-        occupiedPosition["-18,-55"] = true;
-        occupiedPosition["-18,-54"] = true;
-        occupiedPosition["-18,-53"] = true;
-        occupiedPosition["-18,-52"] = true;
-        occupiedPosition["-18,-51"] = true;
-        occupiedPosition["-18,-50"] = true;
-        occupiedPosition["-18,-49"] = true;
-        occupiedPosition["-18,-39"] = true;
-        occupiedPosition["-18,-38"] = true;
-        occupiedPosition["-18,-37"] = true;
-        occupiedPosition["-18,-36"] = true;
-        occupiedPosition["-18,-35"] = true;
-        occupiedPosition["-18,-31"] = true;
-        occupiedPosition["-18,-30"] = true;
-        occupiedPosition["-18,-29"] = true;
-        occupiedPosition["-18,-28"] = true;
-        occupiedPosition["-18,-27"] = true;
-        occupiedPosition["-18,-26"] = true;
-        occupiedPosition["-18,-25"] = true;
-        occupiedPosition["-18,-24"] = true;
-        occupiedPosition["-18,-13"] = true;
-        occupiedPosition["-18,-12"] = true;
-        occupiedPosition["-18,-11"] = true;
-        occupiedPosition["-18,-10"] = true;
-        occupiedPosition["-18,-9"] = true;
-        occupiedPosition["-18,-8"] = true;
-        occupiedPosition["-18,-1"] = true;
-        occupiedPosition["-18,0"] = true;
-        occupiedPosition["-18,1"] = true;
-        occupiedPosition["-18,9"] = true;
-        occupiedPosition["-18,10"] = true;
-        occupiedPosition["-18,34"] = true;
-        occupiedPosition["-18,35"] = true;
-        occupiedPosition["-18,64"] = true;
-        occupiedPosition["-17,-56"] = true;
-        occupiedPosition["-17,-55"] = true;
-        occupiedPosition["-17,-53"] = true;
-        occupiedPosition["-17,-52"] = true;
-        occupiedPosition["-17,-51"] = true;
-        occupiedPosition["-17,-50"] = true;
-        occupiedPosition["-17,-49"] = true;
-        occupiedPosition["-17,-38"] = true;
-        occupiedPosition["-17,-37"] = true;
-        occupiedPosition["-17,-36"] = true;
-        occupiedPosition["-17,-35"] = true;
-        occupiedPosition["-17,-34"] = true;
-        occupiedPosition["-17,-31"] = true;
-        occupiedPosition["-17,-30"] = true;
-        occupiedPosition["-17,-29"] = true;
-        occupiedPosition["-17,-28"] = true;
-        occupiedPosition["-17,-27"] = true;
-        occupiedPosition["-17,-26"] = true;
-        occupiedPosition["-17,-25"] = true;
-        occupiedPosition["-17,-24"] = true;
-        occupiedPosition["-17,-13"] = true;
-        occupiedPosition["-17,-12"] = true;
-        occupiedPosition["-17,-11"] = true;
-        occupiedPosition["-17,-10"] = true;
-        occupiedPosition["-17,-9"] = true;
-        occupiedPosition["-17,-8"] = true;
-        occupiedPosition["-17,-5"] = true;
-        occupiedPosition["-17,-4"] = true;
-        occupiedPosition["-17,-3"] = true;
-        occupiedPosition["-17,-1"] = true;
-        occupiedPosition["-17,0"] = true;
-        occupiedPosition["-17,1"] = true;
-        occupiedPosition["-17,9"] = true;
-        occupiedPosition["-17,10"] = true;
-        occupiedPosition["-17,34"] = true;
-        occupiedPosition["-17,35"] = true;
-        occupiedPosition["-17,64"] = true;
-        occupiedPosition["-16,-56"] = true;
-        occupiedPosition["-16,-55"] = true;
-        occupiedPosition["-16,-54"] = true;
-        occupiedPosition["-16,-53"] = true;
-        occupiedPosition["-16,-52"] = true;
-        occupiedPosition["-16,-51"] = true;
-        occupiedPosition["-16,-50"] = true;
-        occupiedPosition["-16,-49"] = true;
-        occupiedPosition["-16,-41"] = true;
-        occupiedPosition["-16,-40"] = true;
-        occupiedPosition["-16,-39"] = true;
-        occupiedPosition["-16,-38"] = true;
-        occupiedPosition["-16,-37"] = true;
-        occupiedPosition["-16,-36"] = true;
-        occupiedPosition["-16,-35"] = true;
-        occupiedPosition["-16,-34"] = true;
-        occupiedPosition["-16,-32"] = true;
-        occupiedPosition["-16,-31"] = true;
-        occupiedPosition["-16,-30"] = true;
-        occupiedPosition["-16,-29"] = true;
-        occupiedPosition["-16,-28"] = true;
-        occupiedPosition["-16,-25"] = true;
-        occupiedPosition["-16,-24"] = true;
-        occupiedPosition["-16,-13"] = true;
-        occupiedPosition["-16,-12"] = true;
-        occupiedPosition["-16,-9"] = true;
-        occupiedPosition["-16,-8"] = true;
-        occupiedPosition["-16,-5"] = true;
-        occupiedPosition["-16,-4"] = true;
-        occupiedPosition["-16,-3"] = true;
-        occupiedPosition["-16,-1"] = true;
-        occupiedPosition["-16,0"] = true;
-        occupiedPosition["-16,1"] = true;
-        occupiedPosition["-16,9"] = true;
-        occupiedPosition["-16,10"] = true;
-        occupiedPosition["-16,20"] = true;
-        occupiedPosition["-16,21"] = true;
-        occupiedPosition["-16,22"] = true;
-        occupiedPosition["-16,23"] = true;
-        occupiedPosition["-16,24"] = true;
-        occupiedPosition["-16,34"] = true;
-        occupiedPosition["-16,35"] = true;
-        occupiedPosition["-16,37"] = true;
-        occupiedPosition["-16,38"] = true;
-        occupiedPosition["-16,39"] = true;
-        occupiedPosition["-16,43"] = true;
-        occupiedPosition["-16,44"] = true;
-        occupiedPosition["-16,45"] = true;
-        occupiedPosition["-16,46"] = true;
-        occupiedPosition["-16,47"] = true;
-        occupiedPosition["-16,48"] = true;
-        occupiedPosition["-16,49"] = true;
-        occupiedPosition["-16,50"] = true;
-        occupiedPosition["-16,51"] = true;
-        occupiedPosition["-16,52"] = true;
-        occupiedPosition["-16,53"] = true;
-        occupiedPosition["-16,54"] = true;
-        occupiedPosition["-16,55"] = true;
-        occupiedPosition["-16,56"] = true;
-        occupiedPosition["-16,57"] = true;
-        occupiedPosition["-16,58"] = true;
-        occupiedPosition["-16,59"] = true;
-        occupiedPosition["-16,60"] = true;
-        occupiedPosition["-16,63"] = true;
-        occupiedPosition["-16,64"] = true;
-        occupiedPosition["-15,-56"] = true;
-        occupiedPosition["-15,-55"] = true;
-        occupiedPosition["-15,-54"] = true;
-        occupiedPosition["-15,-53"] = true;
-        occupiedPosition["-15,-52"] = true;
-        occupiedPosition["-15,-51"] = true;
-        occupiedPosition["-15,-50"] = true;
-        occupiedPosition["-15,-49"] = true;
-        occupiedPosition["-15,-41"] = true;
-        occupiedPosition["-15,-40"] = true;
-        occupiedPosition["-15,-39"] = true;
-        occupiedPosition["-15,-38"] = true;
-        occupiedPosition["-15,-37"] = true;
-        occupiedPosition["-15,-36"] = true;
-        occupiedPosition["-15,-35"] = true;
-        occupiedPosition["-15,-34"] = true;
-        occupiedPosition["-15,-33"] = true;
-        occupiedPosition["-15,-32"] = true;
-        occupiedPosition["-15,-31"] = true;
-        occupiedPosition["-15,-30"] = true;
-        occupiedPosition["-15,-29"] = true;
-        occupiedPosition["-15,-28"] = true;
-        occupiedPosition["-15,-27"] = true;
-        occupiedPosition["-15,-26"] = true;
-        occupiedPosition["-15,-25"] = true;
-        occupiedPosition["-15,-24"] = true;
-        occupiedPosition["-15,-23"] = true;
-        occupiedPosition["-15,-22"] = true;
-        occupiedPosition["-15,-21"] = true;
-        occupiedPosition["-15,-20"] = true;
-        occupiedPosition["-15,-17"] = true;
-        occupiedPosition["-15,-16"] = true;
-        occupiedPosition["-15,-15"] = true;
-        occupiedPosition["-15,-14"] = true;
-        occupiedPosition["-15,-13"] = true;
-        occupiedPosition["-15,-12"] = true;
-        occupiedPosition["-15,-11"] = true;
-        occupiedPosition["-15,-10"] = true;
-        occupiedPosition["-15,-9"] = true;
-        occupiedPosition["-15,-8"] = true;
-        occupiedPosition["-15,-7"] = true;
-        occupiedPosition["-15,-5"] = true;
-        occupiedPosition["-15,-4"] = true;
-        occupiedPosition["-15,-3"] = true;
-        occupiedPosition["-15,-1"] = true;
-        occupiedPosition["-15,0"] = true;
-        occupiedPosition["-15,1"] = true;
-        occupiedPosition["-15,9"] = true;
-        occupiedPosition["-15,10"] = true;
-        occupiedPosition["-15,11"] = true;
-        occupiedPosition["-15,12"] = true;
-        occupiedPosition["-15,13"] = true;
-        occupiedPosition["-15,14"] = true;
-        occupiedPosition["-15,15"] = true;
-        occupiedPosition["-15,16"] = true;
-        occupiedPosition["-15,17"] = true;
-        occupiedPosition["-15,18"] = true;
-        occupiedPosition["-15,19"] = true;
-        occupiedPosition["-15,20"] = true;
-        occupiedPosition["-15,21"] = true;
-        occupiedPosition["-15,22"] = true;
-        occupiedPosition["-15,23"] = true;
-        occupiedPosition["-15,24"] = true;
-        occupiedPosition["-15,25"] = true;
-        occupiedPosition["-15,26"] = true;
-        occupiedPosition["-15,27"] = true;
-        occupiedPosition["-15,28"] = true;
-        occupiedPosition["-15,29"] = true;
-        occupiedPosition["-15,30"] = true;
-        occupiedPosition["-15,31"] = true;
-        occupiedPosition["-15,32"] = true;
-        occupiedPosition["-15,33"] = true;
-        occupiedPosition["-15,34"] = true;
-        occupiedPosition["-15,35"] = true;
-        occupiedPosition["-15,36"] = true;
-        occupiedPosition["-15,37"] = true;
-        occupiedPosition["-15,38"] = true;
-        occupiedPosition["-15,39"] = true;
-        occupiedPosition["-15,43"] = true;
-        occupiedPosition["-15,44"] = true;
-        occupiedPosition["-15,45"] = true;
-        occupiedPosition["-15,46"] = true;
-        occupiedPosition["-15,47"] = true;
-        occupiedPosition["-15,48"] = true;
-        occupiedPosition["-15,49"] = true;
-        occupiedPosition["-15,50"] = true;
-        occupiedPosition["-15,51"] = true;
-        occupiedPosition["-15,52"] = true;
-        occupiedPosition["-15,53"] = true;
-        occupiedPosition["-15,54"] = true;
-        occupiedPosition["-15,55"] = true;
-        occupiedPosition["-15,56"] = true;
-        occupiedPosition["-15,57"] = true;
-        occupiedPosition["-15,58"] = true;
-        occupiedPosition["-15,59"] = true;
-        occupiedPosition["-15,60"] = true;
-        occupiedPosition["-15,64"] = true;
-        occupiedPosition["-14,-56"] = true;
-        occupiedPosition["-14,-55"] = true;
-        occupiedPosition["-14,-54"] = true;
-        occupiedPosition["-14,-53"] = true;
-        occupiedPosition["-14,-50"] = true;
-        occupiedPosition["-14,-49"] = true;
-        occupiedPosition["-14,-41"] = true;
-        occupiedPosition["-14,-40"] = true;
-        occupiedPosition["-14,-39"] = true;
-        occupiedPosition["-14,-38"] = true;
-        occupiedPosition["-14,-37"] = true;
-        occupiedPosition["-14,-36"] = true;
-        occupiedPosition["-14,-35"] = true;
-        occupiedPosition["-14,-33"] = true;
-        occupiedPosition["-14,-32"] = true;
-        occupiedPosition["-14,-31"] = true;
-        occupiedPosition["-14,-30"] = true;
-        occupiedPosition["-14,-29"] = true;
-        occupiedPosition["-14,-28"] = true;
-        occupiedPosition["-14,-27"] = true;
-        occupiedPosition["-14,-26"] = true;
-        occupiedPosition["-14,-25"] = true;
-        occupiedPosition["-14,-24"] = true;
-        occupiedPosition["-14,-23"] = true;
-        occupiedPosition["-14,-22"] = true;
-        occupiedPosition["-14,-21"] = true;
-        occupiedPosition["-14,-20"] = true;
-        occupiedPosition["-14,-17"] = true;
-        occupiedPosition["-14,-16"] = true;
-        occupiedPosition["-14,-15"] = true;
-        occupiedPosition["-14,-14"] = true;
-        occupiedPosition["-14,-13"] = true;
-        occupiedPosition["-14,-12"] = true;
-        occupiedPosition["-14,-11"] = true;
-        occupiedPosition["-14,-10"] = true;
-        occupiedPosition["-14,-9"] = true;
-        occupiedPosition["-14,-8"] = true;
-        occupiedPosition["-14,-7"] = true;
-        occupiedPosition["-14,-6"] = true;
-        occupiedPosition["-14,-5"] = true;
-        occupiedPosition["-14,-4"] = true;
-        occupiedPosition["-14,-1"] = true;
-        occupiedPosition["-14,0"] = true;
-        occupiedPosition["-14,1"] = true;
-        occupiedPosition["-14,4"] = true;
-        occupiedPosition["-14,9"] = true;
-        occupiedPosition["-14,10"] = true;
-        occupiedPosition["-14,11"] = true;
-        occupiedPosition["-14,12"] = true;
-        occupiedPosition["-14,13"] = true;
-        occupiedPosition["-14,14"] = true;
-        occupiedPosition["-14,15"] = true;
-        occupiedPosition["-14,16"] = true;
-        occupiedPosition["-14,17"] = true;
-        occupiedPosition["-14,18"] = true;
-        occupiedPosition["-14,19"] = true;
-        occupiedPosition["-14,20"] = true;
-        occupiedPosition["-14,21"] = true;
-        occupiedPosition["-14,22"] = true;
-        occupiedPosition["-14,23"] = true;
-        occupiedPosition["-14,24"] = true;
-        occupiedPosition["-14,25"] = true;
-        occupiedPosition["-14,26"] = true;
-        occupiedPosition["-14,27"] = true;
-        occupiedPosition["-14,28"] = true;
-        occupiedPosition["-14,29"] = true;
-        occupiedPosition["-14,30"] = true;
-        occupiedPosition["-14,31"] = true;
-        occupiedPosition["-14,32"] = true;
-        occupiedPosition["-14,33"] = true;
-        occupiedPosition["-14,34"] = true;
-        occupiedPosition["-14,36"] = true;
-        occupiedPosition["-14,37"] = true;
-        occupiedPosition["-14,38"] = true;
-        occupiedPosition["-14,39"] = true;
-        occupiedPosition["-14,43"] = true;
-        occupiedPosition["-14,44"] = true;
-        occupiedPosition["-14,47"] = true;
-        occupiedPosition["-14,48"] = true;
-        occupiedPosition["-14,49"] = true;
-        occupiedPosition["-14,50"] = true;
-        occupiedPosition["-14,53"] = true;
-        occupiedPosition["-14,54"] = true;
-        occupiedPosition["-14,55"] = true;
-        occupiedPosition["-14,56"] = true;
-        occupiedPosition["-14,59"] = true;
-        occupiedPosition["-14,60"] = true;
-        occupiedPosition["-14,63"] = true;
-        occupiedPosition["-14,64"] = true;
-        occupiedPosition["-13,-56"] = true;
-        occupiedPosition["-13,-55"] = true;
-        occupiedPosition["-13,-54"] = true;
-        occupiedPosition["-13,-53"] = true;
-        occupiedPosition["-13,-50"] = true;
-        occupiedPosition["-13,-49"] = true;
-        occupiedPosition["-13,-41"] = true;
-        occupiedPosition["-13,-40"] = true;
-        occupiedPosition["-13,-39"] = true;
-        occupiedPosition["-13,-38"] = true;
-        occupiedPosition["-13,-37"] = true;
-        occupiedPosition["-13,-36"] = true;
-        occupiedPosition["-13,-35"] = true;
-        occupiedPosition["-13,-33"] = true;
-        occupiedPosition["-13,-32"] = true;
-        occupiedPosition["-13,-21"] = true;
-        occupiedPosition["-13,-20"] = true;
-        occupiedPosition["-13,-19"] = true;
-        occupiedPosition["-13,-18"] = true;
-        occupiedPosition["-13,-17"] = true;
-        occupiedPosition["-13,-16"] = true;
-        occupiedPosition["-13,-6"] = true;
-        occupiedPosition["-13,-5"] = true;
-        occupiedPosition["-13,-4"] = true;
-        occupiedPosition["-13,-1"] = true;
-        occupiedPosition["-13,0"] = true;
-        occupiedPosition["-13,1"] = true;
-        occupiedPosition["-13,4"] = true;
-        occupiedPosition["-13,19"] = true;
-        occupiedPosition["-13,20"] = true;
-        occupiedPosition["-13,23"] = true;
-        occupiedPosition["-13,24"] = true;
-        occupiedPosition["-13,43"] = true;
-        occupiedPosition["-13,44"] = true;
-        occupiedPosition["-13,47"] = true;
-        occupiedPosition["-13,48"] = true;
-        occupiedPosition["-13,49"] = true;
-        occupiedPosition["-13,50"] = true;
-        occupiedPosition["-13,53"] = true;
-        occupiedPosition["-13,54"] = true;
-        occupiedPosition["-13,55"] = true;
-        occupiedPosition["-13,56"] = true;
-        occupiedPosition["-13,59"] = true;
-        occupiedPosition["-13,60"] = true;
-        occupiedPosition["-13,63"] = true;
-        occupiedPosition["-13,64"] = true;
-        occupiedPosition["-12,-56"] = true;
-        occupiedPosition["-12,-55"] = true;
-        occupiedPosition["-12,-54"] = true;
-        occupiedPosition["-12,-53"] = true;
-        occupiedPosition["-12,-52"] = true;
-        occupiedPosition["-12,-51"] = true;
-        occupiedPosition["-12,-50"] = true;
-        occupiedPosition["-12,-49"] = true;
-        occupiedPosition["-12,-41"] = true;
-        occupiedPosition["-12,-40"] = true;
-        occupiedPosition["-12,-39"] = true;
-        occupiedPosition["-12,-36"] = true;
-        occupiedPosition["-12,-35"] = true;
-        occupiedPosition["-12,-33"] = true;
-        occupiedPosition["-12,-32"] = true;
-        occupiedPosition["-12,-21"] = true;
-        occupiedPosition["-12,-20"] = true;
-        occupiedPosition["-12,-19"] = true;
-        occupiedPosition["-12,-18"] = true;
-        occupiedPosition["-12,-17"] = true;
-        occupiedPosition["-12,-16"] = true;
-        occupiedPosition["-12,-5"] = true;
-        occupiedPosition["-12,-4"] = true;
-        occupiedPosition["-12,-1"] = true;
-        occupiedPosition["-12,0"] = true;
-        occupiedPosition["-12,1"] = true;
-        occupiedPosition["-12,4"] = true;
-        occupiedPosition["-12,19"] = true;
-        occupiedPosition["-12,20"] = true;
-        occupiedPosition["-12,21"] = true;
-        occupiedPosition["-12,22"] = true;
-        occupiedPosition["-12,23"] = true;
-        occupiedPosition["-12,24"] = true;
-        occupiedPosition["-12,43"] = true;
-        occupiedPosition["-12,44"] = true;
-        occupiedPosition["-12,45"] = true;
-        occupiedPosition["-12,46"] = true;
-        occupiedPosition["-12,47"] = true;
-        occupiedPosition["-12,48"] = true;
-        occupiedPosition["-12,49"] = true;
-        occupiedPosition["-12,50"] = true;
-        occupiedPosition["-12,51"] = true;
-        occupiedPosition["-12,52"] = true;
-        occupiedPosition["-12,53"] = true;
-        occupiedPosition["-12,54"] = true;
-        occupiedPosition["-12,55"] = true;
-        occupiedPosition["-12,56"] = true;
-        occupiedPosition["-12,57"] = true;
-        occupiedPosition["-12,58"] = true;
-        occupiedPosition["-12,59"] = true;
-        occupiedPosition["-12,60"] = true;
-        occupiedPosition["-12,63"] = true;
-        occupiedPosition["-12,64"] = true;
-        occupiedPosition["-11,-56"] = true;
-        occupiedPosition["-11,-55"] = true;
-        occupiedPosition["-11,-53"] = true;
-        occupiedPosition["-11,-52"] = true;
-        occupiedPosition["-11,-51"] = true;
-        occupiedPosition["-11,-50"] = true;
-        occupiedPosition["-11,-49"] = true;
-        occupiedPosition["-11,-41"] = true;
-        occupiedPosition["-11,-40"] = true;
-        occupiedPosition["-11,-39"] = true;
-        occupiedPosition["-11,-36"] = true;
-        occupiedPosition["-11,-35"] = true;
-        occupiedPosition["-11,-33"] = true;
-        occupiedPosition["-11,-32"] = true;
-        occupiedPosition["-11,-21"] = true;
-        occupiedPosition["-11,-20"] = true;
-        occupiedPosition["-11,-19"] = true;
-        occupiedPosition["-11,-18"] = true;
-        occupiedPosition["-11,-17"] = true;
-        occupiedPosition["-11,-16"] = true;
-        occupiedPosition["-11,-5"] = true;
-        occupiedPosition["-11,-4"] = true;
-        occupiedPosition["-11,-1"] = true;
-        occupiedPosition["-11,0"] = true;
-        occupiedPosition["-11,1"] = true;
-        occupiedPosition["-11,19"] = true;
-        occupiedPosition["-11,20"] = true;
-        occupiedPosition["-11,21"] = true;
-        occupiedPosition["-11,22"] = true;
-        occupiedPosition["-11,23"] = true;
-        occupiedPosition["-11,24"] = true;
-        occupiedPosition["-11,43"] = true;
-        occupiedPosition["-11,44"] = true;
-        occupiedPosition["-11,45"] = true;
-        occupiedPosition["-11,46"] = true;
-        occupiedPosition["-11,47"] = true;
-        occupiedPosition["-11,49"] = true;
-        occupiedPosition["-11,50"] = true;
-        occupiedPosition["-11,51"] = true;
-        occupiedPosition["-11,52"] = true;
-        occupiedPosition["-11,53"] = true;
-        occupiedPosition["-11,55"] = true;
-        occupiedPosition["-11,56"] = true;
-        occupiedPosition["-11,57"] = true;
-        occupiedPosition["-11,58"] = true;
-        occupiedPosition["-11,59"] = true;
-        occupiedPosition["-11,60"] = true;
-        occupiedPosition["-11,63"] = true;
-        occupiedPosition["-11,64"] = true;
-        occupiedPosition["-10,-56"] = true;
-        occupiedPosition["-10,-55"] = true;
-        occupiedPosition["-10,-54"] = true;
-        occupiedPosition["-10,-53"] = true;
-        occupiedPosition["-10,-52"] = true;
-        occupiedPosition["-10,-51"] = true;
-        occupiedPosition["-10,-50"] = true;
-        occupiedPosition["-10,-49"] = true;
-        occupiedPosition["-10,-41"] = true;
-        occupiedPosition["-10,-40"] = true;
-        occupiedPosition["-10,-39"] = true;
-        occupiedPosition["-10,-38"] = true;
-        occupiedPosition["-10,-37"] = true;
-        occupiedPosition["-10,-36"] = true;
-        occupiedPosition["-10,-35"] = true;
-        occupiedPosition["-10,-33"] = true;
-        occupiedPosition["-10,-32"] = true;
-        occupiedPosition["-10,-21"] = true;
-        occupiedPosition["-10,-20"] = true;
-        occupiedPosition["-10,-17"] = true;
-        occupiedPosition["-10,-16"] = true;
-        occupiedPosition["-10,-5"] = true;
-        occupiedPosition["-10,-4"] = true;
-        occupiedPosition["-10,-1"] = true;
-        occupiedPosition["-10,0"] = true;
-        occupiedPosition["-10,1"] = true;
-        occupiedPosition["-10,26"] = true;
-        occupiedPosition["-10,27"] = true;
-        occupiedPosition["-10,64"] = true;
-        occupiedPosition["-9,-56"] = true;
-        occupiedPosition["-9,-55"] = true;
-        occupiedPosition["-9,-54"] = true;
-        occupiedPosition["-9,-53"] = true;
-        occupiedPosition["-9,-52"] = true;
-        occupiedPosition["-9,-51"] = true;
-        occupiedPosition["-9,-50"] = true;
-        occupiedPosition["-9,-49"] = true;
-        occupiedPosition["-9,-41"] = true;
-        occupiedPosition["-9,-40"] = true;
-        occupiedPosition["-9,-39"] = true;
-        occupiedPosition["-9,-38"] = true;
-        occupiedPosition["-9,-37"] = true;
-        occupiedPosition["-9,-36"] = true;
-        occupiedPosition["-9,-35"] = true;
-        occupiedPosition["-9,-33"] = true;
-        occupiedPosition["-9,-32"] = true;
-        occupiedPosition["-9,-21"] = true;
-        occupiedPosition["-9,-20"] = true;
-        occupiedPosition["-9,-17"] = true;
-        occupiedPosition["-9,-16"] = true;
-        occupiedPosition["-9,-5"] = true;
-        occupiedPosition["-9,-4"] = true;
-        occupiedPosition["-9,-1"] = true;
-        occupiedPosition["-9,0"] = true;
-        occupiedPosition["-9,1"] = true;
-        occupiedPosition["-9,25"] = true;
-        occupiedPosition["-9,26"] = true;
-        occupiedPosition["-9,27"] = true;
-        occupiedPosition["-9,28"] = true;
-        occupiedPosition["-9,64"] = true;
-        occupiedPosition["-8,-56"] = true;
-        occupiedPosition["-8,-55"] = true;
-        occupiedPosition["-8,-54"] = true;
-        occupiedPosition["-8,-53"] = true;
-        occupiedPosition["-8,-50"] = true;
-        occupiedPosition["-8,-49"] = true;
-        occupiedPosition["-8,-40"] = true;
-        occupiedPosition["-8,-33"] = true;
-        occupiedPosition["-8,-32"] = true;
-        occupiedPosition["-8,-31"] = true;
-        occupiedPosition["-8,-30"] = true;
-        occupiedPosition["-8,-29"] = true;
-        occupiedPosition["-8,-28"] = true;
-        occupiedPosition["-8,-27"] = true;
-        occupiedPosition["-8,-26"] = true;
-        occupiedPosition["-8,-25"] = true;
-        occupiedPosition["-8,-24"] = true;
-        occupiedPosition["-8,-23"] = true;
-        occupiedPosition["-8,-22"] = true;
-        occupiedPosition["-8,-21"] = true;
-        occupiedPosition["-8,-20"] = true;
-        occupiedPosition["-8,-17"] = true;
-        occupiedPosition["-8,-16"] = true;
-        occupiedPosition["-8,-15"] = true;
-        occupiedPosition["-8,-14"] = true;
-        occupiedPosition["-8,-13"] = true;
-        occupiedPosition["-8,-12"] = true;
-        occupiedPosition["-8,-11"] = true;
-        occupiedPosition["-8,-10"] = true;
-        occupiedPosition["-8,-9"] = true;
-        occupiedPosition["-8,-8"] = true;
-        occupiedPosition["-8,-7"] = true;
-        occupiedPosition["-8,-6"] = true;
-        occupiedPosition["-8,-5"] = true;
-        occupiedPosition["-8,-4"] = true;
-        occupiedPosition["-8,-1"] = true;
-        occupiedPosition["-8,0"] = true;
-        occupiedPosition["-8,1"] = true;
-        occupiedPosition["-8,12"] = true;
-        occupiedPosition["-8,13"] = true;
-        occupiedPosition["-8,14"] = true;
-        occupiedPosition["-8,15"] = true;
-        occupiedPosition["-8,16"] = true;
-        occupiedPosition["-8,17"] = true;
-        occupiedPosition["-8,25"] = true;
-        occupiedPosition["-8,26"] = true;
-        occupiedPosition["-8,27"] = true;
-        occupiedPosition["-8,28"] = true;
-        occupiedPosition["-8,63"] = true;
-        occupiedPosition["-8,64"] = true;
-        occupiedPosition["-7,-56"] = true;
-        occupiedPosition["-7,-55"] = true;
-        occupiedPosition["-7,-54"] = true;
-        occupiedPosition["-7,-53"] = true;
-        occupiedPosition["-7,-50"] = true;
-        occupiedPosition["-7,-49"] = true;
-        occupiedPosition["-7,-33"] = true;
-        occupiedPosition["-7,-32"] = true;
-        occupiedPosition["-7,-31"] = true;
-        occupiedPosition["-7,-30"] = true;
-        occupiedPosition["-7,-29"] = true;
-        occupiedPosition["-7,-28"] = true;
-        occupiedPosition["-7,-27"] = true;
-        occupiedPosition["-7,-26"] = true;
-        occupiedPosition["-7,-25"] = true;
-        occupiedPosition["-7,-24"] = true;
-        occupiedPosition["-7,-23"] = true;
-        occupiedPosition["-7,-22"] = true;
-        occupiedPosition["-7,-21"] = true;
-        occupiedPosition["-7,-20"] = true;
-        occupiedPosition["-7,-17"] = true;
-        occupiedPosition["-7,-16"] = true;
-        occupiedPosition["-7,-15"] = true;
-        occupiedPosition["-7,-14"] = true;
-        occupiedPosition["-7,-13"] = true;
-        occupiedPosition["-7,-12"] = true;
-        occupiedPosition["-7,-11"] = true;
-        occupiedPosition["-7,-10"] = true;
-        occupiedPosition["-7,-9"] = true;
-        occupiedPosition["-7,-8"] = true;
-        occupiedPosition["-7,-7"] = true;
-        occupiedPosition["-7,-6"] = true;
-        occupiedPosition["-7,-5"] = true;
-        occupiedPosition["-7,-4"] = true;
-        occupiedPosition["-7,-1"] = true;
-        occupiedPosition["-7,0"] = true;
-        occupiedPosition["-7,1"] = true;
-        occupiedPosition["-7,12"] = true;
-        occupiedPosition["-7,13"] = true;
-        occupiedPosition["-7,14"] = true;
-        occupiedPosition["-7,15"] = true;
-        occupiedPosition["-7,16"] = true;
-        occupiedPosition["-7,17"] = true;
-        occupiedPosition["-7,18"] = true;
-        occupiedPosition["-7,26"] = true;
-        occupiedPosition["-7,27"] = true;
-        occupiedPosition["-7,43"] = true;
-        occupiedPosition["-7,44"] = true;
-        occupiedPosition["-7,45"] = true;
-        occupiedPosition["-7,46"] = true;
-        occupiedPosition["-7,47"] = true;
-        occupiedPosition["-7,48"] = true;
-        occupiedPosition["-7,49"] = true;
-        occupiedPosition["-7,50"] = true;
-        occupiedPosition["-7,51"] = true;
-        occupiedPosition["-7,52"] = true;
-        occupiedPosition["-7,53"] = true;
-        occupiedPosition["-7,54"] = true;
-        occupiedPosition["-7,57"] = true;
-        occupiedPosition["-7,58"] = true;
-        occupiedPosition["-7,59"] = true;
-        occupiedPosition["-7,60"] = true;
-        occupiedPosition["-7,61"] = true;
-        occupiedPosition["-7,62"] = true;
-        occupiedPosition["-7,64"] = true;
-        occupiedPosition["-6,-56"] = true;
-        occupiedPosition["-6,-55"] = true;
-        occupiedPosition["-6,-54"] = true;
-        occupiedPosition["-6,-53"] = true;
-        occupiedPosition["-6,-52"] = true;
-        occupiedPosition["-6,-51"] = true;
-        occupiedPosition["-6,-50"] = true;
-        occupiedPosition["-6,-49"] = true;
-        occupiedPosition["-6,-32"] = true;
-        occupiedPosition["-6,-31"] = true;
-        occupiedPosition["-6,-16"] = true;
-        occupiedPosition["-6,-15"] = true;
-        occupiedPosition["-6,-14"] = true;
-        occupiedPosition["-6,-1"] = true;
-        occupiedPosition["-6,0"] = true;
-        occupiedPosition["-6,1"] = true;
-        occupiedPosition["-6,12"] = true;
-        occupiedPosition["-6,13"] = true;
-        occupiedPosition["-6,14"] = true;
-        occupiedPosition["-6,15"] = true;
-        occupiedPosition["-6,16"] = true;
-        occupiedPosition["-6,17"] = true;
-        occupiedPosition["-6,18"] = true;
-        occupiedPosition["-6,30"] = true;
-        occupiedPosition["-6,31"] = true;
-        occupiedPosition["-6,43"] = true;
-        occupiedPosition["-6,44"] = true;
-        occupiedPosition["-6,45"] = true;
-        occupiedPosition["-6,46"] = true;
-        occupiedPosition["-6,47"] = true;
-        occupiedPosition["-6,48"] = true;
-        occupiedPosition["-6,49"] = true;
-        occupiedPosition["-6,50"] = true;
-        occupiedPosition["-6,51"] = true;
-        occupiedPosition["-6,52"] = true;
-        occupiedPosition["-6,53"] = true;
-        occupiedPosition["-6,54"] = true;
-        occupiedPosition["-6,55"] = true;
-        occupiedPosition["-6,57"] = true;
-        occupiedPosition["-6,58"] = true;
-        occupiedPosition["-6,59"] = true;
-        occupiedPosition["-6,60"] = true;
-        occupiedPosition["-6,61"] = true;
-        occupiedPosition["-6,62"] = true;
-        occupiedPosition["-6,64"] = true;
-        occupiedPosition["-5,-56"] = true;
-        occupiedPosition["-5,-55"] = true;
-        occupiedPosition["-5,-54"] = true;
-        occupiedPosition["-5,-53"] = true;
-        occupiedPosition["-5,-52"] = true;
-        occupiedPosition["-5,-51"] = true;
-        occupiedPosition["-5,-50"] = true;
-        occupiedPosition["-5,-49"] = true;
-        occupiedPosition["-5,-33"] = true;
-        occupiedPosition["-5,-32"] = true;
-        occupiedPosition["-5,-31"] = true;
-        occupiedPosition["-5,-30"] = true;
-        occupiedPosition["-5,-16"] = true;
-        occupiedPosition["-5,-15"] = true;
-        occupiedPosition["-5,-14"] = true;
-        occupiedPosition["-5,-1"] = true;
-        occupiedPosition["-5,0"] = true;
-        occupiedPosition["-5,1"] = true;
-        occupiedPosition["-5,2"] = true;
-        occupiedPosition["-5,3"] = true;
-        occupiedPosition["-5,4"] = true;
-        occupiedPosition["-5,12"] = true;
-        occupiedPosition["-5,13"] = true;
-        occupiedPosition["-5,14"] = true;
-        occupiedPosition["-5,15"] = true;
-        occupiedPosition["-5,16"] = true;
-        occupiedPosition["-5,17"] = true;
-        occupiedPosition["-5,18"] = true;
-        occupiedPosition["-5,29"] = true;
-        occupiedPosition["-5,30"] = true;
-        occupiedPosition["-5,31"] = true;
-        occupiedPosition["-5,32"] = true;
-        occupiedPosition["-5,43"] = true;
-        occupiedPosition["-5,44"] = true;
-        occupiedPosition["-5,47"] = true;
-        occupiedPosition["-5,48"] = true;
-        occupiedPosition["-5,49"] = true;
-        occupiedPosition["-5,50"] = true;
-        occupiedPosition["-5,54"] = true;
-        occupiedPosition["-5,55"] = true;
-        occupiedPosition["-5,57"] = true;
-        occupiedPosition["-5,58"] = true;
-        occupiedPosition["-5,61"] = true;
-        occupiedPosition["-5,62"] = true;
-        occupiedPosition["-5,63"] = true;
-        occupiedPosition["-5,64"] = true;
-        occupiedPosition["-4,-56"] = true;
-        occupiedPosition["-4,-55"] = true;
-        occupiedPosition["-4,-33"] = true;
-        occupiedPosition["-4,-32"] = true;
-        occupiedPosition["-4,-31"] = true;
-        occupiedPosition["-4,-30"] = true;
-        occupiedPosition["-4,-16"] = true;
-        occupiedPosition["-4,-15"] = true;
-        occupiedPosition["-4,-14"] = true;
-        occupiedPosition["-4,-1"] = true;
-        occupiedPosition["-4,0"] = true;
-        occupiedPosition["-4,1"] = true;
-        occupiedPosition["-4,2"] = true;
-        occupiedPosition["-4,3"] = true;
-        occupiedPosition["-4,4"] = true;
-        occupiedPosition["-4,12"] = true;
-        occupiedPosition["-4,13"] = true;
-        occupiedPosition["-4,14"] = true;
-        occupiedPosition["-4,15"] = true;
-        occupiedPosition["-4,16"] = true;
-        occupiedPosition["-4,17"] = true;
-        occupiedPosition["-4,18"] = true;
-        occupiedPosition["-4,29"] = true;
-        occupiedPosition["-4,30"] = true;
-        occupiedPosition["-4,31"] = true;
-        occupiedPosition["-4,32"] = true;
-        occupiedPosition["-4,43"] = true;
-        occupiedPosition["-4,44"] = true;
-        occupiedPosition["-4,45"] = true;
-        occupiedPosition["-4,46"] = true;
-        occupiedPosition["-4,47"] = true;
-        occupiedPosition["-4,48"] = true;
-        occupiedPosition["-4,49"] = true;
-        occupiedPosition["-4,50"] = true;
-        occupiedPosition["-4,51"] = true;
-        occupiedPosition["-4,52"] = true;
-        occupiedPosition["-4,53"] = true;
-        occupiedPosition["-4,54"] = true;
-        occupiedPosition["-4,55"] = true;
-        occupiedPosition["-4,57"] = true;
-        occupiedPosition["-4,58"] = true;
-        occupiedPosition["-4,61"] = true;
-        occupiedPosition["-4,62"] = true;
-        occupiedPosition["-4,64"] = true;
-        occupiedPosition["-3,-56"] = true;
-        occupiedPosition["-3,-55"] = true;
-        occupiedPosition["-3,-32"] = true;
-        occupiedPosition["-3,-31"] = true;
-        occupiedPosition["-3,-1"] = true;
-        occupiedPosition["-3,0"] = true;
-        occupiedPosition["-3,1"] = true;
-        occupiedPosition["-3,2"] = true;
-        occupiedPosition["-3,3"] = true;
-        occupiedPosition["-3,4"] = true;
-        occupiedPosition["-2,-56"] = true;
-        occupiedPosition["-2,-55"] = true;
-        occupiedPosition["-2,-54"] = true;
-        occupiedPosition["-2,-53"] = true;
-        occupiedPosition["-2,-52"] = true;
-        occupiedPosition["-2,-51"] = true;
-        occupiedPosition["-2,-49"] = true;
-        occupiedPosition["-2,-46"] = true;
-        occupiedPosition["-2,-44"] = true;
-        occupiedPosition["-2,-43"] = true;
-        occupiedPosition["-2,-41"] = true;
-        occupiedPosition["-2,-38"] = true;
-        occupiedPosition["-2,-36"] = true;
-        occupiedPosition["-2,-35"] = true;
-        occupiedPosition["-2,-33"] = true;
-        occupiedPosition["-2,-25"] = true;
-        occupiedPosition["-2,-23"] = true;
-        occupiedPosition["-2,-22"] = true;
-        occupiedPosition["-2,-20"] = true;
-        occupiedPosition["-2,-18"] = true;
-        occupiedPosition["-2,-17"] = true;
-        occupiedPosition["-2,-15"] = true;
-        occupiedPosition["-2,-13"] = true;
-        occupiedPosition["-2,-12"] = true;
-        occupiedPosition["-2,-9"] = true;
-        occupiedPosition["-2,-8"] = true;
-        occupiedPosition["-2,-6"] = true;
-        occupiedPosition["-2,-4"] = true;
-        occupiedPosition["-2,-3"] = true;
-        occupiedPosition["-2,-1"] = true;
-        occupiedPosition["-2,0"] = true;
-        occupiedPosition["-2,1"] = true;
-        occupiedPosition["-2,3"] = true;
-        occupiedPosition["-1,-56"] = true;
-        occupiedPosition["-1,-55"] = true;
-        occupiedPosition["-1,-54"] = true;
-        occupiedPosition["-1,-53"] = true;
-        occupiedPosition["-1,-52"] = true;
-        occupiedPosition["-1,-51"] = true;
-        occupiedPosition["-1,-50"] = true;
-        occupiedPosition["-1,-49"] = true;
-        occupiedPosition["-1,-48"] = true;
-        occupiedPosition["-1,-47"] = true;
-        occupiedPosition["-1,-46"] = true;
-        occupiedPosition["-1,-45"] = true;
-        occupiedPosition["-1,-44"] = true;
-        occupiedPosition["-1,-43"] = true;
-        occupiedPosition["-1,-42"] = true;
-        occupiedPosition["-1,-41"] = true;
-        occupiedPosition["-1,-40"] = true;
-        occupiedPosition["-1,-39"] = true;
-        occupiedPosition["-1,-38"] = true;
-        occupiedPosition["-1,-37"] = true;
-        occupiedPosition["-1,-36"] = true;
-        occupiedPosition["-1,-35"] = true;
-        occupiedPosition["-1,-34"] = true;
-        occupiedPosition["-1,-33"] = true;
-        occupiedPosition["-1,-32"] = true;
-        occupiedPosition["-1,-31"] = true;
-        occupiedPosition["-1,-30"] = true;
-        occupiedPosition["-1,-29"] = true;
-        occupiedPosition["-1,-28"] = true;
-        occupiedPosition["-1,-27"] = true;
-        occupiedPosition["-1,-26"] = true;
-        occupiedPosition["-1,-25"] = true;
-        occupiedPosition["-1,-24"] = true;
-        occupiedPosition["-1,-23"] = true;
-        occupiedPosition["-1,-22"] = true;
-        occupiedPosition["-1,-21"] = true;
-        occupiedPosition["-1,-20"] = true;
-        occupiedPosition["-1,-19"] = true;
-        occupiedPosition["-1,-18"] = true;
-        occupiedPosition["-1,-17"] = true;
-        occupiedPosition["-1,-16"] = true;
-        occupiedPosition["-1,-15"] = true;
-        occupiedPosition["-1,-14"] = true;
-        occupiedPosition["-1,-13"] = true;
-        occupiedPosition["-1,-12"] = true;
-        occupiedPosition["-1,-11"] = true;
-        occupiedPosition["-1,-10"] = true;
-        occupiedPosition["-1,-9"] = true;
-        occupiedPosition["-1,-8"] = true;
-        occupiedPosition["-1,-7"] = true;
-        occupiedPosition["-1,-6"] = true;
-        occupiedPosition["-1,-5"] = true;
-        occupiedPosition["-1,-4"] = true;
-        occupiedPosition["-1,-3"] = true;
-        occupiedPosition["-1,-2"] = true;
-        occupiedPosition["-1,-1"] = true;
-        occupiedPosition["-1,0"] = true;
-        occupiedPosition["-1,1"] = true;
-        occupiedPosition["-1,64"] = true;
-        occupiedPosition["0,-56"] = true;
-        occupiedPosition["0,-55"] = true;
-        occupiedPosition["0,-54"] = true;
-        occupiedPosition["0,-53"] = true;
-        occupiedPosition["0,-52"] = true;
-        occupiedPosition["0,-51"] = true;
-        occupiedPosition["0,-50"] = true;
-        occupiedPosition["0,-49"] = true;
-        occupiedPosition["0,-48"] = true;
-        occupiedPosition["0,-47"] = true;
-        occupiedPosition["0,-46"] = true;
-        occupiedPosition["0,-45"] = true;
-        occupiedPosition["0,-44"] = true;
-        occupiedPosition["0,-43"] = true;
-        occupiedPosition["0,-42"] = true;
-        occupiedPosition["0,-41"] = true;
-        occupiedPosition["0,-40"] = true;
-        occupiedPosition["0,-39"] = true;
-        occupiedPosition["0,-38"] = true;
-        occupiedPosition["0,-37"] = true;
-        occupiedPosition["0,-36"] = true;
-        occupiedPosition["0,-35"] = true;
-        occupiedPosition["0,-34"] = true;
-        occupiedPosition["0,-33"] = true;
-        occupiedPosition["0,-32"] = true;
-        occupiedPosition["0,-31"] = true;
-        occupiedPosition["0,-30"] = true;
-        occupiedPosition["0,-29"] = true;
-        occupiedPosition["0,-28"] = true;
-        occupiedPosition["0,-27"] = true;
-        occupiedPosition["0,-26"] = true;
-        occupiedPosition["0,-25"] = true;
-        occupiedPosition["0,-24"] = true;
-        occupiedPosition["0,-23"] = true;
-        occupiedPosition["0,-22"] = true;
-        occupiedPosition["0,-21"] = true;
-        occupiedPosition["0,-20"] = true;
-        occupiedPosition["0,-19"] = true;
-        occupiedPosition["0,-18"] = true;
-        occupiedPosition["0,-17"] = true;
-        occupiedPosition["0,-16"] = true;
-        occupiedPosition["0,-15"] = true;
-        occupiedPosition["0,-14"] = true;
-        occupiedPosition["0,-13"] = true;
-        occupiedPosition["0,-12"] = true;
-        occupiedPosition["0,-11"] = true;
-        occupiedPosition["0,-10"] = true;
-        occupiedPosition["0,-9"] = true;
-        occupiedPosition["0,-8"] = true;
-        occupiedPosition["0,-7"] = true;
-        occupiedPosition["0,-6"] = true;
-        occupiedPosition["0,-5"] = true;
-        occupiedPosition["0,-4"] = true;
-        occupiedPosition["0,-3"] = true;
-        occupiedPosition["0,-2"] = true;
-        occupiedPosition["0,-1"] = true;
-        occupiedPosition["0,0"] = true;
-        occupiedPosition["0,1"] = true;
-        occupiedPosition["1,-56"] = true;
-        occupiedPosition["1,-55"] = true;
-        occupiedPosition["1,-54"] = true;
-        occupiedPosition["1,-53"] = true;
-        occupiedPosition["1,-52"] = true;
-        occupiedPosition["1,-51"] = true;
-        occupiedPosition["1,-50"] = true;
-        occupiedPosition["1,-49"] = true;
-        occupiedPosition["1,-48"] = true;
-        occupiedPosition["1,-47"] = true;
-        occupiedPosition["1,-46"] = true;
-        occupiedPosition["1,-45"] = true;
-        occupiedPosition["1,-44"] = true;
-        occupiedPosition["1,-43"] = true;
-        occupiedPosition["1,-42"] = true;
-        occupiedPosition["1,-41"] = true;
-        occupiedPosition["1,-40"] = true;
-        occupiedPosition["1,-39"] = true;
-        occupiedPosition["1,-38"] = true;
-        occupiedPosition["1,-37"] = true;
-        occupiedPosition["1,-36"] = true;
-        occupiedPosition["1,-35"] = true;
-        occupiedPosition["1,-34"] = true;
-        occupiedPosition["1,-33"] = true;
-        occupiedPosition["1,-32"] = true;
-        occupiedPosition["1,-31"] = true;
-        occupiedPosition["1,-30"] = true;
-        occupiedPosition["1,-29"] = true;
-        occupiedPosition["1,-28"] = true;
-        occupiedPosition["1,-27"] = true;
-        occupiedPosition["1,-26"] = true;
-        occupiedPosition["1,-25"] = true;
-        occupiedPosition["1,-24"] = true;
-        occupiedPosition["1,-23"] = true;
-        occupiedPosition["1,-22"] = true;
-        occupiedPosition["1,-21"] = true;
-        occupiedPosition["1,-20"] = true;
-        occupiedPosition["1,-19"] = true;
-        occupiedPosition["1,-18"] = true;
-        occupiedPosition["1,-17"] = true;
-        occupiedPosition["1,-16"] = true;
-        occupiedPosition["1,-15"] = true;
-        occupiedPosition["1,-14"] = true;
-        occupiedPosition["1,-13"] = true;
-        occupiedPosition["1,-12"] = true;
-        occupiedPosition["1,-11"] = true;
-        occupiedPosition["1,-10"] = true;
-        occupiedPosition["1,-9"] = true;
-        occupiedPosition["1,-8"] = true;
-        occupiedPosition["1,-7"] = true;
-        occupiedPosition["1,-6"] = true;
-        occupiedPosition["1,-5"] = true;
-        occupiedPosition["1,-4"] = true;
-        occupiedPosition["1,-3"] = true;
-        occupiedPosition["1,-2"] = true;
-        occupiedPosition["1,-1"] = true;
-        occupiedPosition["1,0"] = true;
-        occupiedPosition["1,1"] = true;
-        occupiedPosition["1,2"] = true;
-        occupiedPosition["2,-56"] = true;
-        occupiedPosition["2,-54"] = true;
-        occupiedPosition["2,-53"] = true;
-        occupiedPosition["2,-51"] = true;
-        occupiedPosition["2,-49"] = true;
-        occupiedPosition["2,-48"] = true;
-        occupiedPosition["2,-45"] = true;
-        occupiedPosition["2,-44"] = true;
-        occupiedPosition["2,-42"] = true;
-        occupiedPosition["2,-40"] = true;
-        occupiedPosition["2,-39"] = true;
-        occupiedPosition["2,-37"] = true;
-        occupiedPosition["2,-35"] = true;
-        occupiedPosition["2,-34"] = true;
-        occupiedPosition["2,-32"] = true;
-        occupiedPosition["2,-24"] = true;
-        occupiedPosition["2,-22"] = true;
-        occupiedPosition["2,-21"] = true;
-        occupiedPosition["2,-19"] = true;
-        occupiedPosition["2,-16"] = true;
-        occupiedPosition["2,-15"] = true;
-        occupiedPosition["2,-14"] = true;
-        occupiedPosition["2,-13"] = true;
-        occupiedPosition["2,-11"] = true;
-        occupiedPosition["2,-8"] = true;
-        occupiedPosition["2,-6"] = true;
-        occupiedPosition["2,-5"] = true;
-        occupiedPosition["2,-4"] = true;
-        occupiedPosition["2,-3"] = true;
-        occupiedPosition["2,-2"] = true;
-        occupiedPosition["2,-1"] = true;
-        occupiedPosition["2,0"] = true;
-        occupiedPosition["2,1"] = true;
-        occupiedPosition["2,2"] = true;
-        occupiedPosition["2,3"] = true;
-        occupiedPosition["2,4"] = true;
-        occupiedPosition["2,64"] = true;
-        occupiedPosition["3,-56"] = true;
-        occupiedPosition["3,-26"] = true;
-        occupiedPosition["3,-25"] = true;
-        occupiedPosition["3,-15"] = true;
-        occupiedPosition["3,-14"] = true;
-        occupiedPosition["3,-2"] = true;
-        occupiedPosition["3,-1"] = true;
-        occupiedPosition["3,0"] = true;
-        occupiedPosition["3,1"] = true;
-        occupiedPosition["3,3"] = true;
-        occupiedPosition["3,4"] = true;
-        occupiedPosition["4,-56"] = true;
-        occupiedPosition["4,-43"] = true;
-        occupiedPosition["4,-42"] = true;
-        occupiedPosition["4,-41"] = true;
-        occupiedPosition["4,-27"] = true;
-        occupiedPosition["4,-26"] = true;
-        occupiedPosition["4,-25"] = true;
-        occupiedPosition["4,-24"] = true;
-        occupiedPosition["4,-2"] = true;
-        occupiedPosition["4,-1"] = true;
-        occupiedPosition["4,0"] = true;
-        occupiedPosition["4,1"] = true;
-        occupiedPosition["4,2"] = true;
-        occupiedPosition["4,3"] = true;
-        occupiedPosition["4,4"] = true;
-        occupiedPosition["4,7"] = true;
-        occupiedPosition["4,8"] = true;
-        occupiedPosition["4,10"] = true;
-        occupiedPosition["4,11"] = true;
-        occupiedPosition["4,12"] = true;
-        occupiedPosition["4,13"] = true;
-        occupiedPosition["4,14"] = true;
-        occupiedPosition["4,15"] = true;
-        occupiedPosition["4,16"] = true;
-        occupiedPosition["4,17"] = true;
-        occupiedPosition["4,18"] = true;
-        occupiedPosition["4,19"] = true;
-        occupiedPosition["4,20"] = true;
-        occupiedPosition["4,21"] = true;
-        occupiedPosition["4,22"] = true;
-        occupiedPosition["4,33"] = true;
-        occupiedPosition["4,34"] = true;
-        occupiedPosition["4,35"] = true;
-        occupiedPosition["4,36"] = true;
-        occupiedPosition["4,47"] = true;
-        occupiedPosition["4,48"] = true;
-        occupiedPosition["4,49"] = true;
-        occupiedPosition["4,50"] = true;
-        occupiedPosition["4,51"] = true;
-        occupiedPosition["4,52"] = true;
-        occupiedPosition["4,53"] = true;
-        occupiedPosition["5,-56"] = true;
-        occupiedPosition["5,-43"] = true;
-        occupiedPosition["5,-42"] = true;
-        occupiedPosition["5,-41"] = true;
-        occupiedPosition["5,-27"] = true;
-        occupiedPosition["5,-26"] = true;
-        occupiedPosition["5,-25"] = true;
-        occupiedPosition["5,-24"] = true;
-        occupiedPosition["5,-8"] = true;
-        occupiedPosition["5,-7"] = true;
-        occupiedPosition["5,-6"] = true;
-        occupiedPosition["5,-5"] = true;
-        occupiedPosition["5,-4"] = true;
-        occupiedPosition["5,-3"] = true;
-        occupiedPosition["5,-2"] = true;
-        occupiedPosition["5,-1"] = true;
-        occupiedPosition["5,0"] = true;
-        occupiedPosition["5,1"] = true;
-        occupiedPosition["5,2"] = true;
-        occupiedPosition["5,3"] = true;
-        occupiedPosition["5,4"] = true;
-        occupiedPosition["5,7"] = true;
-        occupiedPosition["5,8"] = true;
-        occupiedPosition["5,10"] = true;
-        occupiedPosition["5,11"] = true;
-        occupiedPosition["5,15"] = true;
-        occupiedPosition["5,16"] = true;
-        occupiedPosition["5,17"] = true;
-        occupiedPosition["5,18"] = true;
-        occupiedPosition["5,21"] = true;
-        occupiedPosition["5,22"] = true;
-        occupiedPosition["5,33"] = true;
-        occupiedPosition["5,34"] = true;
-        occupiedPosition["5,35"] = true;
-        occupiedPosition["5,36"] = true;
-        occupiedPosition["5,47"] = true;
-        occupiedPosition["5,48"] = true;
-        occupiedPosition["5,49"] = true;
-        occupiedPosition["5,50"] = true;
-        occupiedPosition["5,51"] = true;
-        occupiedPosition["5,52"] = true;
-        occupiedPosition["5,53"] = true;
-        occupiedPosition["5,64"] = true;
-        occupiedPosition["6,-56"] = true;
-        occupiedPosition["6,-43"] = true;
-        occupiedPosition["6,-42"] = true;
-        occupiedPosition["6,-41"] = true;
-        occupiedPosition["6,-26"] = true;
-        occupiedPosition["6,-25"] = true;
-        occupiedPosition["6,-8"] = true;
-        occupiedPosition["6,-7"] = true;
-        occupiedPosition["6,-6"] = true;
-        occupiedPosition["6,-5"] = true;
-        occupiedPosition["6,-4"] = true;
-        occupiedPosition["6,-3"] = true;
-        occupiedPosition["6,-2"] = true;
-        occupiedPosition["6,-1"] = true;
-        occupiedPosition["6,0"] = true;
-        occupiedPosition["6,1"] = true;
-        occupiedPosition["6,2"] = true;
-        occupiedPosition["6,3"] = true;
-        occupiedPosition["6,4"] = true;
-        occupiedPosition["6,5"] = true;
-        occupiedPosition["6,6"] = true;
-        occupiedPosition["6,7"] = true;
-        occupiedPosition["6,8"] = true;
-        occupiedPosition["6,10"] = true;
-        occupiedPosition["6,11"] = true;
-        occupiedPosition["6,12"] = true;
-        occupiedPosition["6,13"] = true;
-        occupiedPosition["6,14"] = true;
-        occupiedPosition["6,15"] = true;
-        occupiedPosition["6,16"] = true;
-        occupiedPosition["6,17"] = true;
-        occupiedPosition["6,18"] = true;
-        occupiedPosition["6,19"] = true;
-        occupiedPosition["6,20"] = true;
-        occupiedPosition["6,21"] = true;
-        occupiedPosition["6,22"] = true;
-        occupiedPosition["6,34"] = true;
-        occupiedPosition["6,35"] = true;
-        occupiedPosition["6,47"] = true;
-        occupiedPosition["6,48"] = true;
-        occupiedPosition["6,49"] = true;
-        occupiedPosition["6,50"] = true;
-        occupiedPosition["6,51"] = true;
-        occupiedPosition["6,52"] = true;
-        occupiedPosition["6,53"] = true;
-        occupiedPosition["7,-56"] = true;
-        occupiedPosition["7,-53"] = true;
-        occupiedPosition["7,-52"] = true;
-        occupiedPosition["7,-51"] = true;
-        occupiedPosition["7,-50"] = true;
-        occupiedPosition["7,-49"] = true;
-        occupiedPosition["7,-48"] = true;
-        occupiedPosition["7,-47"] = true;
-        occupiedPosition["7,-46"] = true;
-        occupiedPosition["7,-45"] = true;
-        occupiedPosition["7,-44"] = true;
-        occupiedPosition["7,-43"] = true;
-        occupiedPosition["7,-42"] = true;
-        occupiedPosition["7,-41"] = true;
-        occupiedPosition["7,-40"] = true;
-        occupiedPosition["7,-37"] = true;
-        occupiedPosition["7,-36"] = true;
-        occupiedPosition["7,-35"] = true;
-        occupiedPosition["7,-34"] = true;
-        occupiedPosition["7,-33"] = true;
-        occupiedPosition["7,-32"] = true;
-        occupiedPosition["7,-31"] = true;
-        occupiedPosition["7,-30"] = true;
-        occupiedPosition["7,-29"] = true;
-        occupiedPosition["7,-28"] = true;
-        occupiedPosition["7,-27"] = true;
-        occupiedPosition["7,-26"] = true;
-        occupiedPosition["7,-25"] = true;
-        occupiedPosition["7,-24"] = true;
-        occupiedPosition["7,-8"] = true;
-        occupiedPosition["7,-7"] = true;
-        occupiedPosition["7,-4"] = true;
-        occupiedPosition["7,-3"] = true;
-        occupiedPosition["7,-2"] = true;
-        occupiedPosition["7,-1"] = true;
-        occupiedPosition["7,0"] = true;
-        occupiedPosition["7,1"] = true;
-        occupiedPosition["7,2"] = true;
-        occupiedPosition["7,3"] = true;
-        occupiedPosition["7,4"] = true;
-        occupiedPosition["7,5"] = true;
-        occupiedPosition["7,6"] = true;
-        occupiedPosition["7,7"] = true;
-        occupiedPosition["7,8"] = true;
-        occupiedPosition["7,11"] = true;
-        occupiedPosition["7,12"] = true;
-        occupiedPosition["7,13"] = true;
-        occupiedPosition["7,14"] = true;
-        occupiedPosition["7,15"] = true;
-        occupiedPosition["7,16"] = true;
-        occupiedPosition["7,17"] = true;
-        occupiedPosition["7,18"] = true;
-        occupiedPosition["7,19"] = true;
-        occupiedPosition["7,20"] = true;
-        occupiedPosition["7,21"] = true;
-        occupiedPosition["7,22"] = true;
-        occupiedPosition["7,38"] = true;
-        occupiedPosition["7,39"] = true;
-        occupiedPosition["7,47"] = true;
-        occupiedPosition["7,48"] = true;
-        occupiedPosition["7,49"] = true;
-        occupiedPosition["7,50"] = true;
-        occupiedPosition["7,51"] = true;
-        occupiedPosition["7,52"] = true;
-        occupiedPosition["7,53"] = true;
-        occupiedPosition["8,-56"] = true;
-        occupiedPosition["8,-53"] = true;
-        occupiedPosition["8,-52"] = true;
-        occupiedPosition["8,-51"] = true;
-        occupiedPosition["8,-50"] = true;
-        occupiedPosition["8,-49"] = true;
-        occupiedPosition["8,-48"] = true;
-        occupiedPosition["8,-47"] = true;
-        occupiedPosition["8,-46"] = true;
-        occupiedPosition["8,-45"] = true;
-        occupiedPosition["8,-44"] = true;
-        occupiedPosition["8,-43"] = true;
-        occupiedPosition["8,-42"] = true;
-        occupiedPosition["8,-41"] = true;
-        occupiedPosition["8,-40"] = true;
-        occupiedPosition["8,-37"] = true;
-        occupiedPosition["8,-36"] = true;
-        occupiedPosition["8,-35"] = true;
-        occupiedPosition["8,-34"] = true;
-        occupiedPosition["8,-33"] = true;
-        occupiedPosition["8,-32"] = true;
-        occupiedPosition["8,-31"] = true;
-        occupiedPosition["8,-30"] = true;
-        occupiedPosition["8,-29"] = true;
-        occupiedPosition["8,-28"] = true;
-        occupiedPosition["8,-27"] = true;
-        occupiedPosition["8,-26"] = true;
-        occupiedPosition["8,-25"] = true;
-        occupiedPosition["8,-24"] = true;
-        occupiedPosition["8,-17"] = true;
-        occupiedPosition["8,-8"] = true;
-        occupiedPosition["8,-7"] = true;
-        occupiedPosition["8,-4"] = true;
-        occupiedPosition["8,-3"] = true;
-        occupiedPosition["8,-2"] = true;
-        occupiedPosition["8,-1"] = true;
-        occupiedPosition["8,0"] = true;
-        occupiedPosition["8,1"] = true;
-        occupiedPosition["8,2"] = true;
-        occupiedPosition["8,3"] = true;
-        occupiedPosition["8,4"] = true;
-        occupiedPosition["8,37"] = true;
-        occupiedPosition["8,38"] = true;
-        occupiedPosition["8,39"] = true;
-        occupiedPosition["8,40"] = true;
-        occupiedPosition["8,48"] = true;
-        occupiedPosition["8,49"] = true;
-        occupiedPosition["8,50"] = true;
-        occupiedPosition["8,51"] = true;
-        occupiedPosition["8,52"] = true;
-        occupiedPosition["8,53"] = true;
-        occupiedPosition["8,64"] = true;
-        occupiedPosition["9,-56"] = true;
-        occupiedPosition["9,-53"] = true;
-        occupiedPosition["9,-52"] = true;
-        occupiedPosition["9,-41"] = true;
-        occupiedPosition["9,-40"] = true;
-        occupiedPosition["9,-37"] = true;
-        occupiedPosition["9,-36"] = true;
-        occupiedPosition["9,-25"] = true;
-        occupiedPosition["9,-24"] = true;
-        occupiedPosition["9,-22"] = true;
-        occupiedPosition["9,-21"] = true;
-        occupiedPosition["9,-20"] = true;
-        occupiedPosition["9,-19"] = true;
-        occupiedPosition["9,-18"] = true;
-        occupiedPosition["9,-17"] = true;
-        occupiedPosition["9,-16"] = true;
-        occupiedPosition["9,-8"] = true;
-        occupiedPosition["9,-7"] = true;
-        occupiedPosition["9,-6"] = true;
-        occupiedPosition["9,-5"] = true;
-        occupiedPosition["9,-4"] = true;
-        occupiedPosition["9,-3"] = true;
-        occupiedPosition["9,-2"] = true;
-        occupiedPosition["9,-1"] = true;
-        occupiedPosition["9,0"] = true;
-        occupiedPosition["9,1"] = true;
-        occupiedPosition["9,2"] = true;
-        occupiedPosition["9,3"] = true;
-        occupiedPosition["9,4"] = true;
-        occupiedPosition["9,37"] = true;
-        occupiedPosition["9,38"] = true;
-        occupiedPosition["9,39"] = true;
-        occupiedPosition["9,40"] = true;
-        occupiedPosition["9,64"] = true;
-        occupiedPosition["10,-56"] = true;
-        occupiedPosition["10,-53"] = true;
-        occupiedPosition["10,-52"] = true;
-        occupiedPosition["10,-41"] = true;
-        occupiedPosition["10,-40"] = true;
-        occupiedPosition["10,-37"] = true;
-        occupiedPosition["10,-36"] = true;
-        occupiedPosition["10,-25"] = true;
-        occupiedPosition["10,-24"] = true;
-        occupiedPosition["10,-22"] = true;
-        occupiedPosition["10,-21"] = true;
-        occupiedPosition["10,-20"] = true;
-        occupiedPosition["10,-19"] = true;
-        occupiedPosition["10,-18"] = true;
-        occupiedPosition["10,-17"] = true;
-        occupiedPosition["10,-16"] = true;
-        occupiedPosition["10,-8"] = true;
-        occupiedPosition["10,-7"] = true;
-        occupiedPosition["10,-6"] = true;
-        occupiedPosition["10,-5"] = true;
-        occupiedPosition["10,-4"] = true;
-        occupiedPosition["10,-3"] = true;
-        occupiedPosition["10,-2"] = true;
-        occupiedPosition["10,-1"] = true;
-        occupiedPosition["10,0"] = true;
-        occupiedPosition["10,1"] = true;
-        occupiedPosition["10,2"] = true;
-        occupiedPosition["10,3"] = true;
-        occupiedPosition["10,4"] = true;
-        occupiedPosition["10,38"] = true;
-        occupiedPosition["10,39"] = true;
-        occupiedPosition["10,64"] = true;
-        occupiedPosition["11,-56"] = true;
-        occupiedPosition["11,-53"] = true;
-        occupiedPosition["11,-52"] = true;
-        occupiedPosition["11,-41"] = true;
-        occupiedPosition["11,-40"] = true;
-        occupiedPosition["11,-39"] = true;
-        occupiedPosition["11,-38"] = true;
-        occupiedPosition["11,-37"] = true;
-        occupiedPosition["11,-36"] = true;
-        occupiedPosition["11,-25"] = true;
-        occupiedPosition["11,-24"] = true;
-        occupiedPosition["11,-22"] = true;
-        occupiedPosition["11,-21"] = true;
-        occupiedPosition["11,-18"] = true;
-        occupiedPosition["11,-17"] = true;
-        occupiedPosition["11,-16"] = true;
-        occupiedPosition["11,-8"] = true;
-        occupiedPosition["11,-7"] = true;
-        occupiedPosition["11,-6"] = true;
-        occupiedPosition["11,-5"] = true;
-        occupiedPosition["11,-4"] = true;
-        occupiedPosition["11,-2"] = true;
-        occupiedPosition["11,-1"] = true;
-        occupiedPosition["11,0"] = true;
-        occupiedPosition["11,1"] = true;
-        occupiedPosition["11,2"] = true;
-        occupiedPosition["11,3"] = true;
-        occupiedPosition["11,4"] = true;
-        occupiedPosition["11,5"] = true;
-        occupiedPosition["11,6"] = true;
-        occupiedPosition["11,7"] = true;
-        occupiedPosition["11,8"] = true;
-        occupiedPosition["11,9"] = true;
-        occupiedPosition["11,10"] = true;
-        occupiedPosition["11,12"] = true;
-        occupiedPosition["11,13"] = true;
-        occupiedPosition["11,14"] = true;
-        occupiedPosition["11,15"] = true;
-        occupiedPosition["11,16"] = true;
-        occupiedPosition["11,18"] = true;
-        occupiedPosition["11,19"] = true;
-        occupiedPosition["11,20"] = true;
-        occupiedPosition["11,21"] = true;
-        occupiedPosition["11,22"] = true;
-        occupiedPosition["11,41"] = true;
-        occupiedPosition["11,42"] = true;
-        occupiedPosition["11,43"] = true;
-        occupiedPosition["11,44"] = true;
-        occupiedPosition["11,45"] = true;
-        occupiedPosition["11,46"] = true;
-        occupiedPosition["11,64"] = true;
-        occupiedPosition["12,-56"] = true;
-        occupiedPosition["12,-53"] = true;
-        occupiedPosition["12,-52"] = true;
-        occupiedPosition["12,-41"] = true;
-        occupiedPosition["12,-40"] = true;
-        occupiedPosition["12,-39"] = true;
-        occupiedPosition["12,-38"] = true;
-        occupiedPosition["12,-37"] = true;
-        occupiedPosition["12,-36"] = true;
-        occupiedPosition["12,-25"] = true;
-        occupiedPosition["12,-24"] = true;
-        occupiedPosition["12,-22"] = true;
-        occupiedPosition["12,-21"] = true;
-        occupiedPosition["12,-18"] = true;
-        occupiedPosition["12,-17"] = true;
-        occupiedPosition["12,-16"] = true;
-        occupiedPosition["12,-8"] = true;
-        occupiedPosition["12,-7"] = true;
-        occupiedPosition["12,-6"] = true;
-        occupiedPosition["12,-5"] = true;
-        occupiedPosition["12,-4"] = true;
-        occupiedPosition["12,-3"] = true;
-        occupiedPosition["12,-2"] = true;
-        occupiedPosition["12,-1"] = true;
-        occupiedPosition["12,0"] = true;
-        occupiedPosition["12,1"] = true;
-        occupiedPosition["12,2"] = true;
-        occupiedPosition["12,3"] = true;
-        occupiedPosition["12,4"] = true;
-        occupiedPosition["12,5"] = true;
-        occupiedPosition["12,6"] = true;
-        occupiedPosition["12,7"] = true;
-        occupiedPosition["12,8"] = true;
-        occupiedPosition["12,9"] = true;
-        occupiedPosition["12,10"] = true;
-        occupiedPosition["12,11"] = true;
-        occupiedPosition["12,12"] = true;
-        occupiedPosition["12,13"] = true;
-        occupiedPosition["12,14"] = true;
-        occupiedPosition["12,15"] = true;
-        occupiedPosition["12,16"] = true;
-        occupiedPosition["12,17"] = true;
-        occupiedPosition["12,18"] = true;
-        occupiedPosition["12,19"] = true;
-        occupiedPosition["12,20"] = true;
-        occupiedPosition["12,21"] = true;
-        occupiedPosition["12,22"] = true;
-        occupiedPosition["12,41"] = true;
-        occupiedPosition["12,42"] = true;
-        occupiedPosition["12,43"] = true;
-        occupiedPosition["12,44"] = true;
-        occupiedPosition["12,45"] = true;
-        occupiedPosition["12,46"] = true;
-        occupiedPosition["12,61"] = true;
-        occupiedPosition["12,64"] = true;
-        occupiedPosition["13,-56"] = true;
-        occupiedPosition["13,-53"] = true;
-        occupiedPosition["13,-52"] = true;
-        occupiedPosition["13,-51"] = true;
-        occupiedPosition["13,-41"] = true;
-        occupiedPosition["13,-40"] = true;
-        occupiedPosition["13,-39"] = true;
-        occupiedPosition["13,-38"] = true;
-        occupiedPosition["13,-37"] = true;
-        occupiedPosition["13,-36"] = true;
-        occupiedPosition["13,-25"] = true;
-        occupiedPosition["13,-24"] = true;
-        occupiedPosition["13,-22"] = true;
-        occupiedPosition["13,-21"] = true;
-        occupiedPosition["13,-20"] = true;
-        occupiedPosition["13,-19"] = true;
-        occupiedPosition["13,-18"] = true;
-        occupiedPosition["13,-17"] = true;
-        occupiedPosition["13,-16"] = true;
-        occupiedPosition["13,-8"] = true;
-        occupiedPosition["13,-7"] = true;
-        occupiedPosition["13,-4"] = true;
-        occupiedPosition["13,-3"] = true;
-        occupiedPosition["13,-2"] = true;
-        occupiedPosition["13,-1"] = true;
-        occupiedPosition["13,0"] = true;
-        occupiedPosition["13,1"] = true;
-        occupiedPosition["13,2"] = true;
-        occupiedPosition["13,3"] = true;
-        occupiedPosition["13,4"] = true;
-        occupiedPosition["13,5"] = true;
-        occupiedPosition["13,6"] = true;
-        occupiedPosition["13,9"] = true;
-        occupiedPosition["13,10"] = true;
-        occupiedPosition["13,11"] = true;
-        occupiedPosition["13,12"] = true;
-        occupiedPosition["13,15"] = true;
-        occupiedPosition["13,16"] = true;
-        occupiedPosition["13,17"] = true;
-        occupiedPosition["13,18"] = true;
-        occupiedPosition["13,21"] = true;
-        occupiedPosition["13,22"] = true;
-        occupiedPosition["13,41"] = true;
-        occupiedPosition["13,42"] = true;
-        occupiedPosition["13,45"] = true;
-        occupiedPosition["13,46"] = true;
-        occupiedPosition["13,61"] = true;
-        occupiedPosition["14,-56"] = true;
-        occupiedPosition["14,-53"] = true;
-        occupiedPosition["14,-52"] = true;
-        occupiedPosition["14,-51"] = true;
-        occupiedPosition["14,-50"] = true;
-        occupiedPosition["14,-49"] = true;
-        occupiedPosition["14,-48"] = true;
-        occupiedPosition["14,-47"] = true;
-        occupiedPosition["14,-46"] = true;
-        occupiedPosition["14,-45"] = true;
-        occupiedPosition["14,-44"] = true;
-        occupiedPosition["14,-43"] = true;
-        occupiedPosition["14,-42"] = true;
-        occupiedPosition["14,-41"] = true;
-        occupiedPosition["14,-40"] = true;
-        occupiedPosition["14,-37"] = true;
-        occupiedPosition["14,-36"] = true;
-        occupiedPosition["14,-35"] = true;
-        occupiedPosition["14,-34"] = true;
-        occupiedPosition["14,-33"] = true;
-        occupiedPosition["14,-32"] = true;
-        occupiedPosition["14,-31"] = true;
-        occupiedPosition["14,-30"] = true;
-        occupiedPosition["14,-29"] = true;
-        occupiedPosition["14,-28"] = true;
-        occupiedPosition["14,-27"] = true;
-        occupiedPosition["14,-26"] = true;
-        occupiedPosition["14,-25"] = true;
-        occupiedPosition["14,-24"] = true;
-        occupiedPosition["14,-22"] = true;
-        occupiedPosition["14,-21"] = true;
-        occupiedPosition["14,-20"] = true;
-        occupiedPosition["14,-19"] = true;
-        occupiedPosition["14,-18"] = true;
-        occupiedPosition["14,-17"] = true;
-        occupiedPosition["14,-16"] = true;
-        occupiedPosition["14,-8"] = true;
-        occupiedPosition["14,-7"] = true;
-        occupiedPosition["14,-4"] = true;
-        occupiedPosition["14,-3"] = true;
-        occupiedPosition["14,-2"] = true;
-        occupiedPosition["14,-1"] = true;
-        occupiedPosition["14,0"] = true;
-        occupiedPosition["14,1"] = true;
-        occupiedPosition["14,2"] = true;
-        occupiedPosition["14,3"] = true;
-        occupiedPosition["14,4"] = true;
-        occupiedPosition["14,5"] = true;
-        occupiedPosition["14,6"] = true;
-        occupiedPosition["14,9"] = true;
-        occupiedPosition["14,10"] = true;
-        occupiedPosition["14,11"] = true;
-        occupiedPosition["14,12"] = true;
-        occupiedPosition["14,15"] = true;
-        occupiedPosition["14,16"] = true;
-        occupiedPosition["14,17"] = true;
-        occupiedPosition["14,18"] = true;
-        occupiedPosition["14,21"] = true;
-        occupiedPosition["14,22"] = true;
-        occupiedPosition["14,26"] = true;
-        occupiedPosition["14,27"] = true;
-        occupiedPosition["14,28"] = true;
-        occupiedPosition["14,29"] = true;
-        occupiedPosition["14,31"] = true;
-        occupiedPosition["14,32"] = true;
-        occupiedPosition["14,33"] = true;
-        occupiedPosition["14,34"] = true;
-        occupiedPosition["14,35"] = true;
-        occupiedPosition["14,36"] = true;
-        occupiedPosition["14,37"] = true;
-        occupiedPosition["14,38"] = true;
-        occupiedPosition["14,39"] = true;
-        occupiedPosition["14,40"] = true;
-        occupiedPosition["14,41"] = true;
-        occupiedPosition["14,42"] = true;
-        occupiedPosition["14,43"] = true;
-        occupiedPosition["14,44"] = true;
-        occupiedPosition["14,45"] = true;
-        occupiedPosition["14,46"] = true;
-        occupiedPosition["14,47"] = true;
-        occupiedPosition["14,48"] = true;
-        occupiedPosition["14,49"] = true;
-        occupiedPosition["14,50"] = true;
-        occupiedPosition["14,51"] = true;
-        occupiedPosition["14,52"] = true;
-        occupiedPosition["14,53"] = true;
-        occupiedPosition["14,54"] = true;
-        occupiedPosition["14,55"] = true;
-        occupiedPosition["14,56"] = true;
-        occupiedPosition["14,61"] = true;
-        occupiedPosition["14,64"] = true;
-        occupiedPosition["15,-56"] = true;
-        occupiedPosition["15,-54"] = true;
-        occupiedPosition["15,-53"] = true;
-        occupiedPosition["15,-52"] = true;
-        occupiedPosition["15,-50"] = true;
-        occupiedPosition["15,-49"] = true;
-        occupiedPosition["15,-48"] = true;
-        occupiedPosition["15,-47"] = true;
-        occupiedPosition["15,-46"] = true;
-        occupiedPosition["15,-45"] = true;
-        occupiedPosition["15,-44"] = true;
-        occupiedPosition["15,-43"] = true;
-        occupiedPosition["15,-42"] = true;
-        occupiedPosition["15,-41"] = true;
-        occupiedPosition["15,-40"] = true;
-        occupiedPosition["15,-37"] = true;
-        occupiedPosition["15,-36"] = true;
-        occupiedPosition["15,-35"] = true;
-        occupiedPosition["15,-34"] = true;
-        occupiedPosition["15,-33"] = true;
-        occupiedPosition["15,-32"] = true;
-        occupiedPosition["15,-31"] = true;
-        occupiedPosition["15,-30"] = true;
-        occupiedPosition["15,-29"] = true;
-        occupiedPosition["15,-28"] = true;
-        occupiedPosition["15,-27"] = true;
-        occupiedPosition["15,-26"] = true;
-        occupiedPosition["15,-25"] = true;
-        occupiedPosition["15,-24"] = true;
-        occupiedPosition["15,-23"] = true;
-        occupiedPosition["15,-22"] = true;
-        occupiedPosition["15,-21"] = true;
-        occupiedPosition["15,-20"] = true;
-        occupiedPosition["15,-19"] = true;
-        occupiedPosition["15,-18"] = true;
-        occupiedPosition["15,-17"] = true;
-        occupiedPosition["15,-16"] = true;
-        occupiedPosition["15,-8"] = true;
-        occupiedPosition["15,-7"] = true;
-        occupiedPosition["15,-6"] = true;
-        occupiedPosition["15,-5"] = true;
-        occupiedPosition["15,-4"] = true;
-        occupiedPosition["15,-3"] = true;
-        occupiedPosition["15,-2"] = true;
-        occupiedPosition["15,-1"] = true;
-        occupiedPosition["15,0"] = true;
-        occupiedPosition["15,1"] = true;
-        occupiedPosition["15,2"] = true;
-        occupiedPosition["15,3"] = true;
-        occupiedPosition["15,4"] = true;
-        occupiedPosition["15,5"] = true;
-        occupiedPosition["15,6"] = true;
-        occupiedPosition["15,7"] = true;
-        occupiedPosition["15,8"] = true;
-        occupiedPosition["15,9"] = true;
-        occupiedPosition["15,10"] = true;
-        occupiedPosition["15,11"] = true;
-        occupiedPosition["15,12"] = true;
-        occupiedPosition["15,13"] = true;
-        occupiedPosition["15,14"] = true;
-        occupiedPosition["15,15"] = true;
-        occupiedPosition["15,16"] = true;
-        occupiedPosition["15,17"] = true;
-        occupiedPosition["15,18"] = true;
-        occupiedPosition["15,19"] = true;
-        occupiedPosition["15,20"] = true;
-        occupiedPosition["15,21"] = true;
-        occupiedPosition["15,22"] = true;
-        occupiedPosition["15,26"] = true;
-        occupiedPosition["15,27"] = true;
-        occupiedPosition["15,28"] = true;
-        occupiedPosition["15,29"] = true;
-        occupiedPosition["15,30"] = true;
-        occupiedPosition["15,31"] = true;
-        occupiedPosition["15,32"] = true;
-        occupiedPosition["15,33"] = true;
-        occupiedPosition["15,34"] = true;
-        occupiedPosition["15,35"] = true;
-        occupiedPosition["15,36"] = true;
-        occupiedPosition["15,37"] = true;
-        occupiedPosition["15,38"] = true;
-        occupiedPosition["15,39"] = true;
-        occupiedPosition["15,40"] = true;
-        occupiedPosition["15,41"] = true;
-        occupiedPosition["15,42"] = true;
-        occupiedPosition["15,43"] = true;
-        occupiedPosition["15,44"] = true;
-        occupiedPosition["15,45"] = true;
-        occupiedPosition["15,46"] = true;
-        occupiedPosition["15,47"] = true;
-        occupiedPosition["15,48"] = true;
-        occupiedPosition["15,49"] = true;
-        occupiedPosition["15,50"] = true;
-        occupiedPosition["15,51"] = true;
-        occupiedPosition["15,52"] = true;
-        occupiedPosition["15,53"] = true;
-        occupiedPosition["15,54"] = true;
-        occupiedPosition["15,55"] = true;
-        occupiedPosition["15,56"] = true;
-        occupiedPosition["15,64"] = true;
-        occupiedPosition["16,-56"] = true;
-        occupiedPosition["16,-54"] = true;
-        occupiedPosition["16,-53"] = true;
-        occupiedPosition["16,-52"] = true;
-        occupiedPosition["16,-49"] = true;
-        occupiedPosition["16,-48"] = true;
-        occupiedPosition["16,-45"] = true;
-        occupiedPosition["16,-44"] = true;
-        occupiedPosition["16,-33"] = true;
-        occupiedPosition["16,-32"] = true;
-        occupiedPosition["16,-29"] = true;
-        occupiedPosition["16,-28"] = true;
-        occupiedPosition["16,-27"] = true;
-        occupiedPosition["16,-26"] = true;
-        occupiedPosition["16,-25"] = true;
-        occupiedPosition["16,-23"] = true;
-        occupiedPosition["16,-22"] = true;
-        occupiedPosition["16,-21"] = true;
-        occupiedPosition["16,-20"] = true;
-        occupiedPosition["16,-19"] = true;
-        occupiedPosition["16,-18"] = true;
-        occupiedPosition["16,-17"] = true;
-        occupiedPosition["16,-16"] = true;
-        occupiedPosition["16,-8"] = true;
-        occupiedPosition["16,-7"] = true;
-        occupiedPosition["16,-6"] = true;
-        occupiedPosition["16,-5"] = true;
-        occupiedPosition["16,-4"] = true;
-        occupiedPosition["16,-3"] = true;
-        occupiedPosition["16,-2"] = true;
-        occupiedPosition["16,-1"] = true;
-        occupiedPosition["16,0"] = true;
-        occupiedPosition["16,1"] = true;
-        occupiedPosition["16,2"] = true;
-        occupiedPosition["16,3"] = true;
-        occupiedPosition["16,4"] = true;
-        occupiedPosition["16,5"] = true;
-        occupiedPosition["16,6"] = true;
-        occupiedPosition["16,7"] = true;
-        occupiedPosition["16,8"] = true;
-        occupiedPosition["16,9"] = true;
-        occupiedPosition["16,10"] = true;
-        occupiedPosition["16,11"] = true;
-        occupiedPosition["16,12"] = true;
-        occupiedPosition["16,13"] = true;
-        occupiedPosition["16,14"] = true;
-        occupiedPosition["16,15"] = true;
-        occupiedPosition["16,16"] = true;
-        occupiedPosition["16,17"] = true;
-        occupiedPosition["16,18"] = true;
-        occupiedPosition["16,19"] = true;
-        occupiedPosition["16,20"] = true;
-        occupiedPosition["16,21"] = true;
-        occupiedPosition["16,22"] = true;
-        occupiedPosition["16,26"] = true;
-        occupiedPosition["16,27"] = true;
-        occupiedPosition["16,28"] = true;
-        occupiedPosition["16,30"] = true;
-        occupiedPosition["16,31"] = true;
-        occupiedPosition["16,41"] = true;
-        occupiedPosition["16,42"] = true;
-        occupiedPosition["16,43"] = true;
-        occupiedPosition["16,44"] = true;
-        occupiedPosition["16,45"] = true;
-        occupiedPosition["16,55"] = true;
-        occupiedPosition["16,56"] = true;
-        occupiedPosition["16,64"] = true;
-        occupiedPosition["17,-56"] = true;
-        occupiedPosition["17,-54"] = true;
-        occupiedPosition["17,-53"] = true;
-        occupiedPosition["17,-52"] = true;
-        occupiedPosition["17,-49"] = true;
-        occupiedPosition["17,-48"] = true;
-        occupiedPosition["17,-47"] = true;
-        occupiedPosition["17,-46"] = true;
-        occupiedPosition["17,-45"] = true;
-        occupiedPosition["17,-44"] = true;
-        occupiedPosition["17,-33"] = true;
-        occupiedPosition["17,-32"] = true;
-        occupiedPosition["17,-31"] = true;
-        occupiedPosition["17,-30"] = true;
-        occupiedPosition["17,-29"] = true;
-        occupiedPosition["17,-28"] = true;
-        occupiedPosition["17,-27"] = true;
-        occupiedPosition["17,-26"] = true;
-        occupiedPosition["17,-23"] = true;
-        occupiedPosition["17,-22"] = true;
-        occupiedPosition["17,-21"] = true;
-        occupiedPosition["17,-20"] = true;
-        occupiedPosition["17,-19"] = true;
-        occupiedPosition["17,-8"] = true;
-        occupiedPosition["17,-7"] = true;
-        occupiedPosition["17,-6"] = true;
-        occupiedPosition["17,-5"] = true;
-        occupiedPosition["17,-4"] = true;
-        occupiedPosition["17,-2"] = true;
-        occupiedPosition["17,-1"] = true;
-        occupiedPosition["17,0"] = true;
-        occupiedPosition["17,1"] = true;
-        occupiedPosition["17,2"] = true;
-        occupiedPosition["17,3"] = true;
-        occupiedPosition["17,4"] = true;
-        occupiedPosition["17,22"] = true;
-        occupiedPosition["17,23"] = true;
-        occupiedPosition["17,24"] = true;
-        occupiedPosition["17,30"] = true;
-        occupiedPosition["17,31"] = true;
-        occupiedPosition["17,55"] = true;
-        occupiedPosition["17,56"] = true;
-        occupiedPosition["17,64"] = true;
-        occupiedPosition["18,-56"] = true;
-        occupiedPosition["18,-49"] = true;
-        occupiedPosition["18,-48"] = true;
-        occupiedPosition["18,-47"] = true;
-        occupiedPosition["18,-46"] = true;
-        occupiedPosition["18,-45"] = true;
-        occupiedPosition["18,-44"] = true;
-        occupiedPosition["18,-33"] = true;
-        occupiedPosition["18,-32"] = true;
-        occupiedPosition["18,-31"] = true;
-        occupiedPosition["18,-30"] = true;
-        occupiedPosition["18,-29"] = true;
-        occupiedPosition["18,-28"] = true;
-        occupiedPosition["18,-27"] = true;
-        occupiedPosition["18,-26"] = true;
-        occupiedPosition["18,-22"] = true;
-        occupiedPosition["18,-21"] = true;
-        occupiedPosition["18,-20"] = true;
-        occupiedPosition["18,-19"] = true;
-        occupiedPosition["18,-18"] = true;
-        occupiedPosition["18,-8"] = true;
-        occupiedPosition["18,-7"] = true;
-        occupiedPosition["18,-6"] = true;
-        occupiedPosition["18,-5"] = true;
-        occupiedPosition["18,-4"] = true;
-        occupiedPosition["18,-3"] = true;
-        occupiedPosition["18,-2"] = true;
-        occupiedPosition["18,-1"] = true;
-        occupiedPosition["18,0"] = true;
-        occupiedPosition["18,1"] = true;
-        occupiedPosition["18,2"] = true;
-        occupiedPosition["18,3"] = true;
-        occupiedPosition["18,4"] = true;
-        occupiedPosition["18,21"] = true;
-        occupiedPosition["18,22"] = true;
-        occupiedPosition["18,23"] = true;
-        occupiedPosition["18,24"] = true;
-        occupiedPosition["18,30"] = true;
-        occupiedPosition["18,31"] = true;
-        occupiedPosition["18,55"] = true;
-        occupiedPosition["18,56"] = true;
-        occupiedPosition["19,-56"] = true;
-        occupiedPosition["19,-31"] = true;
-        occupiedPosition["19,-30"] = true;
-        occupiedPosition["19,-29"] = true;
-        occupiedPosition["19,-23"] = true;
-        occupiedPosition["19,-22"] = true;
-        occupiedPosition["19,-21"] = true;
-        occupiedPosition["19,-20"] = true;
-        occupiedPosition["19,-19"] = true;
-        occupiedPosition["19,-18"] = true;
-        occupiedPosition["19,-13"] = true;
-        occupiedPosition["19,-8"] = true;
-        occupiedPosition["19,-7"] = true;
-        occupiedPosition["19,-4"] = true;
-        occupiedPosition["19,-3"] = true;
-        occupiedPosition["19,-2"] = true;
-        occupiedPosition["19,-1"] = true;
-        occupiedPosition["19,0"] = true;
-        occupiedPosition["19,1"] = true;
-        occupiedPosition["19,2"] = true;
-        occupiedPosition["19,3"] = true;
-        occupiedPosition["19,4"] = true;
-        occupiedPosition["19,22"] = true;
-        occupiedPosition["19,23"] = true;
-        occupiedPosition["19,24"] = true;
-        occupiedPosition["19,30"] = true;
-        occupiedPosition["19,31"] = true;
-        occupiedPosition["19,55"] = true;
-        occupiedPosition["19,56"] = true;
-        occupiedPosition["19,64"] = true;
-        occupiedPosition["20,-56"] = true;
-        occupiedPosition["20,-54"] = true;
-        occupiedPosition["20,-53"] = true;
-        occupiedPosition["20,-30"] = true;
-        occupiedPosition["20,-29"] = true;
-        occupiedPosition["20,-23"] = true;
-        occupiedPosition["20,-22"] = true;
-        occupiedPosition["20,-21"] = true;
-        occupiedPosition["20,-20"] = true;
-        occupiedPosition["20,-19"] = true;
-        occupiedPosition["20,-18"] = true;
-        occupiedPosition["20,-14"] = true;
-        occupiedPosition["20,-13"] = true;
-        occupiedPosition["20,-12"] = true;
-        occupiedPosition["20,-8"] = true;
-        occupiedPosition["20,-7"] = true;
-        occupiedPosition["20,-4"] = true;
-        occupiedPosition["20,-3"] = true;
-        occupiedPosition["20,-2"] = true;
-        occupiedPosition["20,-1"] = true;
-        occupiedPosition["20,0"] = true;
-        occupiedPosition["20,1"] = true;
-        occupiedPosition["20,2"] = true;
-        occupiedPosition["20,3"] = true;
-        occupiedPosition["20,4"] = true;
-        occupiedPosition["20,20"] = true;
-        occupiedPosition["20,21"] = true;
-        occupiedPosition["20,22"] = true;
-        occupiedPosition["20,30"] = true;
-        occupiedPosition["20,31"] = true;
-        occupiedPosition["20,55"] = true;
-        occupiedPosition["20,56"] = true;
-        occupiedPosition["20,64"] = true;
-        occupiedPosition["21,-56"] = true;
-        occupiedPosition["21,-55"] = true;
-        occupiedPosition["21,-54"] = true;
-        occupiedPosition["21,-53"] = true;
-        occupiedPosition["21,-52"] = true;
-        occupiedPosition["21,-21"] = true;
-        occupiedPosition["21,-20"] = true;
-        occupiedPosition["21,-19"] = true;
-        occupiedPosition["21,-18"] = true;
-        occupiedPosition["21,-14"] = true;
-        occupiedPosition["21,-13"] = true;
-        occupiedPosition["21,-12"] = true;
-        occupiedPosition["21,-8"] = true;
-        occupiedPosition["21,-7"] = true;
-        occupiedPosition["21,-6"] = true;
-        occupiedPosition["21,-5"] = true;
-        occupiedPosition["21,-4"] = true;
-        occupiedPosition["21,-3"] = true;
-        occupiedPosition["21,-2"] = true;
-        occupiedPosition["21,-1"] = true;
-        occupiedPosition["21,0"] = true;
-        occupiedPosition["21,1"] = true;
-        occupiedPosition["21,2"] = true;
-        occupiedPosition["21,3"] = true;
-        occupiedPosition["21,4"] = true;
-        occupiedPosition["21,19"] = true;
-        occupiedPosition["21,20"] = true;
-        occupiedPosition["21,21"] = true;
-        occupiedPosition["21,22"] = true;
-        occupiedPosition["21,30"] = true;
-        occupiedPosition["21,31"] = true;
-        occupiedPosition["21,55"] = true;
-        occupiedPosition["21,56"] = true;
-        occupiedPosition["22,-56"] = true;
-        occupiedPosition["22,-55"] = true;
-        occupiedPosition["22,-54"] = true;
-        occupiedPosition["22,-53"] = true;
-        occupiedPosition["22,-52"] = true;
-        occupiedPosition["22,-42"] = true;
-        occupiedPosition["22,-41"] = true;
-        occupiedPosition["22,-40"] = true;
-        occupiedPosition["22,-14"] = true;
-        occupiedPosition["22,-13"] = true;
-        occupiedPosition["22,-12"] = true;
-        occupiedPosition["22,-8"] = true;
-        occupiedPosition["22,-7"] = true;
-        occupiedPosition["22,-6"] = true;
-        occupiedPosition["22,-5"] = true;
-        occupiedPosition["22,-4"] = true;
-        occupiedPosition["22,-3"] = true;
-        occupiedPosition["22,-1"] = true;
-        occupiedPosition["22,0"] = true;
-        occupiedPosition["22,1"] = true;
-        occupiedPosition["22,2"] = true;
-        occupiedPosition["22,3"] = true;
-        occupiedPosition["22,4"] = true;
-        occupiedPosition["22,20"] = true;
-        occupiedPosition["22,21"] = true;
-        occupiedPosition["22,22"] = true;
-        occupiedPosition["22,29"] = true;
-        occupiedPosition["22,30"] = true;
-        occupiedPosition["22,31"] = true;
-        occupiedPosition["22,55"] = true;
-        occupiedPosition["22,56"] = true;
-        occupiedPosition["22,64"] = true;
-        occupiedPosition["23,-54"] = true;
-        occupiedPosition["23,-53"] = true;
-        occupiedPosition["23,-42"] = true;
-        occupiedPosition["23,-41"] = true;
-        occupiedPosition["23,-40"] = true;
-        occupiedPosition["23,-1"] = true;
-        occupiedPosition["23,0"] = true;
-        occupiedPosition["23,1"] = true;
-        occupiedPosition["23,2"] = true;
-        occupiedPosition["23,3"] = true;
-        occupiedPosition["23,4"] = true;
-        occupiedPosition["23,29"] = true;
-        occupiedPosition["23,30"] = true;
-        occupiedPosition["23,31"] = true;
-        occupiedPosition["23,55"] = true;
-        occupiedPosition["23,56"] = true;
-        occupiedPosition["24,-42"] = true;
-        occupiedPosition["24,-41"] = true;
-        occupiedPosition["24,-40"] = true;
-        occupiedPosition["24,-1"] = true;
-        occupiedPosition["24,0"] = true;
-        occupiedPosition["24,1"] = true;
-        occupiedPosition["24,2"] = true;
-        occupiedPosition["24,3"] = true;
-        occupiedPosition["24,4"] = true;
-        occupiedPosition["24,9"] = true;
-        occupiedPosition["24,10"] = true;
-        occupiedPosition["24,11"] = true;
-        occupiedPosition["24,12"] = true;
-        occupiedPosition["24,13"] = true;
-        occupiedPosition["24,14"] = true;
-        occupiedPosition["24,15"] = true;
-        occupiedPosition["24,16"] = true;
-        occupiedPosition["24,29"] = true;
-        occupiedPosition["24,30"] = true;
-        occupiedPosition["24,31"] = true;
-        occupiedPosition["24,55"] = true;
-        occupiedPosition["24,56"] = true;
-        occupiedPosition["24,64"] = true;
-        occupiedPosition["25,-41"] = true;
-        occupiedPosition["25,-1"] = true;
-        occupiedPosition["25,0"] = true;
-        occupiedPosition["25,1"] = true;
-        occupiedPosition["25,2"] = true;
-        occupiedPosition["25,3"] = true;
-        occupiedPosition["25,4"] = true;
-        occupiedPosition["25,8"] = true;
-        occupiedPosition["25,9"] = true;
-        occupiedPosition["25,10"] = true;
-        occupiedPosition["25,11"] = true;
-        occupiedPosition["25,12"] = true;
-        occupiedPosition["25,13"] = true;
-        occupiedPosition["25,14"] = true;
-        occupiedPosition["25,15"] = true;
-        occupiedPosition["25,16"] = true;
-        occupiedPosition["25,20"] = true;
-        occupiedPosition["25,21"] = true;
-        occupiedPosition["25,29"] = true;
-        occupiedPosition["25,30"] = true;
-        occupiedPosition["25,31"] = true;
-        occupiedPosition["25,55"] = true;
-        occupiedPosition["25,56"] = true;
-        occupiedPosition["25,60"] = true;
-        occupiedPosition["25,61"] = true;
-        occupiedPosition["25,64"] = true;
-        occupiedPosition["26,-56"] = true;
-        occupiedPosition["26,-55"] = true;
-        occupiedPosition["26,-54"] = true;
-        occupiedPosition["26,-8"] = true;
-        occupiedPosition["26,-7"] = true;
-        occupiedPosition["26,-6"] = true;
-        occupiedPosition["26,-1"] = true;
-        occupiedPosition["26,0"] = true;
-        occupiedPosition["26,1"] = true;
-        occupiedPosition["26,2"] = true;
-        occupiedPosition["26,3"] = true;
-        occupiedPosition["26,4"] = true;
-        occupiedPosition["26,9"] = true;
-        occupiedPosition["26,10"] = true;
-        occupiedPosition["26,11"] = true;
-        occupiedPosition["26,12"] = true;
-        occupiedPosition["26,13"] = true;
-        occupiedPosition["26,14"] = true;
-        occupiedPosition["26,15"] = true;
-        occupiedPosition["26,16"] = true;
-        occupiedPosition["26,18"] = true;
-        occupiedPosition["26,19"] = true;
-        occupiedPosition["26,20"] = true;
-        occupiedPosition["26,21"] = true;
-        occupiedPosition["26,29"] = true;
-        occupiedPosition["26,30"] = true;
-        occupiedPosition["26,31"] = true;
-        occupiedPosition["26,55"] = true;
-        occupiedPosition["26,56"] = true;
-        occupiedPosition["26,59"] = true;
-        occupiedPosition["26,60"] = true;
-        occupiedPosition["26,61"] = true;
-        occupiedPosition["27,-56"] = true;
-        occupiedPosition["27,-55"] = true;
-        occupiedPosition["27,-54"] = true;
-        occupiedPosition["27,-35"] = true;
-        occupiedPosition["27,-34"] = true;
-        occupiedPosition["27,-33"] = true;
-        occupiedPosition["27,-32"] = true;
-        occupiedPosition["27,-31"] = true;
-        occupiedPosition["27,-30"] = true;
-        occupiedPosition["27,-29"] = true;
-        occupiedPosition["27,-8"] = true;
-        occupiedPosition["27,-7"] = true;
-        occupiedPosition["27,-6"] = true;
-        occupiedPosition["27,-1"] = true;
-        occupiedPosition["27,0"] = true;
-        occupiedPosition["27,1"] = true;
-        occupiedPosition["27,2"] = true;
-        occupiedPosition["27,3"] = true;
-        occupiedPosition["27,4"] = true;
-        occupiedPosition["27,9"] = true;
-        occupiedPosition["27,10"] = true;
-        occupiedPosition["27,13"] = true;
-        occupiedPosition["27,14"] = true;
-        occupiedPosition["27,15"] = true;
-        occupiedPosition["27,16"] = true;
-        occupiedPosition["27,17"] = true;
-        occupiedPosition["27,18"] = true;
-        occupiedPosition["27,19"] = true;
-        occupiedPosition["27,20"] = true;
-        occupiedPosition["27,21"] = true;
-        occupiedPosition["27,30"] = true;
-        occupiedPosition["27,31"] = true;
-        occupiedPosition["27,32"] = true;
-        occupiedPosition["27,33"] = true;
-        occupiedPosition["27,34"] = true;
-        occupiedPosition["27,35"] = true;
-        occupiedPosition["27,36"] = true;
-        occupiedPosition["27,37"] = true;
-        occupiedPosition["27,38"] = true;
-        occupiedPosition["27,39"] = true;
-        occupiedPosition["27,40"] = true;
-        occupiedPosition["27,41"] = true;
-        occupiedPosition["27,42"] = true;
-        occupiedPosition["27,43"] = true;
-        occupiedPosition["27,44"] = true;
-        occupiedPosition["27,45"] = true;
-        occupiedPosition["27,46"] = true;
-        occupiedPosition["27,47"] = true;
-        occupiedPosition["27,48"] = true;
-        occupiedPosition["27,49"] = true;
-        occupiedPosition["27,50"] = true;
-        occupiedPosition["27,51"] = true;
-        occupiedPosition["27,52"] = true;
-        occupiedPosition["27,53"] = true;
-        occupiedPosition["27,54"] = true;
-        occupiedPosition["27,55"] = true;
-        occupiedPosition["27,56"] = true;
-        occupiedPosition["27,60"] = true;
-        occupiedPosition["27,61"] = true;
-        occupiedPosition["28,-55"] = true;
-        occupiedPosition["28,-35"] = true;
-        occupiedPosition["28,-34"] = true;
-        occupiedPosition["28,-33"] = true;
-        occupiedPosition["28,-32"] = true;
-        occupiedPosition["28,-31"] = true;
-        occupiedPosition["28,-30"] = true;
-        occupiedPosition["28,-29"] = true;
-        occupiedPosition["28,-8"] = true;
-        occupiedPosition["28,-7"] = true;
-        occupiedPosition["28,-6"] = true;
-        occupiedPosition["28,-1"] = true;
-        occupiedPosition["28,0"] = true;
-        occupiedPosition["28,1"] = true;
-        occupiedPosition["28,2"] = true;
-        occupiedPosition["28,3"] = true;
-        occupiedPosition["28,4"] = true;
-        occupiedPosition["28,9"] = true;
-        occupiedPosition["28,10"] = true;
-        occupiedPosition["28,13"] = true;
-        occupiedPosition["28,14"] = true;
-        occupiedPosition["28,15"] = true;
-        occupiedPosition["28,16"] = true;
-        occupiedPosition["28,17"] = true;
-        occupiedPosition["28,18"] = true;
-        occupiedPosition["28,19"] = true;
-        occupiedPosition["28,20"] = true;
-        occupiedPosition["28,21"] = true;
-        occupiedPosition["28,30"] = true;
-        occupiedPosition["28,31"] = true;
-        occupiedPosition["28,32"] = true;
-        occupiedPosition["28,33"] = true;
-        occupiedPosition["28,34"] = true;
-        occupiedPosition["28,35"] = true;
-        occupiedPosition["28,36"] = true;
-        occupiedPosition["28,37"] = true;
-        occupiedPosition["28,38"] = true;
-        occupiedPosition["28,39"] = true;
-        occupiedPosition["28,40"] = true;
-        occupiedPosition["28,41"] = true;
-        occupiedPosition["28,42"] = true;
-        occupiedPosition["28,43"] = true;
-        occupiedPosition["28,44"] = true;
-        occupiedPosition["28,45"] = true;
-        occupiedPosition["28,46"] = true;
-        occupiedPosition["28,47"] = true;
-        occupiedPosition["28,48"] = true;
-        occupiedPosition["28,49"] = true;
-        occupiedPosition["28,50"] = true;
-        occupiedPosition["28,51"] = true;
-        occupiedPosition["28,52"] = true;
-        occupiedPosition["28,53"] = true;
-        occupiedPosition["28,54"] = true;
-        occupiedPosition["28,55"] = true;
-        occupiedPosition["28,56"] = true;
-        occupiedPosition["28,60"] = true;
-        occupiedPosition["28,61"] = true;
-        occupiedPosition["29,-35"] = true;
-        occupiedPosition["29,-34"] = true;
-        occupiedPosition["29,-33"] = true;
-        occupiedPosition["29,-32"] = true;
-        occupiedPosition["29,-31"] = true;
-        occupiedPosition["29,-30"] = true;
-        occupiedPosition["29,-29"] = true;
-        occupiedPosition["29,-18"] = true;
-        occupiedPosition["29,-17"] = true;
-        occupiedPosition["29,-16"] = true;
-        occupiedPosition["29,-15"] = true;
-        occupiedPosition["29,-14"] = true;
-        occupiedPosition["29,-7"] = true;
-        occupiedPosition["29,-6"] = true;
-        occupiedPosition["29,-1"] = true;
-        occupiedPosition["29,0"] = true;
-        occupiedPosition["29,1"] = true;
-        occupiedPosition["29,2"] = true;
-        occupiedPosition["29,3"] = true;
-        occupiedPosition["29,4"] = true;
-        occupiedPosition["29,9"] = true;
-        occupiedPosition["29,10"] = true;
-        occupiedPosition["29,11"] = true;
-        occupiedPosition["29,12"] = true;
-        occupiedPosition["29,13"] = true;
-        occupiedPosition["29,14"] = true;
-        occupiedPosition["29,15"] = true;
-        occupiedPosition["29,16"] = true;
-        occupiedPosition["29,17"] = true;
-        occupiedPosition["29,18"] = true;
-        occupiedPosition["29,19"] = true;
-        occupiedPosition["29,20"] = true;
-        occupiedPosition["29,21"] = true;
-        occupiedPosition["29,32"] = true;
-        occupiedPosition["29,33"] = true;
-        occupiedPosition["29,34"] = true;
-        occupiedPosition["29,35"] = true;
-        occupiedPosition["29,36"] = true;
-        occupiedPosition["29,37"] = true;
-        occupiedPosition["30,-35"] = true;
-        occupiedPosition["30,-34"] = true;
-        occupiedPosition["30,-33"] = true;
-        occupiedPosition["30,-32"] = true;
-        occupiedPosition["30,-31"] = true;
-        occupiedPosition["30,-30"] = true;
-        occupiedPosition["30,-29"] = true;
-        occupiedPosition["30,-20"] = true;
-        occupiedPosition["30,-19"] = true;
-        occupiedPosition["30,-18"] = true;
-        occupiedPosition["30,-17"] = true;
-        occupiedPosition["30,-16"] = true;
-        occupiedPosition["30,-15"] = true;
-        occupiedPosition["30,-14"] = true;
-        occupiedPosition["30,-13"] = true;
-        occupiedPosition["30,-12"] = true;
-        occupiedPosition["30,-11"] = true;
-        occupiedPosition["30,-10"] = true;
-        occupiedPosition["30,-9"] = true;
-        occupiedPosition["30,-8"] = true;
-        occupiedPosition["30,-7"] = true;
-        occupiedPosition["30,-1"] = true;
-        occupiedPosition["30,0"] = true;
-        occupiedPosition["30,1"] = true;
-        occupiedPosition["30,2"] = true;
-        occupiedPosition["30,3"] = true;
-        occupiedPosition["30,4"] = true;
-        occupiedPosition["30,9"] = true;
-        occupiedPosition["30,10"] = true;
-        occupiedPosition["30,11"] = true;
-        occupiedPosition["30,12"] = true;
-        occupiedPosition["30,13"] = true;
-        occupiedPosition["30,14"] = true;
-        occupiedPosition["30,15"] = true;
-        occupiedPosition["30,16"] = true;
-        occupiedPosition["30,17"] = true;
-        occupiedPosition["30,18"] = true;
-        occupiedPosition["30,19"] = true;
-        occupiedPosition["30,20"] = true;
-        occupiedPosition["30,32"] = true;
-        occupiedPosition["30,33"] = true;
-        occupiedPosition["30,34"] = true;
-        occupiedPosition["30,35"] = true;
-        occupiedPosition["30,36"] = true;
-        occupiedPosition["30,37"] = true;
-        occupiedPosition["30,38"] = true;
-        occupiedPosition["30,39"] = true;
-        occupiedPosition["30,40"] = true;
-        occupiedPosition["30,41"] = true;
-        occupiedPosition["30,42"] = true;
-        occupiedPosition["30,43"] = true;
-        occupiedPosition["31,-35"] = true;
-        occupiedPosition["31,-34"] = true;
-        occupiedPosition["31,-33"] = true;
-        occupiedPosition["31,-32"] = true;
-        occupiedPosition["31,-31"] = true;
-        occupiedPosition["31,-30"] = true;
-        occupiedPosition["31,-29"] = true;
-        occupiedPosition["31,-20"] = true;
-        occupiedPosition["31,-19"] = true;
-        occupiedPosition["31,-18"] = true;
-        occupiedPosition["31,-17"] = true;
-        occupiedPosition["31,-16"] = true;
-        occupiedPosition["31,-15"] = true;
-        occupiedPosition["31,-14"] = true;
-        occupiedPosition["31,-13"] = true;
-        occupiedPosition["31,-12"] = true;
-        occupiedPosition["31,-11"] = true;
-        occupiedPosition["31,-10"] = true;
-        occupiedPosition["31,-9"] = true;
-        occupiedPosition["31,-8"] = true;
-        occupiedPosition["31,-7"] = true;
-        occupiedPosition["31,-6"] = true;
-        occupiedPosition["31,-1"] = true;
-        occupiedPosition["31,0"] = true;
-        occupiedPosition["31,1"] = true;
-        occupiedPosition["31,2"] = true;
-        occupiedPosition["31,3"] = true;
-        occupiedPosition["31,4"] = true;
-        occupiedPosition["31,15"] = true;
-        occupiedPosition["31,16"] = true;
-        occupiedPosition["31,17"] = true;
-        occupiedPosition["31,19"] = true;
-        occupiedPosition["31,20"] = true;
-        occupiedPosition["31,33"] = true;
-        occupiedPosition["31,34"] = true;
-        occupiedPosition["31,35"] = true;
-        occupiedPosition["31,36"] = true;
-        occupiedPosition["31,38"] = true;
-        occupiedPosition["31,39"] = true;
-        occupiedPosition["31,40"] = true;
-        occupiedPosition["31,41"] = true;
-        occupiedPosition["31,42"] = true;
-        occupiedPosition["31,43"] = true;
-        occupiedPosition["32,-35"] = true;
-        occupiedPosition["32,-34"] = true;
-        occupiedPosition["32,-33"] = true;
-        occupiedPosition["32,-32"] = true;
-        occupiedPosition["32,-31"] = true;
-        occupiedPosition["32,-30"] = true;
-        occupiedPosition["32,-29"] = true;
-        occupiedPosition["32,-22"] = true;
-        occupiedPosition["32,-21"] = true;
-        occupiedPosition["32,-20"] = true;
-        occupiedPosition["32,-19"] = true;
-        occupiedPosition["32,-7"] = true;
-        occupiedPosition["32,-6"] = true;
-        occupiedPosition["32,-1"] = true;
-        occupiedPosition["32,0"] = true;
-        occupiedPosition["32,1"] = true;
-        occupiedPosition["32,2"] = true;
-        occupiedPosition["32,3"] = true;
-        occupiedPosition["32,4"] = true;
-        occupiedPosition["32,5"] = true;
-        occupiedPosition["32,7"] = true;
-        occupiedPosition["32,8"] = true;
-        occupiedPosition["32,9"] = true;
-        occupiedPosition["32,10"] = true;
-        occupiedPosition["32,11"] = true;
-        occupiedPosition["32,12"] = true;
-        occupiedPosition["32,13"] = true;
-        occupiedPosition["32,14"] = true;
-        occupiedPosition["32,15"] = true;
-        occupiedPosition["32,39"] = true;
-        occupiedPosition["32,40"] = true;
-        occupiedPosition["32,41"] = true;
-        occupiedPosition["32,42"] = true;
-        occupiedPosition["32,43"] = true;
-        occupiedPosition["33,-23"] = true;
-        occupiedPosition["33,-22"] = true;
-        occupiedPosition["33,-21"] = true;
-        occupiedPosition["33,-20"] = true;
-        occupiedPosition["33,-19"] = true;
-        occupiedPosition["33,-7"] = true;
-        occupiedPosition["33,-6"] = true;
-        occupiedPosition["33,-1"] = true;
-        occupiedPosition["33,0"] = true;
-        occupiedPosition["33,1"] = true;
-        occupiedPosition["33,2"] = true;
-        occupiedPosition["33,3"] = true;
-        occupiedPosition["33,4"] = true;
-        occupiedPosition["33,5"] = true;
-        occupiedPosition["33,6"] = true;
-        occupiedPosition["33,7"] = true;
-        occupiedPosition["33,8"] = true;
-        occupiedPosition["33,9"] = true;
-        occupiedPosition["33,10"] = true;
-        occupiedPosition["33,11"] = true;
-        occupiedPosition["33,12"] = true;
-        occupiedPosition["33,13"] = true;
-        occupiedPosition["33,14"] = true;
-        occupiedPosition["33,15"] = true;
-        occupiedPosition["33,16"] = true;
-        occupiedPosition["33,39"] = true;
-        occupiedPosition["33,40"] = true;
-        occupiedPosition["33,41"] = true;
-        occupiedPosition["33,42"] = true;
-        occupiedPosition["33,43"] = true;
-        occupiedPosition["33,44"] = true;
-        occupiedPosition["33,45"] = true;
-        occupiedPosition["34,-23"] = true;
-        occupiedPosition["34,-22"] = true;
-        occupiedPosition["34,-21"] = true;
-        occupiedPosition["34,-20"] = true;
-        occupiedPosition["34,-19"] = true;
-        occupiedPosition["34,-7"] = true;
-        occupiedPosition["34,-6"] = true;
-        occupiedPosition["34,-1"] = true;
-        occupiedPosition["34,0"] = true;
-        occupiedPosition["34,1"] = true;
-        occupiedPosition["34,2"] = true;
-        occupiedPosition["34,3"] = true;
-        occupiedPosition["34,4"] = true;
-        occupiedPosition["34,5"] = true;
-        occupiedPosition["34,6"] = true;
-        occupiedPosition["34,7"] = true;
-        occupiedPosition["34,8"] = true;
-        occupiedPosition["34,14"] = true;
-        occupiedPosition["34,15"] = true;
-        occupiedPosition["34,16"] = true;
-        occupiedPosition["34,17"] = true;
-        occupiedPosition["34,18"] = true;
-        occupiedPosition["34,39"] = true;
-        occupiedPosition["34,40"] = true;
-        occupiedPosition["34,41"] = true;
-        occupiedPosition["34,42"] = true;
-        occupiedPosition["34,43"] = true;
-        occupiedPosition["34,44"] = true;
-        occupiedPosition["34,45"] = true;
-        occupiedPosition["35,-23"] = true;
-        occupiedPosition["35,-22"] = true;
-        occupiedPosition["35,-21"] = true;
-        occupiedPosition["35,-20"] = true;
-        occupiedPosition["35,-19"] = true;
-        occupiedPosition["35,-7"] = true;
-        occupiedPosition["35,-6"] = true;
-        occupiedPosition["35,-1"] = true;
-        occupiedPosition["35,0"] = true;
-        occupiedPosition["35,1"] = true;
-        occupiedPosition["35,2"] = true;
-        occupiedPosition["35,3"] = true;
-        occupiedPosition["35,4"] = true;
-        occupiedPosition["35,5"] = true;
-        occupiedPosition["35,7"] = true;
-        occupiedPosition["35,8"] = true;
-        occupiedPosition["35,14"] = true;
-        occupiedPosition["35,15"] = true;
-        occupiedPosition["35,16"] = true;
-        occupiedPosition["35,17"] = true;
-        occupiedPosition["35,18"] = true;
-        occupiedPosition["35,39"] = true;
-        occupiedPosition["35,40"] = true;
-        occupiedPosition["35,41"] = true;
-        occupiedPosition["35,42"] = true;
-        occupiedPosition["35,43"] = true;
-        occupiedPosition["35,44"] = true;
-        occupiedPosition["35,45"] = true;
-        occupiedPosition["35,61"] = true;
-        occupiedPosition["36,-23"] = true;
-        occupiedPosition["36,-22"] = true;
-        occupiedPosition["36,-21"] = true;
-        occupiedPosition["36,-20"] = true;
-        occupiedPosition["36,-19"] = true;
-        occupiedPosition["36,-7"] = true;
-        occupiedPosition["36,-6"] = true;
-        occupiedPosition["36,-1"] = true;
-        occupiedPosition["36,0"] = true;
-        occupiedPosition["36,1"] = true;
-        occupiedPosition["36,2"] = true;
-        occupiedPosition["36,3"] = true;
-        occupiedPosition["36,4"] = true;
-        occupiedPosition["36,7"] = true;
-        occupiedPosition["36,8"] = true;
-        occupiedPosition["36,14"] = true;
-        occupiedPosition["36,15"] = true;
-        occupiedPosition["36,16"] = true;
-        occupiedPosition["36,17"] = true;
-        occupiedPosition["36,18"] = true;
-        occupiedPosition["36,40"] = true;
-        occupiedPosition["36,41"] = true;
-        occupiedPosition["36,42"] = true;
-        occupiedPosition["36,43"] = true;
-        occupiedPosition["36,44"] = true;
-        occupiedPosition["36,50"] = true;
-        occupiedPosition["36,51"] = true;
-        occupiedPosition["36,52"] = true;
-        occupiedPosition["36,53"] = true;
-        occupiedPosition["36,54"] = true;
-        occupiedPosition["36,55"] = true;
-        occupiedPosition["36,60"] = true;
-        occupiedPosition["36,61"] = true;
-        occupiedPosition["37,-35"] = true;
-        occupiedPosition["37,-34"] = true;
-        occupiedPosition["37,-33"] = true;
-        occupiedPosition["37,-22"] = true;
-        occupiedPosition["37,-21"] = true;
-        occupiedPosition["37,-20"] = true;
-        occupiedPosition["37,-19"] = true;
-        occupiedPosition["37,-7"] = true;
-        occupiedPosition["37,-6"] = true;
-        occupiedPosition["37,-1"] = true;
-        occupiedPosition["37,0"] = true;
-        occupiedPosition["37,1"] = true;
-        occupiedPosition["37,2"] = true;
-        occupiedPosition["37,3"] = true;
-        occupiedPosition["37,4"] = true;
-        occupiedPosition["37,7"] = true;
-        occupiedPosition["37,8"] = true;
-        occupiedPosition["37,14"] = true;
-        occupiedPosition["37,15"] = true;
-        occupiedPosition["37,16"] = true;
-        occupiedPosition["37,17"] = true;
-        occupiedPosition["37,18"] = true;
-        occupiedPosition["37,19"] = true;
-        occupiedPosition["37,20"] = true;
-        occupiedPosition["37,27"] = true;
-        occupiedPosition["37,28"] = true;
-        occupiedPosition["37,29"] = true;
-        occupiedPosition["37,30"] = true;
-        occupiedPosition["37,31"] = true;
-        occupiedPosition["37,32"] = true;
-        occupiedPosition["37,50"] = true;
-        occupiedPosition["37,51"] = true;
-        occupiedPosition["37,52"] = true;
-        occupiedPosition["37,53"] = true;
-        occupiedPosition["37,54"] = true;
-        occupiedPosition["37,55"] = true;
-        occupiedPosition["37,60"] = true;
-        occupiedPosition["37,61"] = true;
-        occupiedPosition["38,-35"] = true;
-        occupiedPosition["38,-34"] = true;
-        occupiedPosition["38,-33"] = true;
-        occupiedPosition["38,-32"] = true;
-        occupiedPosition["38,-23"] = true;
-        occupiedPosition["38,-22"] = true;
-        occupiedPosition["38,-20"] = true;
-        occupiedPosition["38,-19"] = true;
-        occupiedPosition["38,-7"] = true;
-        occupiedPosition["38,-6"] = true;
-        occupiedPosition["38,-1"] = true;
-        occupiedPosition["38,0"] = true;
-        occupiedPosition["38,1"] = true;
-        occupiedPosition["38,2"] = true;
-        occupiedPosition["38,3"] = true;
-        occupiedPosition["38,4"] = true;
-        occupiedPosition["38,7"] = true;
-        occupiedPosition["38,8"] = true;
-        occupiedPosition["38,14"] = true;
-        occupiedPosition["38,15"] = true;
-        occupiedPosition["38,17"] = true;
-        occupiedPosition["38,18"] = true;
-        occupiedPosition["38,19"] = true;
-        occupiedPosition["38,20"] = true;
-        occupiedPosition["38,27"] = true;
-        occupiedPosition["38,28"] = true;
-        occupiedPosition["38,29"] = true;
-        occupiedPosition["38,30"] = true;
-        occupiedPosition["38,31"] = true;
-        occupiedPosition["38,32"] = true;
-        occupiedPosition["38,40"] = true;
-        occupiedPosition["38,41"] = true;
-        occupiedPosition["38,50"] = true;
-        occupiedPosition["38,51"] = true;
-        occupiedPosition["38,54"] = true;
-        occupiedPosition["38,55"] = true;
-        occupiedPosition["38,61"] = true;
-        occupiedPosition["39,-56"] = true;
-        occupiedPosition["39,-55"] = true;
-        occupiedPosition["39,-54"] = true;
-        occupiedPosition["39,-35"] = true;
-        occupiedPosition["39,-34"] = true;
-        occupiedPosition["39,-33"] = true;
-        occupiedPosition["39,-32"] = true;
-        occupiedPosition["39,-27"] = true;
-        occupiedPosition["39,-26"] = true;
-        occupiedPosition["39,-25"] = true;
-        occupiedPosition["39,-24"] = true;
-        occupiedPosition["39,-23"] = true;
-        occupiedPosition["39,-22"] = true;
-        occupiedPosition["39,-20"] = true;
-        occupiedPosition["39,-19"] = true;
-        occupiedPosition["39,-7"] = true;
-        occupiedPosition["39,-6"] = true;
-        occupiedPosition["39,-1"] = true;
-        occupiedPosition["39,0"] = true;
-        occupiedPosition["39,1"] = true;
-        occupiedPosition["39,2"] = true;
-        occupiedPosition["39,3"] = true;
-        occupiedPosition["39,4"] = true;
-        occupiedPosition["39,7"] = true;
-        occupiedPosition["39,8"] = true;
-        occupiedPosition["39,14"] = true;
-        occupiedPosition["39,15"] = true;
-        occupiedPosition["39,17"] = true;
-        occupiedPosition["39,18"] = true;
-        occupiedPosition["39,19"] = true;
-        occupiedPosition["39,27"] = true;
-        occupiedPosition["39,28"] = true;
-        occupiedPosition["39,29"] = true;
-        occupiedPosition["39,30"] = true;
-        occupiedPosition["39,31"] = true;
-        occupiedPosition["39,32"] = true;
-        occupiedPosition["39,40"] = true;
-        occupiedPosition["39,41"] = true;
-        occupiedPosition["39,42"] = true;
-        occupiedPosition["39,43"] = true;
-        occupiedPosition["39,44"] = true;
-        occupiedPosition["39,45"] = true;
-        occupiedPosition["39,46"] = true;
-        occupiedPosition["39,47"] = true;
-        occupiedPosition["39,48"] = true;
-        occupiedPosition["39,49"] = true;
-        occupiedPosition["39,50"] = true;
-        occupiedPosition["39,51"] = true;
-        occupiedPosition["39,54"] = true;
-        occupiedPosition["39,55"] = true;
-        occupiedPosition["40,-56"] = true;
-        occupiedPosition["40,-55"] = true;
-        occupiedPosition["40,-34"] = true;
-        occupiedPosition["40,-33"] = true;
-        occupiedPosition["40,-32"] = true;
-        occupiedPosition["40,-31"] = true;
-        occupiedPosition["40,-30"] = true;
-        occupiedPosition["40,-28"] = true;
-        occupiedPosition["40,-27"] = true;
-        occupiedPosition["40,-26"] = true;
-        occupiedPosition["40,-25"] = true;
-        occupiedPosition["40,-24"] = true;
-        occupiedPosition["40,-23"] = true;
-        occupiedPosition["40,-22"] = true;
-        occupiedPosition["40,-20"] = true;
-        occupiedPosition["40,-19"] = true;
-        occupiedPosition["40,-7"] = true;
-        occupiedPosition["40,-6"] = true;
-        occupiedPosition["40,-2"] = true;
-        occupiedPosition["40,-1"] = true;
-        occupiedPosition["40,0"] = true;
-        occupiedPosition["40,1"] = true;
-        occupiedPosition["40,2"] = true;
-        occupiedPosition["40,3"] = true;
-        occupiedPosition["40,4"] = true;
-        occupiedPosition["40,7"] = true;
-        occupiedPosition["40,8"] = true;
-        occupiedPosition["40,14"] = true;
-        occupiedPosition["40,15"] = true;
-        occupiedPosition["40,16"] = true;
-        occupiedPosition["40,17"] = true;
-        occupiedPosition["40,18"] = true;
-        occupiedPosition["40,27"] = true;
-        occupiedPosition["40,28"] = true;
-        occupiedPosition["40,29"] = true;
-        occupiedPosition["40,30"] = true;
-        occupiedPosition["40,31"] = true;
-        occupiedPosition["40,32"] = true;
-        occupiedPosition["40,33"] = true;
-        occupiedPosition["40,34"] = true;
-        occupiedPosition["40,38"] = true;
-        occupiedPosition["40,39"] = true;
-        occupiedPosition["40,40"] = true;
-        occupiedPosition["40,41"] = true;
-        occupiedPosition["40,42"] = true;
-        occupiedPosition["40,43"] = true;
-        occupiedPosition["40,44"] = true;
-        occupiedPosition["40,45"] = true;
-        occupiedPosition["40,46"] = true;
-        occupiedPosition["40,47"] = true;
-        occupiedPosition["40,48"] = true;
-        occupiedPosition["40,49"] = true;
-        occupiedPosition["40,50"] = true;
-        occupiedPosition["40,51"] = true;
-        occupiedPosition["40,54"] = true;
-        occupiedPosition["40,55"] = true;
-        occupiedPosition["41,-56"] = true;
-        occupiedPosition["41,-53"] = true;
-        occupiedPosition["41,-52"] = true;
-        occupiedPosition["41,-51"] = true;
-        occupiedPosition["41,-50"] = true;
-        occupiedPosition["41,-49"] = true;
-        occupiedPosition["41,-48"] = true;
-        occupiedPosition["41,-47"] = true;
-        occupiedPosition["41,-46"] = true;
-        occupiedPosition["41,-45"] = true;
-        occupiedPosition["41,-44"] = true;
-        occupiedPosition["41,-43"] = true;
-        occupiedPosition["41,-42"] = true;
-        occupiedPosition["41,-39"] = true;
-        occupiedPosition["41,-38"] = true;
-        occupiedPosition["41,-37"] = true;
-        occupiedPosition["41,-36"] = true;
-        occupiedPosition["41,-35"] = true;
-        occupiedPosition["41,-34"] = true;
-        occupiedPosition["41,-33"] = true;
-        occupiedPosition["41,-32"] = true;
-        occupiedPosition["41,-31"] = true;
-        occupiedPosition["41,-30"] = true;
-        occupiedPosition["41,-28"] = true;
-        occupiedPosition["41,-27"] = true;
-        occupiedPosition["41,-26"] = true;
-        occupiedPosition["41,-25"] = true;
-        occupiedPosition["41,-24"] = true;
-        occupiedPosition["41,-23"] = true;
-        occupiedPosition["41,-22"] = true;
-        occupiedPosition["41,-20"] = true;
-        occupiedPosition["41,-19"] = true;
-        occupiedPosition["41,-8"] = true;
-        occupiedPosition["41,-7"] = true;
-        occupiedPosition["41,-6"] = true;
-        occupiedPosition["41,-5"] = true;
-        occupiedPosition["41,-4"] = true;
-        occupiedPosition["41,-3"] = true;
-        occupiedPosition["41,-2"] = true;
-        occupiedPosition["41,-1"] = true;
-        occupiedPosition["41,0"] = true;
-        occupiedPosition["41,1"] = true;
-        occupiedPosition["41,2"] = true;
-        occupiedPosition["41,3"] = true;
-        occupiedPosition["41,7"] = true;
-        occupiedPosition["41,8"] = true;
-        occupiedPosition["41,14"] = true;
-        occupiedPosition["41,15"] = true;
-        occupiedPosition["41,16"] = true;
-        occupiedPosition["41,17"] = true;
-        occupiedPosition["41,18"] = true;
-        occupiedPosition["41,27"] = true;
-        occupiedPosition["41,28"] = true;
-        occupiedPosition["41,29"] = true;
-        occupiedPosition["41,30"] = true;
-        occupiedPosition["41,31"] = true;
-        occupiedPosition["41,32"] = true;
-        occupiedPosition["41,33"] = true;
-        occupiedPosition["41,34"] = true;
-        occupiedPosition["41,37"] = true;
-        occupiedPosition["41,38"] = true;
-        occupiedPosition["41,39"] = true;
-        occupiedPosition["41,40"] = true;
-        occupiedPosition["41,41"] = true;
-        occupiedPosition["41,42"] = true;
-        occupiedPosition["41,54"] = true;
-        occupiedPosition["41,55"] = true;
-        occupiedPosition["41,60"] = true;
-        occupiedPosition["41,61"] = true;
-        occupiedPosition["42,-56"] = true;
-        occupiedPosition["42,-53"] = true;
-        occupiedPosition["42,-52"] = true;
-        occupiedPosition["42,-51"] = true;
-        occupiedPosition["42,-50"] = true;
-        occupiedPosition["42,-49"] = true;
-        occupiedPosition["42,-48"] = true;
-        occupiedPosition["42,-47"] = true;
-        occupiedPosition["42,-46"] = true;
-        occupiedPosition["42,-45"] = true;
-        occupiedPosition["42,-44"] = true;
-        occupiedPosition["42,-43"] = true;
-        occupiedPosition["42,-42"] = true;
-        occupiedPosition["42,-39"] = true;
-        occupiedPosition["42,-38"] = true;
-        occupiedPosition["42,-37"] = true;
-        occupiedPosition["42,-36"] = true;
-        occupiedPosition["42,-35"] = true;
-        occupiedPosition["42,-34"] = true;
-        occupiedPosition["42,-33"] = true;
-        occupiedPosition["42,-32"] = true;
-        occupiedPosition["42,-31"] = true;
-        occupiedPosition["42,-28"] = true;
-        occupiedPosition["42,-27"] = true;
-        occupiedPosition["42,-26"] = true;
-        occupiedPosition["42,-25"] = true;
-        occupiedPosition["42,-24"] = true;
-        occupiedPosition["42,-23"] = true;
-        occupiedPosition["42,-22"] = true;
-        occupiedPosition["42,-20"] = true;
-        occupiedPosition["42,-19"] = true;
-        occupiedPosition["42,-8"] = true;
-        occupiedPosition["42,-7"] = true;
-        occupiedPosition["42,-6"] = true;
-        occupiedPosition["42,-5"] = true;
-        occupiedPosition["42,-4"] = true;
-        occupiedPosition["42,-3"] = true;
-        occupiedPosition["42,-2"] = true;
-        occupiedPosition["42,-1"] = true;
-        occupiedPosition["42,0"] = true;
-        occupiedPosition["42,1"] = true;
-        occupiedPosition["42,2"] = true;
-        occupiedPosition["42,3"] = true;
-        occupiedPosition["42,7"] = true;
-        occupiedPosition["42,8"] = true;
-        occupiedPosition["42,14"] = true;
-        occupiedPosition["42,15"] = true;
-        occupiedPosition["42,27"] = true;
-        occupiedPosition["42,28"] = true;
-        occupiedPosition["42,29"] = true;
-        occupiedPosition["42,30"] = true;
-        occupiedPosition["42,31"] = true;
-        occupiedPosition["42,32"] = true;
-        occupiedPosition["42,33"] = true;
-        occupiedPosition["42,34"] = true;
-        occupiedPosition["42,37"] = true;
-        occupiedPosition["42,38"] = true;
-        occupiedPosition["42,39"] = true;
-        occupiedPosition["42,40"] = true;
-        occupiedPosition["42,41"] = true;
-        occupiedPosition["42,42"] = true;
-        occupiedPosition["42,54"] = true;
-        occupiedPosition["42,55"] = true;
-        occupiedPosition["42,60"] = true;
-        occupiedPosition["42,61"] = true;
-        occupiedPosition["42,64"] = true;
-        occupiedPosition["43,-56"] = true;
-        occupiedPosition["43,-53"] = true;
-        occupiedPosition["43,-52"] = true;
-        occupiedPosition["43,-43"] = true;
-        occupiedPosition["43,-42"] = true;
-        occupiedPosition["43,-39"] = true;
-        occupiedPosition["43,-38"] = true;
-        occupiedPosition["43,-32"] = true;
-        occupiedPosition["43,-31"] = true;
-        occupiedPosition["43,-28"] = true;
-        occupiedPosition["43,-27"] = true;
-        occupiedPosition["43,-26"] = true;
-        occupiedPosition["43,-25"] = true;
-        occupiedPosition["43,-24"] = true;
-        occupiedPosition["43,-23"] = true;
-        occupiedPosition["43,-22"] = true;
-        occupiedPosition["43,-20"] = true;
-        occupiedPosition["43,-19"] = true;
-        occupiedPosition["43,-8"] = true;
-        occupiedPosition["43,-7"] = true;
-        occupiedPosition["43,-6"] = true;
-        occupiedPosition["43,-4"] = true;
-        occupiedPosition["43,-3"] = true;
-        occupiedPosition["43,-2"] = true;
-        occupiedPosition["43,-1"] = true;
-        occupiedPosition["43,0"] = true;
-        occupiedPosition["43,1"] = true;
-        occupiedPosition["43,2"] = true;
-        occupiedPosition["43,3"] = true;
-        occupiedPosition["43,7"] = true;
-        occupiedPosition["43,8"] = true;
-        occupiedPosition["43,14"] = true;
-        occupiedPosition["43,15"] = true;
-        occupiedPosition["43,27"] = true;
-        occupiedPosition["43,28"] = true;
-        occupiedPosition["43,29"] = true;
-        occupiedPosition["43,30"] = true;
-        occupiedPosition["43,31"] = true;
-        occupiedPosition["43,32"] = true;
-        occupiedPosition["43,37"] = true;
-        occupiedPosition["43,38"] = true;
-        occupiedPosition["43,39"] = true;
-        occupiedPosition["43,41"] = true;
-        occupiedPosition["43,42"] = true;
-        occupiedPosition["43,54"] = true;
-        occupiedPosition["43,55"] = true;
-        occupiedPosition["43,60"] = true;
-        occupiedPosition["43,61"] = true;
-        occupiedPosition["43,64"] = true;
-        occupiedPosition["44,-56"] = true;
-        occupiedPosition["44,-53"] = true;
-        occupiedPosition["44,-52"] = true;
-        occupiedPosition["44,-43"] = true;
-        occupiedPosition["44,-42"] = true;
-        occupiedPosition["44,-39"] = true;
-        occupiedPosition["44,-38"] = true;
-        occupiedPosition["44,-32"] = true;
-        occupiedPosition["44,-31"] = true;
-        occupiedPosition["44,-28"] = true;
-        occupiedPosition["44,-27"] = true;
-        occupiedPosition["44,-26"] = true;
-        occupiedPosition["44,-25"] = true;
-        occupiedPosition["44,-20"] = true;
-        occupiedPosition["44,-19"] = true;
-        occupiedPosition["44,-8"] = true;
-        occupiedPosition["44,-7"] = true;
-        occupiedPosition["44,-6"] = true;
-        occupiedPosition["44,-4"] = true;
-        occupiedPosition["44,-3"] = true;
-        occupiedPosition["44,-2"] = true;
-        occupiedPosition["44,-1"] = true;
-        occupiedPosition["44,0"] = true;
-        occupiedPosition["44,1"] = true;
-        occupiedPosition["44,2"] = true;
-        occupiedPosition["44,3"] = true;
-        occupiedPosition["44,7"] = true;
-        occupiedPosition["44,8"] = true;
-        occupiedPosition["44,9"] = true;
-        occupiedPosition["44,10"] = true;
-        occupiedPosition["44,11"] = true;
-        occupiedPosition["44,12"] = true;
-        occupiedPosition["44,13"] = true;
-        occupiedPosition["44,14"] = true;
-        occupiedPosition["44,15"] = true;
-        occupiedPosition["44,41"] = true;
-        occupiedPosition["44,42"] = true;
-        occupiedPosition["44,54"] = true;
-        occupiedPosition["44,55"] = true;
-        occupiedPosition["44,64"] = true;
-        occupiedPosition["45,-56"] = true;
-        occupiedPosition["45,-53"] = true;
-        occupiedPosition["45,-52"] = true;
-        occupiedPosition["45,-46"] = true;
-        occupiedPosition["45,-45"] = true;
-        occupiedPosition["45,-44"] = true;
-        occupiedPosition["45,-43"] = true;
-        occupiedPosition["45,-42"] = true;
-        occupiedPosition["45,-39"] = true;
-        occupiedPosition["45,-38"] = true;
-        occupiedPosition["45,-32"] = true;
-        occupiedPosition["45,-31"] = true;
-        occupiedPosition["45,-27"] = true;
-        occupiedPosition["45,-26"] = true;
-        occupiedPosition["45,-25"] = true;
-        occupiedPosition["45,-20"] = true;
-        occupiedPosition["45,-19"] = true;
-        occupiedPosition["45,-8"] = true;
-        occupiedPosition["45,-7"] = true;
-        occupiedPosition["45,-6"] = true;
-        occupiedPosition["45,-5"] = true;
-        occupiedPosition["45,-4"] = true;
-        occupiedPosition["45,-3"] = true;
-        occupiedPosition["45,-2"] = true;
-        occupiedPosition["45,-1"] = true;
-        occupiedPosition["45,0"] = true;
-        occupiedPosition["45,1"] = true;
-        occupiedPosition["45,2"] = true;
-        occupiedPosition["45,3"] = true;
-        occupiedPosition["45,7"] = true;
-        occupiedPosition["45,8"] = true;
-        occupiedPosition["45,9"] = true;
-        occupiedPosition["45,10"] = true;
-        occupiedPosition["45,11"] = true;
-        occupiedPosition["45,12"] = true;
-        occupiedPosition["45,13"] = true;
-        occupiedPosition["45,14"] = true;
-        occupiedPosition["45,15"] = true;
-        occupiedPosition["45,41"] = true;
-        occupiedPosition["45,42"] = true;
-        occupiedPosition["45,54"] = true;
-        occupiedPosition["45,55"] = true;
-        occupiedPosition["45,64"] = true;
-        occupiedPosition["46,-56"] = true;
-        occupiedPosition["46,-53"] = true;
-        occupiedPosition["46,-52"] = true;
-        occupiedPosition["46,-46"] = true;
-        occupiedPosition["46,-45"] = true;
-        occupiedPosition["46,-44"] = true;
-        occupiedPosition["46,-43"] = true;
-        occupiedPosition["46,-42"] = true;
-        occupiedPosition["46,-39"] = true;
-        occupiedPosition["46,-38"] = true;
-        occupiedPosition["46,-32"] = true;
-        occupiedPosition["46,-31"] = true;
-        occupiedPosition["46,-20"] = true;
-        occupiedPosition["46,-19"] = true;
-        occupiedPosition["46,-7"] = true;
-        occupiedPosition["46,-6"] = true;
-        occupiedPosition["46,-5"] = true;
-        occupiedPosition["46,-4"] = true;
-        occupiedPosition["46,-3"] = true;
-        occupiedPosition["46,-2"] = true;
-        occupiedPosition["46,-1"] = true;
-        occupiedPosition["46,0"] = true;
-        occupiedPosition["46,1"] = true;
-        occupiedPosition["46,2"] = true;
-        occupiedPosition["46,3"] = true;
-        occupiedPosition["46,11"] = true;
-        occupiedPosition["46,12"] = true;
-        occupiedPosition["46,13"] = true;
-        occupiedPosition["46,41"] = true;
-        occupiedPosition["46,42"] = true;
-        occupiedPosition["46,43"] = true;
-        occupiedPosition["46,44"] = true;
-        occupiedPosition["46,45"] = true;
-        occupiedPosition["46,46"] = true;
-        occupiedPosition["46,47"] = true;
-        occupiedPosition["46,48"] = true;
-        occupiedPosition["46,49"] = true;
-        occupiedPosition["46,50"] = true;
-        occupiedPosition["46,51"] = true;
-        occupiedPosition["46,52"] = true;
-        occupiedPosition["46,53"] = true;
-        occupiedPosition["46,54"] = true;
-        occupiedPosition["46,55"] = true;
-        occupiedPosition["47,-56"] = true;
-        occupiedPosition["47,-53"] = true;
-        occupiedPosition["47,-52"] = true;
-        occupiedPosition["47,-46"] = true;
-        occupiedPosition["47,-45"] = true;
-        occupiedPosition["47,-39"] = true;
-        occupiedPosition["47,-38"] = true;
-        occupiedPosition["47,-32"] = true;
-        occupiedPosition["47,-31"] = true;
-        occupiedPosition["47,-20"] = true;
-        occupiedPosition["47,-19"] = true;
-        occupiedPosition["47,-7"] = true;
-        occupiedPosition["47,-6"] = true;
-        occupiedPosition["47,-2"] = true;
-        occupiedPosition["47,-1"] = true;
-        occupiedPosition["47,0"] = true;
-        occupiedPosition["47,1"] = true;
-        occupiedPosition["47,2"] = true;
-        occupiedPosition["47,3"] = true;
-        occupiedPosition["47,11"] = true;
-        occupiedPosition["47,12"] = true;
-        occupiedPosition["47,13"] = true;
-        occupiedPosition["47,41"] = true;
-        occupiedPosition["47,42"] = true;
-        occupiedPosition["47,43"] = true;
-        occupiedPosition["47,44"] = true;
-        occupiedPosition["47,45"] = true;
-        occupiedPosition["47,46"] = true;
-        occupiedPosition["47,47"] = true;
-        occupiedPosition["47,48"] = true;
-        occupiedPosition["47,49"] = true;
-        occupiedPosition["47,50"] = true;
-        occupiedPosition["47,51"] = true;
-        occupiedPosition["47,52"] = true;
-        occupiedPosition["47,53"] = true;
-        occupiedPosition["47,54"] = true;
-        occupiedPosition["47,55"] = true;
-        occupiedPosition["47,64"] = true;
-        occupiedPosition["48,-56"] = true;
-        occupiedPosition["48,-53"] = true;
-        occupiedPosition["48,-52"] = true;
-        occupiedPosition["48,-46"] = true;
-        occupiedPosition["48,-45"] = true;
-        occupiedPosition["48,-39"] = true;
-        occupiedPosition["48,-38"] = true;
-        occupiedPosition["48,-32"] = true;
-        occupiedPosition["48,-31"] = true;
-        occupiedPosition["48,-20"] = true;
-        occupiedPosition["48,-19"] = true;
-        occupiedPosition["48,-7"] = true;
-        occupiedPosition["48,-6"] = true;
-        occupiedPosition["48,-2"] = true;
-        occupiedPosition["48,-1"] = true;
-        occupiedPosition["48,0"] = true;
-        occupiedPosition["48,1"] = true;
-        occupiedPosition["48,2"] = true;
-        occupiedPosition["48,3"] = true;
-        occupiedPosition["48,7"] = true;
-        occupiedPosition["48,8"] = true;
-        occupiedPosition["48,9"] = true;
-        occupiedPosition["48,10"] = true;
-        occupiedPosition["48,11"] = true;
-        occupiedPosition["48,12"] = true;
-        occupiedPosition["48,13"] = true;
-        occupiedPosition["48,14"] = true;
-        occupiedPosition["48,15"] = true;
-        occupiedPosition["48,22"] = true;
-        occupiedPosition["48,23"] = true;
-        occupiedPosition["48,24"] = true;
-        occupiedPosition["48,64"] = true;
-        occupiedPosition["49,-56"] = true;
-        occupiedPosition["49,-53"] = true;
-        occupiedPosition["49,-52"] = true;
-        occupiedPosition["49,-46"] = true;
-        occupiedPosition["49,-45"] = true;
-        occupiedPosition["49,-44"] = true;
-        occupiedPosition["49,-43"] = true;
-        occupiedPosition["49,-39"] = true;
-        occupiedPosition["49,-38"] = true;
-        occupiedPosition["49,-32"] = true;
-        occupiedPosition["49,-31"] = true;
-        occupiedPosition["49,-20"] = true;
-        occupiedPosition["49,-19"] = true;
-        occupiedPosition["49,-7"] = true;
-        occupiedPosition["49,-6"] = true;
-        occupiedPosition["49,-2"] = true;
-        occupiedPosition["49,-1"] = true;
-        occupiedPosition["49,0"] = true;
-        occupiedPosition["49,1"] = true;
-        occupiedPosition["49,2"] = true;
-        occupiedPosition["49,3"] = true;
-        occupiedPosition["49,4"] = true;
-        occupiedPosition["49,5"] = true;
-        occupiedPosition["49,6"] = true;
-        occupiedPosition["49,7"] = true;
-        occupiedPosition["49,8"] = true;
-        occupiedPosition["49,9"] = true;
-        occupiedPosition["49,10"] = true;
-        occupiedPosition["49,11"] = true;
-        occupiedPosition["49,12"] = true;
-        occupiedPosition["49,13"] = true;
-        occupiedPosition["49,14"] = true;
-        occupiedPosition["49,15"] = true;
-        occupiedPosition["49,22"] = true;
-        occupiedPosition["49,23"] = true;
-        occupiedPosition["49,24"] = true;
-        occupiedPosition["49,25"] = true;
-        occupiedPosition["50,-56"] = true;
-        occupiedPosition["50,-53"] = true;
-        occupiedPosition["50,-52"] = true;
-        occupiedPosition["50,-46"] = true;
-        occupiedPosition["50,-45"] = true;
-        occupiedPosition["50,-44"] = true;
-        occupiedPosition["50,-43"] = true;
-        occupiedPosition["50,-39"] = true;
-        occupiedPosition["50,-38"] = true;
-        occupiedPosition["50,-32"] = true;
-        occupiedPosition["50,-31"] = true;
-        occupiedPosition["50,-30"] = true;
-        occupiedPosition["50,-29"] = true;
-        occupiedPosition["50,-28"] = true;
-        occupiedPosition["50,-20"] = true;
-        occupiedPosition["50,-19"] = true;
-        occupiedPosition["50,-7"] = true;
-        occupiedPosition["50,-6"] = true;
-        occupiedPosition["50,-2"] = true;
-        occupiedPosition["50,-1"] = true;
-        occupiedPosition["50,0"] = true;
-        occupiedPosition["50,1"] = true;
-        occupiedPosition["50,2"] = true;
-        occupiedPosition["50,3"] = true;
-        occupiedPosition["50,4"] = true;
-        occupiedPosition["50,5"] = true;
-        occupiedPosition["50,6"] = true;
-        occupiedPosition["50,7"] = true;
-        occupiedPosition["50,8"] = true;
-        occupiedPosition["50,14"] = true;
-        occupiedPosition["50,15"] = true;
-        occupiedPosition["50,22"] = true;
-        occupiedPosition["50,23"] = true;
-        occupiedPosition["50,24"] = true;
-        occupiedPosition["50,41"] = true;
-        occupiedPosition["50,42"] = true;
-        occupiedPosition["50,43"] = true;
-        occupiedPosition["50,44"] = true;
-        occupiedPosition["50,45"] = true;
-        occupiedPosition["50,46"] = true;
-        occupiedPosition["50,54"] = true;
-        occupiedPosition["50,55"] = true;
-        occupiedPosition["50,64"] = true;
-        occupiedPosition["51,-56"] = true;
-        occupiedPosition["51,-53"] = true;
-        occupiedPosition["51,-52"] = true;
-        occupiedPosition["51,-46"] = true;
-        occupiedPosition["51,-45"] = true;
-        occupiedPosition["51,-39"] = true;
-        occupiedPosition["51,-38"] = true;
-        occupiedPosition["51,-32"] = true;
-        occupiedPosition["51,-31"] = true;
-        occupiedPosition["51,-30"] = true;
-        occupiedPosition["51,-29"] = true;
-        occupiedPosition["51,-28"] = true;
-        occupiedPosition["51,-20"] = true;
-        occupiedPosition["51,-19"] = true;
-        occupiedPosition["51,-7"] = true;
-        occupiedPosition["51,-6"] = true;
-        occupiedPosition["51,-2"] = true;
-        occupiedPosition["51,-1"] = true;
-        occupiedPosition["51,0"] = true;
-        occupiedPosition["51,1"] = true;
-        occupiedPosition["51,2"] = true;
-        occupiedPosition["51,3"] = true;
-        occupiedPosition["51,4"] = true;
-        occupiedPosition["51,5"] = true;
-        occupiedPosition["51,6"] = true;
-        occupiedPosition["51,7"] = true;
-        occupiedPosition["51,8"] = true;
-        occupiedPosition["51,14"] = true;
-        occupiedPosition["51,15"] = true;
-        occupiedPosition["51,41"] = true;
-        occupiedPosition["51,42"] = true;
-        occupiedPosition["51,43"] = true;
-        occupiedPosition["51,44"] = true;
-        occupiedPosition["51,45"] = true;
-        occupiedPosition["51,46"] = true;
-        occupiedPosition["51,49"] = true;
-        occupiedPosition["51,50"] = true;
-        occupiedPosition["51,52"] = true;
-        occupiedPosition["51,53"] = true;
-        occupiedPosition["51,54"] = true;
-        occupiedPosition["51,55"] = true;
-        occupiedPosition["52,-56"] = true;
-        occupiedPosition["52,-53"] = true;
-        occupiedPosition["52,-52"] = true;
-        occupiedPosition["52,-46"] = true;
-        occupiedPosition["52,-45"] = true;
-        occupiedPosition["52,-44"] = true;
-        occupiedPosition["52,-43"] = true;
-        occupiedPosition["52,-39"] = true;
-        occupiedPosition["52,-38"] = true;
-        occupiedPosition["52,-29"] = true;
-        occupiedPosition["52,-28"] = true;
-        occupiedPosition["52,-20"] = true;
-        occupiedPosition["52,-19"] = true;
-        occupiedPosition["52,-7"] = true;
-        occupiedPosition["52,-6"] = true;
-        occupiedPosition["52,-2"] = true;
-        occupiedPosition["52,-1"] = true;
-        occupiedPosition["52,0"] = true;
-        occupiedPosition["52,1"] = true;
-        occupiedPosition["52,2"] = true;
-        occupiedPosition["52,3"] = true;
-        occupiedPosition["52,7"] = true;
-        occupiedPosition["52,8"] = true;
-        occupiedPosition["52,14"] = true;
-        occupiedPosition["52,15"] = true;
-        occupiedPosition["52,16"] = true;
-        occupiedPosition["52,17"] = true;
-        occupiedPosition["52,18"] = true;
-        occupiedPosition["52,41"] = true;
-        occupiedPosition["52,42"] = true;
-        occupiedPosition["52,45"] = true;
-        occupiedPosition["52,46"] = true;
-        occupiedPosition["52,49"] = true;
-        occupiedPosition["52,50"] = true;
-        occupiedPosition["52,52"] = true;
-        occupiedPosition["52,53"] = true;
-        occupiedPosition["52,54"] = true;
-        occupiedPosition["52,55"] = true;
-        occupiedPosition["52,64"] = true;
-        occupiedPosition["53,-56"] = true;
-        occupiedPosition["53,-53"] = true;
-        occupiedPosition["53,-52"] = true;
-        occupiedPosition["53,-51"] = true;
-        occupiedPosition["53,-50"] = true;
-        occupiedPosition["53,-49"] = true;
-        occupiedPosition["53,-48"] = true;
-        occupiedPosition["53,-47"] = true;
-        occupiedPosition["53,-46"] = true;
-        occupiedPosition["53,-45"] = true;
-        occupiedPosition["53,-44"] = true;
-        occupiedPosition["53,-43"] = true;
-        occupiedPosition["53,-39"] = true;
-        occupiedPosition["53,-38"] = true;
-        occupiedPosition["53,-29"] = true;
-        occupiedPosition["53,-28"] = true;
-        occupiedPosition["53,-20"] = true;
-        occupiedPosition["53,-19"] = true;
-        occupiedPosition["53,-7"] = true;
-        occupiedPosition["53,-6"] = true;
-        occupiedPosition["53,-2"] = true;
-        occupiedPosition["53,-1"] = true;
-        occupiedPosition["53,0"] = true;
-        occupiedPosition["53,1"] = true;
-        occupiedPosition["53,2"] = true;
-        occupiedPosition["53,3"] = true;
-        occupiedPosition["53,7"] = true;
-        occupiedPosition["53,8"] = true;
-        occupiedPosition["53,14"] = true;
-        occupiedPosition["53,15"] = true;
-        occupiedPosition["53,16"] = true;
-        occupiedPosition["53,17"] = true;
-        occupiedPosition["53,18"] = true;
-        occupiedPosition["53,41"] = true;
-        occupiedPosition["53,42"] = true;
-        occupiedPosition["53,45"] = true;
-        occupiedPosition["53,46"] = true;
-        occupiedPosition["53,47"] = true;
-        occupiedPosition["53,48"] = true;
-        occupiedPosition["53,49"] = true;
-        occupiedPosition["53,50"] = true;
-        occupiedPosition["53,51"] = true;
-        occupiedPosition["53,52"] = true;
-        occupiedPosition["53,53"] = true;
-        occupiedPosition["53,54"] = true;
-        occupiedPosition["53,64"] = true;
-        occupiedPosition["54,-56"] = true;
-        occupiedPosition["54,-53"] = true;
-        occupiedPosition["54,-52"] = true;
-        occupiedPosition["54,-51"] = true;
-        occupiedPosition["54,-50"] = true;
-        occupiedPosition["54,-49"] = true;
-        occupiedPosition["54,-48"] = true;
-        occupiedPosition["54,-47"] = true;
-        occupiedPosition["54,-46"] = true;
-        occupiedPosition["54,-45"] = true;
-        occupiedPosition["54,-44"] = true;
-        occupiedPosition["54,-43"] = true;
-        occupiedPosition["54,-42"] = true;
-        occupiedPosition["54,-39"] = true;
-        occupiedPosition["54,-38"] = true;
-        occupiedPosition["54,-37"] = true;
-        occupiedPosition["54,-36"] = true;
-        occupiedPosition["54,-35"] = true;
-        occupiedPosition["54,-34"] = true;
-        occupiedPosition["54,-33"] = true;
-        occupiedPosition["54,-32"] = true;
-        occupiedPosition["54,-31"] = true;
-        occupiedPosition["54,-30"] = true;
-        occupiedPosition["54,-29"] = true;
-        occupiedPosition["54,-28"] = true;
-        occupiedPosition["54,-20"] = true;
-        occupiedPosition["54,-19"] = true;
-        occupiedPosition["54,-7"] = true;
-        occupiedPosition["54,-6"] = true;
-        occupiedPosition["54,-2"] = true;
-        occupiedPosition["54,-1"] = true;
-        occupiedPosition["54,0"] = true;
-        occupiedPosition["54,1"] = true;
-        occupiedPosition["54,2"] = true;
-        occupiedPosition["54,3"] = true;
-        occupiedPosition["54,7"] = true;
-        occupiedPosition["54,8"] = true;
-        occupiedPosition["54,14"] = true;
-        occupiedPosition["54,15"] = true;
-        occupiedPosition["54,17"] = true;
-        occupiedPosition["54,18"] = true;
-        occupiedPosition["54,41"] = true;
-        occupiedPosition["54,42"] = true;
-        occupiedPosition["54,45"] = true;
-        occupiedPosition["54,46"] = true;
-        occupiedPosition["54,47"] = true;
-        occupiedPosition["54,48"] = true;
-        occupiedPosition["54,49"] = true;
-        occupiedPosition["54,50"] = true;
-        occupiedPosition["54,51"] = true;
-        occupiedPosition["54,52"] = true;
-        occupiedPosition["54,53"] = true;
-        occupiedPosition["54,54"] = true;
-        occupiedPosition["55,-56"] = true;
-        occupiedPosition["55,-44"] = true;
-        occupiedPosition["55,-43"] = true;
-        occupiedPosition["55,-42"] = true;
-        occupiedPosition["55,-39"] = true;
-        occupiedPosition["55,-38"] = true;
-        occupiedPosition["55,-37"] = true;
-        occupiedPosition["55,-36"] = true;
-        occupiedPosition["55,-35"] = true;
-        occupiedPosition["55,-34"] = true;
-        occupiedPosition["55,-33"] = true;
-        occupiedPosition["55,-32"] = true;
-        occupiedPosition["55,-31"] = true;
-        occupiedPosition["55,-30"] = true;
-        occupiedPosition["55,-29"] = true;
-        occupiedPosition["55,-28"] = true;
-        occupiedPosition["55,-20"] = true;
-        occupiedPosition["55,-19"] = true;
-        occupiedPosition["55,-18"] = true;
-        occupiedPosition["55,-17"] = true;
-        occupiedPosition["55,-16"] = true;
-        occupiedPosition["55,-15"] = true;
-        occupiedPosition["55,-14"] = true;
-        occupiedPosition["55,-13"] = true;
-        occupiedPosition["55,-12"] = true;
-        occupiedPosition["55,-11"] = true;
-        occupiedPosition["55,-10"] = true;
-        occupiedPosition["55,-9"] = true;
-        occupiedPosition["55,-8"] = true;
-        occupiedPosition["55,-7"] = true;
-        occupiedPosition["55,-6"] = true;
-        occupiedPosition["55,-2"] = true;
-        occupiedPosition["55,-1"] = true;
-        occupiedPosition["55,0"] = true;
-        occupiedPosition["55,1"] = true;
-        occupiedPosition["55,2"] = true;
-        occupiedPosition["55,3"] = true;
-        occupiedPosition["55,7"] = true;
-        occupiedPosition["55,8"] = true;
-        occupiedPosition["55,14"] = true;
-        occupiedPosition["55,15"] = true;
-        occupiedPosition["55,17"] = true;
-        occupiedPosition["55,18"] = true;
-        occupiedPosition["55,41"] = true;
-        occupiedPosition["55,42"] = true;
-        occupiedPosition["55,53"] = true;
-        occupiedPosition["55,54"] = true;
-        occupiedPosition["56,-56"] = true;
-        occupiedPosition["56,-20"] = true;
-        occupiedPosition["56,-19"] = true;
-        occupiedPosition["56,-18"] = true;
-        occupiedPosition["56,-17"] = true;
-        occupiedPosition["56,-16"] = true;
-        occupiedPosition["56,-15"] = true;
-        occupiedPosition["56,-14"] = true;
-        occupiedPosition["56,-13"] = true;
-        occupiedPosition["56,-12"] = true;
-        occupiedPosition["56,-11"] = true;
-        occupiedPosition["56,-10"] = true;
-        occupiedPosition["56,-9"] = true;
-        occupiedPosition["56,-8"] = true;
-        occupiedPosition["56,-7"] = true;
-        occupiedPosition["56,-6"] = true;
-        occupiedPosition["56,-2"] = true;
-        occupiedPosition["56,-1"] = true;
-        occupiedPosition["56,0"] = true;
-        occupiedPosition["56,1"] = true;
-        occupiedPosition["56,2"] = true;
-        occupiedPosition["56,3"] = true;
-        occupiedPosition["56,7"] = true;
-        occupiedPosition["56,8"] = true;
-        occupiedPosition["56,14"] = true;
-        occupiedPosition["56,15"] = true;
-        occupiedPosition["56,16"] = true;
-        occupiedPosition["56,17"] = true;
-        occupiedPosition["56,18"] = true;
-        occupiedPosition["56,41"] = true;
-        occupiedPosition["56,42"] = true;
-        occupiedPosition["56,53"] = true;
-        occupiedPosition["56,54"] = true;
-        occupiedPosition["57,-56"] = true;
-        occupiedPosition["57,-53"] = true;
-        occupiedPosition["57,-52"] = true;
-        occupiedPosition["57,-2"] = true;
-        occupiedPosition["57,-1"] = true;
-        occupiedPosition["57,0"] = true;
-        occupiedPosition["57,1"] = true;
-        occupiedPosition["57,2"] = true;
-        occupiedPosition["57,3"] = true;
-        occupiedPosition["57,7"] = true;
-        occupiedPosition["57,8"] = true;
-        occupiedPosition["57,14"] = true;
-        occupiedPosition["57,15"] = true;
-        occupiedPosition["57,16"] = true;
-        occupiedPosition["57,17"] = true;
-        occupiedPosition["57,18"] = true;
-        occupiedPosition["57,41"] = true;
-        occupiedPosition["57,42"] = true;
-        occupiedPosition["57,53"] = true;
-        occupiedPosition["57,54"] = true;
-        occupiedPosition["58,-56"] = true;
-        occupiedPosition["58,-54"] = true;
-        occupiedPosition["58,-53"] = true;
-        occupiedPosition["58,-52"] = true;
-        occupiedPosition["58,-51"] = true;
-        occupiedPosition["58,-2"] = true;
-        occupiedPosition["58,-1"] = true;
-        occupiedPosition["58,0"] = true;
-        occupiedPosition["58,1"] = true;
-        occupiedPosition["58,2"] = true;
-        occupiedPosition["58,3"] = true;
-        occupiedPosition["58,7"] = true;
-        occupiedPosition["58,8"] = true;
-        occupiedPosition["58,14"] = true;
-        occupiedPosition["58,15"] = true;
-        occupiedPosition["58,41"] = true;
-        occupiedPosition["58,42"] = true;
-        occupiedPosition["58,53"] = true;
-        occupiedPosition["58,54"] = true;
-        occupiedPosition["59,-56"] = true;
-        occupiedPosition["59,-54"] = true;
-        occupiedPosition["59,-53"] = true;
-        occupiedPosition["59,-52"] = true;
-        occupiedPosition["59,-51"] = true;
-        occupiedPosition["59,-18"] = true;
-        occupiedPosition["59,-2"] = true;
-        occupiedPosition["59,-1"] = true;
-        occupiedPosition["59,0"] = true;
-        occupiedPosition["59,1"] = true;
-        occupiedPosition["59,2"] = true;
-        occupiedPosition["59,3"] = true;
-        occupiedPosition["59,7"] = true;
-        occupiedPosition["59,8"] = true;
-        occupiedPosition["59,13"] = true;
-        occupiedPosition["59,14"] = true;
-        occupiedPosition["59,41"] = true;
-        occupiedPosition["59,42"] = true;
-        occupiedPosition["59,53"] = true;
-        occupiedPosition["59,54"] = true;
-        occupiedPosition["59,58"] = true;
-        occupiedPosition["59,59"] = true;
-        occupiedPosition["59,64"] = true;
-        occupiedPosition["60,-56"] = true;
-        occupiedPosition["60,-53"] = true;
-        occupiedPosition["60,-52"] = true;
-        occupiedPosition["60,-35"] = true;
-        occupiedPosition["60,-34"] = true;
-        occupiedPosition["60,-33"] = true;
-        occupiedPosition["60,-29"] = true;
-        occupiedPosition["60,-28"] = true;
-        occupiedPosition["60,-20"] = true;
-        occupiedPosition["60,-19"] = true;
-        occupiedPosition["60,-18"] = true;
-        occupiedPosition["60,-17"] = true;
-        occupiedPosition["60,-2"] = true;
-        occupiedPosition["60,-1"] = true;
-        occupiedPosition["60,0"] = true;
-        occupiedPosition["60,1"] = true;
-        occupiedPosition["60,2"] = true;
-        occupiedPosition["60,3"] = true;
-        occupiedPosition["60,7"] = true;
-        occupiedPosition["60,8"] = true;
-        occupiedPosition["60,9"] = true;
-        occupiedPosition["60,10"] = true;
-        occupiedPosition["60,11"] = true;
-        occupiedPosition["60,12"] = true;
-        occupiedPosition["60,13"] = true;
-        occupiedPosition["60,14"] = true;
-        occupiedPosition["60,15"] = true;
-        occupiedPosition["60,16"] = true;
-        occupiedPosition["60,17"] = true;
-        occupiedPosition["60,21"] = true;
-        occupiedPosition["60,22"] = true;
-        occupiedPosition["60,41"] = true;
-        occupiedPosition["60,42"] = true;
-        occupiedPosition["60,43"] = true;
-        occupiedPosition["60,44"] = true;
-        occupiedPosition["60,45"] = true;
-        occupiedPosition["60,46"] = true;
-        occupiedPosition["60,47"] = true;
-        occupiedPosition["60,48"] = true;
-        occupiedPosition["60,49"] = true;
-        occupiedPosition["60,50"] = true;
-        occupiedPosition["60,51"] = true;
-        occupiedPosition["60,52"] = true;
-        occupiedPosition["60,53"] = true;
-        occupiedPosition["60,54"] = true;
-        occupiedPosition["60,57"] = true;
-        occupiedPosition["60,58"] = true;
-        occupiedPosition["60,59"] = true;
-        occupiedPosition["60,60"] = true;
-        occupiedPosition["61,-56"] = true;
-        occupiedPosition["61,-35"] = true;
-        occupiedPosition["61,-34"] = true;
-        occupiedPosition["61,-33"] = true;
-        occupiedPosition["61,-30"] = true;
-        occupiedPosition["61,-29"] = true;
-        occupiedPosition["61,-28"] = true;
-        occupiedPosition["61,-27"] = true;
-        occupiedPosition["61,-20"] = true;
-        occupiedPosition["61,-19"] = true;
-        occupiedPosition["61,-18"] = true;
-        occupiedPosition["61,-17"] = true;
-        occupiedPosition["61,-6"] = true;
-        occupiedPosition["61,-5"] = true;
-        occupiedPosition["61,-4"] = true;
-        occupiedPosition["61,-2"] = true;
-        occupiedPosition["61,-1"] = true;
-        occupiedPosition["61,0"] = true;
-        occupiedPosition["61,1"] = true;
-        occupiedPosition["61,2"] = true;
-        occupiedPosition["61,3"] = true;
-        occupiedPosition["61,7"] = true;
-        occupiedPosition["61,8"] = true;
-        occupiedPosition["61,9"] = true;
-        occupiedPosition["61,10"] = true;
-        occupiedPosition["61,11"] = true;
-        occupiedPosition["61,12"] = true;
-        occupiedPosition["61,13"] = true;
-        occupiedPosition["61,14"] = true;
-        occupiedPosition["61,15"] = true;
-        occupiedPosition["61,16"] = true;
-        occupiedPosition["61,17"] = true;
-        occupiedPosition["61,20"] = true;
-        occupiedPosition["61,21"] = true;
-        occupiedPosition["61,22"] = true;
-        occupiedPosition["61,23"] = true;
-        occupiedPosition["61,41"] = true;
-        occupiedPosition["61,42"] = true;
-        occupiedPosition["61,43"] = true;
-        occupiedPosition["61,44"] = true;
-        occupiedPosition["61,45"] = true;
-        occupiedPosition["61,46"] = true;
-        occupiedPosition["61,47"] = true;
-        occupiedPosition["61,48"] = true;
-        occupiedPosition["61,49"] = true;
-        occupiedPosition["61,50"] = true;
-        occupiedPosition["61,51"] = true;
-        occupiedPosition["61,52"] = true;
-        occupiedPosition["61,53"] = true;
-        occupiedPosition["61,54"] = true;
-        occupiedPosition["61,57"] = true;
-        occupiedPosition["61,58"] = true;
-        occupiedPosition["61,59"] = true;
-        occupiedPosition["61,60"] = true;
-        occupiedPosition["61,64"] = true;
-        occupiedPosition["62,-56"] = true;
-        occupiedPosition["62,-1"] = true;
-        occupiedPosition["62,0"] = true;
-        occupiedPosition["62,1"] = true;
-        occupiedPosition["62,2"] = true;
-        occupiedPosition["62,15"] = true;
-        occupiedPosition["62,16"] = true;
-        occupiedPosition["62,17"] = true;
-        occupiedPosition["62,20"] = true;
-        occupiedPosition["62,21"] = true;
-        occupiedPosition["62,22"] = true;
-        occupiedPosition["62,23"] = true;
-        occupiedPosition["62,26"] = true;
-        occupiedPosition["62,27"] = true;
-        occupiedPosition["62,39"] = true;
-        occupiedPosition["62,58"] = true;
-        occupiedPosition["62,59"] = true;
-        occupiedPosition["62,64"] = true;
-        occupiedPosition["63,-56"] = true;
-        occupiedPosition["63,-1"] = true;
-        occupiedPosition["63,0"] = true;
-        occupiedPosition["63,1"] = true;
-        occupiedPosition["63,21"] = true;
-        occupiedPosition["63,22"] = true;
-        occupiedPosition["63,26"] = true;
-        occupiedPosition["63,27"] = true;
-        occupiedPosition["63,28"] = true;
-        occupiedPosition["63,39"] = true;
-        occupiedPosition["63,40"] = true;
-        occupiedPosition["64,-56"] = true;
-        occupiedPosition["64,-54"] = true;
-        occupiedPosition["64,-53"] = true;
-        occupiedPosition["64,-51"] = true;
-        occupiedPosition["64,-45"] = true;
-        occupiedPosition["64,-44"] = true;
-        occupiedPosition["64,-42"] = true;
-        occupiedPosition["64,-40"] = true;
-        occupiedPosition["64,-39"] = true;
-        occupiedPosition["64,-37"] = true;
-        occupiedPosition["64,-36"] = true;
-        occupiedPosition["64,-22"] = true;
-        occupiedPosition["64,-19"] = true;
-        occupiedPosition["64,-17"] = true;
-        occupiedPosition["64,-16"] = true;
-        occupiedPosition["64,-14"] = true;
-        occupiedPosition["64,-12"] = true;
-        occupiedPosition["64,-11"] = true;
-        occupiedPosition["64,-9"] = true;
-        occupiedPosition["64,-8"] = true;
-        occupiedPosition["64,-7"] = true;
-        occupiedPosition["64,-6"] = true;
-        occupiedPosition["64,-4"] = true;
-        occupiedPosition["64,-3"] = true;
-        occupiedPosition["64,-2"] = true;
-        occupiedPosition["64,-1"] = true;
-        occupiedPosition["64,0"] = true;
-        occupiedPosition["64,1"] = true;
-        occupiedPosition["64,2"] = true;
-        occupiedPosition["64,3"] = true;
-        occupiedPosition["64,4"] = true;
-        occupiedPosition["64,5"] = true;
-        occupiedPosition["64,6"] = true;
-        occupiedPosition["64,7"] = true;
-        occupiedPosition["64,8"] = true;
-        occupiedPosition["64,9"] = true;
-        occupiedPosition["64,10"] = true;
-        occupiedPosition["64,11"] = true;
-        occupiedPosition["64,12"] = true;
-        occupiedPosition["64,13"] = true;
-        occupiedPosition["64,14"] = true;
-        occupiedPosition["64,15"] = true;
-        occupiedPosition["64,16"] = true;
-        occupiedPosition["64,17"] = true;
-        occupiedPosition["64,18"] = true;
-        occupiedPosition["64,19"] = true;
-        occupiedPosition["64,20"] = true;
-        occupiedPosition["64,21"] = true;
-        occupiedPosition["64,22"] = true;
-        occupiedPosition["64,26"] = true;
-        occupiedPosition["64,27"] = true;
-        occupiedPosition["64,37"] = true;
-        occupiedPosition["64,38"] = true;
-        occupiedPosition["64,39"] = true;
-        occupiedPosition["64,40"] = true;
-        occupiedPosition["64,41"] = true;
-        occupiedPosition["64,42"] = true;
-        occupiedPosition["64,43"] = true;
-        occupiedPosition["64,44"] = true;
-        occupiedPosition["64,45"] = true;
-        occupiedPosition["64,46"] = true;
-        occupiedPosition["64,47"] = true;
-        occupiedPosition["64,48"] = true;
-        occupiedPosition["64,49"] = true;
-        occupiedPosition["64,50"] = true;
-        occupiedPosition["64,51"] = true;
-        occupiedPosition["64,52"] = true;
-        occupiedPosition["64,53"] = true;
-        occupiedPosition["64,54"] = true;
-        occupiedPosition["64,55"] = true;
-        occupiedPosition["64,56"] = true;
-        occupiedPosition["64,57"] = true;
-        occupiedPosition["64,58"] = true;
-        occupiedPosition["64,59"] = true;
-        occupiedPosition["64,60"] = true;
-        occupiedPosition["64,61"] = true;
-        occupiedPosition["64,62"] = true;
-        occupiedPosition["64,63"] = true;
-        occupiedPosition["64,64"] = true;
+        Networking.TerrainPackInfo info = opened.GetInfo();
+        this.Width = info.Width;
+        this.Length = info.Length;
+        this.Data = new Encoding() { tiles = opened.Tiles() };
+        this.CompressedData = opened.Payload();
+        pack = opened;
+        return true;
+    }
+
+    // Writes the current map's pack to path for later matches to load
+    public bool SavePack(string path)
+    {
+        return pack != null && pack.Save(path);
     }
+
+    // The town, world x, z pairs that are occupied whatever map is generated
+    private static readonly Int32[] townOccupied =
+    {
+        -65, -54, -65, -53, -65, -52, -65, -51, -65, -50, -65, -49, -65, -48, -65, -46, -65, -45, -65, -44,
+        -65, -43, -65, -42, -65, -41, -65, -40, -65, -38, -65, -36, -65, -35, -65, -34, -65, -21, -65, -20,
+        -65, -19, -65, -18, -65, -17, -65, -16, -65, -15, -65, -14, -65, -13, -65, -12, -65, -9, -65, -7,
+        -65, -6, -65, -5, -65, -4, -65, -3, -65, -1, -65, 0, -65, 1, -65, 2, -65, 3, -65, 4,
+        -65, 5, -65, 6, -65, 7, -65, 8, -65, 9, -65, 10, -65, 11, -65, 12, -65, 13, -65, 14,
+        -65, 15, -65, 16, -65, 17, -65, 18, -65, 19, -65, 20, -65, 21, -65, 22, -65, 23, -65, 24,
+        -65, 25, -65, 26, -65, 27, -65, 43, -65, 44, -65, 45, -65, 46, -65, 47, -65, 48, -65, 49,
+        -65, 50, -65, 51, -65, 52, -65, 53, -65, 54, -65, 55, -65, 56, -65, 57, -65, 58, -65, 59,
+        -65, 60, -65, 61, -65, 62, -65, 63, -65, 64, -64, -56, -64, -55, -64, -54, -64, -53, -64, -51,
+        -64, -50, -64, -49, -64, -48, -64, -46, -64, -45, -64, -43, -64, -41, -64, -40, -64, -38, -64, -35,
+        -64, -21, -64, -20, -64, -18, -64, -17, -64, -15, -64, -13, -64, -12, -64, -6, -64, -4, -64, -3,
+        -64, -1, -64, 0, -64, 1, -64, 2, -64, 3, -64, 4, -64, 5, -64, 6, -64, 7, -64, 8,
+        -64, 9, -64, 10, -64, 11, -64, 12, -64, 13, -64, 14, -64, 15, -64, 16, -64, 17, -64, 18,
+        -64, 19, -64, 20, -64, 21, -64, 22, -64, 23, -64, 24, -64, 25, -64, 26, -64, 27, -64, 28,
+        -64, 38, -64, 39, -64, 43, -64, 44, -64, 45, -64, 46, -64, 47, -64, 48, -64, 49, -64, 50,
+        -64, 51, -64, 52, -64, 53, -64, 54, -64, 55, -64, 56, -64, 57, -64, 58, -64, 59, -64, 60,
+        -64, 61, -64, 62, -64, 63, -64, 64, -63, -1, -63, 0, -63, 25, -63, 26, -63, 37, -63, 38,
+        -63, 39, -63, 43, -63, 44, -63, 64, -62, -1, -62, 0, -62, 1, -62, 6, -62, 7, -62, 26,
+        -62, 38, -62, 39, -62, 42, -62, 43, -62, 44, -62, 45, -62, 48, -62, 49, -62, 50, -62, 63,
+        -62, 64, -61, -56, -61, -55, -61, -53, -61, -52, -61, -51, -61, -40, -61, -39, -61, -38, -61, -37,
+        -61, -30, -61, -29, -61, -28, -61, -27, -61, -24, -61, -23, -61, -22, -61, -1, -61, 0, -61, 1,
+        -61, 5, -61, 6, -61, 7, -61, 8, -61, 11, -61, 12, -61, 13, -61, 14, -61, 15, -61, 16,
+        -61, 17, -61, 18, -61, 19, -61, 20, -61, 21, -61, 22, -61, 23, -61, 24, -61, 42, -61, 43,
+        -61, 44, -61, 45, -61, 48, -61, 49, -61, 50, -61, 51, -61, 52, -61, 53, -61, 54, -61, 55,
+        -61, 56, -61, 57, -61, 58, -61, 63, -61, 64, -60, -56, -60, -55, -60, -40, -60, -39, -60, -38,
+        -60, -37, -60, -29, -60, -28, -60, -24, -60, -23, -60, -22, -60, -5, -60, -4, -60, -1, -60, 0,
+        -60, 1, -60, 5, -60, 6, -60, 7, -60, 8, -60, 11, -60, 12, -60, 13, -60, 14, -60, 15,
+        -60, 16, -60, 17, -60, 18, -60, 19, -60, 20, -60, 21, -60, 22, -60, 23, -60, 24, -60, 43,
+        -60, 44, -60, 48, -60, 49, -60, 50, -60, 51, -60, 52, -60, 53, -60, 54, -60, 55, -60, 56,
+        -60, 57, -60, 58, -60, 64, -59, -56, -59, -55, -59, -39, -59, -6, -59, -5, -59, -4, -59, -3,
+        -59, -1, -59, 0, -59, 1, -59, 6, -59, 7, -59, 11, -59, 12, -59, 23, -59, 24, -59, 51,
+        -59, 52, -59, 57, -59, 58, -59, 63, -59, 64, -58, -56, -58, -55, -58, -6, -58, -5, -58, -4,
+        -58, -3, -58, -1, -58, 0, -58, 1, -58, 11, -58, 12, -58, 23, -58, 24, -58, 50, -58, 51,
+        -58, 57, -58, 58, -58, 64, -57, -56, -57, -55, -57, -5, -57, -4, -57, -1, -57, 0, -57, 1,
+        -57, 11, -57, 12, -57, 23, -57, 24, -57, 47, -57, 48, -57, 49, -57, 50, -57, 51, -57, 57,
+        -57, 58, -57, 63, -57, 64, -56, -56, -56, -55, -56, -51, -56, -50, -56, -49, -56, -48, -56, -47,
+        -56, -46, -56, -45, -56, -44, -56, -43, -56, -42, -56, -41, -56, -40, -56, -39, -56, -38, -56, -37,
+        -56, -1, -56, 0, -56, 1, -56, 11, -56, 12, -56, 23, -56, 24, -56, 47, -56, 48, -56, 49,
+        -56, 50, -56, 51, -56, 57, -56, 58, -56, 63, -56, 64, -55, -56, -55, -55, -55, -51, -55, -50,
+        -55, -49, -55, -48, -55, -47, -55, -46, -55, -45, -55, -44, -55, -43, -55, -42, -55, -41, -55, -40,
+        -55, -39, -55, -38, -55, -37, -55, -29, -55, -28, -55, -27, -55, -26, -55, -25, -55, -24, -55, -23,
+        -55, -22, -55, -21, -55, -20, -55, -19, -55, -18, -55, -15, -55, -14, -55, -13, -55, -1, -55, 0,
+        -55, 1, -55, 11, -55, 12, -55, 23, -55, 24, -55, 47, -55, 48, -55, 50, -55, 51, -55, 57,
+        -55, 58, -55, 64, -54, -56, -54, -55, -54, -51, -54, -50, -54, -38, -54, -37, -54, -29, -54, -28,
+        -54, -27, -54, -26, -54, -25, -54, -24, -54, -23, -54, -22, -54, -21, -54, -20, -54, -19, -54, -18,
+        -54, -15, -54, -14, -54, -13, -54, -12, -54, -11, -54, -10, -54, -9, -54, -8, -54, -7, -54, -6,
+        -54, -5, -54, -4, -54, -1, -54, 0, -54, 1, -54, 11, -54, 12, -54, 13, -54, 14, -54, 15,
+        -54, 16, -54, 17, -54, 18, -54, 19, -54, 20, -54, 23, -54, 24, -54, 47, -54, 48, -54, 50,
+        -54, 51, -54, 57, -54, 58, -54, 64, -53, -56, -53, -55, -53, -51, -53, -50, -53, -38, -53, -37,
+        -53, -29, -53, -28, -53, -19, -53, -18, -53, -14, -53, -13, -53, -12, -53, -11, -53, -10, -53, -9,
+        -53, -8, -53, -7, -53, -6, -53, -5, -53, -4, -53, -1, -53, 0, -53, 1, -53, 11, -53, 12,
+        -53, 13, -53, 14, -53, 15, -53, 16, -53, 17, -53, 18, -53, 19, -53, 20, -53, 23, -53, 24,
+        -53, 47, -53, 48, -53, 49, -53, 50, -53, 51, -53, 57, -53, 58, -53, 63, -53, 64, -52, -56,
+        -52, -55, -52, -51, -52, -50, -52, -38, -52, -37, -52, -29, -52, -28, -52, -19, -52, -18, -52, -14,
+        -52, -13, -52, -12, -52, -11, -52, -5, -52, -4, -52, -1, -52, 0, -52, 1, -52, 10, -52, 11,
+        -52, 12, -52, 13, -52, 15, -52, 16, -52, 19, -52, 20, -52, 23, -52, 24, -52, 47, -52, 48,
+        -52, 49, -52, 50, -52, 51, -52, 57, -52, 58, -52, 63, -52, 64, -51, -56, -51, -55, -51, -51,
+        -51, -50, -51, -38, -51, -37, -51, -29, -51, -28, -51, -27, -51, -26, -51, -25, -51, -19, -51, -18,
+        -51, -12, -51, -11, -51, -5, -51, -4, -51, -1, -51, 0, -51, 1, -51, 10, -51, 11, -51, 12,
+        -51, 13, -51, 15, -51, 16, -51, 19, -51, 20, -51, 21, -51, 22, -51, 23, -51, 24, -51, 50,
+        -51, 51, -51, 57, -51, 58, -51, 59, -51, 60, -51, 61, -51, 64, -50, -56, -50, -55, -50, -51,
+        -50, -50, -50, -38, -50, -37, -50, -29, -50, -28, -50, -27, -50, -26, -50, -25, -50, -19, -50, -18,
+        -50, -14, -50, -13, -50, -12, -50, -11, -50, -5, -50, -4, -50, -1, -50, 0, -50, 1, -50, 10,
+        -50, 11, -50, 19, -50, 20, -50, 21, -50, 22, -50, 23, -50, 24, -50, 41, -50, 42, -50, 43,
+        -50, 50, -50, 51, -50, 57, -50, 58, -50, 59, -50, 60, -50, 61, -50, 63, -50, 64, -49, -56,
+        -49, -55, -49, -51, -49, -50, -49, -38, -49, -37, -49, -26, -49, -25, -49, -19, -49, -18, -49, -14,
+        -49, -13, -49, -12, -49, -11, -49, -5, -49, -4, -49, -1, -49, 0, -49, 1, -49, 40, -49, 41,
+        -49, 42, -49, 43, -49, 50, -49, 51, -49, 52, -49, 53, -49, 54, -49, 55, -49, 56, -49, 57,
+        -49, 58, -49, 59, -49, 60, -49, 61, -49, 64, -48, -56, -48, -55, -48, -51, -48, -50, -48, -38,
+        -48, -37, -48, -26, -48, -25, -48, -19, -48, -18, -48, -12, -48, -11, -48, -5, -48, -4, -48, -1,
+        -48, 0, -48, 1, -48, 41, -48, 42, -48, 43, -48, 50, -48, 51, -48, 52, -48, 53, -48, 54,
+        -48, 55, -48, 56, -48, 57, -48, 58, -48, 63, -48, 64, -47, -56, -47, -55, -47, -51, -47, -50,
+        -47, -38, -47, -37, -47, -26, -47, -25, -47, -19, -47, -18, -47, -12, -47, -11, -47, -5, -47, -4,
+        -47, -1, -47, 0, -47, 1, -47, 10, -47, 11, -47, 12, -47, 13, -47, 14, -47, 15, -47, 16,
+        -47, 17, -47, 18, -47, 19, -47, 20, -47, 21, -47, 22, -47, 23, -47, 24, -47, 52, -47, 53,
+        -47, 54, -47, 63, -47, 64, -46, -56, -46, -55, -46, -54, -46, -53, -46, -52, -46, -51, -46, -50,
+        -46, -38, -46, -37, -46, -26, -46, -25, -46, -19, -46, -18, -46, -15, -46, -14, -46, -13, -46, -12,
+        -46, -11, -46, -5, -46, -4, -46, -1, -46, 0, -46, 1, -46, 10, -46, 11, -46, 12, -46, 13,
+        -46, 14, -46, 15, -46, 16, -46, 17, -46, 18, -46, 19, -46, 20, -46, 21, -46, 22, -46, 23,
+        -46, 24, -46, 52, -46, 53, -46, 54, -46, 64, -45, -56, -45, -55, -45, -54, -45, -53, -45, -52,
+        -45, -51, -45, -50, -45, -49, -45, -38, -45, -37, -45, -32, -45, -31, -45, -30, -45, -26, -45, -25,
+        -45, -19, -45, -18, -45, -15, -45, -14, -45, -13, -45, -12, -45, -11, -45, -5, -45, -4, -45, -1,
+        -45, 0, -45, 1, -45, 10, -45, 11, -45, 23, -45, 24, -45, 50, -45, 51, -45, 52, -45, 53,
+        -45, 54, -45, 55, -45, 56, -45, 57, -45, 58, -45, 63, -45, 64, -44, -56, -44, -55, -44, -54,
+        -44, -53, -44, -51, -44, -50, -44, -49, -44, -38, -44, -37, -44, -32, -44, -31, -44, -30, -44, -29,
+        -44, -26, -44, -25, -44, -19, -44, -18, -44, -15, -44, -14, -44, -5, -44, -4, -44, -1, -44, 0,
+        -44, 1, -44, 10, -44, 11, -44, 23, -44, 24, -44, 50, -44, 51, -44, 52, -44, 53, -44, 54,
+        -44, 55, -44, 56, -44, 57, -44, 58, -44, 64, -43, -56, -43, -55, -43, -54, -43, -53, -43, -51,
+        -43, -50, -43, -49, -43, -38, -43, -37, -43, -35, -43, -34, -43, -33, -43, -32, -43, -31, -43, -30,
+        -43, -29, -43, -26, -43, -25, -43, -19, -43, -18, -43, -15, -43, -14, -43, -5, -43, -4, -43, -1,
+        -43, 0, -43, 1, -43, 4, -43, 5, -43, 10, -43, 11, -43, 23, -43, 24, -43, 26, -43, 27,
+        -43, 28, -43, 33, -43, 34, -43, 35, -43, 36, -43, 37, -43, 38, -43, 50, -43, 51, -43, 57,
+        -43, 58, -43, 63, -43, 64, -42, -56, -42, -55, -42, -54, -42, -53, -42, -52, -42, -51, -42, -50,
+        -42, -49, -42, -38, -42, -37, -42, -35, -42, -34, -42, -33, -42, -32, -42, -31, -42, -30, -42, -29,
+        -42, -26, -42, -25, -42, -24, -42, -23, -42, -22, -42, -21, -42, -20, -42, -19, -42, -18, -42, -15,
+        -42, -14, -42, -13, -42, -12, -42, -11, -42, -10, -42, -9, -42, -8, -42, -7, -42, -6, -42, -5,
+        -42, -4, -42, -1, -42, 0, -42, 1, -42, 4, -42, 5, -42, 10, -42, 11, -42, 23, -42, 24,
+        -42, 25, -42, 26, -42, 27, -42, 28, -42, 33, -42, 34, -42, 35, -42, 36, -42, 37, -42, 38,
+        -42, 50, -42, 51, -42, 57, -42, 58, -42, 63, -42, 64, -41, -56, -41, -55, -41, -54, -41, -53,
+        -41, -52, -41, -51, -41, -50, -41, -49, -41, -38, -41, -37, -41, -35, -41, -34, -41, -33, -41, -32,
+        -41, -31, -41, -30, -41, -29, -41, -27, -41, -26, -41, -25, -41, -24, -41, -23, -41, -22, -41, -21,
+        -41, -20, -41, -19, -41, -18, -41, -15, -41, -14, -41, -13, -41, -12, -41, -11, -41, -10, -41, -9,
+        -41, -8, -41, -7, -41, -6, -41, -5, -41, -4, -41, -1, -41, 0, -41, 1, -41, 4, -41, 5,
+        -41, 10, -41, 11, -41, 23, -41, 24, -41, 25, -41, 26, -41, 27, -41, 28, -41, 33, -41, 34,
+        -41, 35, -41, 36, -41, 37, -41, 38, -41, 47, -41, 48, -41, 49, -41, 50, -41, 51, -41, 57,
+        -41, 58, -41, 64, -40, -56, -40, -55, -40, -51, -40, -50, -40, -38, -40, -37, -40, -35, -40, -34,
+        -40, -33, -40, -32, -40, -31, -40, -30, -40, -29, -40, -27, -40, -26, -40, -25, -40, -24, -40, -23,
+        -40, -2, -40, -1, -40, 0, -40, 1, -40, 10, -40, 11, -40, 14, -40, 15, -40, 16, -40, 17,
+        -40, 18, -40, 19, -40, 20, -40, 21, -40, 22, -40, 23, -40, 24, -40, 25, -40, 26, -40, 27,
+        -40, 33, -40, 34, -40, 35, -40, 36, -40, 37, -40, 38, -40, 47, -40, 48, -40, 49, -40, 50,
+        -40, 51, -40, 57, -40, 58, -40, 63, -40, 64, -39, -56, -39, -51, -39, -50, -39, -38, -39, -37,
+        -39, -35, -39, -34, -39, -33, -39, -32, -39, -31, -39, -30, -39, -25, -39, -24, -39, -23, -39, -22,
+        -39, -3, -39, -2, -39, -1, -39, 0, -39, 1, -39, 10, -39, 11, -39, 14, -39, 15, -39, 16,
+        -39, 17, -39, 18, -39, 19, -39, 20, -39, 21, -39, 22, -39, 23, -39, 24, -39, 25, -39, 33,
+        -39, 34, -39, 35, -39, 36, -39, 37, -39, 38, -39, 46, -39, 47, -39, 48, -39, 50, -39, 51,
+        -39, 57, -39, 58, -39, 64, -38, -51, -38, -50, -38, -38, -38, -37, -38, -35, -38, -34, -38, -25,
+        -38, -24, -38, -23, -38, -22, -38, 4, -38, 10, -38, 11, -38, 14, -38, 15, -38, 24, -38, 25,
+        -38, 33, -38, 34, -38, 35, -38, 36, -38, 37, -38, 38, -38, 45, -38, 46, -38, 47, -38, 48,
+        -38, 50, -38, 51, -38, 57, -38, 58, -37, -51, -37, -50, -37, -38, -37, -37, -37, -36, -37, -35,
+        -37, -24, -37, -23, -37, -22, -37, 4, -37, 5, -37, 10, -37, 11, -37, 12, -37, 13, -37, 14,
+        -37, 15, -37, 33, -37, 34, -37, 35, -37, 36, -37, 37, -37, 38, -37, 45, -37, 46, -37, 47,
+        -37, 48, -37, 49, -37, 50, -37, 51, -37, 57, -37, 58, -36, -51, -36, -50, -36, -38, -36, -37,
+        -36, -36, -36, -35, -36, -34, -36, 4, -36, 5, -36, 10, -36, 11, -36, 12, -36, 13, -36, 14,
+        -36, 15, -36, 21, -36, 22, -36, 23, -36, 24, -36, 25, -36, 47, -36, 48, -36, 49, -36, 50,
+        -36, 51, -36, 57, -36, 58, -35, -51, -35, -50, -35, -38, -35, -37, -35, -36, -35, -35, -35, -34,
+        -35, 4, -35, 20, -35, 21, -35, 22, -35, 23, -35, 24, -35, 25, -35, 26, -35, 47, -35, 48,
+        -35, 49, -35, 50, -35, 51, -35, 57, -35, 58, -35, 60, -35, 61, -34, -51, -34, -50, -34, -38,
+        -34, -37, -34, -36, -34, -35, -34, -34, -34, 20, -34, 21, -34, 22, -34, 23, -34, 24, -34, 25,
+        -34, 26, -34, 47, -34, 48, -34, 49, -34, 50, -34, 51, -34, 57, -34, 58, -34, 59, -34, 60,
+        -34, 61, -34, 62, -33, -51, -33, -50, -33, -38, -33, -37, -33, -36, -33, -35, -33, -34, -33, 20,
+        -33, 21, -33, 22, -33, 23, -33, 24, -33, 25, -33, 26, -33, 49, -33, 50, -33, 51, -33, 52,
+        -33, 53, -33, 54, -33, 55, -33, 56, -33, 57, -33, 58, -33, 59, -33, 60, -33, 61, -33, 62,
+        -32, -51, -32, -50, -32, -38, -32, -37, -32, -36, -32, -35, -32, -28, -32, -27, -32, -26, -32, -25,
+        -32, -24, -32, -23, -32, -22, -32, 22, -32, 23, -32, 24, -32, 25, -32, 26, -32, 50, -32, 51,
+        -32, 52, -32, 53, -32, 54, -32, 55, -32, 56, -32, 57, -32, 58, -32, 60, -32, 61, -31, -51,
+        -31, -50, -31, -49, -31, -48, -31, -47, -31, -46, -31, -45, -31, -44, -31, -43, -31, -42, -31, -41,
+        -31, -40, -31, -39, -31, -38, -31, -37, -31, -28, -31, -27, -31, -26, -31, -25, -31, -24, -31, -23,
+        -31, -22, -31, 22, -31, 23, -31, 24, -31, 25, -31, 26, -31, 27, -31, 29, -31, 30, -31, 31,
+        -31, 32, -31, 45, -31, 46, -31, 48, -31, 49, -31, 50, -30, -50, -30, -49, -30, -48, -30, -47,
+        -30, -46, -30, -45, -30, -44, -30, -43, -30, -42, -30, -41, -30, -40, -30, -39, -30, -38, -30, -37,
+        -30, -28, -30, -27, -30, -26, -30, -25, -30, -24, -30, -23, -30, -22, -30, 22, -30, 23, -30, 24,
+        -30, 25, -30, 26, -30, 27, -30, 28, -30, 29, -30, 30, -30, 31, -30, 32, -30, 33, -30, 45,
+        -30, 46, -30, 47, -30, 48, -30, 49, -30, 50, -30, 51, -30, 52, -30, 53, -30, 54, -30, 55,
+        -30, 56, -29, -51, -29, -50, -29, -43, -29, -42, -29, -41, -29, -40, -29, -39, -29, -28, -29, -27,
+        -29, -26, -29, -25, -29, -24, -29, -23, -29, -22, -29, 28, -29, 29, -29, 30, -29, 31, -29, 32,
+        -29, 33, -29, 44, -29, 45, -29, 46, -29, 47, -29, 48, -29, 49, -29, 50, -29, 51, -29, 52,
+        -29, 53, -29, 54, -29, 55, -29, 56, -28, -51, -28, -50, -28, -49, -28, -28, -28, -27, -28, -26,
+        -28, -25, -28, -24, -28, -23, -28, -22, -28, -2, -28, 4, -28, 5, -28, 9, -28, 10, -28, 11,
+        -28, 12, -28, 13, -28, 14, -28, 15, -28, 16, -28, 17, -28, 18, -28, 19, -28, 20, -28, 21,
+        -28, 22, -28, 23, -28, 24, -28, 25, -28, 26, -28, 27, -28, 28, -28, 29, -28, 30, -28, 31,
+        -28, 32, -28, 33, -28, 34, -28, 35, -28, 44, -28, 45, -28, 46, -28, 47, -28, 48, -28, 49,
+        -28, 50, -28, 51, -28, 52, -28, 55, -28, 56, -27, -51, -27, -50, -27, -49, -27, -28, -27, -27,
+        -27, -26, -27, -25, -27, -24, -27, -23, -27, -22, -27, -3, -27, -2, -27, -1, -27, 0, -27, 1,
+        -27, 4, -27, 5, -27, 9, -27, 10, -27, 11, -27, 12, -27, 13, -27, 14, -27, 15, -27, 16,
+        -27, 17, -27, 18, -27, 19, -27, 20, -27, 21, -27, 22, -27, 23, -27, 24, -27, 25, -27, 26,
+        -27, 27, -27, 28, -27, 29, -27, 30, -27, 31, -27, 32, -27, 33, -27, 34, -27, 35, -27, 44,
+        -27, 45, -27, 46, -27, 47, -27, 48, -27, 49, -27, 50, -27, 51, -27, 52, -27, 55, -27, 56,
+        -27, 64, -26, -51, -26, -50, -26, -49, -26, -3, -26, -2, -26, -1, -26, 0, -26, 1, -26, 4,
+        -26, 5, -26, 6, -26, 9, -26, 10, -26, 34, -26, 35, -26, 36, -26, 44, -26, 45, -26, 46,
+        -26, 47, -26, 49, -26, 50, -26, 51, -26, 52, -26, 53, -26, 54, -26, 55, -26, 56, -26, 64,
+        -25, -16, -25, 0, -25, 1, -25, 4, -25, 5, -25, 9, -25, 10, -25, 34, -25, 35, -25, 36,
+        -25, 49, -25, 50, -25, 51, -25, 52, -25, 53, -25, 54, -25, 55, -25, 56, -25, 57, -25, 64,
+        -24, -17, -24, -16, -24, -15, -24, -1, -24, 0, -24, 1, -24, 9, -24, 10, -24, 34, -24, 35,
+        -24, 36, -24, 49, -24, 50, -24, 51, -24, 52, -24, 53, -24, 54, -24, 55, -24, 56, -24, 63,
+        -24, 64, -23, -17, -23, -16, -23, -15, -23, -4, -23, -3, -23, 0, -23, 1, -23, 9, -23, 10,
+        -23, 34, -23, 35, -23, 36, -23, 64, -22, -56, -22, -54, -22, -53, -22, -52, -22, -51, -22, -50,
+        -22, -49, -22, -45, -22, -44, -22, -43, -22, -17, -22, -16, -22, -15, -22, -5, -22, -4, -22, -3,
+        -22, -2, -22, -1, -22, 0, -22, 1, -22, 9, -22, 10, -22, 34, -22, 35, -22, 36, -22, 43,
+        -22, 44, -22, 45, -22, 63, -22, 64, -21, -56, -21, -55, -21, -54, -21, -53, -21, -52, -21, -51,
+        -21, -50, -21, -49, -21, -45, -21, -44, -21, -43, -21, -39, -21, -38, -21, -37, -21, -36, -21, -5,
+        -21, -4, -21, -3, -21, -2, -21, -1, -21, 0, -21, 1, -21, 9, -21, 10, -21, 34, -21, 35,
+        -21, 43, -21, 44, -21, 45, -21, 46, -21, 63, -21, 64, -20, -56, -20, -55, -20, -54, -20, -53,
+        -20, -50, -20, -49, -20, -45, -20, -44, -20, -43, -20, -39, -20, -38, -20, -37, -20, -36, -20, -35,
+        -20, -34, -20, -28, -20, -27, -20, -4, -20, -3, -20, -2, -20, -1, -20, 0, -20, 1, -20, 9,
+        -20, 10, -20, 34, -20, 35, -20, 43, -20, 44, -20, 45, -20, 64, -19, -56, -19, -55, -19, -54,
+        -19, -53, -19, -50, -19, -49, -19, -44, -19, -39, -19, -38, -19, -37, -19, -36, -19, -35, -19, -34,
+        -19, -28, -19, -27, -19, -26, -19, -1, -19, 0, -19, 1, -19, 9, -19, 10, -19, 34, -19, 35,
+        -19, 63, -19, 64, -18, -56, -18, -55, -18, -54, -18, -53, -18, -52, -18, -51, -18, -50, -18, -49,
+        -18, -39, -18, -38, -18, -37, -18, -36, -18, -35, -18, -31, -18, -30, -18, -29, -18, -28, -18, -27,
+        -18, -26, -18, -25, -18, -24, -18, -13, -18, -12, -18, -11, -18, -10, -18, -9, -18, -8, -18, -1,
+        -18, 0, -18, 1, -18, 9, -18, 10, -18, 34, -18, 35, -18, 64, -17, -56, -17, -55, -17, -53,
+        -17, -52, -17, -51, -17, -50, -17, -49, -17, -38, -17, -37, -17, -36, -17, -35, -17, -34, -17, -31,
+        -17, -30, -17, -29, -17, -28, -17, -27, -17, -26, -17, -25, -17, -24, -17, -13, -17, -12, -17, -11,
+        -17, -10, -17, -9, -17, -8, -17, -5, -17, -4, -17, -3, -17, -1, -17, 0, -17, 1, -17, 9,
+        -17, 10, -17, 34, -17, 35, -17, 64, -16, -56, -16, -55, -16, -54, -16, -53, -16, -52, -16, -51,
+        -16, -50, -16, -49, -16, -41, -16, -40, -16, -39, -16, -38, -16, -37, -16, -36, -16, -35, -16, -34,
+        -16, -32, -16, -31, -16, -30, -16, -29, -16, -28, -16, -25, -16, -24, -16, -13, -16, -12, -16, -9,
+        -16, -8, -16, -5, -16, -4, -16, -3, -16, -1, -16, 0, -16, 1, -16, 9, -16, 10, -16, 20,
+        -16, 21, -16, 22, -16, 23, -16, 24, -16, 34, -16, 35, -16, 37, -16, 38, -16, 39, -16, 43,
+        -16, 44, -16, 45, -16, 46, -16, 47, -16, 48, -16, 49, -16, 50, -16, 51, -16, 52, -16, 53,
+        -16, 54, -16, 55, -16, 56, -16, 57, -16, 58, -16, 59, -16, 60, -16, 63, -16, 64, -15, -56,
+        -15, -55, -15, -54, -15, -53, -15, -52, -15, -51, -15, -50, -15, -49, -15, -41, -15, -40, -15, -39,
+        -15, -38, -15, -37, -15, -36, -15, -35, -15, -34, -15, -33, -15, -32, -15, -31, -15, -30, -15, -29,
+        -15, -28, -15, -27, -15, -26, -15, -25, -15, -24, -15, -23, -15, -22, -15, -21, -15, -20, -15, -17,
+        -15, -16, -15, -15, -15, -14, -15, -13, -15, -12, -15, -11, -15, -10, -15, -9, -15, -8, -15, -7,
+        -15, -5, -15, -4, -15, -3, -15, -1, -15, 0, -15, 1, -15, 9, -15, 10, -15, 11, -15, 12,
+        -15, 13, -15, 14, -15, 15, -15, 16, -15, 17, -15, 18, -15, 19, -15, 20, -15, 21, -15, 22,
+        -15, 23, -15, 24, -15, 25, -15, 26, -15, 27, -15, 28, -15, 29, -15, 30, -15, 31, -15, 32,
+        -15, 33, -15, 34, -15, 35, -15, 36, -15, 37, -15, 38, -15, 39, -15, 43, -15, 44, -15, 45,
+        -15, 46, -15, 47, -15, 48, -15, 49, -15, 50, -15, 51, -15, 52, -15, 53, -15, 54, -15, 55,
+        -15, 56, -15, 57, -15, 58, -15, 59, -15, 60, -15, 64, -14, -56, -14, -55, -14, -54, -14, -53,
+        -14, -50, -14, -49, -14, -41, -14, -40, -14, -39, -14, -38, -14, -37, -14, -36, -14, -35, -14, -33,
+        -14, -32, -14, -31, -14, -30, -14, -29, -14, -28, -14, -27, -14, -26, -14, -25, -14, -24, -14, -23,
+        -14, -22, -14, -21, -14, -20, -14, -17, -14, -16, -14, -15, -14, -14, -14, -13, -14, -12, -14, -11,
+        -14, -10, -14, -9, -14, -8, -14, -7, -14, -6, -14, -5, -14, -4, -14, -1, -14, 0, -14, 1,
+        -14, 4, -14, 9, -14, 10, -14, 11, -14, 12, -14, 13, -14, 14, -14, 15, -14, 16, -14, 17,
+        -14, 18, -14, 19, -14, 20, -14, 21, -14, 22, -14, 23, -14, 24, -14, 25, -14, 26, -14, 27,
+        -14, 28, -14, 29, -14, 30, -14, 31, -14, 32, -14, 33, -14, 34, -14, 36, -14, 37, -14, 38,
+        -14, 39, -14, 43, -14, 44, -14, 47, -14, 48, -14, 49, -14, 50, -14, 53, -14, 54, -14, 55,
+        -14, 56, -14, 59, -14, 60, -14, 63, -14, 64, -13, -56, -13, -55, -13, -54, -13, -53, -13, -50,
+        -13, -49, -13, -41, -13, -40, -13, -39, -13, -38, -13, -37, -13, -36, -13, -35, -13, -33, -13, -32,
+        -13, -21, -13, -20, -13, -19, -13, -18, -13, -17, -13, -16, -13, -6, -13, -5, -13, -4, -13, -1,
+        -13, 0, -13, 1, -13, 4, -13, 19, -13, 20, -13, 23, -13, 24, -13, 43, -13, 44, -13, 47,
+        -13, 48, -13, 49, -13, 50, -13, 53, -13, 54, -13, 55, -13, 56, -13, 59, -13, 60, -13, 63,
+        -13, 64, -12, -56, -12, -55, -12, -54, -12, -53, -12, -52, -12, -51, -12, -50, -12, -49, -12, -41,
+        -12, -40, -12, -39, -12, -36, -12, -35, -12, -33, -12, -32, -12, -21, -12, -20, -12, -19, -12, -18,
+        -12, -17, -12, -16, -12, -5, -12, -4, -12, -1, -12, 0, -12, 1, -12, 4, -12, 19, -12, 20,
+        -12, 21, -12, 22, -12, 23, -12, 24, -12, 43, -12, 44, -12, 45, -12, 46, -12, 47, -12, 48,
+        -12, 49, -12, 50, -12, 51, -12, 52, -12, 53, -12, 54, -12, 55, -12, 56, -12, 57, -12, 58,
+        -12, 59, -12, 60, -12, 63, -12, 64, -11, -56, -11, -55, -11, -53, -11, -52, -11, -51, -11, -50,
+        -11, -49, -11, -41, -11, -40, -11, -39, -11, -36, -11, -35, -11, -33, -11, -32, -11, -21, -11, -20,
+        -11, -19, -11, -18, -11, -17, -11, -16, -11, -5, -11, -4, -11, -1, -11, 0, -11, 1, -11, 19,
+        -11, 20, -11, 21, -11, 22, -11, 23, -11, 24, -11, 43, -11, 44, -11, 45, -11, 46, -11, 47,
+        -11, 49, -11, 50, -11, 51, -11, 52, -11, 53, -11, 55, -11, 56, -11, 57, -11, 58, -11, 59,
+        -11, 60, -11, 63, -11, 64, -10, -56, -10, -55, -10, -54, -10, -53, -10, -52, -10, -51, -10, -50,
+        -10, -49, -10, -41, -10, -40, -10, -39, -10, -38, -10, -37, -10, -36, -10, -35, -10, -33, -10, -32,
+        -10, -21, -10, -20, -10, -17, -10, -16, -10, -5, -10, -4, -10, -1, -10, 0, -10, 1, -10, 26,
+        -10, 27, -10, 64, -9, -56, -9, -55, -9, -54, -9, -53, -9, -52, -9, -51, -9, -50, -9, -49,
+        -9, -41, -9, -40, -9, -39, -9, -38, -9, -37, -9, -36, -9, -35, -9, -33, -9, -32, -9, -21,
+        -9, -20, -9, -17, -9, -16, -9, -5, -9, -4, -9, -1, -9, 0, -9, 1, -9, 25, -9, 26,
+        -9, 27, -9, 28, -9, 64, -8, -56, -8, -55, -8, -54, -8, -53, -8, -50, -8, -49, -8, -40,
+        -8, -33, -8, -32, -8, -31, -8, -30, -8, -29, -8, -28, -8, -27, -8, -26, -8, -25, -8, -24,
+        -8, -23, -8, -22, -8, -21, -8, -20, -8, -17, -8, -16, -8, -15, -8, -14, -8, -13, -8, -12,
+        -8, -11, -8, -10, -8, -9, -8, -8, -8, -7, -8, -6, -8, -5, -8, -4, -8, -1, -8, 0,
+        -8, 1, -8, 12, -8, 13, -8, 14, -8, 15, -8, 16, -8, 17, -8, 25, -8, 26, -8, 27,
+        -8, 28, -8, 63, -8, 64, -7, -56, -7, -55, -7, -54, -7, -53, -7, -50, -7, -49, -7, -33,
+        -7, -32, -7, -31, -7, -30, -7, -29, -7, -28, -7, -27, -7, -26, -7, -25, -7, -24, -7, -23,
+        -7, -22, -7, -21, -7, -20, -7, -17, -7, -16, -7, -15, -7, -14, -7, -13, -7, -12, -7, -11,
+        -7, -10, -7, -9, -7, -8, -7, -7, -7, -6, -7, -5, -7, -4, -7, -1, -7, 0, -7, 1,
+        -7, 12, -7, 13, -7, 14, -7, 15, -7, 16, -7, 17, -7, 18, -7, 26, -7, 27, -7, 43,
+        -7, 44, -7, 45, -7, 46, -7, 47, -7, 48, -7, 49, -7, 50, -7, 51, -7, 52, -7, 53,
+        -7, 54, -7, 57, -7, 58, -7, 59, -7, 60, -7, 61, -7, 62, -7, 64, -6, -56, -6, -55,
+        -6, -54, -6, -53, -6, -52, -6, -51, -6, -50, -6, -49, -6, -32, -6, -31, -6, -16, -6, -15,
+        -6, -14, -6, -1, -6, 0, -6, 1, -6, 12, -6, 13, -6, 14, -6, 15, -6, 16, -6, 17,
+        -6, 18, -6, 30, -6, 31, -6, 43, -6, 44, -6, 45, -6, 46, -6, 47, -6, 48, -6, 49,
+        -6, 50, -6, 51, -6, 52, -6, 53, -6, 54, -6, 55, -6, 57, -6, 58, -6, 59, -6, 60,
+        -6, 61, -6, 62, -6, 64, -5, -56, -5, -55, -5, -54, -5, -53, -5, -52, -5, -51, -5, -50,
+        -5, -49, -5, -33, -5, -32, -5, -31, -5, -30, -5, -16, -5, -15, -5, -14, -5, -1, -5, 0,
+        -5, 1, -5, 2, -5, 3, -5, 4, -5, 12, -5, 13, -5, 14, -5, 15, -5, 16, -5, 17,
+        -5, 18, -5, 29, -5, 30, -5, 31, -5, 32, -5, 43, -5, 44, -5, 47, -5, 48, -5, 49,
+        -5, 50, -5, 54, -5, 55, -5, 57, -5, 58, -5, 61, -5, 62, -5, 63, -5, 64, -4, -56,
+        -4, -55, -4, -33, -4, -32, -4, -31, -4, -30, -4, -16, -4, -15, -4, -14, -4, -1, -4, 0,
+        -4, 1, -4, 2, -4, 3, -4, 4, -4, 12, -4, 13, -4, 14, -4, 15, -4, 16, -4, 17,
+        -4, 18, -4, 29, -4, 30, -4, 31, -4, 32, -4, 43, -4, 44, -4, 45, -4, 46, -4, 47,
+        -4, 48, -4, 49, -4, 50, -4, 51, -4, 52, -4, 53, -4, 54, -4, 55, -4, 57, -4, 58,
+        -4, 61, -4, 62, -4, 64, -3, -56, -3, -55, -3, -32, -3, -31, -3, -1, -3, 0, -3, 1,
+        -3, 2, -3, 3, -3, 4, -2, -56, -2, -55, -2, -54, -2, -53, -2, -52, -2, -51, -2, -49,
+        -2, -46, -2, -44, -2, -43, -2, -41, -2, -38, -2, -36, -2, -35, -2, -33, -2, -25, -2, -23,
+        -2, -22, -2, -20, -2, -18, -2, -17, -2, -15, -2, -13, -2, -12, -2, -9, -2, -8, -2, -6,
+        -2, -4, -2, -3, -2, -1, -2, 0, -2, 1, -2, 3, -1, -56, -1, -55, -1, -54, -1, -53,
+        -1, -52, -1, -51, -1, -50, -1, -49, -1, -48, -1, -47, -1, -46, -1, -45, -1, -44, -1, -43,
+        -1, -42, -1, -41, -1, -40, -1, -39, -1, -38, -1, -37, -1, -36, -1, -35, -1, -34, -1, -33,
+        -1, -32, -1, -31, -1, -30, -1, -29, -1, -28, -1, -27, -1, -26, -1, -25, -1, -24, -1, -23,
+        -1, -22, -1, -21, -1, -20, -1, -19, -1, -18, -1, -17, -1, -16, -1, -15, -1, -14, -1, -13,
+        -1, -12, -1, -11, -1, -10, -1, -9, -1, -8, -1, -7, -1, -6, -1, -5, -1, -4, -1, -3,
+        -1, -2, -1, -1, -1, 0, -1, 1, -1, 64, 0, -56, 0, -55, 0, -54, 0, -53, 0, -52,
+        0, -51, 0, -50, 0, -49, 0, -48, 0, -47, 0, -46, 0, -45, 0, -44, 0, -43, 0, -42,
+        0, -41, 0, -40, 0, -39, 0, -38, 0, -37, 0, -36, 0, -35, 0, -34, 0, -33, 0, -32,
+        0, -31, 0, -30, 0, -29, 0, -28, 0, -27, 0, -26, 0, -25, 0, -24, 0, -23, 0, -22,
+        0, -21, 0, -20, 0, -19, 0, -18, 0, -17, 0, -16, 0, -15, 0, -14, 0, -13, 0, -12,
+        0, -11, 0, -10, 0, -9, 0, -8, 0, -7, 0, -6, 0, -5, 0, -4, 0, -3, 0, -2,
+        0, -1, 0, 0, 0, 1, 1, -56, 1, -55, 1, -54, 1, -53, 1, -52, 1, -51, 1, -50,
+        1, -49, 1, -48, 1, -47, 1, -46, 1, -45, 1, -44, 1, -43, 1, -42, 1, -41, 1, -40,
+        1, -39, 1, -38, 1, -37, 1, -36, 1, -35, 1, -34, 1, -33, 1, -32, 1, -31, 1, -30,
+        1, -29, 1, -28, 1, -27, 1, -26, 1, -25, 1, -24, 1, -23, 1, -22, 1, -21, 1, -20,
+        1, -19, 1, -18, 1, -17, 1, -16, 1, -15, 1, -14, 1, -13, 1, -12, 1, -11, 1, -10,
+        1, -9, 1, -8, 1, -7, 1, -6, 1, -5, 1, -4, 1, -3, 1, -2, 1, -1, 1, 0,
+        1, 1, 1, 2, 2, -56, 2, -54, 2, -53, 2, -51, 2, -49, 2, -48, 2, -45, 2, -44,
+        2, -42, 2, -40, 2, -39, 2, -37, 2, -35, 2, -34, 2, -32, 2, -24, 2, -22, 2, -21,
+        2, -19, 2, -16, 2, -15, 2, -14, 2, -13, 2, -11, 2, -8, 2, -6, 2, -5, 2, -4,
+        2, -3, 2, -2, 2, -1, 2, 0, 2, 1, 2, 2, 2, 3, 2, 4, 2, 64, 3, -56,
+        3, -26, 3, -25, 3, -15, 3, -14, 3, -2, 3, -1, 3, 0, 3, 1, 3, 3, 3, 4,
+        4, -56, 4, -43, 4, -42, 4, -41, 4, -27, 4, -26, 4, -25, 4, -24, 4, -2, 4, -1,
+        4, 0, 4, 1, 4, 2, 4, 3, 4, 4, 4, 7, 4, 8, 4, 10, 4, 11, 4, 12,
+        4, 13, 4, 14, 4, 15, 4, 16, 4, 17, 4, 18, 4, 19, 4, 20, 4, 21, 4, 22,
+        4, 33, 4, 34, 4, 35, 4, 36, 4, 47, 4, 48, 4, 49, 4, 50, 4, 51, 4, 52,
+        4, 53, 5, -56, 5, -43, 5, -42, 5, -41, 5, -27, 5, -26, 5, -25, 5, -24, 5, -8,
+        5, -7, 5, -6, 5, -5, 5, -4, 5, -3, 5, -2, 5, -1, 5, 0, 5, 1, 5, 2,
+        5, 3, 5, 4, 5, 7, 5, 8, 5, 10, 5, 11, 5, 15, 5, 16, 5, 17, 5, 18,
+        5, 21, 5, 22, 5, 33, 5, 34, 5, 35, 5, 36, 5, 47, 5, 48, 5, 49, 5, 50,
+        5, 51, 5, 52, 5, 53, 5, 64, 6, -56, 6, -43, 6, -42, 6, -41, 6, -26, 6, -25,
+        6, -8, 6, -7, 6, -6, 6, -5, 6, -4, 6, -3, 6, -2, 6, -1, 6, 0, 6, 1,
+        6, 2, 6, 3, 6, 4, 6, 5, 6, 6, 6, 7, 6, 8, 6, 10, 6, 11, 6, 12,
+        6, 13, 6, 14, 6, 15, 6, 16, 6, 17, 6, 18, 6, 19, 6, 20, 6, 21, 6, 22,
+        6, 34, 6, 35, 6, 47, 6, 48, 6, 49, 6, 50, 6, 51, 6, 52, 6, 53, 7, -56,
+        7, -53, 7, -52, 7, -51, 7, -50, 7, -49, 7, -48, 7, -47, 7, -46, 7, -45, 7, -44,
+        7, -43, 7, -42, 7, -41, 7, -40, 7, -37, 7, -36, 7, -35, 7, -34, 7, -33, 7, -32,
+        7, -31, 7, -30, 7, -29, 7, -28, 7, -27, 7, -26, 7, -25, 7, -24, 7, -8, 7, -7,
+        7, -4, 7, -3, 7, -2, 7, -1, 7, 0, 7, 1, 7, 2, 7, 3, 7, 4, 7, 5,
+        7, 6, 7, 7, 7, 8, 7, 11, 7, 12, 7, 13, 7, 14, 7, 15, 7, 16, 7, 17,
+        7, 18, 7, 19, 7, 20, 7, 21, 7, 22, 7, 38, 7, 39, 7, 47, 7, 48, 7, 49,
+        7, 50, 7, 51, 7, 52, 7, 53, 8, -56, 8, -53, 8, -52, 8, -51, 8, -50, 8, -49,
+        8, -48, 8, -47, 8, -46, 8, -45, 8, -44, 8, -43, 8, -42, 8, -41, 8, -40, 8, -37,
+        8, -36, 8, -35, 8, -34, 8, -33, 8, -32, 8, -31, 8, -30, 8, -29, 8, -28, 8, -27,
+        8, -26, 8, -25, 8, -24, 8, -17, 8, -8, 8, -7, 8, -4, 8, -3, 8, -2, 8, -1,
+        8, 0, 8, 1, 8, 2, 8, 3, 8, 4, 8, 37, 8, 38, 8, 39, 8, 40, 8, 48,
+        8, 49, 8, 50, 8, 51, 8, 52, 8, 53, 8, 64, 9, -56, 9, -53, 9, -52, 9, -41,
+        9, -40, 9, -37, 9, -36, 9, -25, 9, -24, 9, -22, 9, -21, 9, -20, 9, -19, 9, -18,
+        9, -17, 9, -16, 9, -8, 9, -7, 9, -6, 9, -5, 9, -4, 9, -3, 9, -2, 9, -1,
+        9, 0, 9, 1, 9, 2, 9, 3, 9, 4, 9, 37, 9, 38, 9, 39, 9, 40, 9, 64,
+        10, -56, 10, -53, 10, -52, 10, -41, 10, -40, 10, -37, 10, -36, 10, -25, 10, -24, 10, -22,
+        10, -21, 10, -20, 10, -19, 10, -18, 10, -17, 10, -16, 10, -8, 10, -7, 10, -6, 10, -5,
+        10, -4, 10, -3, 10, -2, 10, -1, 10, 0, 10, 1, 10, 2, 10, 3, 10, 4, 10, 38,
+        10, 39, 10, 64, 11, -56, 11, -53, 11, -52, 11, -41, 11, -40, 11, -39, 11, -38, 11, -37,
+        11, -36, 11, -25, 11, -24, 11, -22, 11, -21, 11, -18, 11, -17, 11, -16, 11, -8, 11, -7,
+        11, -6, 11, -5, 11, -4, 11, -2, 11, -1, 11, 0, 11, 1, 11, 2, 11, 3, 11, 4,
+        11, 5, 11, 6, 11, 7, 11, 8, 11, 9, 11, 10, 11, 12, 11, 13, 11, 14, 11, 15,
+        11, 16, 11, 18, 11, 19, 11, 20, 11, 21, 11, 22, 11, 41, 11, 42, 11, 43, 11, 44,
+        11, 45, 11, 46, 11, 64, 12, -56, 12, -53, 12, -52, 12, -41, 12, -40, 12, -39, 12, -38,
+        12, -37, 12, -36, 12, -25, 12, -24, 12, -22, 12, -21, 12, -18, 12, -17, 12, -16, 12, -8,
+        12, -7, 12, -6, 12, -5, 12, -4, 12, -3, 12, -2, 12, -1, 12, 0, 12, 1, 12, 2,
+        12, 3, 12, 4, 12, 5, 12, 6, 12, 7, 12, 8, 12, 9, 12, 10, 12, 11, 12, 12,
+        12, 13, 12, 14, 12, 15, 12, 16, 12, 17, 12, 18, 12, 19, 12, 20, 12, 21, 12, 22,
+        12, 41, 12, 42, 12, 43, 12, 44, 12, 45, 12, 46, 12, 61, 12, 64, 13, -56, 13, -53,
+        13, -52, 13, -51, 13, -41, 13, -40, 13, -39, 13, -38, 13, -37, 13, -36, 13, -25, 13, -24,
+        13, -22, 13, -21, 13, -20, 13, -19, 13, -18, 13, -17, 13, -16, 13, -8, 13, -7, 13, -4,
+        13, -3, 13, -2, 13, -1, 13, 0, 13, 1, 13, 2, 13, 3, 13, 4, 13, 5, 13, 6,
+        13, 9, 13, 10, 13, 11, 13, 12, 13, 15, 13, 16, 13, 17, 13, 18, 13, 21, 13, 22,
+        13, 41, 13, 42, 13, 45, 13, 46, 13, 61, 14, -56, 14, -53, 14, -52, 14, -51, 14, -50,
+        14, -49, 14, -48, 14, -47, 14, -46, 14, -45, 14, -44, 14, -43, 14, -42, 14, -41, 14, -40,
+        14, -37, 14, -36, 14, -35, 14, -34, 14, -33, 14, -32, 14, -31, 14, -30, 14, -29, 14, -28,
+        14, -27, 14, -26, 14, -25, 14, -24, 14, -22, 14, -21, 14, -20, 14, -19, 14, -18, 14, -17,
+        14, -16, 14, -8, 14, -7, 14, -4, 14, -3, 14, -2, 14, -1, 14, 0, 14, 1, 14, 2,
+        14, 3, 14, 4, 14, 5, 14, 6, 14, 9, 14, 10, 14, 11, 14, 12, 14, 15, 14, 16,
+        14, 17, 14, 18, 14, 21, 14, 22, 14, 26, 14, 27, 14, 28, 14, 29, 14, 31, 14, 32,
+        14, 33, 14, 34, 14, 35, 14, 36, 14, 37, 14, 38, 14, 39, 14, 40, 14, 41, 14, 42,
+        14, 43, 14, 44, 14, 45, 14, 46, 14, 47, 14, 48, 14, 49, 14, 50, 14, 51, 14, 52,
+        14, 53, 14, 54, 14, 55, 14, 56, 14, 61, 14, 64, 15, -56, 15, -54, 15, -53, 15, -52,
+        15, -50, 15, -49, 15, -48, 15, -47, 15, -46, 15, -45, 15, -44, 15, -43, 15, -42, 15, -41,
+        15, -40, 15, -37, 15, -36, 15, -35, 15, -34, 15, -33, 15, -32, 15, -31, 15, -30, 15, -29,
+        15, -28, 15, -27, 15, -26, 15, -25, 15, -24, 15, -23, 15, -22, 15, -21, 15, -20, 15, -19,
+        15, -18, 15, -17, 15, -16, 15, -8, 15, -7, 15, -6, 15, -5, 15, -4, 15, -3, 15, -2,
+        15, -1, 15, 0, 15, 1, 15, 2, 15, 3, 15, 4, 15, 5, 15, 6, 15, 7, 15, 8,
+        15, 9, 15, 10, 15, 11, 15, 12, 15, 13, 15, 14, 15, 15, 15, 16, 15, 17, 15, 18,
+        15, 19, 15, 20, 15, 21, 15, 22, 15, 26, 15, 27, 15, 28, 15, 29, 15, 30, 15, 31,
+        15, 32, 15, 33, 15, 34, 15, 35, 15, 36, 15, 37, 15, 38, 15, 39, 15, 40, 15, 41,
+        15, 42, 15, 43, 15, 44, 15, 45, 15, 46, 15, 47, 15, 48, 15, 49, 15, 50, 15, 51,
+        15, 52, 15, 53, 15, 54, 15, 55, 15, 56, 15, 64, 16, -56, 16, -54, 16, -53, 16, -52,
+        16, -49, 16, -48, 16, -45, 16, -44, 16, -33, 16, -32, 16, -29, 16, -28, 16, -27, 16, -26,
+        16, -25, 16, -23, 16, -22, 16, -21, 16, -20, 16, -19, 16, -18, 16, -17, 16, -16, 16, -8,
+        16, -7, 16, -6, 16, -5, 16, -4, 16, -3, 16, -2, 16, -1, 16, 0, 16, 1, 16, 2,
+        16, 3, 16, 4, 16, 5, 16, 6, 16, 7, 16, 8, 16, 9, 16, 10, 16, 11, 16, 12,
+        16, 13, 16, 14, 16, 15, 16, 16, 16, 17, 16, 18, 16, 19, 16, 20, 16, 21, 16, 22,
+        16, 26, 16, 27, 16, 28, 16, 30, 16, 31, 16, 41, 16, 42, 16, 43, 16, 44, 16, 45,
+        16, 55, 16, 56, 16, 64, 17, -56, 17, -54, 17, -53, 17, -52, 17, -49, 17, -48, 17, -47,
+        17, -46, 17, -45, 17, -44, 17, -33, 17, -32, 17, -31, 17, -30, 17, -29, 17, -28, 17, -27,
+        17, -26, 17, -23, 17, -22, 17, -21, 17, -20, 17, -19, 17, -8, 17, -7, 17, -6, 17, -5,
+        17, -4, 17, -2, 17, -1, 17, 0, 17, 1, 17, 2, 17, 3, 17, 4, 17, 22, 17, 23,
+        17, 24, 17, 30, 17, 31, 17, 55, 17, 56, 17, 64, 18, -56, 18, -49, 18, -48, 18, -47,
+        18, -46, 18, -45, 18, -44, 18, -33, 18, -32, 18, -31, 18, -30, 18, -29, 18, -28, 18, -27,
+        18, -26, 18, -22, 18, -21, 18, -20, 18, -19, 18, -18, 18, -8, 18, -7, 18, -6, 18, -5,
+        18, -4, 18, -3, 18, -2, 18, -1, 18, 0, 18, 1, 18, 2, 18, 3, 18, 4, 18, 21,
+        18, 22, 18, 23, 18, 24, 18, 30, 18, 31, 18, 55, 18, 56, 19, -56, 19, -31, 19, -30,
+        19, -29, 19, -23, 19, -22, 19, -21, 19, -20, 19, -19, 19, -18, 19, -13, 19, -8, 19, -7,
+        19, -4, 19, -3, 19, -2, 19, -1, 19, 0, 19, 1, 19, 2, 19, 3, 19, 4, 19, 22,
+        19, 23, 19, 24, 19, 30, 19, 31, 19, 55, 19, 56, 19, 64, 20, -56, 20, -54, 20, -53,
+        20, -30, 20, -29, 20, -23, 20, -22, 20, -21, 20, -20, 20, -19, 20, -18, 20, -14, 20, -13,
+        20, -12, 20, -8, 20, -7, 20, -4, 20, -3, 20, -2, 20, -1, 20, 0, 20, 1, 20, 2,
+        20, 3, 20, 4, 20, 20, 20, 21, 20, 22, 20, 30, 20, 31, 20, 55, 20, 56, 20, 64,
+        21, -56, 21, -55, 21, -54, 21, -53, 21, -52, 21, -21, 21, -20, 21, -19, 21, -18, 21, -14,
+        21, -13, 21, -12, 21, -8, 21, -7, 21, -6, 21, -5, 21, -4, 21, -3, 21, -2, 21, -1,
+        21, 0, 21, 1, 21, 2, 21, 3, 21, 4, 21, 19, 21, 20, 21, 21, 21, 22, 21, 30,
+        21, 31, 21, 55, 21, 56, 22, -56, 22, -55, 22, -54, 22, -53, 22, -52, 22, -42, 22, -41,
+        22, -40, 22, -14, 22, -13, 22, -12, 22, -8, 22, -7, 22, -6, 22, -5, 22, -4, 22, -3,
+        22, -1, 22, 0, 22, 1, 22, 2, 22, 3, 22, 4, 22, 20, 22, 21, 22, 22, 22, 29,
+        22, 30, 22, 31, 22, 55, 22, 56, 22, 64, 23, -54, 23, -53, 23, -42, 23, -41, 23, -40,
+        23, -1, 23, 0, 23, 1, 23, 2, 23, 3, 23, 4, 23, 29, 23, 30, 23, 31, 23, 55,
+        23, 56, 24, -42, 24, -41, 24, -40, 24, -1, 24, 0, 24, 1, 24, 2, 24, 3, 24, 4,
+        24, 9, 24, 10, 24, 11, 24, 12, 24, 13, 24, 14, 24, 15, 24, 16, 24, 29, 24, 30,
+        24, 31, 24, 55, 24, 56, 24, 64, 25, -41, 25, -1, 25, 0, 25, 1, 25, 2, 25, 3,
+        25, 4, 25, 8, 25, 9, 25, 10, 25, 11, 25, 12, 25, 13, 25, 14, 25, 15, 25, 16,
+        25, 20, 25, 21, 25, 29, 25, 30, 25, 31, 25, 55, 25, 56, 25, 60, 25, 61, 25, 64,
+        26, -56, 26, -55, 26, -54, 26, -8, 26, -7, 26, -6, 26, -1, 26, 0, 26, 1, 26, 2,
+        26, 3, 26, 4, 26, 9, 26, 10, 26, 11, 26, 12, 26, 13, 26, 14, 26, 15, 26, 16,
+        26, 18, 26, 19, 26, 20, 26, 21, 26, 29, 26, 30, 26, 31, 26, 55, 26, 56, 26, 59,
+        26, 60, 26, 61, 27, -56, 27, -55, 27, -54, 27, -35, 27, -34, 27, -33, 27, -32, 27, -31,
+        27, -30, 27, -29, 27, -8, 27, -7, 27, -6, 27, -1, 27, 0, 27, 1, 27, 2, 27, 3,
+        27, 4, 27, 9, 27, 10, 27, 13, 27, 14, 27, 15, 27, 16, 27, 17, 27, 18, 27, 19,
+        27, 20, 27, 21, 27, 30, 27, 31, 27, 32, 27, 33, 27, 34, 27, 35, 27, 36, 27, 37,
+        27, 38, 27, 39, 27, 40, 27, 41, 27, 42, 27, 43, 27, 44, 27, 45, 27, 46, 27, 47,
+        27, 48, 27, 49, 27, 50, 27, 51, 27, 52, 27, 53, 27, 54, 27, 55, 27, 56, 27, 60,
+        27, 61, 28, -55, 28, -35, 28, -34, 28, -33, 28, -32, 28, -31, 28, -30, 28, -29, 28, -8,
+        28, -7, 28, -6, 28, -1, 28, 0, 28, 1, 28, 2, 28, 3, 28, 4, 28, 9, 28, 10,
+        28, 13, 28, 14, 28, 15, 28, 16, 28, 17, 28, 18, 28, 19, 28, 20, 28, 21, 28, 30,
+        28, 31, 28, 32, 28, 33, 28, 34, 28, 35, 28, 36, 28, 37, 28, 38, 28, 39, 28, 40,
+        28, 41, 28, 42, 28, 43, 28, 44, 28, 45, 28, 46, 28, 47, 28, 48, 28, 49, 28, 50,
+        28, 51, 28, 52, 28, 53, 28, 54, 28, 55, 28, 56, 28, 60, 28, 61, 29, -35, 29, -34,
+        29, -33, 29, -32, 29, -31, 29, -30, 29, -29, 29, -18, 29, -17, 29, -16, 29, -15, 29, -14,
+        29, -7, 29, -6, 29, -1, 29, 0, 29, 1, 29, 2, 29, 3, 29, 4, 29, 9, 29, 10,
+        29, 11, 29, 12, 29, 13, 29, 14, 29, 15, 29, 16, 29, 17, 29, 18, 29, 19, 29, 20,
+        29, 21, 29, 32, 29, 33, 29, 34, 29, 35, 29, 36, 29, 37, 30, -35, 30, -34, 30, -33,
+        30, -32, 30, -31, 30, -30, 30, -29, 30, -20, 30, -19, 30, -18, 30, -17, 30, -16, 30, -15,
+        30, -14, 30, -13, 30, -12, 30, -11, 30, -10, 30, -9, 30, -8, 30, -7, 30, -1, 30, 0,
+        30, 1, 30, 2, 30, 3, 30, 4, 30, 9, 30, 10, 30, 11, 30, 12, 30, 13, 30, 14,
+        30, 15, 30, 16, 30, 17, 30, 18, 30, 19, 30, 20, 30, 32, 30, 33, 30, 34, 30, 35,
+        30, 36, 30, 37, 30, 38, 30, 39, 30, 40, 30, 41, 30, 42, 30, 43, 31, -35, 31, -34,
+        31, -33, 31, -32, 31, -31, 31, -30, 31, -29, 31, -20, 31, -19, 31, -18, 31, -17, 31, -16,
+        31, -15, 31, -14, 31, -13, 31, -12, 31, -11, 31, -10, 31, -9, 31, -8, 31, -7, 31, -6,
+        31, -1, 31, 0, 31, 1, 31, 2, 31, 3, 31, 4, 31, 15, 31, 16, 31, 17, 31, 19,
+        31, 20, 31, 33, 31, 34, 31, 35, 31, 36, 31, 38, 31, 39, 31, 40, 31, 41, 31, 42,
+        31, 43, 32, -35, 32, -34, 32, -33, 32, -32, 32, -31, 32, -30, 32, -29, 32, -22, 32, -21,
+        32, -20, 32, -19, 32, -7, 32, -6, 32, -1, 32, 0, 32, 1, 32, 2, 32, 3, 32, 4,
+        32, 5, 32, 7, 32, 8, 32, 9, 32, 10, 32, 11, 32, 12, 32, 13, 32, 14, 32, 15,
+        32, 39, 32, 40, 32, 41, 32, 42, 32, 43, 33, -23, 33, -22, 33, -21, 33, -20, 33, -19,
+        33, -7, 33, -6, 33, -1, 33, 0, 33, 1, 33, 2, 33, 3, 33, 4, 33, 5, 33, 6,
+        33, 7, 33, 8, 33, 9, 33, 10, 33, 11, 33, 12, 33, 13, 33, 14, 33, 15, 33, 16,
+        33, 39, 33, 40, 33, 41, 33, 42, 33, 43, 33, 44, 33, 45, 34, -23, 34, -22, 34, -21,
+        34, -20, 34, -19, 34, -7, 34, -6, 34, -1, 34, 0, 34, 1, 34, 2, 34, 3, 34, 4,
+        34, 5, 34, 6, 34, 7, 34, 8, 34, 14, 34, 15, 34, 16, 34, 17, 34, 18, 34, 39,
+        34, 40, 34, 41, 34, 42, 34, 43, 34, 44, 34, 45, 35, -23, 35, -22, 35, -21, 35, -20,
+        35, -19, 35, -7, 35, -6, 35, -1, 35, 0, 35, 1, 35, 2, 35, 3, 35, 4, 35, 5,
+        35, 7, 35, 8, 35, 14, 35, 15, 35, 16, 35, 17, 35, 18, 35, 39, 35, 40, 35, 41,
+        35, 42, 35, 43, 35, 44, 35, 45, 35, 61, 36, -23, 36, -22, 36, -21, 36, -20, 36, -19,
+        36, -7, 36, -6, 36, -1, 36, 0, 36, 1, 36, 2, 36, 3, 36, 4, 36, 7, 36, 8,
+        36, 14, 36, 15, 36, 16, 36, 17, 36, 18, 36, 40, 36, 41, 36, 42, 36, 43, 36, 44,
+        36, 50, 36, 51, 36, 52, 36, 53, 36, 54, 36, 55, 36, 60, 36, 61, 37, -35, 37, -34,
+        37, -33, 37, -22, 37, -21, 37, -20, 37, -19, 37, -7, 37, -6, 37, -1, 37, 0, 37, 1,
+        37, 2, 37, 3, 37, 4, 37, 7, 37, 8, 37, 14, 37, 15, 37, 16, 37, 17, 37, 18,
+        37, 19, 37, 20, 37, 27, 37, 28, 37, 29, 37, 30, 37, 31, 37, 32, 37, 50, 37, 51,
+        37, 52, 37, 53, 37, 54, 37, 55, 37, 60, 37, 61, 38, -35, 38, -34, 38, -33, 38, -32,
+        38, -23, 38, -22, 38, -20, 38, -19, 38, -7, 38, -6, 38, -1, 38, 0, 38, 1, 38, 2,
+        38, 3, 38, 4, 38, 7, 38, 8, 38, 14, 38, 15, 38, 17, 38, 18, 38, 19, 38, 20,
+        38, 27, 38, 28, 38, 29, 38, 30, 38, 31, 38, 32, 38, 40, 38, 41, 38, 50, 38, 51,
+        38, 54, 38, 55, 38, 61, 39, -56, 39, -55, 39, -54, 39, -35, 39, -34, 39, -33, 39, -32,
+        39, -27, 39, -26, 39, -25, 39, -24, 39, -23, 39, -22, 39, -20, 39, -19, 39, -7, 39, -6,
+        39, -1, 39, 0, 39, 1, 39, 2, 39, 3, 39, 4, 39, 7, 39, 8, 39, 14, 39, 15,
+        39, 17, 39, 18, 39, 19, 39, 27, 39, 28, 39, 29, 39, 30, 39, 31, 39, 32, 39, 40,
+        39, 41, 39, 42, 39, 43, 39, 44, 39, 45, 39, 46, 39, 47, 39, 48, 39, 49, 39, 50,
+        39, 51, 39, 54, 39, 55, 40, -56, 40, -55, 40, -34, 40, -33, 40, -32, 40, -31, 40, -30,
+        40, -28, 40, -27, 40, -26, 40, -25, 40, -24, 40, -23, 40, -22, 40, -20, 40, -19, 40, -7,
+        40, -6, 40, -2, 40, -1, 40, 0, 40, 1, 40, 2, 40, 3, 40, 4, 40, 7, 40, 8,
+        40, 14, 40, 15, 40, 16, 40, 17, 40, 18, 40, 27, 40, 28, 40, 29, 40, 30, 40, 31,
+        40, 32, 40, 33, 40, 34, 40, 38, 40, 39, 40, 40, 40, 41, 40, 42, 40, 43, 40, 44,
+        40, 45, 40, 46, 40, 47, 40, 48, 40, 49, 40, 50, 40, 51, 40, 54, 40, 55, 41, -56,
+        41, -53, 41, -52, 41, -51, 41, -50, 41, -49, 41, -48, 41, -47, 41, -46, 41, -45, 41, -44,
+        41, -43, 41, -42, 41, -39, 41, -38, 41, -37, 41, -36, 41, -35, 41, -34, 41, -33, 41, -32,
+        41, -31, 41, -30, 41, -28, 41, -27, 41, -26, 41, -25, 41, -24, 41, -23, 41, -22, 41, -20,
+        41, -19, 41, -8, 41, -7, 41, -6, 41, -5, 41, -4, 41, -3, 41, -2, 41, -1, 41, 0,
+        41, 1, 41, 2, 41, 3, 41, 7, 41, 8, 41, 14, 41, 15, 41, 16, 41, 17, 41, 18,
+        41, 27, 41, 28, 41, 29, 41, 30, 41, 31, 41, 32, 41, 33, 41, 34, 41, 37, 41, 38,
+        41, 39, 41, 40, 41, 41, 41, 42, 41, 54, 41, 55, 41, 60, 41, 61, 42, -56, 42, -53,
+        42, -52, 42, -51, 42, -50, 42, -49, 42, -48, 42, -47, 42, -46, 42, -45, 42, -44, 42, -43,
+        42, -42, 42, -39, 42, -38, 42, -37, 42, -36, 42, -35, 42, -34, 42, -33, 42, -32, 42, -31,
+        42, -28, 42, -27, 42, -26, 42, -25, 42, -24, 42, -23, 42, -22, 42, -20, 42, -19, 42, -8,
+        42, -7, 42, -6, 42, -5, 42, -4, 42, -3, 42, -2, 42, -1, 42, 0, 42, 1, 42, 2,
+        42, 3, 42, 7, 42, 8, 42, 14, 42, 15, 42, 27, 42, 28, 42, 29, 42, 30, 42, 31,
+        42, 32, 42, 33, 42, 34, 42, 37, 42, 38, 42, 39, 42, 40, 42, 41, 42, 42, 42, 54,
+        42, 55, 42, 60, 42, 61, 42, 64, 43, -56, 43, -53, 43, -52, 43, -43, 43, -42, 43, -39,
+        43, -38, 43, -32, 43, -31, 43, -28, 43, -27, 43, -26, 43, -25, 43, -24, 43, -23, 43, -22,
+        43, -20, 43, -19, 43, -8, 43, -7, 43, -6, 43, -4, 43, -3, 43, -2, 43, -1, 43, 0,
+        43, 1, 43, 2, 43, 3, 43, 7, 43, 8, 43, 14, 43, 15, 43, 27, 43, 28, 43, 29,
+        43, 30, 43, 31, 43, 32, 43, 37, 43, 38, 43, 39, 43, 41, 43, 42, 43, 54, 43, 55,
+        43, 60, 43, 61, 43, 64, 44, -56, 44, -53, 44, -52, 44, -43, 44, -42, 44, -39, 44, -38,
+        44, -32, 44, -31, 44, -28, 44, -27, 44, -26, 44, -25, 44, -20, 44, -19, 44, -8, 44, -7,
+        44, -6, 44, -4, 44, -3, 44, -2, 44, -1, 44, 0, 44, 1, 44, 2, 44, 3, 44, 7,
+        44, 8, 44, 9, 44, 10, 44, 11, 44, 12, 44, 13, 44, 14, 44, 15, 44, 41, 44, 42,
+        44, 54, 44, 55, 44, 64, 45, -56, 45, -53, 45, -52, 45, -46, 45, -45, 45, -44, 45, -43,
+        45, -42, 45, -39, 45, -38, 45, -32, 45, -31, 45, -27, 45, -26, 45, -25, 45, -20, 45, -19,
+        45, -8, 45, -7, 45, -6, 45, -5, 45, -4, 45, -3, 45, -2, 45, -1, 45, 0, 45, 1,
+        45, 2, 45, 3, 45, 7, 45, 8, 45, 9, 45, 10, 45, 11, 45, 12, 45, 13, 45, 14,
+        45, 15, 45, 41, 45, 42, 45, 54, 45, 55, 45, 64, 46, -56, 46, -53, 46, -52, 46, -46,
+        46, -45, 46, -44, 46, -43, 46, -42, 46, -39, 46, -38, 46, -32, 46, -31, 46, -20, 46, -19,
+        46, -7, 46, -6, 46, -5, 46, -4, 46, -3, 46, -2, 46, -1, 46, 0, 46, 1, 46, 2,
+        46, 3, 46, 11, 46, 12, 46, 13, 46, 41, 46, 42, 46, 43, 46, 44, 46, 45, 46, 46,
+        46, 47, 46, 48, 46, 49, 46, 50, 46, 51, 46, 52, 46, 53, 46, 54, 46, 55, 47, -56,
+        47, -53, 47, -52, 47, -46, 47, -45, 47, -39, 47, -38, 47, -32, 47, -31, 47, -20, 47, -19,
+        47, -7, 47, -6, 47, -2, 47, -1, 47, 0, 47, 1, 47, 2, 47, 3, 47, 11, 47, 12,
+        47, 13, 47, 41, 47, 42, 47, 43, 47, 44, 47, 45, 47, 46, 47, 47, 47, 48, 47, 49,
+        47, 50, 47, 51, 47, 52, 47, 53, 47, 54, 47, 55, 47, 64, 48, -56, 48, -53, 48, -52,
+        48, -46, 48, -45, 48, -39, 48, -38, 48, -32, 48, -31, 48, -20, 48, -19, 48, -7, 48, -6,
+        48, -2, 48, -1, 48, 0, 48, 1, 48, 2, 48, 3, 48, 7, 48, 8, 48, 9, 48, 10,
+        48, 11, 48, 12, 48, 13, 48, 14, 48, 15, 48, 22, 48, 23, 48, 24, 48, 64, 49, -56,
+        49, -53, 49, -52, 49, -46, 49, -45, 49, -44, 49, -43, 49, -39, 49, -38, 49, -32, 49, -31,
+        49, -20, 49, -19, 49, -7, 49, -6, 49, -2, 49, -1, 49, 0, 49, 1, 49, 2, 49, 3,
+        49, 4, 49, 5, 49, 6, 49, 7, 49, 8, 49, 9, 49, 10, 49, 11, 49, 12, 49, 13,
+        49, 14, 49, 15, 49, 22, 49, 23, 49, 24, 49, 25, 50, -56, 50, -53, 50, -52, 50, -46,
+        50, -45, 50, -44, 50, -43, 50, -39, 50, -38, 50, -32, 50, -31, 50, -30, 50, -29, 50, -28,
+        50, -20, 50, -19, 50, -7, 50, -6, 50, -2, 50, -1, 50, 0, 50, 1, 50, 2, 50, 3,
+        50, 4, 50, 5, 50, 6, 50, 7, 50, 8, 50, 14, 50, 15, 50, 22, 50, 23, 50, 24,
+        50, 41, 50, 42, 50, 43, 50, 44, 50, 45, 50, 46, 50, 54, 50, 55, 50, 64, 51, -56,
+        51, -53, 51, -52, 51, -46, 51, -45, 51, -39, 51, -38, 51, -32, 51, -31, 51, -30, 51, -29,
+        51, -28, 51, -20, 51, -19, 51, -7, 51, -6, 51, -2, 51, -1, 51, 0, 51, 1, 51, 2,
+        51, 3, 51, 4, 51, 5, 51, 6, 51, 7, 51, 8, 51, 14, 51, 15, 51, 41, 51, 42,
+        51, 43, 51, 44, 51, 45, 51, 46, 51, 49, 51, 50, 51, 52, 51, 53, 51, 54, 51, 55,
+        52, -56, 52, -53, 52, -52, 52, -46, 52, -45, 52, -44, 52, -43, 52, -39, 52, -38, 52, -29,
+        52, -28, 52, -20, 52, -19, 52, -7, 52, -6, 52, -2, 52, -1, 52, 0, 52, 1, 52, 2,
+        52, 3, 52, 7, 52, 8, 52, 14, 52, 15, 52, 16, 52, 17, 52, 18, 52, 41, 52, 42,
+        52, 45, 52, 46, 52, 49, 52, 50, 52, 52, 52, 53, 52, 54, 52, 55, 52, 64, 53, -56,
+        53, -53, 53, -52, 53, -51, 53, -50, 53, -49, 53, -48, 53, -47, 53, -46, 53, -45, 53, -44,
+        53, -43, 53, -39, 53, -38, 53, -29, 53, -28, 53, -20, 53, -19, 53, -7, 53, -6, 53, -2,
+        53, -1, 53, 0, 53, 1, 53, 2, 53, 3, 53, 7, 53, 8, 53, 14, 53, 15, 53, 16,
+        53, 17, 53, 18, 53, 41, 53, 42, 53, 45, 53, 46, 53, 47, 53, 48, 53, 49, 53, 50,
+        53, 51, 53, 52, 53, 53, 53, 54, 53, 64, 54, -56, 54, -53, 54, -52, 54, -51, 54, -50,
+        54, -49, 54, -48, 54, -47, 54, -46, 54, -45, 54, -44, 54, -43, 54, -42, 54, -39, 54, -38,
+        54, -37, 54, -36, 54, -35, 54, -34, 54, -33, 54, -32, 54, -31, 54, -30, 54, -29, 54, -28,
+        54, -20, 54, -19, 54, -7, 54, -6, 54, -2, 54, -1, 54, 0, 54, 1, 54, 2, 54, 3,
+        54, 7, 54, 8, 54, 14, 54, 15, 54, 17, 54, 18, 54, 41, 54, 42, 54, 45, 54, 46,
+        54, 47, 54, 48, 54, 49, 54, 50, 54, 51, 54, 52, 54, 53, 54, 54, 55, -56, 55, -44,
+        55, -43, 55, -42, 55, -39, 55, -38, 55, -37, 55, -36, 55, -35, 55, -34, 55, -33, 55, -32,
+        55, -31, 55, -30, 55, -29, 55, -28, 55, -20, 55, -19, 55, -18, 55, -17, 55, -16, 55, -15,
+        55, -14, 55, -13, 55, -12, 55, -11, 55, -10, 55, -9, 55, -8, 55, -7, 55, -6, 55, -2,
+        55, -1, 55, 0, 55, 1, 55, 2, 55, 3, 55, 7, 55, 8, 55, 14, 55, 15, 55, 17,
+        55, 18, 55, 41, 55, 42, 55, 53, 55, 54, 56, -56, 56, -20, 56, -19, 56, -18, 56, -17,
+        56, -16, 56, -15, 56, -14, 56, -13, 56, -12, 56, -11, 56, -10, 56, -9, 56, -8, 56, -7,
+        56, -6, 56, -2, 56, -1, 56, 0, 56, 1, 56, 2, 56, 3, 56, 7, 56, 8, 56, 14,
+        56, 15, 56, 16, 56, 17, 56, 18, 56, 41, 56, 42, 56, 53, 56, 54, 57, -56, 57, -53,
+        57, -52, 57, -2, 57, -1, 57, 0, 57, 1, 57, 2, 57, 3, 57, 7, 57, 8, 57, 14,
+        57, 15, 57, 16, 57, 17, 57, 18, 57, 41, 57, 42, 57, 53, 57, 54, 58, -56, 58, -54,
+        58, -53, 58, -52, 58, -51, 58, -2, 58, -1, 58, 0, 58, 1, 58, 2, 58, 3, 58, 7,
+        58, 8, 58, 14, 58, 15, 58, 41, 58, 42, 58, 53, 58, 54, 59, -56, 59, -54, 59, -53,
+        59, -52, 59, -51, 59, -18, 59, -2, 59, -1, 59, 0, 59, 1, 59, 2, 59, 3, 59, 7,
+        59, 8, 59, 13, 59, 14, 59, 41, 59, 42, 59, 53, 59, 54, 59, 58, 59, 59, 59, 64,
+        60, -56, 60, -53, 60, -52, 60, -35, 60, -34, 60, -33, 60, -29, 60, -28, 60, -20, 60, -19,
+        60, -18, 60, -17, 60, -2, 60, -1, 60, 0, 60, 1, 60, 2, 60, 3, 60, 7, 60, 8,
+        60, 9, 60, 10, 60, 11, 60, 12, 60, 13, 60, 14, 60, 15, 60, 16, 60, 17, 60, 21,
+        60, 22, 60, 41, 60, 42, 60, 43, 60, 44, 60, 45, 60, 46, 60, 47, 60, 48, 60, 49,
+        60, 50, 60, 51, 60, 52, 60, 53, 60, 54, 60, 57, 60, 58, 60, 59, 60, 60, 61, -56,
+        61, -35, 61, -34, 61, -33, 61, -30, 61, -29, 61, -28, 61, -27, 61, -20, 61, -19, 61, -18,
+        61, -17, 61, -6, 61, -5, 61, -4, 61, -2, 61, -1, 61, 0, 61, 1, 61, 2, 61, 3,
+        61, 7, 61, 8, 61, 9, 61, 10, 61, 11, 61, 12, 61, 13, 61, 14, 61, 15, 61, 16,
+        61, 17, 61, 20, 61, 21, 61, 22, 61, 23, 61, 41, 61, 42, 61, 43, 61, 44, 61, 45,
+        61, 46, 61, 47, 61, 48, 61, 49, 61, 50, 61, 51, 61, 52, 61, 53, 61, 54, 61, 57,
+        61, 58, 61, 59, 61, 60, 61, 64, 62, -56, 62, -1, 62, 0, 62, 1, 62, 2, 62, 15,
+        62, 16, 62, 17, 62, 20, 62, 21, 62, 22, 62, 23, 62, 26, 62, 27, 62, 39, 62, 58,
+        62, 59, 62, 64, 63, -56, 63, -1, 63, 0, 63, 1, 63, 21, 63, 22, 63, 26, 63, 27,
+        63, 28, 63, 39, 63, 40, 64, -56, 64, -54, 64, -53, 64, -51, 64, -45, 64, -44, 64, -42,
+        64, -40, 64, -39, 64, -37, 64, -36, 64, -22, 64, -19, 64, -17, 64, -16, 64, -14, 64, -12,
+        64, -11, 64, -9, 64, -8, 64, -7, 64, -6, 64, -4, 64, -3, 64, -2, 64, -1, 64, 0,
+        64, 1, 64, 2, 64, 3, 64, 4, 64, 5, 64, 6, 64, 7, 64, 8, 64, 9, 64, 10,
+        64, 11, 64, 12, 64, 13, 64, 14, 64, 15, 64, 16, 64, 17, 64, 18, 64, 19, 64, 20,
+        64, 21, 64, 22, 64, 26, 64, 27, 64, 37, 64, 38, 64, 39, 64, 40, 64, 41, 64, 42,
+        64, 43, 64, 44, 64, 45, 64, 46, 64, 47, 64, 48, 64, 49, 64, 50, 64, 51, 64, 52,
+        64, 53, 64, 54, 64, 55, 64, 56, 64, 57, 64, 58, 64, 59, 64, 60, 64, 61, 64, 62,
+        64, 63, 64, 64
+    };
 }
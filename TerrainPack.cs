@@ -0,0 +1,153 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	TerrainPack.cs -   A C# wrapper class for native terrain packs
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		TerrainPack()
+--					Build(byte[,] tiles, Int32[] fixedXZ, byte[] payload)
+--					Save(string path)
+--					Open(string path)
+--					Occupied(Int32 x, Int32 z)
+--					Tiles()
+--					GetInfo()
+--					Payload()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A terrain pack holds a map's obstacles as a sparse list, its occupancy grid as a bitset and
+--		the compressed payload sent to clients, laid out to be mapped straight from disk. Opening
+--		one is all a match needs to do for its terrain, and every match on a host shares the pages.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct TerrainPackInfo
+	{
+		public UInt32 Magic;
+		public UInt32 Version;
+		public UInt32 Width;
+		public UInt32 Length;
+		public Int32 OriginX;
+		public Int32 OriginZ;
+		public UInt32 Side;
+		public UInt32 ObstacleCount;
+		public UInt64 ObstacleOffset;
+		public UInt64 OccupancyOffset;
+		public UInt64 PayloadOffset;
+		public UInt32 PayloadSize;
+		public UInt32 Reserved;
+		public UInt64 FileSize;
+		public UInt64 Checksum;
+	}
+
+	public unsafe class TerrainPack
+	{
+		private IntPtr pack;
+
+		public TerrainPack()
+		{
+			pack = ServerLibrary.TerrainPack_Create();
+		}
+
+		internal IntPtr Pointer
+		{
+			get { return pack; }
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Build
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool Build(byte[,] tiles, Int32[] fixedXZ, byte[] payload)
+--								tiles: TerrainController's tile grid
+--								fixedXZ: world x, z pairs that are always occupied
+--								payload: the compressed terrain as sent to clients
+--
+-- RETURNS: true if the pack was built; false if this pack already holds terrain or the sizes are out of range.
+--
+-- NOTES:
+-- 		Obstacles and their clearance are rasterized into the occupancy grid in the library. The pack
+--		is usable at once and can be saved for later matches.
+--------------------------------------------------------------------------------------------------------------*/
+		public bool Build(byte[,] tiles, Int32[] fixedXZ, byte[] payload)
+		{
+			fixed (byte* t = tiles, p = payload)
+			fixed (Int32* xz = fixedXZ)
+			{
+				return ServerLibrary.TerrainPack_build(pack, t, (UInt32)tiles.GetLength(0), (UInt32)tiles.GetLength(1),
+					xz, (UInt32)(fixedXZ.Length / 2), p, (UInt32)payload.Length) == 0;
+			}
+		}
+
+		// Writes the pack to path, replacing any pack there in one step
+		public bool Save(string path)
+		{
+			return ServerLibrary.TerrainPack_save(pack, path) == 0;
+		}
+
+		// Maps a saved pack; false if it is missing or not a valid pack
+		public bool Open(string path)
+		{
+			return ServerLibrary.TerrainPack_open(pack, path) == 0;
+		}
+
+		public bool Occupied(Int32 x, Int32 z)
+		{
+			return ServerLibrary.TerrainPack_occupied(pack, x, z) != 0;
+		}
+
+		// The tile grid, rebuilt from the obstacle list
+		public byte[,] Tiles()
+		{
+			TerrainPackInfo info = GetInfo();
+			byte[,] tiles = new byte[info.Width, info.Length];
+			fixed (byte* t = tiles)
+			{
+				ServerLibrary.TerrainPack_expandTiles(pack, t, (UInt64)tiles.Length);
+			}
+			return tiles;
+		}
+
+		public TerrainPackInfo GetInfo()
+		{
+			TerrainPackInfo info = new TerrainPackInfo();
+			ServerLibrary.TerrainPack_getInfo(pack, &info);
+			return info;
+		}
+
+		// A copy of the compressed terrain payload
+		public byte[] Payload()
+		{
+			byte[] payload = new byte[GetInfo().PayloadSize];
+			fixed (byte* p = payload)
+			{
+				ServerLibrary.TerrainPack_copyPayload(pack, p, (UInt32)payload.Length);
+			}
+			return payload;
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.TerrainPack_Destroy(pack);
+			pack = IntPtr.Zero;
+		}
+	}
+}
@@ -0,0 +1,181 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	TickGovernor.cs -   A C# wrapper class for the native tick governor
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		TickGovernor(double budgetMs)
+--					AddPhase(UInt32 lane)
+--					AddStep(UInt32 engagePercent, UInt32 releasePercent)
+--					WaitTick(UInt32 lane)
+--					BeginTick(UInt32 lane)
+--					Mark(Int32 phase)
+--					Engaged(Int32 step)
+--					Level()
+--					DrainEvents(GovernorEvent* output, Int32 max)
+--					GetStats()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - BeginTick for lanes a MatchHost worker already runs on time
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Keeps each tick thread (a lane) on a fixed grid of deadlines one budget apart, times the
+--		phases of every tick against the budget, and when the load stays high applies the
+--		degradation steps one at a time in the order they were added, lifting them again in
+--		reverse once it falls. The owner decides what each step does by asking Engaged, and
+--		reports the changes it drains with DrainEvents.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct GovernorEvent
+	{
+		public UInt32 Kind;
+		public UInt32 Tick;
+		public Int32 Step;
+		public UInt32 Level;
+		public UInt32 Value;
+	}
+
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public unsafe struct GovernorStats
+	{
+		public UInt64 Ticks;
+		public UInt64 Overruns;
+		public UInt64 Skipped;
+		public UInt64 EventsDropped;
+		public UInt32 Level;
+		public UInt32 LoadPercent;
+		public UInt32 WorstUs;
+		public UInt32 Phases;
+		public fixed UInt32 PhaseUs[TickGovernor.MAX_PHASES];
+	}
+
+	public unsafe class TickGovernor
+	{
+		public const Int32 MAX_PHASES = 16;
+
+		// GovernorEvent kinds: a step was applied, a step was lifted, a lane gave up Value late deadlines
+		public const UInt32 ENGAGE = 1;
+		public const UInt32 RELEASE = 2;
+		public const UInt32 RESYNC = 3;
+
+		private IntPtr governor;
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: TickGovernor
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: TickGovernor(double budgetMs)
+--								budgetMs: length of a tick, R.Game.TICK_INTERVAL
+--
+-- NOTES:
+-- 		The deadline grid starts now. Add the phases and steps before any thread waits for a tick.
+--		Throws if the budget rounds to nothing.
+--------------------------------------------------------------------------------------------------------------*/
+		public TickGovernor(double budgetMs)
+		{
+			governor = ServerLibrary.TickGovernor_Create();
+			if (ServerLibrary.TickGovernor_init(governor, Convert.ToUInt32(budgetMs * 1000)) != 0)
+			{
+				ServerLibrary.TickGovernor_Destroy(governor);
+				throw new ArgumentException("invalid tick budget");
+			}
+		}
+
+		// Returns the id to Mark the phase with, or -1 if there are too many
+		public Int32 AddPhase(UInt32 lane)
+		{
+			return ServerLibrary.TickGovernor_addPhase(governor, lane);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: AddStep
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 AddStep(UInt32 engagePercent, UInt32 releasePercent)
+--								engagePercent: load, as a percentage of the budget, that applies the step
+--								releasePercent: load under which it is lifted again, below engagePercent
+--
+-- RETURNS: the step's id for Engaged, or -1 if the percentages are invalid or there are too many steps.
+--
+-- NOTES:
+-- 		Steps are applied in the order they are added, so add the cheapest to the game first.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 AddStep(UInt32 engagePercent, UInt32 releasePercent)
+		{
+			return ServerLibrary.TickGovernor_addStep(governor, engagePercent, releasePercent);
+		}
+
+		// Sleeps until the lane's next deadline; returns how many whole ticks late it woke
+		public Int32 WaitTick(UInt32 lane)
+		{
+			return ServerLibrary.TickGovernor_waitTick(governor, lane);
+		}
+
+		// Closes the lane's last tick and starts the next one now, without sleeping; for ticks scheduled elsewhere
+		public Int32 BeginTick(UInt32 lane)
+		{
+			return ServerLibrary.TickGovernor_beginTick(governor, lane);
+		}
+
+		// Ends the phase, counting the time since the lane's last Mark or its wake up to it
+		public void Mark(Int32 phase)
+		{
+			ServerLibrary.TickGovernor_mark(governor, (UInt32)phase);
+		}
+
+		public bool Engaged(Int32 step)
+		{
+			return step >= 0 && ServerLibrary.TickGovernor_level(governor) > (UInt32)step;
+		}
+
+		// Steps applied
+		public UInt32 Level()
+		{
+			return ServerLibrary.TickGovernor_level(governor);
+		}
+
+		// Returns the number of events copied to output, oldest first
+		public Int32 DrainEvents(GovernorEvent* output, Int32 max)
+		{
+			return (Int32)ServerLibrary.TickGovernor_drainEvents(governor, output, Convert.ToUInt32(max));
+		}
+
+		public GovernorStats GetStats()
+		{
+			GovernorStats stats = new GovernorStats();
+			ServerLibrary.TickGovernor_getStats(governor, &stats);
+			return stats;
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.TickGovernor_Destroy(governor);
+			governor = IntPtr.Zero;
+		}
+	}
+}
@@ -0,0 +1,133 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	TimerWheel.cs -   A C# wrapper class for the native timer wheel
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		TimerWheel(UInt32 capacity)
+--					Schedule(UInt32 kind, UInt32 key, UInt32 delayMs)
+--					Reschedule(Int32 handle, UInt32 delayMs)
+--					Cancel(Int32 handle)
+--					Advance(TimerFired* output, Int32 max)
+--					Pending()
+--					Now()
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		One-shot timers at millisecond resolution, each naming a kind and a key the owner acts
+--		on when it expires. Scheduling, rescheduling and cancelling are constant time and the
+--		timers are allocated once, in the library, so a timer per connection costs nothing
+--		until it fires. Any thread may schedule; expired timers are collected by Advance.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Runtime.InteropServices;
+
+namespace Networking
+{
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct TimerFired
+	{
+		public UInt32 Kind;
+		public UInt32 Key;
+	}
+
+	public unsafe class TimerWheel
+	{
+		public const Int32 NO_TIMER = 0;
+
+		private IntPtr wheel;
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: TimerWheel
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: TimerWheel(UInt32 capacity)
+--								capacity: timers pending at once, at most 65535
+--
+-- NOTES:
+-- 		Throws if the library rejects the capacity.
+--------------------------------------------------------------------------------------------------------------*/
+		public TimerWheel(UInt32 capacity)
+		{
+			wheel = ServerLibrary.TimerWheel_Create();
+			if (ServerLibrary.TimerWheel_init(wheel, capacity) != 0)
+			{
+				ServerLibrary.TimerWheel_Destroy(wheel);
+				throw new ArgumentException("invalid timer wheel capacity");
+			}
+		}
+
+		// Returns a handle for the timer, or -1 if the wheel is full
+		public Int32 Schedule(UInt32 kind, UInt32 key, UInt32 delayMs)
+		{
+			return ServerLibrary.TimerWheel_schedule(wheel, kind, key, delayMs);
+		}
+
+		public bool Reschedule(Int32 handle, UInt32 delayMs)
+		{
+			return ServerLibrary.TimerWheel_reschedule(wheel, handle, delayMs) == 0;
+		}
+
+		public bool Cancel(Int32 handle)
+		{
+			return ServerLibrary.TimerWheel_cancel(wheel, handle) == 0;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Advance
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Advance(TimerFired* output, Int32 max)
+--								output: room for max expired timers
+--								max: the most to take
+--
+-- RETURNS: the number of timers that expired, in due order.
+--
+-- NOTES:
+-- 		Anything past max stays pending for the next call. An expired timer's handle is dead; a timer
+--		that should keep running is scheduled again.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Advance(TimerFired* output, Int32 max)
+		{
+			return ServerLibrary.TimerWheel_advance(wheel, output, Convert.ToUInt32(max));
+		}
+
+		public UInt32 Pending()
+		{
+			return ServerLibrary.TimerWheel_pending(wheel);
+		}
+
+		// Milliseconds on the wheel's monotonic clock
+		public static Int64 Now()
+		{
+			return (Int64)ServerLibrary.TimerWheel_now();
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.TimerWheel_Destroy(wheel);
+			wheel = IntPtr.Zero;
+		}
+	}
+}
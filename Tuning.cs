@@ -0,0 +1,122 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	Tuning.cs -   A C# wrapper class for the native thread and socket tuning profile
+--
+--	PROGRAM:		game
+--
+--	FUNCTIONS:		Tuning()
+--					Load(string path)
+--					ApplyThread(Int32 role)
+--					ApplySocket(Int32 kind, Int32 fd)
+--					DescribeThread(Int32 role)
+--					DescribeSocket(Int32 kind)
+--					Pointer
+--					Destroy()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - Pointer, for a MatchHost to apply to its own threads
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A profile file pins the receive, send, game and TCP transmit threads to cores, optionally
+--		moves them to SCHED_FIFO or a nice level, and sets buffer sizes, busy polling, priority and
+--		DSCP on the UDP and TCP sockets. See src/tuning.cpp for the file format.
+--
+--		Managed threads run on their own OS threads, so each thread calls ApplyThread for its role
+--		as the first thing it does. DescribeThread and DescribeSocket report what actually took
+--		effect, so an unprivileged run shows which settings were refused.
+---------------------------------------------------------------------------------------*/
+using System;
+using System.Text;
+
+namespace Networking
+{
+	public unsafe class Tuning
+	{
+		public const Int32 THREAD_RECV = 0;
+		public const Int32 THREAD_SEND = 1;
+		public const Int32 THREAD_GAME = 2;
+		public const Int32 THREAD_TCP = 3;
+
+		public const Int32 SOCKET_UDP = 0;
+		public const Int32 SOCKET_TCP = 1;
+
+		private const Int32 REPORT_SIZE = 512;
+
+		private IntPtr tuning;
+
+		public Tuning()
+		{
+			tuning = ServerLibrary.Tuning_Create();
+		}
+
+		internal IntPtr Pointer
+		{
+			get { return tuning; }
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: Load
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 Load(string path)
+--								path: the profile file
+--
+-- RETURNS: the number of settings read, or -1 if the file could not be opened.
+--
+-- NOTES:
+-- 		Until a profile is loaded every Apply call leaves the thread or socket as it was.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 Load(string path)
+		{
+			return ServerLibrary.Tuning_load(tuning, path);
+		}
+
+		public UInt32 ApplyThread(Int32 role)
+		{
+			return ServerLibrary.Tuning_applyThread(tuning, role);
+		}
+
+		public UInt32 ApplySocket(Int32 kind, Int32 fd)
+		{
+			return ServerLibrary.Tuning_applySocket(tuning, kind, fd);
+		}
+
+		public string DescribeThread(Int32 role)
+		{
+			byte[] text = new byte[REPORT_SIZE];
+			fixed (byte* p = text)
+			{
+				Int32 len = ServerLibrary.Tuning_describeThread(tuning, role, p, REPORT_SIZE);
+				return len > 0 ? Encoding.ASCII.GetString(text, 0, len) : "";
+			}
+		}
+
+		public string DescribeSocket(Int32 kind)
+		{
+			byte[] text = new byte[REPORT_SIZE];
+			fixed (byte* p = text)
+			{
+				Int32 len = ServerLibrary.Tuning_describeSocket(tuning, kind, p, REPORT_SIZE);
+				return len > 0 ? Encoding.ASCII.GetString(text, 0, len) : "";
+			}
+		}
+
+		public void Destroy()
+		{
+			ServerLibrary.Tuning_Destroy(tuning);
+			tuning = IntPtr.Zero;
+		}
+	}
+}
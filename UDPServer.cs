@@ -3,16 +3,36 @@
 --
 --	PROGRAM:		game
 --
---	FUNCTIONS:		Init(string ipaddr, ushort port)
+--	FUNCTIONS:		Server()
+--					Server(IntPtr shared)
+--					Init(string ipaddr, ushort port)
 --					Poll()
 --					Select()
 --					Recv(byte[] buffer, Int32 len)
 --					Send(byte[] buffer, Int32 len)
+--					SetEngine(Int32 engine)
+--					QueueSend(EndPoint ep, byte[] buffer, Int32 len)
+--					FlushSends()
+--					SendBuffer(BufferPool pool, Int32 handle, EndPoint ep, Int32 len)
+--					QueueBuffer(BufferPool pool, Int32 handle, EndPoint ep, Int32 len)
+--					RecvBuffer(BufferPool pool, Int32 handle, ref EndPoint ep)
+--					GetSocket()
+--					SetFilter(IngressFilter filter)
+--					SetPacing(Int32 mode, UInt32 intervalUs, UInt32 percent)
+--					GetPacerStats()
+--					SetUpstream(EndPoint proxy)
 --
 --	DATE:			February 27th, 2018
 --					
 --
 --	REVISIONS:		(Date and Description)
+--					October 19th, 2026 - transport engine selection and batched sends
+--					October 19th, 2026 - pooled send and receive by buffer handle
+--					October 19th, 2026 - socket descriptor for the tuning profile
+--					October 19th, 2026 - ingress filter on the receive path
+--					October 19th, 2026 - paced flushes
+--					October 19th, 2026 - upstream mode behind the front proxy
+--					October 19th, 2026 - wraps a MatchHost's shared socket to configure it
 --
 --	DESIGNERS:		Delan Elliot, Wilson Hu, Jeff Chou, Jeremy Lee
 --
@@ -24,14 +44,32 @@
 --		
 ---------------------------------------------------------------------------------------*/
 using System;
+using System.Runtime.InteropServices;
 
 namespace Networking
 {
+	[StructLayout(LayoutKind.Sequential, Pack = 1)]
+	public struct PacerStats
+	{
+		public UInt64 Scheduled;
+		public UInt64 Sent;
+		public UInt64 Dropped;
+		public UInt64 Late;
+	}
+
 	public unsafe class Server
 	{
 		public static Int32 SOCKET_NO_DATA = 0;
 		public static Int32 SOCKET_DATA_WAITING = 1;
 
+		public const Int32 ENGINE_POLL = 0;
+		public const Int32 ENGINE_EPOLL = 1;
+		public const Int32 ENGINE_URING = 2;
+
+		public const Int32 PACING_OFF = 0;
+		public const Int32 PACING_TXTIME = 1;
+		public const Int32 PACING_WHEEL = 2;
+
 		private IntPtr server;
 
 		public Server()
@@ -39,6 +77,12 @@ namespace Networking
 			server = ServerLibrary.Server_CreateServer();
 		}
 
+		// Wraps a server owned by the library, such as MatchHost.Transport(); it is never freed from here
+		internal Server(IntPtr shared)
+		{
+			server = shared;
+		}
+
 /*------------------------------------------------------------------------------------------------------------
 -- FUNCTION: Init
 --
@@ -156,6 +200,188 @@ namespace Networking
 				return ret;
 			}
 		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: SetEngine
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 SetEngine(Int32 engine)
+--								engine: ENGINE_POLL, ENGINE_EPOLL or ENGINE_URING
+--
+-- RETURNS: the engine actually in use, which is ENGINE_EPOLL when io_uring was asked for but is unavailable.
+--
+-- NOTES:
+-- 		Call after Init and before any thread starts sending or receiving.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 SetEngine(Int32 engine)
+		{
+			return ServerLibrary.Server_setEngine(server, engine);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: QueueSend
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 QueueSend(EndPoint ep, byte[] buffer, Int32 len)
+--
+-- RETURNS: len once queued, or -1 on failure
+--
+-- NOTES:
+-- 		The datagram is copied into the unmanaged staging area and goes out on the next FlushSends, so the
+--		buffer may be reused immediately. Only one thread may queue and flush.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 QueueSend(EndPoint ep, byte[] buffer, Int32 len)
+		{
+			fixed (byte* tmpBuf = buffer)
+			{
+				return ServerLibrary.Server_queueSend(server, ep, new IntPtr(tmpBuf), Convert.ToUInt32(len));
+			}
+		}
+
+		public Int32 FlushSends()
+		{
+			return ServerLibrary.Server_flushSends(server);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: RecvBuffer
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 RecvBuffer(BufferPool pool, Int32 handle, ref EndPoint ep)
+--				pool: the pool the buffer was leased from
+--				handle: the leased buffer to receive into
+--				ep: reference to an EndPoint struct filled with the sender
+--
+-- RETURNS: the number of bytes received
+--
+-- NOTES:
+-- 		The pooled counterpart of Recv. The datagram is written straight into the pool's unmanaged memory,
+--		so no managed array is allocated or pinned.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 RecvBuffer(BufferPool pool, Int32 handle, ref EndPoint ep)
+		{
+			fixed (EndPoint* p = &ep)
+			{
+				return ServerLibrary.Server_recvBuffer(server, pool.Pointer, handle, p);
+			}
+		}
+
+		public Int32 SendBuffer(BufferPool pool, Int32 handle, EndPoint ep, Int32 len)
+		{
+			return ServerLibrary.Server_sendBuffer(server, pool.Pointer, handle, ep, Convert.ToUInt32(len));
+		}
+
+		public Int32 QueueBuffer(BufferPool pool, Int32 handle, EndPoint ep, Int32 len)
+		{
+			return ServerLibrary.Server_queueBuffer(server, pool.Pointer, handle, ep, Convert.ToUInt32(len));
+		}
+
+		public Int32 GetSocket()
+		{
+			return ServerLibrary.Server_getSocket(server);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: SetFilter
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void SetFilter(IngressFilter filter)
+--								filter: checked against every datagram before Recv or RecvBuffer returns it
+--
+-- NOTES:
+-- 		Call before the receive thread starts. Rejected datagrams never reach managed code; they are
+--		counted in the filter's stats instead.
+--------------------------------------------------------------------------------------------------------------*/
+		public void SetFilter(IngressFilter filter)
+		{
+			ServerLibrary.Server_setFilter(server, filter.Pointer);
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: SetPacing
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Int32 SetPacing(Int32 mode, UInt32 intervalUs, UInt32 percent)
+--								mode: PACING_OFF, PACING_TXTIME or PACING_WHEEL
+--								intervalUs: time between flushes
+--								percent: share of the interval each flush is spread across
+--
+-- RETURNS: the pacing mode actually in use, which is PACING_WHEEL when SO_TXTIME was asked for but refused.
+--
+-- NOTES:
+-- 		Call after Init and before the send thread starts. PACING_TXTIME needs the fq qdisc on the
+--		outgoing interface to have any effect.
+--------------------------------------------------------------------------------------------------------------*/
+		public Int32 SetPacing(Int32 mode, UInt32 intervalUs, UInt32 percent)
+		{
+			return ServerLibrary.Server_setPacing(server, mode, intervalUs, percent);
+		}
+
+		public PacerStats GetPacerStats()
+		{
+			PacerStats stats = new PacerStats();
+			ServerLibrary.Server_getPacerStats(server, &stats);
+			return stats;
+		}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: SetUpstream
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void SetUpstream(EndPoint proxy)
+--								proxy: the front proxy's internal address
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Puts the server behind the front proxy. Clients keep their own addresses on both sides of
+--		the wrapper; only the datagrams on the wire carry the proxy header. Call after Init.
+--------------------------------------------------------------------------------------------------------------*/
+		public void SetUpstream(EndPoint proxy)
+		{
+			ServerLibrary.Server_setUpstream(server, proxy);
+		}
 	}
 }
-
@@ -5,25 +5,17 @@
 --
 --    FUNCTIONS:        
 --                    public static void Main()
---                    public static void pregame()
---                    public static void startGame()
---                    private static bool isTick()
---                    private static void gameThreadFunction()
---                    private static void sendThreadFunction()
---                    private static byte generateTickPacketHeader(bool hasPlayer, bool hasBullet, bool hasWeapon, int players)
---                    private static void updateHealthPacket(Player player, byte[] snapshot)
---                    private static void buildSendPacket()
---                    private static void recvThreadFunction()
---                    private static void handleBuffer(byte[] inBuffer, EndPoint ep)
---                    private static void updateExistingPlayer(ref byte[] inBuffer)
---                    private static void handleIncomingBullet(byte playerId, int bulletId, byte bulletType)
---                    private static void handleIncomingWeapon(byte playerId, int weaponId, byte weaponType)
---                    private static void addNewPlayer(EndPoint ep)
---                    private static void sendInitPacket(Player newPlayer)
---                    private static void initTCPServer()
---                    private static void generateInitData()
---                    private static void listenThreadFunc()
---                    private static void transmitThreadFunc(object clientsockfd)
+--                    private static bool startHost()
+--                    private static void shutdown(object sender, EventArgs e)
+--                    private static Int32 requestedMatches()
+--                    private static Int32 requestedWorkers()
+--                    internal static Int32 requestedEngine()
+--                    private static Int32 requestedPacing()
+--                    private static ushort listenPort()
+--                    private static void joinUpstream()
+--                    private static void loadTuningProfile()
+--                    private static void initIngressFilter()
+--                    private static void reportIngress()
 --
 --    DATE:           Feb 18, 2018
 --
@@ -31,16 +23,45 @@
 --                    Mar 30, 2018 - Moved the server off unity to a seperate script
 --                    Apr 2, 2018 - Added bullet handling
 --                    Apr 11, 2018 - Merged in danger zone
+--                    Oct 19, 2026 - NETWORK_ENGINE selects the native transport, batched tick sends
+--                    Oct 19, 2026 - Tick packets live in native pooled buffers instead of managed arrays
+--                    Oct 19, 2026 - Snapshots carry a sequence number, send rate adapts to each player's link
+--                    Oct 19, 2026 - Snapshots are bit-packed before they are queued
+--                    Oct 19, 2026 - Bullet hits are tested against player positions from the shooter's snapshot
+--                    Oct 19, 2026 - TUNING_PROFILE pins threads to cores and tunes the sockets
+--                    Oct 19, 2026 - Init data is generated during the accept window and sent on connect
+--                    Oct 19, 2026 - MATCH_RECORD records every tick's world state to a seekable file
+--                    Oct 19, 2026 - Native ingress filter drops malformed, unknown and excess datagrams
+--                    Oct 19, 2026 - LogError queues to a native asynchronous log instead of writing the console
+--                    Oct 19, 2026 - SEND_PACING spreads each tick's snapshots across part of the tick interval
+--                    Oct 19, 2026 - Bullet and weapon swap events go through native lock-free queues, in order
+--                    Oct 19, 2026 - SERVER_PORT and PROXY_UPSTREAM run the match behind the front proxy
+--                    Oct 19, 2026 - Keepalives to quiet players, idle and disconnected players are dropped
+--                    Oct 19, 2026 - SPECTATOR_RING publishes each tick's snapshot once for spectator relays
+--                    Oct 19, 2026 - Packets are read and written through the accessors generated from packets.def
+--                    Oct 19, 2026 - Ticks follow the native tick governor, which degrades non-critical work under load
+--                    Oct 19, 2026 - TERRAIN_PACK maps prebuilt terrain instead of generating it every match
+--                    Oct 19, 2026 - Client tick clock fields feed connStats' per-player clock sync
+--                    Oct 19, 2026 - Bullets are swept along each tick's movement against players and terrain
+--                    Oct 19, 2026 - Each player's events are held back to fit their rate's byte budget
+--                    Oct 19, 2026 - The match moved to Match.cs; MATCH_COUNT matches run on MatchHost workers
+--                                   over one shared UDP socket
 --
 --    DESIGNERS:      Benny Wang, Tim Bruecker, Haley Booker, Alfred Swinton
 --
 --    PROGRAMMER:     Benny Wang, Tim Bruecker, Haley Booker, Alfred Swinton
 --
 -- NOTES:
--- This is the csharp class to start the server. It waits for a maximum of 30 players.
--- After 30 seconds of running the game will be initiated if a minimum of 2 players have joined.
--- The server keeps track of all players, bullets and weapons in the game. It sends the
--- information of the players inventory, health and the other players coordinates to each player.
+-- This is the csharp class to start the server. It hosts MATCH_COUNT matches, one by default,
+-- each of which waits for a maximum of 30 players. After 30 seconds of running a match will be
+-- initiated if a minimum of 2 players have joined. See Match.cs for the game itself.
+--
+-- Every match in the process shares one UDP socket, owned by a native MatchHost. The host
+-- routes each datagram to the match its sender joined and ticks every match on a shared pool
+-- of MATCH_WORKERS threads, so the process has no threads of its own per match once its
+-- pregame is over. A client joins match i by carrying the token i + 1 in its ACK, as it would
+-- behind the front proxy, or 0 for the match with the fewest players; match i takes its
+-- pregame TCP connections on SERVER_PORT + i.
 ---------------------------------------------------------------------------------------*/
 using System;
 using System.Collections;
@@ -49,49 +70,23 @@ using System.Threading;
 using Networking;
 using InitGuns;
 
-class Server
+unsafe class Server
 {
-    private static DateTime nextTick = DateTime.Now;
-    private static Thread sendThread;
-    private static Thread recvThread;
-    private static Thread gameThread;
-    private static bool running;
-    private static Mutex mutex;
-
+    private static MatchHost host;
     private static Networking.Server server;
+    private static Match[] matches;
 
-    private static byte[] sendBuffer = new byte[R.Net.Size.SERVER_TICK];
-
-    private static bool overtime = false;
-    private static Random random = new Random();
-
-    private static byte nextPlayerId = 1;
-    private static Dictionary<byte, Player> players;
-    private static HashSet<byte> deadPlayers = new HashSet<byte>();
-    private static Stack<Bullet> newBullets = new Stack<Bullet>();
-    private static Dictionary<int, Bullet> bullets = new Dictionary<int, Bullet>();
-    private static Stack<Tuple<byte, int>> weaponSwapEvents = new Stack<Tuple<byte, int>>();
-    private static TerrainController tc = new TerrainController();
-
-    // Game generation variables
-    private static Int32[] clientSockFdArr = new Int32[R.Net.MAX_PLAYERS];
-    private static Thread[] transmitThreadArr = new Thread[R.Net.MAX_PLAYERS];
-    private static Thread listenThread;
-    private static byte[] itemData = new byte[R.Net.TCP_BUFFER_SIZE];
-    private static byte[] mapData = new byte[R.Net.TCP_BUFFER_SIZE];
-    private static Int32 numClients = 0;
-    private static bool accepting = false;
-    private static TCPServer tcpServer;
-
-    private static DangerZone dangerZone;
-    private static SpawnPointGenerator spawnPointGenerator = new SpawnPointGenerator();
+    private static Tuning tuning;
+    private static IngressFilter ingress;
+    private static UInt64 ingressRejected;
+    private static AsyncLog log;
 
     /*-------------------------------------------------------------------------------------------------
     -- FUNCTION:         Main()
     --
     -- DATE:             Feb 18, 2018
     --
-    -- REVISIONS:
+    -- REVISIONS:        Oct 19, 2026 - Starts the host, then runs every match's pregame at once
     --
     -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
     --
@@ -102,917 +97,398 @@ class Server
     -- RETURNS:          void
     --
     -- NOTES:
-    -- The starting point of the server. Sets up the pregame and starts the game.
+    -- The starting point of the server. Sets up the host, then runs the pregame of every match
+    -- on a thread of its own and waits for them. The matches are created on the host in order
+    -- first, so match i is the host's match i.
+    --
+    -- From then on the host's threads run the games and this thread only reports the ingress
+    -- filter. If no match could be started the server exits with an error. The host and every
+    -- match are torn down when the process exits.
     -------------------------------------------------------------------------------------------------*/
     public static void Main()
     {
         Console.WriteLine("Starting server");
-        mutex = new Mutex();
-
-        pregame();
-
-        startGame();
-    }
-
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:         pregame
-    --
-    -- DATE:             Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- PROGRAMMER:       Benny Wang
-    --
-    -- INTERFACE:        public static void pregame()
-    --
-    -- RETURNS:          void
-    --
-    -- NOTES:
-    -- Creates everything needed before the game can start.
-    -------------------------------------------------------------------------------------------------*/
-    public static void pregame()
-    {
-        players = new Dictionary<byte, Player>();
-        initTCPServer();
-    }
+        log = new AsyncLog();
+        log.Start();
+        loadTuningProfile();
+        host = new MatchHost();
+        AppDomain.CurrentDomain.ProcessExit += shutdown;
 
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:         startGame
-    --
-    -- DATE:             Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- PROGRAMMER:       Benny Wang, Haley Booker
-    --
-    -- INTERFACE:        public static void startGame()
-    --
-    -- RETURNS:         void
-    --
-    -- NOTES:
-    -- Starts the threads for the game.
-    -------------------------------------------------------------------------------------------------*/
-    public static void startGame()
-    {
-        server = new Networking.Server();
-        server.Init(R.Net.PORT);
-
-        sendThread = new Thread(sendThreadFunction);
-        recvThread = new Thread(recvThreadFunction);
-        gameThread = new Thread(gameThreadFunction);
-
-        mutex.WaitOne();
-        running = true;
-        mutex.ReleaseMutex();
-        sendThread.Start();
-        recvThread.Start();
-        gameThread.Start();
-    }
-
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:         isTick
-    --
-    -- DATE:             Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- PROGRAMMER:       Benny Wang
-    --
-    -- INTERFACE:        public static void isTick()
-    --
-    -- RETURNS:          Returns true if time has elapsed. Else it returns false
-    --
-    -- NOTES:
-    -- Checks if a new tick has occurred. It’s used to update the send thread.
-    -------------------------------------------------------------------------------------------------*/
-    private static bool isTick()
-    {
-        if (DateTime.Now > nextTick)
+        if (!startHost())
         {
-            nextTick = DateTime.Now.AddMilliseconds(R.Game.TICK_INTERVAL);
-            return true;
+            Environment.Exit(1);
         }
-        return false;
-    }
+        Match.Init(log, tuning, host, ingress);
 
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:         gameThreadFunction
-    --
-    -- DATE:             Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- PROGRAMMER:       Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- INTERFACE:        private static void gameThreadFunction()
-    --
-    -- RETURNS:          void
-    --
-    -- NOTES:
-    -- Updates the the players based on collisions and the danger zone. The systems handles
-    -- players outside the danger zone, collisions between bullets and players and expired bullets.
-    -------------------------------------------------------------------------------------------------*/
-    private static void gameThreadFunction()
-    {
-        try
+        Int32 count = requestedMatches();
+        matches = new Match[count];
+        Thread[] pregames = new Thread[count];
+        for (int i = 0; i < count; i++)
         {
-            while (running)
+            matches[i] = new Match(i, (ushort)(listenPort() + i));
+            if (matches[i].Create() == MatchHost.MATCH_INVALID)
             {
-                if (isTick())
-                {
-                    dangerZone.Update();
-
-                    Dictionary<int, int> bulletIds = new Dictionary<int, int>();
-
-                    mutex.WaitOne();
-                    foreach (KeyValuePair<int, Bullet> bullet in bullets)
-                    {
-                        if (tc.IsOccupied(bullet.Value))
-                        {
-                            bulletIds[bullet.Key] = bullet.Key;
-                        }
-                    }
-                    mutex.ReleaseMutex();
-
-                    mutex.WaitOne();
-                    foreach (KeyValuePair<byte, Player> player in players)
-                    {
-                        dangerZone.HandlePlayer(player.Value);
-                    }
-                    mutex.ReleaseMutex();
-
-                    // Loop through players
-                    foreach (KeyValuePair<byte, Player> player in players)
-                    {
-                        // Loop through bullets
-                        mutex.WaitOne();
-                        foreach(KeyValuePair<int, Bullet> bullet in bullets)
-                        {
-                            // If bullet collides
-                            if (bullet.Value.PlayerId == player.Value.id)
-                            {
-                                continue;
-                            }
-                            if (bullet.Value.IsColliding(player.Value.x, player.Value.z, R.Game.Players.RADIUS))
-                            {
-                                // Subtract health
-                                if (player.Value.h < bullet.Value.Damage)
-                                {
-                                    player.Value.h = 0;
-                                }
-                                else
-                                {
-                                    player.Value.TakeDamage(bullet.Value.Damage);
-                                }
-                                // Signal delete
-                                bulletIds[bullet.Key] = bullet.Key;
-                            }
-                        }
-                        mutex.ReleaseMutex();
-                    }
-
-                    mutex.WaitOne();
-                    foreach (KeyValuePair<int, Bullet> pair in bullets)
-                    {
-                        // Update bullet positions
-                        if (!pair.Value.Update())
-                        {
-                            // Remove expired bullets
-                            bulletIds[pair.Key] = pair.Key;
-                        }
-                    }
-                    mutex.ReleaseMutex();
+                LogError("No room on the host for match " + i);
+                continue;
+            }
+            pregames[i] = new Thread(matches[i].Run);
+            pregames[i].Start();
+        }
 
-                    // Remove bullets
-                    mutex.WaitOne();
-                    foreach (KeyValuePair<int, int> pair in bulletIds)
-                    {
-                        bullets[pair.Key].Event = R.Game.Bullet.REMOVE;
-                        newBullets.Push(bullets[pair.Key]);
-                        bullets.Remove(pair.Key);
-                    }
-                    mutex.ReleaseMutex();
-                }
+        Int32 started = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (pregames[i] != null)
+            {
+                pregames[i].Join();
+                started += matches[i].Started ? 1 : 0;
             }
         }
-        catch (Exception e)
+        if (started == 0)
         {
-            LogError("Game Logic Thread Exception");
-            LogError(e.ToString());
+            LogError("No match could be started");
+            Environment.Exit(1);
         }
-    }
+        LogError(started + " of " + count + " matches started");
+        LogError(tuning.DescribeThread(Tuning.THREAD_RECV));
+        LogError(tuning.DescribeThread(Tuning.THREAD_GAME));
 
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:         sendThreadFunction
-    --
-    -- DATE:             Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- PROGRAMMER:       Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- INTERFACE:        private static void sendThreadFunction()
-    --
-    -- RETURNS:          void
-    --
-    -- NOTES:
-    -- Sends and packet to each connected player. The system sends each players
-    -- health out after updating it.
-    -------------------------------------------------------------------------------------------------*/
-    private static void sendThreadFunction()
-    {
-        Console.WriteLine("Starting Sending Thread");
-        while (running)
+        while (true)
         {
-            try
-            {
-                if (isTick())
-                {
-                    buildSendPacket();
-
-                    byte[] snapshot = new byte[sendBuffer.Length];
-                    Buffer.BlockCopy(sendBuffer, 0, snapshot, 0, sendBuffer.Length);
-
-                    foreach (KeyValuePair<byte, Player> pair in players)
-                    {
-                        updateHealthPacket(pair.Value, snapshot);
-                        server.Send(pair.Value.ep, snapshot, snapshot.Length);
-                    }
-                }
-            }
-            catch (Exception e)
-            {
-                LogError("Send Thread Exception");
-                LogError(e.ToString());
-            }
+            Thread.Sleep(R.Net.INGRESS_REPORT_SECONDS * 1000);
+            reportIngress();
         }
     }
 
-
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:         generateTickPacketHeader
+    -- FUNCTION:         startHost
     --
     -- DATE:             Feb 18, 2018
     --
-    -- REVISIONS:
+    -- REVISIONS:        Oct 19, 2026 - The UDP half of the old startGame, set up once for every match
     --
     -- DESIGNER:         Benny Wang, Tim Bruecker, Haley Booker
     --
-    -- PROGRAMMER:       Benny Wang
+    -- PROGRAMMER:       Benny Wang, Haley Booker
     --
-    -- INTERFACE:        private static byte generateTickPacketHeader(bool hasPlayer, bool hasBullet, bool hasWeapon, int players)
-    --                      bool hasPlayer: True if the packet is sending players
-    --                      bool hasBullet: True if the packet is sending bullets
-    --                      bool hasWeapon: True if the packet is sending weapons
-    --                      int players: The number of players in the game
+    -- INTERFACE:        private static bool startHost()
     --
-    -- RETURNS:          The header byte generated
+    -- RETURNS:          false if the UDP socket could not be opened
     --
     -- NOTES:
-    -- Generates a byte for the header based on what it needs to send. The byte value will      
-    -- depend on the number of players and whether the packet will have players, bullets and/or
-    -- weapons.
+    -- Opens the shared UDP socket and sets it up as a single match's used to be: the engine,
+    -- pacing, upstream, socket tuning and ingress filter all apply to every match. Then the host's
+    -- receive thread and workers are started; they run nothing until a match is created.
     -------------------------------------------------------------------------------------------------*/
-    private static byte generateTickPacketHeader(bool hasPlayer, bool hasBullet, bool hasWeapon, int players)
+    private static bool startHost()
     {
-        byte tmp = 0;
-
-        if (hasPlayer)
-        {
-            tmp += 128;
-        }
-
-        if (hasBullet)
+        if (host.Init(listenPort()) != 0)
         {
-            tmp += 64;
+            LogError("Could not open UDP port " + listenPort());
+            return false;
         }
 
-        if (hasWeapon)
-        {
-            tmp += 32;
-        }
-
-        tmp += Convert.ToByte(players);
-
-        return tmp;
+        server = host.Transport();
+        joinUpstream();
+        tuning.ApplySocket(Tuning.SOCKET_UDP, server.GetSocket());
+        Console.WriteLine(tuning.DescribeSocket(Tuning.SOCKET_UDP));
+        initIngressFilter();
+        Int32 engine = server.SetEngine(requestedEngine());
+        Console.WriteLine("UDP engine: " + engine);
+        Int32 pacing = server.SetPacing(requestedPacing(), (UInt32)(1000000 / R.Game.TICK_RATE), R.Net.PACING_PERCENT);
+        Console.WriteLine("Send pacing: " + pacing);
+
+        host.SetJoin(R.Net.Header.ACK, R.Net.Offset.PID);
+        host.SetTuning(tuning);
+        Console.WriteLine("Match workers: " + host.Start(requestedWorkers()));
+        return true;
     }
 
-
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		updateHealthPacket
-    --
-    -- DATE: 			Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker
-    --
-    -- PROGRAMMER: 	    Benny Wang, Tim Bruecker
-    --
-    -- INTERFACE:	 	private static void updateHealthPacket(Player player, byte[] snapshot)
-    --				        Player player: The player object
-    --				        byte[] snapshot: The byte array to be copied to
-    --
-    -- RETURNS: 		void
-    --
-    -- NOTES:
-    -- Takes a players health value and copies it into a byte array. Used to update player’s health
-    -------------------------------------------------------------------------------------------------*/
-    private static void updateHealthPacket(Player player, byte[] snapshot)
+    // Takes every match off the host, then stops and frees the host and flushes the log
+    private static void shutdown(object sender, EventArgs e)
     {
-        int offset = R.Net.Offset.HEALTH;
-        mutex.WaitOne();
-        Array.Copy(BitConverter.GetBytes(player.h), 0, snapshot, offset, 1);
-        mutex.ReleaseMutex();
-    }
-
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		buildSendPacket
-    --
-    -- DATE: 			Feb 18, 2018
-    --
-    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
-    --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- PROGRAMMER: 	    Benny Wang, Tim Bruecker, Haley Booker
-    --
-    -- INTERFACE:	 	private static void buildSendPacket()
-    --
-    -- RETURNS: 		void
-    --
-    -- NOTES:
-    -- Builds the send packet with the players ids and coordinates. For any new bullets it adds
-    -- them to the packet.The offset of the bullets is based on which player fired the bullet. If a
-    -- player’s inventory has changed. The weapons on the map will be updated.
-    -------------------------------------------------------------------------------------------------*/
-    private static void buildSendPacket()
-    {
-        int offset = R.Net.Offset.PLAYERS;
-        int bulletOffset = R.Net.Offset.BULLETS;
-        int weaponOffset = R.Net.Offset.WEAPONS;
-
-        // Header
-        mutex.WaitOne();
-
-        sendBuffer[0] = generateTickPacketHeader(true, newBullets.Count > 0, weaponSwapEvents.Count > 0, players.Count - deadPlayers.Count);
-
-        // Danger zone
-        Array.Copy(dangerZone.ToBytes(), 0, sendBuffer, R.Net.Offset.DANGER_ZONE, 16);
-
-        // Player data
-        foreach (KeyValuePair<byte, Player> pair in players)
+        if (matches != null)
         {
-            byte id = pair.Key;
-            Player player = pair.Value;
-
-            sendBuffer[offset] = id;
-            Array.Copy(BitConverter.GetBytes(player.x), 0, sendBuffer, offset + 1, 4);
-            Array.Copy(BitConverter.GetBytes(player.z), 0, sendBuffer, offset + 5, 4);
-            Array.Copy(BitConverter.GetBytes(player.r), 0, sendBuffer, offset + 9, 4);
-            offset += R.Net.Size.PLAYER_DATA;
-        }
-        mutex.ReleaseMutex();
-
-        if (newBullets.Count > 0)
-        {
-            // Bullet data
-            mutex.WaitOne();
-            sendBuffer[bulletOffset] = Convert.ToByte(newBullets.Count);
-            bulletOffset++;
-
-            while (newBullets.Count > 0)
+            foreach (Match match in matches)
             {
-                Bullet bullet = newBullets.Pop();
-                if (bullet == null)
-                {
-                    continue;
-                }
-                sendBuffer[bulletOffset] = bullet.PlayerId;
-                Array.Copy(BitConverter.GetBytes(bullet.BulletId), 0, sendBuffer, bulletOffset + 1, 4);
-                sendBuffer[bulletOffset + 5] = bullet.Type;
-                if (bullet.Event != R.Game.Bullet.IGNORE)
-                {
-                    sendBuffer[bulletOffset + 6] = bullet.Event;
-                }
-                else
+                if (match != null)
                 {
-                    LogError("Bullet event is set to ignore");
+                    match.Stop();
                 }
-                bulletOffset += 7;
             }
-            mutex.ReleaseMutex();
-            //Console.WriteLine(BitConverter.ToString(sendBuffer));
-        }
-
-        if (weaponSwapEvents.Count > 0)
-        {
-            // Weapon swap event
-            mutex.WaitOne();
-            sendBuffer[weaponOffset] = Convert.ToByte(weaponSwapEvents.Count);
-            weaponOffset++;
-
-            while (weaponSwapEvents.Count > 0)
-            {
-                Tuple<byte, int> weaponSwap = weaponSwapEvents.Pop();
-                sendBuffer[weaponOffset] = weaponSwap.Item1;
-                Array.Copy(BitConverter.GetBytes(weaponSwap.Item2), 0, sendBuffer, weaponOffset + 1, 4);
-                weaponOffset += 5;
-            }
-            mutex.ReleaseMutex();
         }
+        host.Dispose();
+        log.Stop();
     }
 
-
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		recvThreadFunction
+    -- FUNCTION:    requestedMatches
     --
-    -- DATE: 			Feb 18, 2018
+    -- DATE:        Oct 19, 2026
     --
     -- REVISIONS:
     --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER: 	    Benny Wang, Tim Bruecker, Haley Booker
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:	 	private static void recvThreadFunction()
+    -- INTERFACE:   private static Int32 requestedMatches()
     --
-    -- RETURNS: 		void
+    -- RETURNS:     The number of matches named by MATCH_COUNT, 1 to R.Net.MAX_MATCHES.
     --
     -- NOTES:
-    -- Receives all incoming data from all clients. Checks to confirm the amount of data
-    -- is accurate.
+    -- Defaults to one match, as the server has always run.
     -------------------------------------------------------------------------------------------------*/
-    private static void recvThreadFunction()
+    private static Int32 requestedMatches()
     {
-        Console.WriteLine("Starting Receive Function");
-
-        try
-        {
-            while (running)
-            {
-                // if (isTick())
-                // {
-                    // Receive from up to 30 clients per tick
-                    for (int i = 0; i < R.Net.MAX_PLAYERS; i++)
-                    {
-                        // If there is not data continue
-                        if (!server.Poll())
-                        {
-                            continue;
-                        }
-
-                        // Prepare to receive
-                        EndPoint ep = new EndPoint();
-                        byte[] recvBuffer = new byte[R.Net.Size.CLIENT_TICK];
-
-                        // Receive
-                        int n = server.Recv(ref ep, recvBuffer, R.Net.Size.CLIENT_TICK);
-
-                        // If invalid amount of data was received discard and continue
-                        if (n != R.Net.Size.CLIENT_TICK)
-                        {
-                            LogError("Server received an invalid amount of data.");
-                            continue;
-                        }
-
-                        // Handle incoming data if it is correct
-                        handleBuffer(recvBuffer, ep);
-                    }
-                // }
-            }
-        }
-        catch (Exception e)
+        Int32 count;
+        if (Int32.TryParse(Environment.GetEnvironmentVariable("MATCH_COUNT"), out count) && count > 0)
         {
-            LogError("Receive Thread Exception");
-            LogError(e.ToString());
+            return Math.Min(count, R.Net.MAX_MATCHES);
         }
-
-        return;
+        return 1;
     }
 
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		handleBuffer
+    -- FUNCTION:    requestedWorkers
     --
-    -- DATE: 			Feb 18, 2018
+    -- DATE:        Oct 19, 2026
     --
     -- REVISIONS:
     --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER: 	    Benny Wang
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:	 	private static void handleBuffer(byte[] inBuffer, EndPoint ep)
-    --				        byte[] inBuffer: The buffer of recieved data
-    --				        EndPoint ep: The end point of who sent the data
+    -- INTERFACE:   private static Int32 requestedWorkers()
     --
-    -- RETURNS: 		void
+    -- RETURNS:     The number of tick workers named by MATCH_WORKERS, or 0 for one per core.
     --
     -- NOTES:
-    -- Checks to see if the data recieved is from a new or existing client.
+    -- Each worker runs one match's tick at a time, so more workers than matches are never busy.
     -------------------------------------------------------------------------------------------------*/
-    private static void handleBuffer(byte[] inBuffer, EndPoint ep)
+    private static Int32 requestedWorkers()
     {
-        switch (inBuffer[0])
+        Int32 workers;
+        if (Int32.TryParse(Environment.GetEnvironmentVariable("MATCH_WORKERS"), out workers) && workers > 0)
         {
-            case R.Net.Header.ACK:
-                LogError("ACK from " + ep.ToString());
-                addNewPlayer(ep);
-                break;
-
-            case R.Net.Header.TICK:
-                updateExistingPlayer(ref inBuffer);
-                break;
-
-            default:
-                LogError("Server received a valid amount of data but the header is incorrect.");
-                break;
+            return workers;
         }
+        return 0;
     }
 
-
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		updateExistingPlayer
+    -- FUNCTION:    requestedEngine
     --
-    -- DATE: 			Feb 18, 2018
+    -- DATE:        Oct 19, 2026
     --
-    -- REVISIONS:
+    -- REVISIONS:   Oct 19, 2026 - Also read by each match for its TCP server
     --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER: 	    Benny Wang, Haley Booker
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:	 	private static void updateExistingPlayer(ref byte[] inBuffer)
-    --				        byte[] inBuffer: The buffer of recieved data
+    -- INTERFACE:   internal static Int32 requestedEngine()
     --
-    -- RETURNS: 		void
+    -- RETURNS:     The transport engine named by NETWORK_ENGINE.
     --
     -- NOTES:
-    -- Updates the coordinates of a player and handles bullets or weapons switching.
+    -- NETWORK_ENGINE may be "uring", "epoll" or "poll" and defaults to "uring". The native
+    -- library falls back to epoll on its own when io_uring is not available.
     -------------------------------------------------------------------------------------------------*/
-    private static void updateExistingPlayer(ref byte[] inBuffer)
+    internal static Int32 requestedEngine()
     {
-        byte id = inBuffer[R.Net.Offset.PID];
-        float x = BitConverter.ToSingle(inBuffer, R.Net.Offset.X);
-        float z = BitConverter.ToSingle(inBuffer, R.Net.Offset.Z);
-        float r = BitConverter.ToSingle(inBuffer, R.Net.Offset.R);
-
-        int weaponId = BitConverter.ToInt32(inBuffer, R.Net.Offset.WEAPON_ID);
-        byte weaponType = inBuffer[R.Net.Offset.WEAPON_TYPE];
-        handleIncomingWeapon(id, weaponId, weaponType);
-
-        int bulletId = BitConverter.ToInt32(inBuffer, R.Net.Offset.BULLET_ID);
-        byte bulletType = inBuffer[R.Net.Offset.BULLET_TYPE];
-        handleIncomingBullet(id, bulletId, bulletType);
-
-        mutex.WaitOne();
-        if (players[id].IsDead())
+        string name = Environment.GetEnvironmentVariable("NETWORK_ENGINE");
+        if (name == "poll")
         {
-            deadPlayers.Add(id);
+            return Networking.Server.ENGINE_POLL;
         }
-
-        players[id].x = x; //crashing here
-        players[id].z = z;
-        players[id].r = r;
-
-        mutex.ReleaseMutex();
+        if (name == "epoll")
+        {
+            return Networking.Server.ENGINE_EPOLL;
+        }
+        return Networking.Server.ENGINE_URING;
     }
 
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		handleIncomingBullet
+    -- FUNCTION:    requestedPacing
     --
-    -- DATE: 			Feb 18, 2018
+    -- DATE:        Oct 19, 2026
     --
     -- REVISIONS:
     --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER: 	    Benny Wang
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:	 	private static void handleIncomingBullet(byte playerId, int bulletId, byte bulletType)
-    --				        byte playerId: The id of the player
-    --				        int bulletId: The id of the bullet
-    --				        byte bulletType: The type of bullet
+    -- INTERFACE:   private static Int32 requestedPacing()
     --
-    -- RETURNS: 		void
+    -- RETURNS:     The send pacing mode named by SEND_PACING.
     --
     -- NOTES:
-    -- Creates a new bullet and adds it to the bullet array.
+    -- SEND_PACING may be "txtime", which needs the fq qdisc on the interface, or "wheel"; anything
+    -- else leaves pacing off and each tick's snapshots go out as one batch.
     -------------------------------------------------------------------------------------------------*/
-    private static void handleIncomingBullet(byte playerId, int bulletId, byte bulletType)
+    private static Int32 requestedPacing()
     {
-        if (bulletType != 0)
+        string name = Environment.GetEnvironmentVariable("SEND_PACING");
+        if (name == "txtime")
         {
-            Player player = players[playerId];
-            Bullet bullet = new Bullet(bulletId, bulletType, player);
-            bullet.Event = R.Game.Bullet.ADD;
-            mutex.WaitOne();
-            newBullets.Push(bullet);
-            bullets[bulletId] = bullet;
-            mutex.ReleaseMutex();
+            return Networking.Server.PACING_TXTIME;
         }
-    }
-
-/*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		handleIncomingWeapon
-    --
-    -- DATE: 			Feb 18, 2018
-    --
-    -- REVISIONS:
-    --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker
-    --
-    -- PROGRAMMER: 	    Benny Wang
-    --
-    -- INTERFACE:	 	private static void handleIncomingWeapon(byte playerId, int weaponId, byte weaponType)
-    --				        byte playerId: The id of the player
-    --				        int weaponId: The id of the weapon
-    --				        byte weaponType: The type of weapon
-    --
-    -- RETURNS: 		void
-    --
-    -- NOTES:
-    -- Handles a player picking up a weapon and updating the player’s inventory.
-    -------------------------------------------------------------------------------------------------*/
-    private static void handleIncomingWeapon(byte playerId, int weaponId, byte weaponType)
-    {
-        if (weaponId != 0)
+        if (name == "wheel")
         {
-            mutex.WaitOne();
-            if (players[playerId].currentWeaponId == weaponId)
-            {
-                mutex.ReleaseMutex();
-                return;
-            }
-
-            players[playerId].currentWeaponId = weaponId;
-            players[playerId].currentWeaponType = weaponType;
-
-            weaponSwapEvents.Push(Tuple.Create(playerId, weaponId));
-            mutex.ReleaseMutex();
-
-            Console.WriteLine("Player {0} changed weapon to -> Weapon: ID - {1}, Type - {2}", playerId, weaponId, weaponType);
+            return Networking.Server.PACING_WHEEL;
         }
+        return Networking.Server.PACING_OFF;
     }
 
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		addNewPlayer
+    -- FUNCTION:    listenPort
     --
-    -- DATE: 			Feb 18, 2018
+    -- DATE:        Oct 19, 2026
     --
-    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
-    -- 				    Mar 30, 2018 - Implemented better spawn points
+    -- REVISIONS:   Oct 19, 2026 - Shared by every match's UDP, the first of their TCP ports
     --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER: 	    Benny Wang, Haley Booker
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:	 	private static void addNewPlayer(EndPoint ep)
-    --				        EndPoint ep: The end point of a new connection
+    -- INTERFACE:   private static ushort listenPort()
     --
-    -- RETURNS: 		void
+    -- RETURNS:     The port named by SERVER_PORT, or R.Net.PORT.
     --
     -- NOTES:
-    -- Creates a new player and adds it to the player array.
+    -- Several processes behind one front proxy each need a port of their own. Within a process
+    -- every match shares the UDP socket on this port, and match i takes TCP init connections on
+    -- this port plus i.
     -------------------------------------------------------------------------------------------------*/
-    private static void addNewPlayer(EndPoint ep)
+    private static ushort listenPort()
     {
-        List<float> spawnPoint = spawnPointGenerator.GetNextSpawnPoint();
-        Player newPlayer = new Player(ep, nextPlayerId, spawnPoint[0], spawnPoint[1]);
-
-        mutex.WaitOne();
-        nextPlayerId++;
-        players[newPlayer.id] = newPlayer;
-        mutex.ReleaseMutex();
-
-        sendInitPacket(newPlayer);
+        ushort port;
+        if (ushort.TryParse(Environment.GetEnvironmentVariable("SERVER_PORT"), out port) && port != 0)
+        {
+            return port;
+        }
+        return R.Net.PORT;
     }
 
-
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		sendInitPacket
+    -- FUNCTION:    joinUpstream
     --
-    -- DATE: 			Feb 18, 2018
+    -- DATE:        Oct 19, 2026
     --
-    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
+    -- REVISIONS:
     --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker, Haley Booker
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER: 	    Haley Booker
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:	 	private static void sendInitPacket(Player newPlayer)
-    --				        Player newPlayer: The new player to be sent
+    -- INTERFACE:   private static void joinUpstream()
     --
-    -- RETURNS: 		void
+    -- RETURNS:     void
     --
     -- NOTES:
-    -- Sends an initial packet to client on connection. The packet contains the client’s
-    -- player id.
+    -- PROXY_UPSTREAM is the front proxy's internal address as ip:port. With it set, every game
+    -- datagram goes through the proxy and players are still seen at their own addresses. The
+    -- proxy maps a player to a match by the token in its ACK join; see frontproxy.cpp.
     -------------------------------------------------------------------------------------------------*/
-    private static void sendInitPacket(Player newPlayer)
+    private static void joinUpstream()
     {
-        byte[] buffer = new byte[R.Net.Size.SERVER_TICK];
-
-        buffer[0] = R.Net.Header.INIT_PLAYER;
-        buffer[1] = newPlayer.id;
-        int offset = 2;
+        string upstream = Environment.GetEnvironmentVariable("PROXY_UPSTREAM");
+        if (string.IsNullOrEmpty(upstream))
+        {
+            return;
+        }
 
-        // sets the coordinates for the new player
-        Array.Copy(BitConverter.GetBytes(newPlayer.x), 0, buffer, offset, 4);
-        Array.Copy(BitConverter.GetBytes(newPlayer.z), 0, buffer, offset + 4, 4);
+        int colon = upstream.LastIndexOf(':');
+        ushort port;
+        if (colon <= 0 || !ushort.TryParse(upstream.Substring(colon + 1), out port))
+        {
+            LogError("Ignoring PROXY_UPSTREAM " + upstream + ", expected ip:port");
+            return;
+        }
 
-        server.Send(newPlayer.ep, buffer, buffer.Length);
+        server.SetUpstream(new EndPoint(upstream.Substring(0, colon), port));
+        Console.WriteLine("Behind front proxy " + upstream);
     }
 
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:    initTCPServer
+    -- FUNCTION:    loadTuningProfile
     --
-    -- DATE:        Mar. 28, 2018
+    -- DATE:        Oct 19, 2026
     --
     -- REVISIONS:
     --
-    -- DESIGNER:    Benny Wang
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER:  Benny Wang
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:   private static void initTCPServer()
+    -- INTERFACE:   private static void loadTuningProfile()
     --
     -- RETURNS:     void
     --
-    -- NOTES: 
-    -- This function is called to initialize a TCPServer object which handles TCP connections.
-    -- After creating the TCPServer object, it creates a thread which executes listenThreadFunc
-    -- and joins on the thread's termination.
-    -------------------------------------------------------------------------------------------------*/
-    private static void initTCPServer()
-    {
-        tcpServer = new TCPServer();
-        tcpServer.Init(R.Net.PORT, R.Net.TIMEOUT);
-        listenThread = new Thread(listenThreadFunc);
-        listenThread.Start();
-        listenThread.Join();
-    }
-
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION: 		generateInitData
-    --
-    -- DATE: 			Feb 18, 2018
-    --
-    -- REVISIONS:		Mar 27, 2018 - Refactored offsets for new packets
-    --
-    -- DESIGNER: 		Benny Wang, Tim Bruecker
-    --
-    -- PROGRAMMER: 	    Benny Wang
-    --				    Roger Zhang
-    -- 				    Alfred Swinton
-    --
-    -- INTERFACE:	 	private static void generateInitData()
-    --
-    -- RETURNS: 		void
-    --
     -- NOTES:
-    -- This function generates the valid initialization for the terrain and weapons.
-    -------------------------------------------------------------------------------------------------*/
-    private static void generateInitData()
-    {
-        dangerZone = new DangerZone();
-
-        InitRandomGuns getItems = new InitRandomGuns(R.Net.MAX_PLAYERS);
-        itemData = getItems.compressedpcktarray;
-
-        while (!tc.GenerateEncoding()) ;
-        int terrainDataLength = tc.CompressedData.Length;
-        Array.Copy(tc.CompressedData, 0, mapData, 0, terrainDataLength);
-    }
-
-    /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:    listenThreadFunc
-    --
-    -- DATE:        Mar. 28, 2018
-    --              
-    -- REVISIONS:   Apr. 9, 2018
-    --                  - Added timeout to listen loop, hard coded to 30s
-    --              Apr. 11, 2018
-    --                  - Modified timeout to accept a value passed down from
-    --                    R.Net.TIMEOUT
-    --
-    -- DESIGNER:    Wilson Hu, Angus Lam, Benny Wang
-    --
-    -- PROGRAMMER:  Wilson Hu, Angus Lam, Benny Wang
-    --
-    -- INTERFACE:   private static void listenThreadFunc()
-    --
-    -- RETURNS:     void
-    --
-    -- NOTES: 
-    -- This thread function performs a listen loop that continuously accepts up to 
-    -- 30 clients. 
-    -- 
-    -- It calls the game generation function upon timing out or receiving the max
-    -- number of clients. 
-    -- 
-    -- It then creates n threads to handle transmitting game initialization data to each
-    -- connected client, and joining on each thread's termination.
+    -- TUNING_PROFILE names a profile file, see tuning.profile for an example. Without one every
+    -- thread and socket keeps the system defaults. Each thread applies its own section when it
+    -- starts and logs what took effect.
     -------------------------------------------------------------------------------------------------*/
-    private static void listenThreadFunc()
+    private static void loadTuningProfile()
     {
-        Int32 clientsockfd;
-        accepting = true;
-		Networking.EndPoint ep = new Networking.EndPoint();
-
-        // Accept loop, accepts incoming client requests if there are <30 clients or loop is broken
-        while (accepting && numClients < R.Net.MAX_PLAYERS)
+        tuning = new Tuning();
+        string path = Environment.GetEnvironmentVariable("TUNING_PROFILE");
+        if (path == null)
         {
-			clientsockfd = tcpServer.AcceptConnection(ref ep);
-
-            // Breaks loop only if there are >1 clients and AcceptConnection call times out
-            if (clientsockfd == R.Net.TIMEOUT_ERRNO && numClients > 1)
-            {
-                LogError("Accept timeout: Breaking out of listen loop");
-                accepting = false;
-            }
-            // If AcceptConnection call returns an error
-            if (clientsockfd <= 0)
-            {
-                LogError("Accept error: " + clientsockfd);
-            }
-            // AcceptConnection call passes
-            else
-            {
-                clientSockFdArr[numClients] = clientsockfd;
-                LogError("Connected client: " + ep.ToString()); //Add toString() for EndPoint
-                numClients++;
-            }
-        }
-
-        // Generate game initialization data - weapon spawns & map data
-        generateInitData();
-
-        // Intialize and start transmit threads
-        for (int i = 0; i < numClients; i++)
-        {
-            transmitThreadArr[i] = new Thread(transmitThreadFunc);
-            transmitThreadArr[i].Start(clientSockFdArr[i]);
-        }
-
-        // Join each transmitThread
-        foreach (Thread t in transmitThreadArr)
-        {
-            if (t != null)
-            {
-                t.Join();
-            }
+            return;
         }
-
-        LogError("All threads joined, Starting game");
+        Console.WriteLine("Tuning profile " + path + ": " + tuning.Load(path) + " settings");
     }
 
     /*-------------------------------------------------------------------------------------------------
-    -- FUNCTION:    transmitThreadFunc
+    -- FUNCTION:    initIngressFilter
     --
-    -- DATE:        Mar. 28, 2018
+    -- DATE:        Oct 19, 2026
     --
     -- REVISIONS:
     --
-    -- DESIGNER:    Wilson Hu, Angus Lam, Benny Wang
+    -- DESIGNER:    agent
     --
-    -- PROGRAMMER:  Angus Lam, Wilson Hu, Benny Wang
+    -- PROGRAMMER:  agent
     --
-    -- INTERFACE:   private static void transmitThreadFunc(object clientsockfd)
-    --                  object clientsockfd: a socket descriptor value which is cast to an Int32
-                                             within the function
+    -- INTERFACE:   private static void initIngressFilter()
     --
     -- RETURNS:     void
     --
-    -- NOTES: 
-    -- This thread function sends the game initialization data to its input client socket descriptor.
+    -- NOTES:
+    -- Joins (ACK) are accepted from anyone at any tick size. Ticks must come from a player's
+    -- registered endpoint and carry that player's id, at the current, the pre-clock or the pre-ack
+    -- size, as must keepalives and disconnects.
     -------------------------------------------------------------------------------------------------*/
-    private static void transmitThreadFunc(object clientsockfd)
+    private static void initIngressFilter()
     {
-        Int32 numSentMap;
-        Int32 numSentItem;
-        Int32 sockfd = (Int32)clientsockfd;
-
-        // Send item spawn data to the client
-        numSentItem = tcpServer.Send(sockfd, itemData, R.Net.TCP_BUFFER_SIZE);
-        LogError("Num Item Bytes Sent: " + numSentItem);
-
-        // Send map data to the client
-        numSentMap = tcpServer.Send(sockfd, mapData, R.Net.TCP_BUFFER_SIZE);
-        LogError("Num Map Bytes Sent: " + numSentMap);
+        ingress = new IngressFilter();
+        ingress.Allow(R.Net.Header.ACK, R.Net.Size.CLIENT_TICK, IngressFilter.ANY_SOURCE);
+        ingress.Allow(R.Net.Header.ACK, R.Net.Size.CLIENT_TICK_NO_CLOCK, IngressFilter.ANY_SOURCE);
+        ingress.Allow(R.Net.Header.ACK, R.Net.Size.CLIENT_TICK_NO_ACK, IngressFilter.ANY_SOURCE);
+        ingress.Allow(R.Net.Header.TICK, R.Net.Size.CLIENT_TICK, R.Net.Offset.PID);
+        ingress.Allow(R.Net.Header.TICK, R.Net.Size.CLIENT_TICK_NO_CLOCK, R.Net.Offset.PID);
+        ingress.Allow(R.Net.Header.TICK, R.Net.Size.CLIENT_TICK_NO_ACK, R.Net.Offset.PID);
+        ingress.Allow(R.Net.Header.KEEP_ALIVE, R.Net.Size.KEEP_ALIVE, R.Net.Offset.PID);
+        ingress.Allow(R.Net.Header.DISCONNECT, R.Net.Size.KEEP_ALIVE, R.Net.Offset.PID);
+        ingress.SetRates(R.Net.INGRESS_RATE, R.Net.INGRESS_BURST, R.Net.INGRESS_UNKNOWN_RATE, R.Net.INGRESS_UNKNOWN_BURST);
+        server.SetFilter(ingress);
+    }
 
-        // Close client TCP socket
-        tcpServer.CloseClientSocket(sockfd);
+    private static void reportIngress()
+    {
+        IngressStats stats = ingress.GetStats();
+        if (stats.Rejected == ingressRejected)
+        {
+            return;
+        }
+        ingressRejected = stats.Rejected;
+        LogError("Ingress: accepted " + stats.Accepted + ", bad header " + stats.BadHeader + ", bad size " + stats.BadSize +
+                 ", unknown source " + stats.UnknownSource + ", bad id " + stats.BadId + ", rate limited " + stats.RateLimited);
     }
 
     /*-------------------------------------------------------------------------------------------------
@@ -1020,7 +496,7 @@ class Server
     --
     -- DATE: 			Feb 18, 2018
     --
-    -- REVISIONS:		
+    -- REVISIONS:		Oct 19, 2026 - Queues to the native asynchronous log
     --
     -- DESIGNER: 		Benny Wang
     --
@@ -1031,10 +507,11 @@ class Server
     -- RETURNS: 		void
     --
     -- NOTES:
-    -- Prints a message to the screen with the timestamp prepended to the message.
+    -- Queues a message for the log writer thread, which prints it with the timestamp prepended.
+    -- Never blocks the calling thread; a message that cannot be queued is counted and dropped.
     -------------------------------------------------------------------------------------------------*/
     private static void LogError(String s)
     {
-        Console.WriteLine(DateTime.Now + " - " + s);
+        log.Write(s);
     }
 }
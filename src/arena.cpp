@@ -0,0 +1,195 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	arena.cpp -   Bump allocator backing a single match's world state
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		Arena();
+--					int32_t initialize(size_t capacity);
+--					void *allocate(size_t size, size_t align);
+--					void reset();
+--					void release();
+--					size_t used();
+--					size_t capacity();
+--					char *base();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: release() unmaps the arena when its match is destroyed
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Each hosted match owns one arena. Everything the match needs for its world state is
+--		carved out of a single page-aligned mapping, so tearing a match down is a reset of the
+--		offset rather than a walk over individual allocations, and matches never share cache
+--		lines with one another.
+---------------------------------------------------------------------------------------*/
+#include "arena.h"
+
+Arena::Arena()
+{
+	memory = 0;
+	size = 0;
+	offset = 0;
+}
+
+Arena::~Arena()
+{
+	release();
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: initialize
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t initialize(size_t capacity)
+--								capacity: number of bytes to reserve, rounded up to a whole page
+--
+-- RETURNS: 0 on success, or -1 if the mapping could not be created.
+--
+-- NOTES:
+-- 		Reserves the backing memory with an anonymous mapping. The pages are zero filled by the kernel so a
+--		freshly allocated block never carries another match's state. A mapping the arena already holds is
+--		released first.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Arena::initialize(size_t capacity)
+{
+	release();
+
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	size = (capacity + page - 1) & ~(page - 1);
+
+	void *mapping = mmap(0, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mapping == MAP_FAILED)
+	{
+		perror("arena mmap failed");
+		memory = 0;
+		size = 0;
+		return -1;
+	}
+
+	memory = (char *)mapping;
+	offset = 0;
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: allocate
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void *allocate(size_t size, size_t align)
+--								size: number of bytes requested
+--								align: required alignment, must be a power of two (0 uses the default)
+--
+-- RETURNS: a pointer into the arena, or NULL if the arena is exhausted.
+--
+-- NOTES:
+-- 		Allocation is a pointer bump. Memory is only given back all at once by reset().
+--------------------------------------------------------------------------------------------------------------*/
+void *Arena::allocate(size_t bytes, size_t align)
+{
+	if (align == 0)
+	{
+		align = ARENA_DEFAULT_ALIGN;
+	}
+
+	size_t start = (offset + align - 1) & ~(align - 1);
+	if (memory == 0 || start + bytes > size)
+	{
+		return 0;
+	}
+
+	offset = start + bytes;
+	return memory + start;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: reset
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void reset()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Releases every allocation at once and zeroes the used region so the next match starts clean.
+--------------------------------------------------------------------------------------------------------------*/
+void Arena::reset()
+{
+	if (memory)
+	{
+		memset(memory, 0, offset);
+	}
+	offset = 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: release
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void release()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Unmaps the backing memory. The arena is empty afterwards until initialize is called again.
+--------------------------------------------------------------------------------------------------------------*/
+void Arena::release()
+{
+	if (memory)
+	{
+		munmap(memory, size);
+	}
+	memory = 0;
+	size = 0;
+	offset = 0;
+}
+
+size_t Arena::used()
+{
+	return offset;
+}
+
+size_t Arena::capacity()
+{
+	return size;
+}
+
+char *Arena::base()
+{
+	return memory;
+}
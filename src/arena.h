@@ -0,0 +1,33 @@
+#ifndef ARENA_DEF
+#define ARENA_DEF
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define ARENA_DEFAULT_ALIGN		16
+
+class Arena
+{
+  public:
+	Arena();
+	~Arena();
+	int32_t initialize(size_t capacity);
+	void *allocate(size_t size, size_t align);
+	void reset();
+	void release();
+	size_t used();
+	size_t capacity();
+	char *base();
+
+  private:
+	char *memory;
+	size_t size;
+	size_t offset;
+};
+
+#endif
@@ -0,0 +1,556 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	asynclog.cpp -   Lock-free per-thread log rings drained by a background writer
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		AsyncLog();
+--					int32_t start(int fd);
+--					int32_t addTemplate(const char *format);
+--					int32_t write(const uint16_t *text, uint32_t len);
+--					int32_t event(int32_t id, int64_t a0, int64_t a1, int64_t a2, int64_t a3);
+--					void getStats(LogStats *stats);
+--					void stop();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Every thread that logs gets a ring of its own the first time it does, so a log call is a
+--		clock read, a copy into the thread's next slot and a release store; there is no lock and
+--		no system call. The writer thread is the only consumer. It merges the rings by timestamp,
+--		does all of the formatting, and hands the text to write(2) in large batches.
+--
+--		There are two kinds of record. write() copies a message that is already text. event()
+--		stores the id of a template added with addTemplate() and up to four integers, and the
+--		writer fills the template's {} placeholders with them later; a hot path using an event
+--		never builds a string at all.
+--
+--		Nothing here waits. A record that finds its thread's ring full is dropped, and a message
+--		repeated more than LOG_RATE_BURST times in a window is suppressed; both are counted, and
+--		the writer reports the counts in the log itself about once a second while they change.
+--		The log must outlive every thread that writes to it.
+---------------------------------------------------------------------------------------*/
+#include "asynclog.h"
+
+// Ring claimed by the calling thread, released to the writer when the thread exits
+struct ThreadRing {
+	const void *owner;
+	std::atomic<bool> *owned;
+	void *ring;
+
+	~ThreadRing()
+	{
+		if (owned != 0)
+		{
+			owned->store(false, std::memory_order_release);
+		}
+	}
+};
+
+static thread_local ThreadRing threadRing = { 0, 0, 0 };
+
+static uint64_t realNow()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_REALTIME, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+AsyncLog::AsyncLog()
+{
+	rings = new Ring[LOG_RINGS];
+	for (uint32_t i = 0; i < LOG_RINGS; i++)
+	{
+		rings[i].claimed.store(false);
+		rings[i].owned.store(false);
+		rings[i].head.store(0);
+		rings[i].tail.store(0);
+	}
+	for (uint32_t i = 0; i < LOG_RATE_SLOTS; i++)
+	{
+		rates[i].window.store(0);
+		rates[i].count.store(0);
+	}
+	dropped.store(0);
+	suppressed.store(0);
+	written.store(0);
+	reportedDropped = 0;
+	reportedSuppressed = 0;
+	lastReportNs = 0;
+	templateCount.store(0);
+	fd = -1;
+	outLen = 0;
+	running.store(false);
+}
+
+AsyncLog::~AsyncLog()
+{
+	stop();
+	if (threadRing.owner == this)
+	{
+		threadRing.owner = 0;
+		threadRing.owned = 0;
+		threadRing.ring = 0;
+	}
+	delete[] rings;
+}
+
+int32_t AsyncLog::start(int out)
+{
+	if (running.load())
+	{
+		return -1;
+	}
+	fd = out;
+	running.store(true);
+	writer = std::thread(&AsyncLog::writerLoop, this);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: addTemplate
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t addTemplate(const char *format)
+--								format: message text, with {} wherever an event argument goes
+--
+-- RETURNS: The template id to pass to event(), starting at 1.
+--
+-- NOTES:
+-- 		Takes a lock; add templates at startup, not from the hot path.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t AsyncLog::addTemplate(const char *format)
+{
+	std::lock_guard<std::mutex> guard(templateLock);
+	templates.push_back(format);
+	int32_t id = (int32_t)templates.size();
+	templateCount.store(id, std::memory_order_release);
+	return id;
+}
+
+AsyncLog::Ring *AsyncLog::ringForThread()
+{
+	if (threadRing.owner == this)
+	{
+		return (Ring *)threadRing.ring;
+	}
+
+	for (uint32_t i = 0; i < LOG_RINGS; i++)
+	{
+		bool expected = false;
+		if (!rings[i].claimed.load(std::memory_order_relaxed) && rings[i].claimed.compare_exchange_strong(expected, true, std::memory_order_acquire))
+		{
+			rings[i].owned.store(true, std::memory_order_relaxed);
+			threadRing.owner = this;
+			threadRing.owned = &rings[i].owned;
+			threadRing.ring = &rings[i];
+			return &rings[i];
+		}
+	}
+	return 0;
+}
+
+// Counts the message against its bucket for the current window; true once it is over the burst
+bool AsyncLog::limited(uint64_t key, uint64_t nowNs)
+{
+	RateSlot &slot = rates[(key >> 32 ^ key) & (LOG_RATE_SLOTS - 1)];
+	uint64_t window = nowNs >> LOG_RATE_WINDOW_SHIFT;
+	uint64_t seen = slot.window.load(std::memory_order_relaxed);
+
+	if (seen != window && slot.window.compare_exchange_strong(seen, window, std::memory_order_relaxed))
+	{
+		slot.count.store(0, std::memory_order_relaxed);
+	}
+	return slot.count.fetch_add(1, std::memory_order_relaxed) >= LOG_RATE_BURST;
+}
+
+AsyncLog::Record *AsyncLog::reserve(uint64_t key, uint64_t *realNs, Ring **ring)
+{
+	if (!running.load(std::memory_order_relaxed))
+	{
+		return 0;
+	}
+
+	*realNs = realNow();
+	if (limited(key, *realNs))
+	{
+		suppressed.fetch_add(1, std::memory_order_relaxed);
+		return 0;
+	}
+
+	*ring = ringForThread();
+	if (*ring == 0)
+	{
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return 0;
+	}
+
+	uint32_t h = (*ring)->head.load(std::memory_order_relaxed);
+	if (h - (*ring)->tail.load(std::memory_order_acquire) >= LOG_SLOTS)
+	{
+		dropped.fetch_add(1, std::memory_order_relaxed);
+		return 0;
+	}
+	return &(*ring)->slots[h & (LOG_SLOTS - 1)];
+}
+
+void AsyncLog::commit(Ring *ring)
+{
+	ring->head.store(ring->head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: write
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t write(const uint16_t *text, uint32_t len)
+--								text: UTF-16 message, as managed strings hold it
+--								len: its length in characters
+--
+-- RETURNS: 0 if the message was queued, or -1 if it was suppressed or dropped.
+--
+-- NOTES:
+-- 		The text is converted to UTF-8 straight into the ring slot and cut at LOG_TEXT bytes.
+--		Identical messages share a rate limit bucket.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t AsyncLog::write(const uint16_t *text, uint32_t len)
+{
+	uint64_t hash = 0xCBF29CE484222325ull;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		hash = (hash ^ text[i]) * 0x100000001B3ull;
+	}
+
+	uint64_t realNs;
+	Ring *ring;
+	Record *record = reserve(hash, &realNs, &ring);
+	if (record == 0)
+	{
+		return -1;
+	}
+
+	uint32_t n = 0;
+	for (uint32_t i = 0; i < len; i++)
+	{
+		uint32_t c = text[i];
+		if (c >= 0xD800 && c < 0xE000)
+		{
+			c = '?';
+		}
+
+		if (c < 0x80 && n + 1 <= LOG_TEXT)
+		{
+			record->text[n++] = (char)c;
+		}
+		else if (c < 0x800 && n + 2 <= LOG_TEXT)
+		{
+			record->text[n++] = (char)(0xC0 | c >> 6);
+			record->text[n++] = (char)(0x80 | (c & 0x3F));
+		}
+		else if (c >= 0x800 && n + 3 <= LOG_TEXT)
+		{
+			record->text[n++] = (char)(0xE0 | c >> 12);
+			record->text[n++] = (char)(0x80 | (c >> 6 & 0x3F));
+			record->text[n++] = (char)(0x80 | (c & 0x3F));
+		}
+		else
+		{
+			break;
+		}
+	}
+
+	record->realNs = realNs;
+	record->templateId = 0;
+	record->len = (uint16_t)n;
+	commit(ring);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: event
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t event(int32_t id, int64_t a0, int64_t a1, int64_t a2, int64_t a3)
+--								id: a template from addTemplate()
+--								a0 - a3: values for its placeholders, in order; unused ones are ignored
+--
+-- RETURNS: 0 if the event was queued, or -1 if the id is unknown or it was suppressed or dropped.
+--
+-- NOTES:
+-- 		Formatting happens on the writer thread. Events of one template share a rate limit bucket,
+--		whatever their arguments.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t AsyncLog::event(int32_t id, int64_t a0, int64_t a1, int64_t a2, int64_t a3)
+{
+	if (id <= 0 || id > templateCount.load(std::memory_order_acquire))
+	{
+		return -1;
+	}
+
+	uint64_t realNs;
+	Ring *ring;
+	Record *record = reserve((uint64_t)id * 0x9E3779B97F4A7C15ull, &realNs, &ring);
+	if (record == 0)
+	{
+		return -1;
+	}
+
+	record->realNs = realNs;
+	record->templateId = id;
+	record->len = 0;
+	record->args[0] = a0;
+	record->args[1] = a1;
+	record->args[2] = a2;
+	record->args[3] = a3;
+	commit(ring);
+	return 0;
+}
+
+void AsyncLog::writerLoop()
+{
+	while (true)
+	{
+		bool busy = drain();
+		report(realNow());
+		output();
+
+		if (!busy)
+		{
+			if (!running.load())
+			{
+				break;
+			}
+			std::unique_lock<std::mutex> guard(wakeLock);
+			wake.wait_for(guard, std::chrono::milliseconds(LOG_WAIT_MS));
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: drain
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool drain()
+--
+-- RETURNS: true if any record was formatted.
+--
+-- NOTES:
+-- 		Writer thread only. Emits the oldest record at the head of any ring until the rings are
+--		empty or a ring's worth has gone out, so the stats report is never starved. Rings whose
+--		threads have exited are released once they are empty.
+--------------------------------------------------------------------------------------------------------------*/
+bool AsyncLog::drain()
+{
+	uint32_t count = 0;
+	while (count < LOG_SLOTS)
+	{
+		Ring *oldest = 0;
+		uint64_t oldestNs = 0;
+
+		for (uint32_t i = 0; i < LOG_RINGS; i++)
+		{
+			Ring &ring = rings[i];
+			if (!ring.claimed.load(std::memory_order_acquire))
+			{
+				continue;
+			}
+
+			bool owned = ring.owned.load(std::memory_order_acquire);
+			uint32_t t = ring.tail.load(std::memory_order_relaxed);
+			if (t == ring.head.load(std::memory_order_acquire))
+			{
+				if (!owned)
+				{
+					ring.claimed.store(false, std::memory_order_release);
+				}
+				continue;
+			}
+
+			uint64_t ns = ring.slots[t & (LOG_SLOTS - 1)].realNs;
+			if (oldest == 0 || ns < oldestNs)
+			{
+				oldest = &ring;
+				oldestNs = ns;
+			}
+		}
+
+		if (oldest == 0)
+		{
+			break;
+		}
+
+		uint32_t t = oldest->tail.load(std::memory_order_relaxed);
+		emit(oldest->slots[t & (LOG_SLOTS - 1)]);
+		oldest->tail.store(t + 1, std::memory_order_release);
+		count++;
+	}
+
+	written.fetch_add(count, std::memory_order_relaxed);
+	return count > 0;
+}
+
+// Appends one line to the output buffer: the timestamp, then the text or the filled template
+void AsyncLog::emit(const Record &record)
+{
+	if (outLen + LOG_LINE_MAX > LOG_OUTPUT_SIZE)
+	{
+		output();
+	}
+
+	char *line = out + outLen;
+	uint32_t n = 0;
+
+	time_t seconds = (time_t)(record.realNs / 1000000000ull);
+	struct tm local;
+	localtime_r(&seconds, &local);
+	n += strftime(line, 32, "%Y-%m-%d %H:%M:%S", &local);
+	n += snprintf(line + n, 16, ".%03u - ", (uint32_t)(record.realNs / 1000000ull % 1000));
+
+	if (record.templateId == 0)
+	{
+		memcpy(line + n, record.text, record.len);
+		n += record.len;
+	}
+	else
+	{
+		std::lock_guard<std::mutex> guard(templateLock);
+		const std::string &format = templates[record.templateId - 1];
+		uint32_t arg = 0;
+		for (size_t i = 0; i < format.size() && n < LOG_LINE_MAX - 32; i++)
+		{
+			if (format[i] == '{' && i + 1 < format.size() && format[i + 1] == '}' && arg < LOG_ARGS)
+			{
+				n += snprintf(line + n, 24, "%lld", (long long)record.args[arg++]);
+				i++;
+			}
+			else
+			{
+				line[n++] = format[i];
+			}
+		}
+	}
+
+	line[n++] = '\n';
+	outLen += n;
+}
+
+// Logs the drop and suppression counts when they have changed, at most once a window
+void AsyncLog::report(uint64_t nowNs)
+{
+	if ((nowNs >> LOG_RATE_WINDOW_SHIFT) == (lastReportNs >> LOG_RATE_WINDOW_SHIFT))
+	{
+		return;
+	}
+
+	uint64_t d = dropped.load(std::memory_order_relaxed);
+	uint64_t s = suppressed.load(std::memory_order_relaxed);
+	if (d == reportedDropped && s == reportedSuppressed)
+	{
+		return;
+	}
+
+	Record record;
+	record.realNs = nowNs;
+	record.templateId = 0;
+	int len = snprintf(record.text, LOG_TEXT, "log: %llu messages dropped on full rings, %llu repeats suppressed",
+		(unsigned long long)(d - reportedDropped), (unsigned long long)(s - reportedSuppressed));
+	record.len = (uint16_t)(len < LOG_TEXT ? len : LOG_TEXT - 1);
+	emit(record);
+
+	reportedDropped = d;
+	reportedSuppressed = s;
+	lastReportNs = nowNs;
+}
+
+void AsyncLog::output()
+{
+	uint32_t done = 0;
+	while (done < outLen)
+	{
+		ssize_t n = ::write(fd, out + done, outLen - done);
+		if (n <= 0)
+		{
+			break;
+		}
+		done += (uint32_t)n;
+	}
+	outLen = 0;
+}
+
+void AsyncLog::getStats(LogStats *stats)
+{
+	stats->written = written.load(std::memory_order_relaxed);
+	stats->dropped = dropped.load(std::memory_order_relaxed);
+	stats->suppressed = suppressed.load(std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: stop
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void stop()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Writes out everything already queued, then joins the writer. Later calls are dropped.
+--------------------------------------------------------------------------------------------------------------*/
+void AsyncLog::stop()
+{
+	if (!running.load())
+	{
+		return;
+	}
+
+	running.store(false);
+	wake.notify_one();
+	if (writer.joinable())
+	{
+		writer.join();
+	}
+}
@@ -0,0 +1,100 @@
+#ifndef ASYNCLOG_DEF
+#define ASYNCLOG_DEF
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#define LOG_RINGS					64			// producing threads with a ring at once
+#define LOG_SLOTS					256			// records per ring, power of two
+#define LOG_TEXT					200			// bytes of text kept per record, longer text is cut
+#define LOG_ARGS					4			// integer arguments per templated record
+#define LOG_RATE_SLOTS				1024		// rate limit buckets, indexed by message hash
+#define LOG_RATE_BURST				10			// identical messages let through per window
+#define LOG_RATE_WINDOW_SHIFT		30			// window of 2^30 ns, about a second
+#define LOG_WAIT_MS					10
+#define LOG_OUTPUT_SIZE				65536
+#define LOG_LINE_MAX				1024		// longest formatted line, template text included
+
+struct LogStats {
+	uint64_t written;
+	uint64_t dropped;							// ring was full
+	uint64_t suppressed;						// over the repeat limit
+};
+
+class AsyncLog
+{
+  public:
+	AsyncLog();
+	~AsyncLog();
+	int32_t start(int fd);
+	int32_t addTemplate(const char *format);
+	int32_t write(const uint16_t *text, uint32_t len);
+	int32_t event(int32_t id, int64_t a0, int64_t a1, int64_t a2, int64_t a3);
+	void getStats(LogStats *stats);
+	void stop();
+
+  private:
+	struct Record {
+		uint64_t realNs;
+		int32_t templateId;						// 0 for plain text
+		uint16_t len;
+		int64_t args[LOG_ARGS];
+		char text[LOG_TEXT];
+	};
+
+	struct Ring {
+		std::atomic<bool> claimed;
+		std::atomic<bool> owned;				// cleared when the owning thread exits
+		std::atomic<uint32_t> head;
+		std::atomic<uint32_t> tail;
+		Record slots[LOG_SLOTS];
+	};
+
+	struct RateSlot {
+		std::atomic<uint64_t> window;
+		std::atomic<uint32_t> count;
+	};
+
+	Ring *ringForThread();
+	Record *reserve(uint64_t key, uint64_t *realNs, Ring **ring);
+	void commit(Ring *ring);
+	bool limited(uint64_t key, uint64_t nowNs);
+	void writerLoop();
+	bool drain();
+	void emit(const Record &record);
+	void report(uint64_t nowNs);
+	void output();
+
+	Ring *rings;
+	RateSlot rates[LOG_RATE_SLOTS];
+	std::atomic<uint64_t> dropped;
+	std::atomic<uint64_t> suppressed;
+	std::atomic<uint64_t> written;
+	uint64_t reportedDropped;
+	uint64_t reportedSuppressed;
+	uint64_t lastReportNs;
+
+	std::mutex templateLock;
+	std::vector<std::string> templates;
+	std::atomic<int32_t> templateCount;
+
+	int fd;
+	char out[LOG_OUTPUT_SIZE];
+	uint32_t outLen;
+
+	std::atomic<bool> running;
+	std::thread writer;
+	std::mutex wakeLock;
+	std::condition_variable wake;
+};
+
+#endif
@@ -0,0 +1,291 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	broadcast.cpp -   Shared memory ring carrying each tick's snapshot to relays
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		BroadcastRing();
+--					int32_t create(const char *name, uint32_t slots, uint32_t slotSize);
+--					int32_t open(const char *name);
+--					int32_t publish(uint32_t tick, const char *data, uint32_t len);
+--					int32_t read(uint64_t index, uint32_t *tick, char *out, uint32_t size);
+--					uint64_t head();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The match server publishes every tick's encoded snapshot once into a POSIX shared memory
+--		object; spectator relays, in their own processes, map the same object read only and
+--		fan the snapshots out. However many spectators there are, the match pays for one copy.
+--
+--		The object is a header and a ring of fixed-size slots. Publishing never waits on a
+--		reader: each slot is a sequence lock, its sequence odd while the snapshot is being
+--		written and even once it is done, and then the head count moves on. A reader copies a
+--		slot out and checks its sequence before and after; a reader that was lapped by the
+--		publisher sees the sequence change and is told so instead of getting a torn snapshot.
+---------------------------------------------------------------------------------------*/
+#include "broadcast.h"
+
+BroadcastRing::BroadcastRing()
+{
+	header = 0;
+	map = 0;
+	mapSize = 0;
+	stride = 0;
+	owner = false;
+	name[0] = '\0';
+}
+
+BroadcastRing::~BroadcastRing()
+{
+	release();
+}
+
+void BroadcastRing::release()
+{
+	if (map != 0)
+	{
+		munmap(map, mapSize);
+	}
+	if (owner)
+	{
+		shm_unlink(name);
+	}
+	header = 0;
+	map = 0;
+	owner = false;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: create
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t create(const char *name, uint32_t slots, uint32_t slotSize)
+--								name: the shared memory object, "/" followed by up to 62 characters
+--								slots: snapshots kept, how far a relay may fall behind before it is lapped
+--								slotSize: largest snapshot that can be published
+--
+-- RETURNS: 0 on success, or -1 if the sizes are out of range or the object could not be made.
+--
+-- NOTES:
+-- 		For the publisher. An object left by a match that did not exit cleanly is replaced. The object
+--		is unlinked again when the ring is destroyed; relays that still have it mapped keep reading
+--		the last snapshots until they notice the head no longer moves.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BroadcastRing::create(const char *ringName, uint32_t slots, uint32_t size)
+{
+	if (map != 0 || slots == 0 || slots > BROADCAST_MAX_SLOTS || size == 0 || size > BROADCAST_MAX_SLOT_SIZE
+		|| strlen(ringName) >= sizeof(name))
+	{
+		return -1;
+	}
+
+	stride = (sizeof(Slot) + size + 63) & ~(size_t)63;
+	mapSize = sizeof(Header) + stride * slots;
+
+	shm_unlink(ringName);
+	int fd = shm_open(ringName, O_CREAT | O_EXCL | O_RDWR, 0644);
+	if (fd < 0)
+	{
+		perror("broadcast shm_open failed");
+		return -1;
+	}
+	if (ftruncate(fd, mapSize) != 0)
+	{
+		perror("broadcast ftruncate failed");
+		close(fd);
+		shm_unlink(ringName);
+		return -1;
+	}
+
+	map = (char *)mmap(0, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+	{
+		perror("broadcast mmap failed");
+		map = 0;
+		shm_unlink(ringName);
+		return -1;
+	}
+
+	strcpy(name, ringName);
+	owner = true;
+
+	// ftruncate() zero filled the object, so every slot starts at sequence 0, never written
+	header = (Header *)map;
+	header->slots = slots;
+	header->slotSize = size;
+	header->version = BROADCAST_VERSION;
+	header->head.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	header->magic = BROADCAST_MAGIC;
+	return 0;
+}
+
+// For a relay: maps a ring made by create(), read only
+int32_t BroadcastRing::open(const char *ringName)
+{
+	if (map != 0)
+	{
+		return -1;
+	}
+
+	int fd = shm_open(ringName, O_RDONLY, 0);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	struct stat info;
+	if (fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(Header))
+	{
+		close(fd);
+		return -1;
+	}
+
+	map = (char *)mmap(0, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+	{
+		map = 0;
+		return -1;
+	}
+	mapSize = info.st_size;
+	header = (Header *)map;
+
+	stride = (sizeof(Slot) + header->slotSize + 63) & ~(size_t)63;
+	if (header->magic != BROADCAST_MAGIC || header->version != BROADCAST_VERSION
+		|| sizeof(Header) + stride * header->slots > mapSize)
+	{
+		release();
+		return -1;
+	}
+	return 0;
+}
+
+BroadcastRing::Slot *BroadcastRing::slotAt(uint64_t index)
+{
+	return (Slot *)(map + sizeof(Header) + stride * (index % header->slots));
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: publish
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t publish(uint32_t tick, const char *data, uint32_t len)
+--								tick: the snapshot's tick, handed to readers with it
+--								data, len: the snapshot as it goes on the wire
+--
+-- RETURNS: len, or -1 if the ring was not created here or the snapshot is empty or does not fit a slot.
+--
+-- NOTES:
+-- 		One copy into the next slot, whatever the relays are doing. Only one thread may publish.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BroadcastRing::publish(uint32_t tick, const char *data, uint32_t len)
+{
+	if (!owner || len == 0 || len > header->slotSize)
+	{
+		return -1;
+	}
+
+	uint64_t index = header->head.load(std::memory_order_relaxed);
+	Slot *slot = slotAt(index);
+
+	slot->seq.store(2 * index + 1, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slot->tick = tick;
+	slot->len = len;
+	memcpy((char *)(slot + 1), data, len);
+	slot->seq.store(2 * index + 2, std::memory_order_release);
+
+	header->head.store(index + 1, std::memory_order_release);
+	return len;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: read
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t read(uint64_t index, uint32_t *tick, char *out, uint32_t size)
+--								index: which snapshot, counting from 0, below head()
+--								tick: set to the snapshot's tick
+--								out, size: receives the snapshot
+--
+-- RETURNS: the snapshot's length, BROADCAST_NOT_READY if it has not been published yet, or BROADCAST_LAPPED
+--			if the publisher has already reused its slot, or BROADCAST_TOO_LARGE if it does not fit in out.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BroadcastRing::read(uint64_t index, uint32_t *tick, char *out, uint32_t size)
+{
+	if (index >= header->head.load(std::memory_order_acquire))
+	{
+		return BROADCAST_NOT_READY;
+	}
+
+	Slot *slot = slotAt(index);
+	uint64_t before = slot->seq.load(std::memory_order_acquire);
+	if (before != 2 * index + 2)
+	{
+		return BROADCAST_LAPPED;
+	}
+
+	uint32_t len = slot->len;
+	uint32_t at = slot->tick;
+	if (len > size || len > header->slotSize)
+	{
+		return BROADCAST_TOO_LARGE;
+	}
+	memcpy(out, (const char *)(slot + 1), len);
+
+	std::atomic_thread_fence(std::memory_order_acquire);
+	if (slot->seq.load(std::memory_order_relaxed) != before)
+	{
+		return BROADCAST_LAPPED;
+	}
+
+	*tick = at;
+	return (int32_t)len;
+}
+
+uint64_t BroadcastRing::head()
+{
+	return header == 0 ? 0 : header->head.load(std::memory_order_acquire);
+}
+
+uint32_t BroadcastRing::slotCount()
+{
+	return header == 0 ? 0 : header->slots;
+}
+
+uint32_t BroadcastRing::slotSize()
+{
+	return header == 0 ? 0 : header->slotSize;
+}
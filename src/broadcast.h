@@ -0,0 +1,61 @@
+#ifndef BROADCAST_DEF
+#define BROADCAST_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <atomic>
+
+#define BROADCAST_MAGIC				0x54534342	// "BCST"
+#define BROADCAST_VERSION			1
+#define BROADCAST_MAX_SLOTS			65536
+#define BROADCAST_MAX_SLOT_SIZE		65536
+#define BROADCAST_NOT_READY			0			// read(): nothing published at that index yet
+#define BROADCAST_LAPPED			-1			// read(): overwritten before it could be copied
+#define BROADCAST_TOO_LARGE			-2			// read(): larger than the buffer given
+
+class BroadcastRing
+{
+  public:
+	BroadcastRing();
+	~BroadcastRing();
+	int32_t create(const char *name, uint32_t slots, uint32_t slotSize);
+	int32_t open(const char *name);
+	int32_t publish(uint32_t tick, const char *data, uint32_t len);
+	int32_t read(uint64_t index, uint32_t *tick, char *out, uint32_t size);
+	uint64_t head();
+	uint32_t slotCount();
+	uint32_t slotSize();
+
+  private:
+	// At the start of the mapping, followed by the slots
+	struct Header {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t slots;
+		uint32_t slotSize;
+		std::atomic<uint64_t> head;				// snapshots published so far
+	};
+
+	struct Slot {
+		std::atomic<uint64_t> seq;				// 2 * index + 1 while being written, 2 * index + 2 once done
+		uint32_t tick;
+		uint32_t len;
+	};
+
+	Slot *slotAt(uint64_t index);
+	void release();
+
+	Header *header;
+	char *map;
+	size_t mapSize;
+	size_t stride;
+	bool owner;
+	char name[64];
+};
+
+#endif
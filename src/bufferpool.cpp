@@ -0,0 +1,236 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	bufferpool.cpp -   Fixed-size packet buffers shared with managed code by handle
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		BufferPool();
+--					int32_t initialize(uint32_t bufferSize, uint32_t count, uint32_t flags);
+--					int32_t lease();
+--					int32_t release(int32_t handle);
+--					char *address(int32_t handle);
+--					uint32_t bufferSize();
+--					uint32_t count();
+--					uint32_t available();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The game loop used to allocate a managed array for every datagram it received and every
+--		snapshot it sent, and pin each one for the length of the native call. The pool replaces
+--		that with one page-aligned slab carved into fixed-size, cache-line aligned buffers that
+--		never move. Managed code leases a buffer by handle, works on it through a pointer and hands
+--		the handle straight to the send and receive exports, so steady-state play allocates
+--		nothing on the managed heap.
+--
+--		Free buffers are kept on a lock-free stack. The head carries a generation count next to
+--		the index so a lease racing with a release and re-lease of the same buffer cannot pop a
+--		stale link.
+---------------------------------------------------------------------------------------*/
+#include "bufferpool.h"
+
+BufferPool::BufferPool()
+{
+	slab = 0;
+	slabSize = 0;
+	stride = 0;
+	size = 0;
+	buffers = 0;
+	next = 0;
+	head = (uint64_t)(uint32_t)BUFFERPOOL_NONE;
+	freeCount = 0;
+}
+
+BufferPool::~BufferPool()
+{
+	unmap();
+}
+
+void BufferPool::unmap()
+{
+	if (slab)
+	{
+		munmap(slab, slabSize);
+		slab = 0;
+	}
+	delete[] next;
+	next = 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: initialize
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t initialize(uint32_t bufferSize, uint32_t count, uint32_t flags)
+--								bufferSize: usable bytes in each buffer
+--								count: number of buffers in the pool
+--								flags: BUFFERPOOL_HUGEPAGES and/or BUFFERPOOL_LOCKED
+--
+-- RETURNS: 0 on success, or -1 if the slab could not be mapped.
+--
+-- NOTES:
+-- 		With BUFFERPOOL_HUGEPAGES the slab is first requested from the hugetlb pool; when none are reserved
+--		it falls back to normal pages and asks for transparent huge pages instead. BUFFERPOOL_LOCKED is best
+--		effort, since an unprivileged process may be over its memlock limit.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BufferPool::initialize(uint32_t bufferSize, uint32_t count, uint32_t flags)
+{
+	unmap();
+
+	size = bufferSize;
+	buffers = count;
+	stride = (bufferSize + BUFFERPOOL_ALIGN - 1) & ~(BUFFERPOOL_ALIGN - 1);
+
+	size_t page = (size_t)sysconf(_SC_PAGESIZE);
+	size_t bytes = (size_t)stride * count;
+	void *mapping = MAP_FAILED;
+
+	if (flags & BUFFERPOOL_HUGEPAGES)
+	{
+		slabSize = (bytes + BUFFERPOOL_HUGEPAGE_SIZE - 1) & ~((size_t)BUFFERPOOL_HUGEPAGE_SIZE - 1);
+		mapping = mmap(0, slabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+	}
+	if (mapping == MAP_FAILED)
+	{
+		slabSize = (bytes + page - 1) & ~(page - 1);
+		mapping = mmap(0, slabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapping == MAP_FAILED)
+		{
+			perror("buffer pool mmap failed");
+			slabSize = 0;
+			return -1;
+		}
+		if (flags & BUFFERPOOL_HUGEPAGES)
+		{
+			madvise(mapping, slabSize, MADV_HUGEPAGE);
+		}
+	}
+	slab = (char *)mapping;
+
+	if ((flags & BUFFERPOOL_LOCKED) && mlock(slab, slabSize) == -1)
+	{
+		perror("buffer pool mlock failed");
+	}
+
+	next = new std::atomic<uint32_t>[count];
+	for (uint32_t i = 0; i < count; i++)
+	{
+		next[i] = (i + 1 < count) ? i + 1 : (uint32_t)BUFFERPOOL_NONE;
+	}
+	head = count > 0 ? 0 : (uint64_t)(uint32_t)BUFFERPOOL_NONE;
+	freeCount = count;
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: lease
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t lease()
+--
+-- RETURNS: the handle of a free buffer, or BUFFERPOOL_NONE if every buffer is leased.
+--
+-- NOTES:
+-- 		Safe to call from any number of threads. The buffer keeps whatever its previous holder wrote.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BufferPool::lease()
+{
+	uint64_t current = head.load(std::memory_order_acquire);
+
+	while (true)
+	{
+		uint32_t index = (uint32_t)current;
+		if (index == (uint32_t)BUFFERPOOL_NONE)
+		{
+			return BUFFERPOOL_NONE;
+		}
+
+		uint64_t replacement = ((current >> 32) + 1) << 32 | next[index].load(std::memory_order_relaxed);
+		if (head.compare_exchange_weak(current, replacement, std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			freeCount.fetch_sub(1, std::memory_order_relaxed);
+			return (int32_t)index;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: release
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t release(int32_t handle)
+--								handle: a handle returned by lease()
+--
+-- RETURNS: 0 on success, or -1 if the handle does not belong to the pool.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BufferPool::release(int32_t handle)
+{
+	if (handle < 0 || (uint32_t)handle >= buffers)
+	{
+		return -1;
+	}
+
+	uint64_t current = head.load(std::memory_order_acquire);
+	uint64_t replacement;
+	do
+	{
+		next[handle].store((uint32_t)current, std::memory_order_relaxed);
+		replacement = ((current >> 32) + 1) << 32 | (uint32_t)handle;
+	} while (!head.compare_exchange_weak(current, replacement, std::memory_order_acq_rel, std::memory_order_acquire));
+
+	freeCount.fetch_add(1, std::memory_order_relaxed);
+	return 0;
+}
+
+char *BufferPool::address(int32_t handle)
+{
+	if (slab == 0 || handle < 0 || (uint32_t)handle >= buffers)
+	{
+		return 0;
+	}
+	return slab + (size_t)handle * stride;
+}
+
+uint32_t BufferPool::bufferSize()
+{
+	return size;
+}
+
+uint32_t BufferPool::count()
+{
+	return buffers;
+}
+
+uint32_t BufferPool::available()
+{
+	return freeCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,45 @@
+#ifndef BUFFERPOOL_DEF
+#define BUFFERPOOL_DEF
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <atomic>
+
+#define BUFFERPOOL_NONE				-1
+#define BUFFERPOOL_HUGEPAGES		1			// back the slab with huge pages when the system allows it
+#define BUFFERPOOL_LOCKED			2			// mlock the slab so leased buffers never fault
+#define BUFFERPOOL_ALIGN			64
+#define BUFFERPOOL_HUGEPAGE_SIZE	(2 * 1024 * 1024)
+
+class BufferPool
+{
+  public:
+	BufferPool();
+	~BufferPool();
+	int32_t initialize(uint32_t bufferSize, uint32_t count, uint32_t flags);
+	int32_t lease();
+	int32_t release(int32_t handle);
+	char *address(int32_t handle);
+	uint32_t bufferSize();
+	uint32_t count();
+	uint32_t available();
+
+  private:
+	void unmap();
+
+	char *slab;
+	size_t slabSize;
+	uint32_t stride;
+	uint32_t size;
+	uint32_t buffers;
+	std::atomic<uint32_t> *next;
+	std::atomic<uint64_t> head;			// generation in the high word, free index in the low word
+	std::atomic<uint32_t> freeCount;
+};
+
+#endif
@@ -8,6 +8,10 @@
 --					int32_t sendBytes(char * data, uint32_t len);
 --					int32_t receiveBytes(char * buffer, uint32_t size);
 --					int32_t UdpPollSocket();
+--					int32_t recvLatest(char * buffer, uint32_t size, char * events, uint32_t eventsSize,
+--									   uint32_t * eventsLen);
+--					int32_t sendTick(char * data, uint32_t len);
+--					void getReassemblyStats(ReassemblyStats * stats);
 --		
 --	DATE:			February 27th, 2018
 --
@@ -15,6 +19,13 @@
 --						Delan Elliot: switched to select
 --					March 14th, 2018
 --						Delan Elliot: switched back to poll
+--					October 19th, 2026
+--						agent: batched drain-to-latest snapshot receive
+--						agent: snapshot acknowledgements for the server's rate control
+--						agent: packed snapshots are expanded on receive
+--						agent: fragmented messages are reassembled on receive, wide snapshots
+--						agent: clock fields on the client tick for the server's clock sync
+--						agent: staging slots sized to the widest snapshot, undecodable snapshots dropped
 --                  
 --
 --	DESIGNERS:		Delan Elliot, Wilson Hu, Jeff Chou, Jeremy Lee, Matthew Shew, Calvin Lai, William Murphy
@@ -25,15 +36,44 @@
 --		This class provides UDP client functionality. Receive is blocking, but it also provides a
 --		non-blocking Poll method to check for waiting datagrams so that receive only gets called
 --		when necessary. 
+--
+--		recvLatest drains everything waiting on the socket with recvmmsg and hands back only the
+--		newest tick snapshot, so a client that hitched does not replay stale state. Datagrams that
+--		are read but not consumed stay staged and are served first by every receive call.
+--
+--		Every snapshot that passes through a receive call, skipped or not, is recorded so sendTick
+--		can acknowledge it.
+--
+--		Packed snapshots (see snapcodec.cpp) are expanded into the fixed tick layout as they are
+--		received, so callers always see the fixed or wide layout whichever form the server sent.
+--
+--		Datagrams starting with FRAG_HEADER are fragments of a larger message (see fragment.cpp).
+--		They go to the client's Reassembler as they are read; the fragment that completes a message
+--		is replaced by the whole message and the rest are passed over, so a snapshot too big for one
+--		datagram reaches every receive call as if it had arrived whole. Staging slots are
+--		TICK_WIDE_MAX_SIZE bytes so the widest snapshot is reassembled and expanded in place; a
+--		packed snapshot that still does not decode is dropped rather than handed on packed.
 --		
 ---------------------------------------------------------------------------------------*/
 
 #include "client.h"
 
+static uint64_t nowUs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
 
 
 Client::Client()
 {
+	stagedCount = 0;
+	stagedIndex = 0;
+	seenSeq = false;
+	ackSeq = 0;
+	ackBits = 0;
+	ackReceivedUs = 0;
 }
 
 
@@ -129,6 +169,7 @@ int32_t Client::sendBytes(char * data, unsigned len)
 -- DATE: March 7th 2018
 --
 -- REVISIONS:
+--		October 19th, 2026: packed snapshots that do not decode are skipped - agent
 --
 -- DESIGNER: Delan Elliot, Matthew Shew, Calvin Lai, Jeff Chou, Wilson Hu, Jeremy Lee
 --
@@ -142,11 +183,39 @@ int32_t Client::sendBytes(char * data, unsigned len)
 --
 -- NOTES:
 -- 		Receives datagram of max size "size". The address of the client that sent the datagram is saved into the 
---		EndPoint referenced by addr. 
+--		EndPoint referenced by addr. Fragments are reassembled before returning, so this blocks until a
+--		fragmented message is complete. A packed snapshot that does not decode into size bytes is skipped
+--		the same way.
 --------------------------------------------------------------------------------------------------------------*/
 int32_t Client::receiveBytes(char * buffer, uint32_t size)
 {
-	int32_t bytesRead = recv(clientSocket, buffer, size, 0);
+	while (stagedIndex < stagedCount && msgs[stagedIndex].msg_len == 0)
+	{
+		stagedIndex++;
+	}
+
+	if (stagedIndex < stagedCount)
+	{
+		uint32_t len = msgs[stagedIndex].msg_len < size ? msgs[stagedIndex].msg_len : size;
+		memcpy(buffer, staging + stagedIndex * CLIENT_SLOT_SIZE, len);
+		noteSnapshot(staging + stagedIndex * CLIENT_SLOT_SIZE, msgs[stagedIndex].msg_len);
+		stagedIndex++;
+		return len;
+	}
+
+	int32_t bytesRead;
+	while ((bytesRead = recv(clientSocket, buffer, size, 0)) > 0)
+	{
+		if ((uint8_t)buffer[0] == FRAG_HEADER && (bytesRead = assemble(buffer, bytesRead, size)) == 0)
+		{
+			continue;
+		}
+		if ((bytesRead = expand(buffer, bytesRead, size)) > 0)
+		{
+			noteSnapshot(buffer, bytesRead);
+			break;
+		}
+	}
 
 	return bytesRead;
 }
@@ -173,12 +242,17 @@ int32_t Client::receiveBytes(char * buffer, uint32_t size)
 --------------------------------------------------------------------------------------------------------------*/
 int32_t Client::UdpPollSocket()
 {
+	if (stagedIndex < stagedCount)
+	{
+		return SOCKET_DATA_WAITING;
+	}
+
 	int numfds = 1;
 	struct pollfd pollfds;
 	pollfds.fd = clientSocket;
 	pollfds.events = POLLIN;
 
-	int retVal = poll(&pollfds, numfds, 0);
+	poll(&pollfds, numfds, 0);
 
 	if(pollfds.revents & POLLIN)
 	{
@@ -188,3 +262,365 @@ int32_t Client::UdpPollSocket()
 }
 
 
+
+// The init packet is sent at snapshot size too; only a tick header always carries the players flag.
+static bool isTick(const char * datagram, uint32_t len)
+{
+	TickLayout layout;
+	return tickLayout(datagram, len, &layout) == 0 && layout.size == len;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: recvLatest
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: a snapshot too big for buffer no longer repeats the events of the one before - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t recvLatest(char * buffer, uint32_t size, char * events, uint32_t eventsSize, uint32_t * eventsLen)
+--								buffer: receives the newest datagram, at least TICK_SIZE bytes, or
+--										TICK_WIDE_MAX_SIZE to take any wide snapshot
+--								size: size of buffer
+--								events: receives the event sections of every snapshot that was skipped
+--								eventsSize: size of events
+--								eventsLen: set to the number of bytes written to events
+--
+-- RETURNS: the length of the datagram in buffer, 0 if nothing was waiting, or -1 if buffer is too small for
+--			TICK_SIZE or for the snapshot that was next, which is then dropped.
+--
+-- NOTES:
+-- 		Never blocks. Consecutive tick snapshots are collapsed into the newest one. The bullet and weapon
+--		sections of each snapshot passed over are appended to events in arrival order as
+--		[type][count][records], so the caller still sees every event exactly once.
+--
+--		Any other datagram (the init packet, for one) is never skipped: it is returned on its own, and a
+--		run of snapshots stops in front of it. A run also stops early when events has no room for the next
+--		skipped snapshot's sections; the rest stays staged for the next call.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Client::recvLatest(char * buffer, uint32_t size, char * events, uint32_t eventsSize, uint32_t * eventsLen)
+{
+	int32_t latest = 0;
+	*eventsLen = 0;
+
+	if (size < TICK_SIZE)
+	{
+		return -1;
+	}
+
+	while (stagedIndex < stagedCount || refill())
+	{
+		char * datagram = staging + stagedIndex * CLIENT_SLOT_SIZE;
+		uint32_t len = msgs[stagedIndex].msg_len;
+
+		if (len == 0)
+		{
+			stagedIndex++;
+			continue;
+		}
+
+		if (!isTick(datagram, len))
+		{
+			if (latest > 0)
+			{
+				break;
+			}
+			len = len < size ? len : size;
+			memcpy(buffer, datagram, len);
+			stagedIndex++;
+			return len;
+		}
+
+		if (len > size)
+		{
+			if (latest > 0)
+			{
+				break;
+			}
+			stagedIndex++;
+			return -1;
+		}
+
+		if (latest > 0)
+		{
+			if (*eventsLen + eventBytes(buffer, latest) > eventsSize)
+			{
+				break;
+			}
+			appendEvents(buffer, latest, events, eventsLen);
+		}
+
+		memcpy(buffer, datagram, len);
+		noteSnapshot(datagram, len);
+		latest = len;
+		stagedIndex++;
+	}
+
+	return latest;
+}
+
+bool Client::refill()
+{
+	for (int32_t i = 0; i < CLIENT_BATCH; i++)
+	{
+		iovecs[i].iov_base = staging + i * CLIENT_SLOT_SIZE;
+		iovecs[i].iov_len = CLIENT_SLOT_SIZE;
+		memset(&msgs[i], 0, sizeof(struct mmsghdr));
+		msgs[i].msg_hdr.msg_iov = &iovecs[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	stagedIndex = 0;
+	stagedCount = recvmmsg(clientSocket, msgs, CLIENT_BATCH, MSG_DONTWAIT, 0);
+	if (stagedCount <= 0)
+	{
+		stagedCount = 0;
+		return false;
+	}
+
+	for (int32_t i = 0; i < stagedCount; i++)
+	{
+		char * datagram = staging + i * CLIENT_SLOT_SIZE;
+		int32_t len = msgs[i].msg_len;
+		if (len > 0 && (uint8_t)datagram[0] == FRAG_HEADER)
+		{
+			len = assemble(datagram, len, CLIENT_SLOT_SIZE);
+		}
+		msgs[i].msg_len = len > 0 ? expand(datagram, len, CLIENT_SLOT_SIZE) : 0;
+	}
+	return true;
+}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: eventBytes
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: wide snapshots
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t eventBytes(const char * snapshot, uint32_t len)
+--
+-- RETURNS: the number of bytes appendEvents will write for this snapshot.
+--
+-- NOTES:
+-- 		Record counts come from tickLayout(), which clamps them to the fixed layout or checks them against
+--		len, so a corrupt count can never read past the end of the datagram.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t Client::eventBytes(const char * snapshot, uint32_t len)
+{
+	TickLayout layout;
+	uint32_t bytes = 0;
+	uint8_t header = (uint8_t)snapshot[0];
+
+	if (tickLayout(snapshot, len, &layout) < 0)
+	{
+		return 0;
+	}
+	if (header & TICK_HAS_BULLETS)
+	{
+		bytes += 2 + layout.bullets * TICK_BULLET_SIZE;
+	}
+	if (header & TICK_HAS_WEAPONS)
+	{
+		bytes += 2 + layout.weapons * TICK_WEAPON_SIZE;
+	}
+	return bytes;
+}
+
+void Client::appendEvents(const char * snapshot, uint32_t len, char * events, uint32_t * eventsLen)
+{
+	TickLayout layout;
+	uint8_t header = (uint8_t)snapshot[0];
+
+	if (tickLayout(snapshot, len, &layout) < 0)
+	{
+		return;
+	}
+	if (header & TICK_HAS_BULLETS)
+	{
+		events[(*eventsLen)++] = TICK_EVENT_BULLETS;
+		events[(*eventsLen)++] = (char)layout.bullets;
+		memcpy(events + *eventsLen, snapshot + layout.bulletsAt + 1, layout.bullets * TICK_BULLET_SIZE);
+		*eventsLen += layout.bullets * TICK_BULLET_SIZE;
+	}
+	if (header & TICK_HAS_WEAPONS)
+	{
+		events[(*eventsLen)++] = TICK_EVENT_WEAPONS;
+		events[(*eventsLen)++] = (char)layout.weapons;
+		memcpy(events + *eventsLen, snapshot + layout.weaponsAt + 1, layout.weapons * TICK_WEAPON_SIZE);
+		*eventsLen += layout.weapons * TICK_WEAPON_SIZE;
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sendTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t sendTick(char * data, uint32_t len)
+--								data: the client tick packet, CLIENT_TICK_SIZE bytes
+--								len: length of data in bytes
+--
+-- RETURNS: the number of bytes sent, or -1 if there is an error.
+--
+-- NOTES:
+-- 		Writes the newest received snapshot sequence and the bitfield of the 32 before it into the ack fields
+--		of the packet, and the clock now and how long that snapshot has been held into the clock fields,
+--		then sends it like sendBytes. A packet too short for a set of fields goes without them.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Client::sendTick(char * data, uint32_t len)
+{
+	if (len >= CLIENT_TICK_NO_CLOCK)
+	{
+		memcpy(data + CLIENT_TICK_ACK, &ackSeq, sizeof(uint32_t));
+		memcpy(data + CLIENT_TICK_ACK_BITS, &ackBits, sizeof(uint32_t));
+	}
+	if (len >= CLIENT_TICK_SIZE)
+	{
+		uint64_t now = nowUs();
+		uint32_t clientTime = (uint32_t)now;
+		uint64_t held = seenSeq ? now - ackReceivedUs : 0;
+		uint32_t ackDelay = held > UINT32_MAX ? UINT32_MAX : (uint32_t)held;
+		memcpy(data + CLIENT_TICK_CLIENT_TIME, &clientTime, sizeof(uint32_t));
+		memcpy(data + CLIENT_TICK_ACK_DELAY, &ackDelay, sizeof(uint32_t));
+	}
+	return sendBytes(data, len);
+}
+
+void Client::noteSnapshot(const char * datagram, uint32_t len)
+{
+	TickLayout layout;
+	if (tickLayout(datagram, len, &layout) < 0 || layout.size != len)
+	{
+		return;
+	}
+
+	uint32_t seq;
+	memcpy(&seq, datagram + layout.seqAt, sizeof(uint32_t));
+
+	if (!seenSeq)
+	{
+		seenSeq = true;
+		ackSeq = seq;
+		ackBits = 0;
+		ackReceivedUs = nowUs();
+		return;
+	}
+
+	int32_t ahead = (int32_t)(seq - ackSeq);
+	if (ahead > 0)
+	{
+		// the previous newest becomes bit ahead - 1
+		ackBits = (ahead < 32 ? ackBits << ahead : 0) | (ahead <= 32 ? 1u << (ahead - 1) : 0);
+		ackSeq = seq;
+		ackReceivedUs = nowUs();
+	}
+	else if (ahead < 0 && -ahead <= 32)
+	{
+		ackBits |= 1u << (-ahead - 1);
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: expand
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: wide snapshots
+--		October 19th, 2026: undecodable snapshots are dropped - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t expand(char * datagram, int32_t len, uint32_t size)
+--								datagram: a received datagram, rewritten in place
+--								len: its length
+--								size: the space available at datagram
+--
+-- RETURNS: the new length of the datagram, or 0 if it was a packed snapshot that has to be dropped.
+--
+-- NOTES:
+-- 		A packed snapshot is replaced by the layout it was packed from. One that does not decode, or does not
+--		fit in size, is dropped: left packed it would reach the caller as a datagram that is not a tick.
+--		Anything else is left as it was.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Client::expand(char * datagram, int32_t len, uint32_t size)
+{
+	if (len < 2 || (uint8_t)datagram[0] != SNAP_PACKED)
+	{
+		return len;
+	}
+
+	int32_t expanded = snapUnpack(datagram, len, unpacked, sizeof(unpacked));
+	if (expanded < 0 || (uint32_t)expanded > size)
+	{
+		return 0;
+	}
+
+	memcpy(datagram, unpacked, expanded);
+	return expanded;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: assemble
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t assemble(char * datagram, int32_t len, uint32_t size)
+--								datagram: a received fragment, rewritten in place
+--								len: its length
+--								size: the space available at datagram
+--
+-- RETURNS: the length of the message now at datagram, or 0 if the fragment did not complete one.
+--
+-- NOTES:
+-- 		A completed message larger than size is dropped.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Client::assemble(char * datagram, int32_t len, uint32_t size)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint64_t now = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+
+	char * message;
+	int32_t whole = reassembly.add(datagram, len, now, &message);
+	if (whole <= 0 || (uint32_t)whole > size)
+	{
+		return 0;
+	}
+
+	memcpy(datagram, message, whole);
+	return whole;
+}
+
+void Client::getReassemblyStats(ReassemblyStats * stats)
+{
+	reassembly.getStats(stats);
+}
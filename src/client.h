@@ -9,7 +9,11 @@
 #include <poll.h>
 #include <iostream>
 #include <string.h>
+#include <time.h>
 #include "EndPoint.h"
+#include "tickpacket.h"
+#include "snapcodec.h"
+#include "fragment.h"
 #ifndef SOCK_NONBLOCK
 #include <fcntl.h>
 #define SOCK_NONBLOCK O_NONBLOCK
@@ -19,6 +23,9 @@
 #define SOCKET_NODATA 0
 #define SOCKET_DATA_WAITING 1
 
+#define CLIENT_BATCH 16
+#define CLIENT_SLOT_SIZE TICK_WIDE_MAX_SIZE		// any snapshot whole, reassembled and expanded in place
+
 
 
 
@@ -31,11 +38,34 @@ public:
 	int32_t sendBytes(char * data, uint32_t len);
 	int32_t receiveBytes(char * buffer, uint32_t size);
 	int32_t UdpPollSocket();
+	int32_t recvLatest(char * buffer, uint32_t size, char * events, uint32_t eventsSize, uint32_t * eventsLen);
+	int32_t sendTick(char * data, uint32_t len);
+	void getReassemblyStats(ReassemblyStats * stats);
 
 private:
+	bool refill();
+	uint32_t eventBytes(const char * snapshot, uint32_t len);
+	void appendEvents(const char * snapshot, uint32_t len, char * events, uint32_t * eventsLen);
+	void noteSnapshot(const char * datagram, uint32_t len);
+	int32_t expand(char * datagram, int32_t len, uint32_t size);
+	int32_t assemble(char * datagram, int32_t len, uint32_t size);
+
 	int clientSocket;
 	sockaddr_in serverAddr;
 
+	char staging[CLIENT_BATCH * CLIENT_SLOT_SIZE];
+	struct mmsghdr msgs[CLIENT_BATCH];
+	struct iovec iovecs[CLIENT_BATCH];
+	char unpacked[TICK_WIDE_MAX_SIZE];
+	Reassembler reassembly;
+	int32_t stagedCount;
+	int32_t stagedIndex;
+
+	bool seenSeq;
+	uint32_t ackSeq;
+	uint32_t ackBits;
+	uint64_t ackReceivedUs;
+
 };
 
 #endif
@@ -0,0 +1,416 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	compressor.cpp -   Chunked LZ compression of the pregame payloads
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		uint32_t compressBound(uint32_t len, uint32_t chunkSize);
+--					int32_t compressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize,
+--											uint32_t chunkSize, int32_t threads);
+--					int32_t decompressedSize(const char *src, uint32_t len);
+--					int32_t decompressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize,
+--											  int32_t threads);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The terrain grid is a million tiles that are almost all GROUND, and the weapon list is a few
+--		hundred fixed-size records. Both go through this codec instead of GZipStream.
+--
+--		The input is cut into fixed-size chunks that are compressed independently, one thread per
+--		core, so both ends can work on chunks in parallel. The stream is laid out as
+--
+--			[magic][raw length][chunk size][chunk count][end offset of each chunk][chunk data...]
+--
+--		all little endian uint32. Each chunk is a series of sequences
+--
+--			[varint literal count][literals][varint match length][varint match offset]
+--
+--		ending with a sequence whose match length is 0. A run of identical bytes is a match at
+--		offset 1, so a long stretch of GROUND costs a handful of bytes. Matches never reach
+--		back past the start of their chunk.
+---------------------------------------------------------------------------------------*/
+#include "compressor.h"
+
+static uint32_t readU32(const char *p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static void writeU32(char *p, uint32_t v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+static void putVarint(std::vector<char> &out, uint32_t value)
+{
+	while (value >= 0x80)
+	{
+		out.push_back((char)((value & 0x7F) | 0x80));
+		value >>= 7;
+	}
+	out.push_back((char)value);
+}
+
+// Returns false if the varint runs past end
+static bool getVarint(const uint8_t *&in, const uint8_t *end, uint32_t *value)
+{
+	*value = 0;
+	for (uint32_t shift = 0; shift < 35; shift += 7)
+	{
+		if (in >= end)
+		{
+			return false;
+		}
+		uint8_t group = *in++;
+		*value |= (uint32_t)(group & 0x7F) << shift;
+		if (!(group & 0x80))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+static uint32_t varintLen(uint32_t value)
+{
+	uint32_t n = 1;
+	while (value >= 0x80)
+	{
+		value >>= 7;
+		n++;
+	}
+	return n;
+}
+
+static uint32_t hash4(const uint8_t *p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return (v * 2654435761u) >> (32 - COMPRESS_HASH_BITS);
+}
+
+static void compressChunk(const uint8_t *src, uint32_t len, std::vector<char> &out)
+{
+	uint32_t table[1 << COMPRESS_HASH_BITS];
+	memset(table, 0xFF, sizeof(table));
+
+	uint32_t anchor = 0;
+	uint32_t i = 0;
+
+	while (i + COMPRESS_MIN_MATCH <= len)
+	{
+		uint32_t h = hash4(src + i);
+		uint32_t candidate = table[h];
+		table[h] = i;
+
+		if (candidate == 0xFFFFFFFF || memcmp(src + candidate, src + i, COMPRESS_MIN_MATCH) != 0)
+		{
+			i++;
+			continue;
+		}
+
+		uint32_t matchLen = COMPRESS_MIN_MATCH;
+		while (i + matchLen < len && src[candidate + matchLen] == src[i + matchLen])
+		{
+			matchLen++;
+		}
+
+		// A match splits the literal run in two; only take it if it pays for both headers, which is
+		// what keeps compressBound honest
+		if (matchLen < varintLen(matchLen) + varintLen(i - candidate) + varintLen(len))
+		{
+			i++;
+			continue;
+		}
+
+		putVarint(out, i - anchor);
+		out.insert(out.end(), src + anchor, src + i);
+		putVarint(out, matchLen);
+		putVarint(out, i - candidate);
+
+		i += matchLen;
+		anchor = i;
+	}
+
+	putVarint(out, len - anchor);
+	out.insert(out.end(), src + anchor, src + len);
+	putVarint(out, 0);
+}
+
+static bool decompressChunk(const uint8_t *in, const uint8_t *end, uint8_t *dst, uint32_t len)
+{
+	uint32_t pos = 0;
+
+	for (;;)
+	{
+		uint32_t literals, matchLen, offset;
+		if (!getVarint(in, end, &literals) || literals > (uint32_t)(end - in) || literals > len - pos)
+		{
+			return false;
+		}
+		memcpy(dst + pos, in, literals);
+		in += literals;
+		pos += literals;
+
+		if (!getVarint(in, end, &matchLen))
+		{
+			return false;
+		}
+		if (matchLen == 0)
+		{
+			return pos == len;
+		}
+		if (!getVarint(in, end, &offset) || offset == 0 || offset > pos || matchLen > len - pos)
+		{
+			return false;
+		}
+
+		// byte by byte, since a match may overlap its own output
+		for (uint32_t k = 0; k < matchLen; k++, pos++)
+		{
+			dst[pos] = dst[pos - offset];
+		}
+	}
+}
+
+static int32_t workerCount(int32_t threads, uint32_t chunks)
+{
+	if (threads <= 0)
+	{
+		threads = (int32_t)std::thread::hardware_concurrency();
+	}
+	if (threads <= 0)
+	{
+		threads = 1;
+	}
+	return (uint32_t)threads < chunks ? threads : (int32_t)chunks;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: compressBound
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t compressBound(uint32_t len, uint32_t chunkSize)
+--
+-- RETURNS: the largest output compressChunked can produce for len bytes in chunks of chunkSize.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t compressBound(uint32_t len, uint32_t chunkSize)
+{
+	if (chunkSize == 0)
+	{
+		chunkSize = COMPRESS_DEFAULT_CHUNK;
+	}
+	uint32_t chunks = (len + chunkSize - 1) / chunkSize;
+	return COMPRESS_HEADER + chunks * 4 + len + chunks * 6;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: compressChunked
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t compressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize,
+--									  uint32_t chunkSize, int32_t threads)
+--								src: data to compress
+--								len: length of src
+--								dst: receives the compressed stream
+--								dstSize: size of dst; compressBound(len, chunkSize) is always enough
+--								chunkSize: bytes of input per chunk, 0 for COMPRESS_DEFAULT_CHUNK
+--								threads: worker threads, <= 0 uses one per core
+--
+-- RETURNS: the length of the compressed stream, or -1 if dst is too small.
+--
+-- NOTES:
+-- 		Workers take chunks round robin. The output does not depend on the number of threads.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t compressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize, uint32_t chunkSize, int32_t threads)
+{
+	if (chunkSize == 0)
+	{
+		chunkSize = COMPRESS_DEFAULT_CHUNK;
+	}
+	uint32_t chunks = (len + chunkSize - 1) / chunkSize;
+	uint32_t tableEnd = COMPRESS_HEADER + chunks * 4;
+	if (dstSize < tableEnd)
+	{
+		return -1;
+	}
+
+	std::vector<std::vector<char> > outputs(chunks);
+	int32_t workers = workerCount(threads, chunks);
+
+	auto work = [&](int32_t worker) {
+		for (uint32_t c = worker; c < chunks; c += workers)
+		{
+			uint32_t start = c * chunkSize;
+			uint32_t size = len - start < chunkSize ? len - start : chunkSize;
+			outputs[c].reserve(size / 4 + 16);
+			compressChunk((const uint8_t *)src + start, size, outputs[c]);
+		}
+	};
+
+	std::vector<std::thread> pool;
+	for (int32_t w = 1; w < workers; w++)
+	{
+		pool.push_back(std::thread(work, w));
+	}
+	if (workers > 0)
+	{
+		work(0);
+	}
+	for (size_t w = 0; w < pool.size(); w++)
+	{
+		pool[w].join();
+	}
+
+	writeU32(dst, COMPRESS_MAGIC);
+	writeU32(dst + 4, len);
+	writeU32(dst + 8, chunkSize);
+	writeU32(dst + 12, chunks);
+
+	uint32_t offset = tableEnd;
+	for (uint32_t c = 0; c < chunks; c++)
+	{
+		if (outputs[c].size() > dstSize - offset)
+		{
+			return -1;
+		}
+		memcpy(dst + offset, outputs[c].data(), outputs[c].size());
+		offset += outputs[c].size();
+		writeU32(dst + COMPRESS_HEADER + c * 4, offset);
+	}
+	return (int32_t)offset;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: decompressedSize
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t decompressedSize(const char *src, uint32_t len)
+--
+-- RETURNS: the raw length recorded in a compressed stream, or -1 if src is not one.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t decompressedSize(const char *src, uint32_t len)
+{
+	if (len < COMPRESS_HEADER || readU32(src) != COMPRESS_MAGIC)
+	{
+		return -1;
+	}
+	return (int32_t)readU32(src + 4);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: decompressChunked
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t decompressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize,
+--										int32_t threads)
+--								src: a stream produced by compressChunked
+--								len: length of src
+--								dst: receives the raw data, at least decompressedSize(src, len) bytes
+--								dstSize: size of dst
+--								threads: worker threads, <= 0 uses one per core
+--
+-- RETURNS: the raw length, or -1 if the stream is malformed or dst is too small.
+--
+-- NOTES:
+-- 		Every read and every match is bounds checked, so a truncated or corrupt stream fails rather
+--		than writing outside dst.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t decompressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize, int32_t threads)
+{
+	if (decompressedSize(src, len) < 0)
+	{
+		return -1;
+	}
+
+	uint32_t raw = readU32(src + 4);
+	uint32_t chunkSize = readU32(src + 8);
+	uint32_t chunks = readU32(src + 12);
+	if (raw > dstSize || chunkSize == 0 || chunks != (raw + chunkSize - 1) / chunkSize
+		|| chunks > (len - COMPRESS_HEADER) / 4)
+	{
+		return -1;
+	}
+
+	uint32_t tableEnd = COMPRESS_HEADER + chunks * 4;
+	std::vector<char> ok(chunks, 0);
+	int32_t workers = workerCount(threads, chunks);
+
+	auto work = [&](int32_t worker) {
+		for (uint32_t c = worker; c < chunks; c += workers)
+		{
+			uint32_t begin = c == 0 ? tableEnd : readU32(src + COMPRESS_HEADER + (c - 1) * 4);
+			uint32_t end = readU32(src + COMPRESS_HEADER + c * 4);
+			if (begin > end || end > len)
+			{
+				continue;
+			}
+			uint32_t start = c * chunkSize;
+			uint32_t size = raw - start < chunkSize ? raw - start : chunkSize;
+			ok[c] = decompressChunk((const uint8_t *)src + begin, (const uint8_t *)src + end, (uint8_t *)dst + start, size);
+		}
+	};
+
+	std::vector<std::thread> pool;
+	for (int32_t w = 1; w < workers; w++)
+	{
+		pool.push_back(std::thread(work, w));
+	}
+	if (workers > 0)
+	{
+		work(0);
+	}
+	for (size_t w = 0; w < pool.size(); w++)
+	{
+		pool[w].join();
+	}
+
+	for (uint32_t c = 0; c < chunks; c++)
+	{
+		if (!ok[c])
+		{
+			return -1;
+		}
+	}
+	return (int32_t)raw;
+}
@@ -0,0 +1,20 @@
+#ifndef COMPRESSOR_DEF
+#define COMPRESSOR_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#define COMPRESS_MAGIC				0x315A4B43	// "CKZ1"
+#define COMPRESS_HEADER				16			// magic, raw length, chunk size, chunk count
+#define COMPRESS_MIN_MATCH			4
+#define COMPRESS_HASH_BITS			12
+#define COMPRESS_DEFAULT_CHUNK		65536
+
+uint32_t compressBound(uint32_t len, uint32_t chunkSize);
+int32_t compressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize, uint32_t chunkSize, int32_t threads);
+int32_t decompressedSize(const char *src, uint32_t len);
+int32_t decompressChunked(const char *src, uint32_t len, char *dst, uint32_t dstSize, int32_t threads);
+
+#endif
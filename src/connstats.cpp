@@ -0,0 +1,584 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	connstats.cpp -   Per-connection RTT/loss tracking and snapshot rate control
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		ConnStats(uint32_t tickRate);
+--					void reset(int32_t id);
+--					uint32_t onSend(int32_t id, uint32_t tick);
+--					void onAck(int32_t id, uint32_t ack, uint32_t ackBits);
+--					int32_t shouldSend(int32_t id, uint64_t tick);
+--					uint32_t budget(int32_t id);
+--					void getInfo(int32_t id, ConnInfo *info);
+--					int32_t ackedTick(int32_t id, uint32_t *tick);
+--					void onClock(int32_t id, uint32_t ack, uint32_t clientTimeUs, uint32_t ackDelayUs);
+--					int32_t getClock(int32_t id, ClockInfo *info);
+--					int32_t clientTick(int32_t id, uint32_t clientTimeUs, uint32_t *tick);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: snapshot ticks for lag compensation
+--					October 19th, 2026 - agent: client clock offset and tick estimation
+--					October 19th, 2026 - agent: a byte budget per rate level, enforced by the send loop
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Every snapshot sent to a player is stamped with a sequence number. The player's tick echoes
+--		the newest sequence it has received plus a 32 bit field for the ones before it, the same
+--		seq/ack scheme packets.h was laid out for. From that each connection keeps a smoothed RTT
+--		(RFC 6298 style) and a smoothed loss rate. A snapshot is only judged lost once it has fallen
+--		out of the ack field, so reordering inside the window is not counted.
+--
+--		The rate controller walks each connection down a ladder of 64, 32 and 16 Hz when loss or
+--		RTT climb, and back up only after a sustained run of clean acks, so a link does not
+--		oscillate between levels. Each level also has a budget of packed bytes per snapshot, so a
+--		player on a poor link gets fewer events per snapshot as well as fewer snapshots. The send
+--		loop trims each player's event sections to fit it and carries the rest to their next one.
+--
+--		Ticks that also carry the clock fields give an NTP style sample each: the snapshot's send time
+--		and the tick's arrival on the server's clock, the tick's send time on the client's, and how
+--		long the acknowledged snapshot waited at the client in between. A sample's offset is only as
+--		good as its RTT is short, so the offset kept is the one from the lowest RTT sample in a
+--		window of recent ones, which rejects the samples queueing delay has skewed.
+---------------------------------------------------------------------------------------*/
+#include "connstats.h"
+
+static const uint32_t levelBudget[CONN_RATE_LEVELS] = { CONN_BUDGET_64HZ, CONN_BUDGET_32HZ, CONN_BUDGET_16HZ };
+
+static uint64_t nowUs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+ConnStats::ConnStats(uint32_t rate)
+{
+	tickRate = rate;
+	for (int32_t i = 0; i < CONN_MAX; i++)
+	{
+		reset(i);
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: reset
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void reset(int32_t id)
+--								id: the player id whose connection starts over
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Call when a player joins. A new connection starts at the full rate with no history.
+--------------------------------------------------------------------------------------------------------------*/
+void ConnStats::reset(int32_t id)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	memset(&conns[id], 0, sizeof(Conn));
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: onSend
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t onSend(int32_t id, uint32_t tick)
+--								id: the player id the snapshot is going to
+--								tick: the server tick the snapshot was built on, reported back by ackedTick
+--
+-- RETURNS: the sequence number to stamp on the snapshot about to be sent.
+--
+-- NOTES:
+-- 		If the player has not acknowledged anything for a whole history window, the oldest entries are
+--		judged lost here so the ring never overwrites an unjudged snapshot.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t ConnStats::onSend(int32_t id, uint32_t tick)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+
+	if (conn.nextSeq - conn.lowest >= CONN_HISTORY)
+	{
+		judge(conn, conn.nextSeq - CONN_HISTORY + 1);
+	}
+
+	uint32_t seq = conn.nextSeq++;
+	conn.sentUs[seq & (CONN_HISTORY - 1)] = nowUs();
+	conn.sentTick[seq & (CONN_HISTORY - 1)] = tick;
+	conn.acked[seq & (CONN_HISTORY - 1)] = false;
+	conn.sent++;
+	return seq;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: onAck
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void onAck(int32_t id, uint32_t ack, uint32_t ackBits)
+--								id: the player id the tick came from
+--								ack: the newest snapshot sequence the player has received
+--								ackBits: bit n set means snapshot ack - 1 - n was received too
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Only a first acknowledgement of ack itself produces an RTT sample; the bitfield only marks delivery.
+--		Acks for sequences that were never sent, or have already left the history, are ignored.
+--------------------------------------------------------------------------------------------------------------*/
+void ConnStats::onAck(int32_t id, uint32_t ack, uint32_t ackBits)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+
+	int32_t age = (int32_t)(conn.nextSeq - 1 - ack);
+	if (conn.nextSeq == 0 || age < 0 || (int32_t)(ack - conn.lowest) < 0)
+	{
+		return;
+	}
+
+	uint32_t slot = ack & (CONN_HISTORY - 1);
+	if (!conn.hasAck || (int32_t)(ack - conn.newestAck) > 0)
+	{
+		conn.newestAck = ack;
+		conn.hasAck = true;
+	}
+
+	if (!conn.acked[slot])
+	{
+		conn.acked[slot] = true;
+
+		double sample = (double)(nowUs() - conn.sentUs[slot]);
+		if (!conn.hasRtt)
+		{
+			conn.srtt = sample;
+			conn.rttVar = sample / 2;
+			conn.hasRtt = true;
+		}
+		else
+		{
+			double delta = sample > conn.srtt ? sample - conn.srtt : conn.srtt - sample;
+			conn.rttVar += (delta - conn.rttVar) / 4;
+			conn.srtt += (sample - conn.srtt) / 8;
+		}
+	}
+
+	for (uint32_t bit = 0; bit < CONN_ACK_BITS; bit++)
+	{
+		uint32_t seq = ack - 1 - bit;
+		if ((int32_t)(seq - conn.lowest) < 0)
+		{
+			break;
+		}
+		if (ackBits & (1u << bit))
+		{
+			conn.acked[seq & (CONN_HISTORY - 1)] = true;
+		}
+	}
+
+	if ((int32_t)(ack - CONN_ACK_BITS - conn.lowest) > 0)
+	{
+		judge(conn, ack - CONN_ACK_BITS);
+	}
+
+	adjust(conn);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: shouldSend
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t shouldSend(int32_t id, uint64_t tick)
+--								id: the player id
+--								tick: the server's tick counter
+--
+-- RETURNS: 1 if this player is due a snapshot on this tick, 0 if not.
+--
+-- NOTES:
+-- 		Reduced-rate players are staggered by id so their snapshots do not all land on the same tick.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t ConnStats::shouldSend(int32_t id, uint64_t tick)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return 1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	uint64_t divisor = (uint64_t)1 << conns[id].level;
+	return ((tick + id) % divisor) == 0 ? 1 : 0;
+}
+
+// Packed bytes the player's next snapshot may take
+uint32_t ConnStats::budget(int32_t id)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return CONN_BUDGET_64HZ;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	return levelBudget[conns[id].level];
+}
+
+void ConnStats::getInfo(int32_t id, ConnInfo *info)
+{
+	memset(info, 0, sizeof(ConnInfo));
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+	info->srttUs = (uint32_t)conn.srtt;
+	info->rttVarUs = (uint32_t)conn.rttVar;
+	info->lossPerMille = (uint32_t)(conn.loss * 1000);
+	info->rateHz = tickRate >> conn.level;
+	info->budget = levelBudget[conn.level];
+	info->sent = conn.sent;
+	info->acked = conn.ackedCount;
+	info->lost = conn.lost;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: ackedTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t ackedTick(int32_t id, uint32_t *tick)
+--								id: the player id
+--								tick: set to the server tick of the newest snapshot the player has acknowledged
+--
+-- RETURNS: 0 on success, -1 if the player has not acknowledged a snapshot still in the history.
+--
+-- NOTES:
+-- 		This is the world state the player was looking at when they sent their last tick.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t ConnStats::ackedTick(int32_t id, uint32_t *tick)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+	if (!conn.hasAck || conn.nextSeq - conn.newestAck > CONN_HISTORY)
+	{
+		return -1;
+	}
+
+	*tick = conn.sentTick[conn.newestAck & (CONN_HISTORY - 1)];
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: onClock
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void onClock(int32_t id, uint32_t ack, uint32_t clientTimeUs, uint32_t ackDelayUs)
+--								id: the player id the tick came from
+--								ack: the newest snapshot sequence the player has received
+--								clientTimeUs: the player's clock when the tick was sent
+--								ackDelayUs: how long snapshot ack was held at the player before the tick was sent
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Call on arrival of a tick carrying the clock fields. Every such tick is a sample, even one
+--		repeating the last ack. Samples for sequences that were never sent or have left the history, and
+--		ones whose ack delay is longer than the round trip, are ignored.
+--------------------------------------------------------------------------------------------------------------*/
+void ConnStats::onClock(int32_t id, uint32_t ack, uint32_t clientTimeUs, uint32_t ackDelayUs)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return;
+	}
+
+	uint64_t now = nowUs();
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+
+	int32_t age = (int32_t)(conn.nextSeq - 1 - ack);
+	if (conn.nextSeq == 0 || age < 0 || age >= CONN_HISTORY)
+	{
+		return;
+	}
+
+	uint64_t flight = now - conn.sentUs[ack & (CONN_HISTORY - 1)];
+	if (ackDelayUs > flight || flight - ackDelayUs > INT32_MAX)
+	{
+		return;
+	}
+
+	// the tick left the client half a round trip before it arrived
+	uint32_t rtt = (uint32_t)(flight - ackDelayUs);
+	uint32_t slot = conn.clockSamples++ & (CONN_CLOCK_WINDOW - 1);
+	conn.clockRtt[slot] = rtt;
+	conn.clockOffset[slot] = clientTimeUs - (uint32_t)now + rtt / 2;
+
+	uint32_t count = conn.clockSamples < CONN_CLOCK_WINDOW ? conn.clockSamples : CONN_CLOCK_WINDOW;
+	conn.minRtt = UINT32_MAX;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		if (conn.clockRtt[i] < conn.minRtt)
+		{
+			conn.minRtt = conn.clockRtt[i];
+			conn.offset = conn.clockOffset[i];
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: getClock
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t getClock(int32_t id, ClockInfo *info)
+--								id: the player id
+--								info: set to the player's clock estimate
+--
+-- RETURNS: 0 on success, -1 if there is no RTT for the player yet.
+--
+-- NOTES:
+-- 		A player that sends no clock fields gets ticks estimated from the smoothed RTT, and no offset.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t ConnStats::getClock(int32_t id, ClockInfo *info)
+{
+	memset(info, 0, sizeof(ClockInfo));
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return -1;
+	}
+
+	uint64_t now = nowUs();
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+	if (conn.clockSamples == 0 && !conn.hasRtt)
+	{
+		return -1;
+	}
+
+	if (conn.clockSamples > 0)
+	{
+		info->offsetUs = conn.offset;
+		info->minRttUs = conn.minRtt;
+		info->samples = conn.clockSamples;
+	}
+	else
+	{
+		info->minRttUs = (uint32_t)conn.srtt;
+	}
+	info->viewTick = tickAt(conn, now - info->minRttUs / 2);
+	info->arrivalTick = tickAt(conn, now + info->minRttUs / 2);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: clientTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t clientTick(int32_t id, uint32_t clientTimeUs, uint32_t *tick)
+--								id: the player id
+--								clientTimeUs: a time on the player's clock, within half an hour of now
+--								tick: set to the server tick running at that time
+--
+-- RETURNS: 0 on success, -1 if the player has not sent a clock sample.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t ConnStats::clientTick(int32_t id, uint32_t clientTimeUs, uint32_t *tick)
+{
+	if (id < 0 || id >= CONN_MAX)
+	{
+		return -1;
+	}
+
+	uint64_t now = nowUs();
+	std::lock_guard<std::mutex> guard(lock);
+	Conn &conn = conns[id];
+	if (conn.clockSamples == 0)
+	{
+		return -1;
+	}
+
+	int32_t ago = (int32_t)((uint32_t)now - (clientTimeUs - conn.offset));
+	*tick = tickAt(conn, now - (int64_t)ago);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: judge
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void judge(Conn &conn, uint32_t upTo)
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Settles every snapshot from the oldest unjudged one up to (not including) upTo as delivered or lost
+--		and folds each outcome into the loss average. Called with the lock held.
+--------------------------------------------------------------------------------------------------------------*/
+void ConnStats::judge(Conn &conn, uint32_t upTo)
+{
+	while ((int32_t)(upTo - conn.lowest) > 0)
+	{
+		bool delivered = conn.acked[conn.lowest & (CONN_HISTORY - 1)];
+		conn.loss += ((delivered ? 0.0 : 1.0) - conn.loss) / 16;
+		if (delivered)
+		{
+			conn.ackedCount++;
+		}
+		else
+		{
+			conn.lost++;
+		}
+		conn.lowest++;
+	}
+}
+
+void ConnStats::adjust(Conn &conn)
+{
+	uint32_t lossPerMille = (uint32_t)(conn.loss * 1000);
+	conn.sinceChange++;
+
+	if (lossPerMille > CONN_DOWNGRADE_LOSS || conn.srtt > CONN_DOWNGRADE_RTT_US)
+	{
+		conn.good = 0;
+		if (conn.level < CONN_RATE_LEVELS - 1 && conn.sinceChange >= CONN_DOWNGRADE_HOLD)
+		{
+			conn.level++;
+			conn.sinceChange = 0;
+		}
+	}
+	else if (lossPerMille < CONN_UPGRADE_LOSS && conn.srtt < CONN_UPGRADE_RTT_US)
+	{
+		if (++conn.good >= CONN_UPGRADE_HOLD && conn.level > 0)
+		{
+			conn.level--;
+			conn.good = 0;
+			conn.sinceChange = 0;
+		}
+	}
+	else
+	{
+		conn.good = 0;
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: tickAt
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t tickAt(Conn &conn, uint64_t us)
+--
+-- RETURNS: the server tick running at us on the server's clock.
+--
+-- NOTES:
+-- 		Counted in whole ticks from the newest snapshot sent to the connection, so it follows the send
+--		thread even when that runs late. Called with the lock held, after at least one send.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t ConnStats::tickAt(Conn &conn, uint64_t us)
+{
+	uint32_t newest = (conn.nextSeq - 1) & (CONN_HISTORY - 1);
+	int64_t since = (int64_t)(us - conn.sentUs[newest]);
+	int64_t tickUs = 1000000 / (tickRate > 0 ? tickRate : 1);
+	int64_t ticks = since >= 0 ? since / tickUs : -((-since + tickUs - 1) / tickUs);
+	return conn.sentTick[newest] + (uint32_t)ticks;
+}
@@ -0,0 +1,98 @@
+#ifndef CONNSTATS_DEF
+#define CONNSTATS_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <mutex>
+
+#define CONN_MAX					256			// indexed by player id
+#define CONN_HISTORY				256			// sent snapshots remembered per connection, power of two
+#define CONN_ACK_BITS				32			// snapshots acknowledged by the bitfield behind ack
+
+#define CONN_RATE_LEVELS			3			// 64, 32 and 16 Hz
+#define CONN_DOWNGRADE_LOSS			100			// per-mille loss that drops a level
+#define CONN_DOWNGRADE_RTT_US		250000
+#define CONN_UPGRADE_LOSS			20
+#define CONN_UPGRADE_RTT_US			150000
+#define CONN_UPGRADE_HOLD			128			// consecutive good acks before climbing a level
+#define CONN_DOWNGRADE_HOLD			32			// acks to wait after a change before dropping again
+
+// Packed bytes one snapshot may take at each level; events past it wait for the player's next snapshot
+#define CONN_BUDGET_64HZ			1200		// more than a packed fixed snapshot can take
+#define CONN_BUDGET_32HZ			480
+#define CONN_BUDGET_16HZ			320			// 30 players and a few events
+
+#define CONN_CLOCK_WINDOW			64			// clock samples the minimum RTT filter looks across, about a second
+
+struct ConnInfo {
+	uint32_t srttUs;
+	uint32_t rttVarUs;
+	uint32_t lossPerMille;
+	uint32_t rateHz;
+	uint32_t budget;							// packed bytes per snapshot at this rate
+	uint32_t sent;
+	uint32_t acked;
+	uint32_t lost;
+};
+
+// A player's clock against the server's, from the clock fields of their ticks
+struct ClockInfo {
+	uint32_t offsetUs;							// client clock minus server clock, modulo 2^32
+	uint32_t minRttUs;							// RTT of the sample the offset came from
+	uint32_t samples;							// 0 if the player sends no clock fields; minRttUs is then the smoothed RTT
+	uint32_t viewTick;							// server tick of the newest snapshot that can have reached the player
+	uint32_t arrivalTick;						// server tick on which input the player sends now arrives
+};
+
+class ConnStats
+{
+  public:
+	ConnStats(uint32_t tickRate);
+	void reset(int32_t id);
+	uint32_t onSend(int32_t id, uint32_t tick);
+	void onAck(int32_t id, uint32_t ack, uint32_t ackBits);
+	int32_t shouldSend(int32_t id, uint64_t tick);
+	uint32_t budget(int32_t id);
+	void getInfo(int32_t id, ConnInfo *info);
+	int32_t ackedTick(int32_t id, uint32_t *tick);
+	void onClock(int32_t id, uint32_t ack, uint32_t clientTimeUs, uint32_t ackDelayUs);
+	int32_t getClock(int32_t id, ClockInfo *info);
+	int32_t clientTick(int32_t id, uint32_t clientTimeUs, uint32_t *tick);
+
+  private:
+	struct Conn {
+		uint32_t nextSeq;
+		uint32_t lowest;						// oldest sequence not yet judged acked or lost
+		uint64_t sentUs[CONN_HISTORY];
+		uint32_t sentTick[CONN_HISTORY];		// server tick each snapshot was built on
+		bool acked[CONN_HISTORY];
+		bool hasRtt;
+		bool hasAck;
+		uint32_t newestAck;
+		double srtt;
+		double rttVar;
+		double loss;
+		int32_t level;
+		uint32_t good;
+		uint32_t sinceChange;
+		uint32_t sent;
+		uint32_t ackedCount;
+		uint32_t lost;
+		uint32_t clockRtt[CONN_CLOCK_WINDOW];
+		uint32_t clockOffset[CONN_CLOCK_WINDOW];
+		uint32_t clockSamples;
+		uint32_t minRtt;						// the best sample in the window and its offset
+		uint32_t offset;
+	};
+
+	void judge(Conn &conn, uint32_t upTo);
+	void adjust(Conn &conn);
+	uint32_t tickAt(Conn &conn, uint64_t us);
+
+	std::mutex lock;
+	uint32_t tickRate;
+	Conn conns[CONN_MAX];
+};
+
+#endif
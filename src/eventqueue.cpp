@@ -0,0 +1,192 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	eventqueue.cpp -   Bounded lock-free multi-producer, single-consumer record queue
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		EventQueue();
+--					int32_t init(uint32_t capacity, uint32_t recordSize);
+--					int32_t push(const char *record);
+--					uint32_t drain(char *out, uint32_t maxRecords);
+--					uint64_t dropped();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Carries fixed-size game event records, such as bullet and weapon swap events, from the
+--		threads that produce them to the thread building the next tick. Records are copied into
+--		cells preallocated by init(), so pushing never allocates and never takes a lock.
+--
+--		Each cell has a sequence number saying whose turn it is. A producer claims a position
+--		with one compare-and-swap on the shared enqueue position, fills the cell, then publishes
+--		it by advancing the cell's sequence. The consumer takes cells in position order and stops
+--		at the first one not yet published, so records come out in the order their positions
+--		were claimed, which is first come, first served. A full queue refuses the record and
+--		counts it rather than waiting.
+---------------------------------------------------------------------------------------*/
+#include "eventqueue.h"
+
+EventQueue::EventQueue()
+{
+	sequences = 0;
+	records = 0;
+	capacity = 0;
+	recordSize = 0;
+	enqueuePos.store(0);
+	dequeuePos = 0;
+	droppedCount.store(0);
+}
+
+EventQueue::~EventQueue()
+{
+	delete[] sequences;
+	delete[] records;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t init(uint32_t capacity, uint32_t recordSize)
+--								capacity: records the queue holds, a power of two
+--								recordSize: bytes per record, at most EVENTQUEUE_MAX_RECORD
+--
+-- RETURNS: 0 on success, or -1 if a size is invalid or the queue is already initialized.
+--
+-- NOTES:
+-- 		Call before any thread pushes.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t EventQueue::init(uint32_t cap, uint32_t size)
+{
+	if (sequences != 0 || cap < 2 || (cap & (cap - 1)) != 0 || size == 0 || size > EVENTQUEUE_MAX_RECORD)
+	{
+		return -1;
+	}
+
+	capacity = cap;
+	recordSize = size;
+	sequences = new std::atomic<uint64_t>[capacity];
+	records = new char[(size_t)capacity * recordSize];
+	for (uint32_t i = 0; i < capacity; i++)
+	{
+		sequences[i].store(i, std::memory_order_relaxed);
+	}
+	enqueuePos.store(0);
+	dequeuePos = 0;
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: push
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t push(const char *record)
+--								record: recordSize bytes, copied before this returns
+--
+-- RETURNS: 0 if the record was queued, or -1 if the queue is full.
+--
+-- NOTES:
+-- 		Safe from any number of threads at once.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t EventQueue::push(const char *record)
+{
+	if (sequences == 0)
+	{
+		return -1;
+	}
+
+	uint64_t pos = enqueuePos.load(std::memory_order_relaxed);
+	while (true)
+	{
+		uint64_t seq = sequences[pos & (capacity - 1)].load(std::memory_order_acquire);
+		int64_t diff = (int64_t)(seq - pos);
+		if (diff == 0)
+		{
+			if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (diff < 0)
+		{
+			droppedCount.fetch_add(1, std::memory_order_relaxed);
+			return -1;
+		}
+		else
+		{
+			pos = enqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+
+	uint32_t cell = (uint32_t)(pos & (capacity - 1));
+	memcpy(records + (size_t)cell * recordSize, record, recordSize);
+	sequences[cell].store(pos + 1, std::memory_order_release);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: drain
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t drain(char *out, uint32_t maxRecords)
+--								out: room for maxRecords records, written back to back
+--								maxRecords: the most to take
+--
+-- RETURNS: the number of records taken, oldest first.
+--
+-- NOTES:
+-- 		Consumer thread only. Records past maxRecords, or behind a producer that has claimed a cell but
+--		not finished filling it, stay queued for the next drain.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t EventQueue::drain(char *out, uint32_t maxRecords)
+{
+	uint32_t count = 0;
+	while (sequences != 0 && count < maxRecords)
+	{
+		uint32_t cell = (uint32_t)(dequeuePos & (capacity - 1));
+		if (sequences[cell].load(std::memory_order_acquire) != dequeuePos + 1)
+		{
+			break;
+		}
+
+		memcpy(out + (size_t)count * recordSize, records + (size_t)cell * recordSize, recordSize);
+		sequences[cell].store(dequeuePos + capacity, std::memory_order_release);
+		dequeuePos++;
+		count++;
+	}
+	return count;
+}
+
+uint64_t EventQueue::dropped()
+{
+	return droppedCount.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,33 @@
+#ifndef EVENTQUEUE_DEF
+#define EVENTQUEUE_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+#define EVENTQUEUE_MAX_RECORD		64			// largest record size in bytes
+
+class EventQueue
+{
+  public:
+	EventQueue();
+	~EventQueue();
+	int32_t init(uint32_t capacity, uint32_t recordSize);
+	int32_t push(const char *record);
+	uint32_t drain(char *out, uint32_t maxRecords);
+	uint64_t dropped();
+
+  private:
+	std::atomic<uint64_t> *sequences;			// per cell: position it is ready to be written at, or +1 once written
+	char *records;
+	uint32_t capacity;
+	uint32_t recordSize;
+
+	char padHead[64];
+	std::atomic<uint64_t> enqueuePos;			// shared by the producers
+	char padTail[64];
+	uint64_t dequeuePos;						// the consumer's alone
+	std::atomic<uint64_t> droppedCount;
+};
+
+#endif
@@ -0,0 +1,281 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	fragment.cpp -   Splitting of large messages into MTU sized fragments and their reassembly
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		int32_t fragCount(uint32_t len);
+--					int32_t fragWrite(char *out, uint32_t id, uint32_t index, const char *message, uint32_t len);
+--
+--					Reassembler();
+--					int32_t add(const char *fragment, uint32_t len, uint64_t nowNs, char **message);
+--					void getStats(ReassemblyStats *stats);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A message larger than FRAG_MTU is sent as up to FRAG_MAX_FRAGMENTS datagrams, each with
+--		a FRAG_HEADER_SIZE header naming the message and the fragment's place in it. Every
+--		fragment but the last carries exactly FRAG_PAYLOAD bytes, so a fragment's index is all
+--		the receiver needs to place it, in whatever order they arrive.
+--
+--		The receiving side of a connection owns a Reassembler: FRAG_SLOTS message buffers
+--		allocated once, each with a bitmap of the fragments it holds. There is no retransmission.
+--		A message missing a fragment for FRAG_TIMEOUT_NS is dropped, as is the oldest incomplete
+--		message when a newer one needs its slot; a snapshot is stale by then anyway.
+--
+--		A completed message is handed back in place, and its slot is free for the next message at
+--		once; the caller copies it out before adding another fragment.
+---------------------------------------------------------------------------------------*/
+#include "fragment.h"
+
+#define SLOT_EMPTY					0
+#define SLOT_ASSEMBLING				1
+
+// Number of fragments len bytes are sent as, or -1 if it is too large to fragment
+int32_t fragCount(uint32_t len)
+{
+	if (len > FRAG_MAX_MESSAGE)
+	{
+		return -1;
+	}
+	return len == 0 ? 1 : (int32_t)((len + FRAG_PAYLOAD - 1) / FRAG_PAYLOAD);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: fragWrite
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t fragWrite(char *out, uint32_t id, uint32_t index, const char *message, uint32_t len)
+--								out: receives the fragment, at least FRAG_MTU bytes
+--								id: the message's id, unique among the sender's recent messages
+--								index: which fragment, below fragCount(len)
+--								message, len: the whole message
+--
+-- RETURNS: the length of the fragment, or -1 if index is out of range.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t fragWrite(char *out, uint32_t id, uint32_t index, const char *message, uint32_t len)
+{
+	int32_t count = fragCount(len);
+	if (count < 0 || index >= (uint32_t)count)
+	{
+		return -1;
+	}
+
+	uint32_t start = index * FRAG_PAYLOAD;
+	uint32_t size = len - start < FRAG_PAYLOAD ? len - start : FRAG_PAYLOAD;
+
+	FragmentView header(out);
+	header.header(FRAG_HEADER);
+	header.id(id);
+	header.index((uint8_t)index);
+	header.count((uint8_t)count);
+	memcpy(out + FRAG_HEADER_SIZE, message + start, size);
+	return FRAG_HEADER_SIZE + size;
+}
+
+Reassembler::Reassembler()
+{
+	buffers = new char[FRAG_SLOTS * FRAG_MAX_MESSAGE];
+	for (int32_t i = 0; i < FRAG_SLOTS; i++)
+	{
+		memset(&slots[i], 0, sizeof(Slot));
+		slots[i].state = SLOT_EMPTY;
+		slots[i].data = buffers + i * FRAG_MAX_MESSAGE;
+	}
+	recentCount = 0;
+	memset(&stats, 0, sizeof(stats));
+}
+
+Reassembler::~Reassembler()
+{
+	delete[] buffers;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: add
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t add(const char *fragment, uint32_t len, uint64_t nowNs, char **message)
+--								fragment: a received datagram starting with FRAG_HEADER
+--								len: its length
+--								nowNs: current CLOCK_MONOTONIC time
+--								message: set to the whole message when this fragment completes it
+--
+-- RETURNS: the length of the completed message, 0 if it is still incomplete, or -1 if the fragment was
+--			dropped.
+--
+-- NOTES:
+-- 		message stays valid until the next call. A repeated fragment is counted and ignored.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Reassembler::add(const char *fragment, uint32_t len, uint64_t nowNs, char **message)
+{
+	expire(nowNs);
+
+	if (len <= FRAG_HEADER_SIZE || (uint8_t)fragment[0] != FRAG_HEADER)
+	{
+		stats.malformed++;
+		return -1;
+	}
+
+	FragmentView header((char *)fragment);
+	uint32_t id = header.id();
+	uint8_t index = header.index();
+	uint8_t count = header.count();
+	uint32_t size = len - FRAG_HEADER_SIZE;
+	bool last = index + 1 == count;
+
+	if (count == 0 || count > FRAG_MAX_FRAGMENTS || index >= count || size > FRAG_PAYLOAD
+		|| (!last && size != FRAG_PAYLOAD))
+	{
+		stats.malformed++;
+		return -1;
+	}
+
+	Slot *slot = claim(id, count, nowNs);
+	if (slot == 0)
+	{
+		return -1;
+	}
+
+	uint32_t bit = 1u << index;
+	if (slot->received & bit)
+	{
+		stats.duplicates++;
+		return 0;
+	}
+
+	memcpy(slot->data + index * FRAG_PAYLOAD, fragment + FRAG_HEADER_SIZE, size);
+	slot->received |= bit;
+	if (last)
+	{
+		slot->len = index * FRAG_PAYLOAD + size;
+	}
+
+	uint32_t full = count == 32 ? 0xFFFFFFFFu : (1u << count) - 1;
+	if (slot->received != full)
+	{
+		return 0;
+	}
+
+	slot->state = SLOT_EMPTY;
+	recent[recentCount++ % FRAG_SLOTS] = id;
+	stats.completed++;
+	*message = slot->data;
+	return slot->len;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: claim
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: Slot *claim(uint32_t id, uint8_t count, uint64_t nowNs)
+--
+-- RETURNS: the slot assembling message id, a newly started one, or 0 if none could be had.
+--
+-- NOTES:
+-- 		A new message takes an empty slot, or else the incomplete slot that was started first. A fragment
+--		of a message completed recently is a duplicate, and one whose count disagrees with the rest of its
+--		message is malformed.
+--------------------------------------------------------------------------------------------------------------*/
+Reassembler::Slot *Reassembler::claim(uint32_t id, uint8_t count, uint64_t nowNs)
+{
+	Slot *empty = 0;
+	Slot *oldest = 0;
+
+	for (int32_t i = 0; i < FRAG_SLOTS; i++)
+	{
+		Slot &slot = slots[i];
+		if (slot.state == SLOT_ASSEMBLING)
+		{
+			if (slot.id == id)
+			{
+				if (slot.count != count)
+				{
+					stats.malformed++;
+					return 0;
+				}
+				return &slot;
+			}
+			if (oldest == 0 || slot.startNs < oldest->startNs)
+			{
+				oldest = &slot;
+			}
+		}
+		else if (empty == 0)
+		{
+			empty = &slot;
+		}
+	}
+
+	uint32_t known = recentCount < FRAG_SLOTS ? recentCount : FRAG_SLOTS;
+	for (uint32_t i = 0; i < known; i++)
+	{
+		if (recent[i] == id)
+		{
+			stats.duplicates++;
+			return 0;
+		}
+	}
+
+	Slot *slot = empty;
+	if (slot == 0)
+	{
+		stats.evicted++;
+		slot = oldest;
+	}
+
+	slot->id = id;
+	slot->count = count;
+	slot->received = 0;
+	slot->len = 0;
+	slot->startNs = nowNs;
+	slot->state = SLOT_ASSEMBLING;
+	return slot;
+}
+
+void Reassembler::expire(uint64_t nowNs)
+{
+	for (int32_t i = 0; i < FRAG_SLOTS; i++)
+	{
+		if (slots[i].state == SLOT_ASSEMBLING && nowNs - slots[i].startNs > FRAG_TIMEOUT_NS)
+		{
+			slots[i].state = SLOT_EMPTY;
+			stats.expired++;
+		}
+	}
+}
+
+void Reassembler::getStats(ReassemblyStats *out)
+{
+	*out = stats;
+}
@@ -0,0 +1,61 @@
+#ifndef FRAGMENT_DEF
+#define FRAGMENT_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include "packets.h"
+#include "packetschema.h"
+
+// Wire layout of one fragment: a Fragment from packets.def, then the payload
+#define FRAG_HEADER					87			// clear of every other first byte; ticks always have 0x80 set
+#define FRAG_HEADER_SIZE			FragmentView::SIZE
+
+#define FRAG_MTU					PAYLOAD_MAX_SIZE	// largest datagram a fragmented message is cut into
+#define FRAG_PAYLOAD				(FRAG_MTU - FRAG_HEADER_SIZE)
+#define FRAG_MAX_FRAGMENTS			32			// one bit each in a slot's bitmap
+#define FRAG_MAX_MESSAGE			(FRAG_PAYLOAD * FRAG_MAX_FRAGMENTS)
+
+#define FRAG_SLOTS					8			// messages being reassembled at once, per connection
+#define FRAG_TIMEOUT_NS				250000000ull	// an incomplete message is dropped after this
+
+struct ReassemblyStats {
+	uint64_t completed;
+	uint64_t expired;							// incomplete after FRAG_TIMEOUT_NS
+	uint64_t evicted;							// incomplete, and its slot was needed for a newer message
+	uint64_t duplicates;
+	uint64_t malformed;
+};
+
+int32_t fragCount(uint32_t len);
+int32_t fragWrite(char *out, uint32_t id, uint32_t index, const char *message, uint32_t len);
+
+class Reassembler
+{
+  public:
+	Reassembler();
+	~Reassembler();
+	int32_t add(const char *fragment, uint32_t len, uint64_t nowNs, char **message);
+	void getStats(ReassemblyStats *stats);
+
+  private:
+	struct Slot {
+		uint32_t id;
+		uint32_t received;						// bitmap of fragments in
+		uint32_t len;							// known once the last fragment is in
+		uint8_t count;
+		uint8_t state;
+		uint64_t startNs;
+		char *data;
+	};
+
+	void expire(uint64_t nowNs);
+	Slot *claim(uint32_t id, uint8_t count, uint64_t nowNs);
+
+	Slot slots[FRAG_SLOTS];
+	char *buffers;
+	uint32_t recent[FRAG_SLOTS];				// ids of the last messages completed
+	uint32_t recentCount;
+	ReassemblyStats stats;
+};
+
+#endif
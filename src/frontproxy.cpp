@@ -0,0 +1,447 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	frontproxy.cpp -   UDP front proxy routing players to backend match processes
+--
+--	PROGRAM:		frontproxy (standalone, built from the library's Server)
+--
+--	FUNCTIONS:		FrontProxy();
+--					int32_t init(short publicPort, short internalPort);
+--					int32_t addBackend(EndPoint backend, uint32_t token, uint32_t capacity);
+--					void setJoin(uint8_t header, uint32_t tokenOffset);
+--					int32_t run();
+--					void stop();
+--					void getStats(ProxyStats *stats);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The proxy owns the public game port and any number of match servers sit behind it, each
+--		its own process on its own port, started with their Server in upstream mode. Two Servers
+--		using the batched epoll engine do the work: front faces the players, back faces the
+--		backends, and one thread moves datagrams between them with recvmmsg()/sendmmsg().
+--
+--		A datagram from a player is forwarded to the player's backend with the player's address
+--		in a PROXY_HEADER_SIZE prefix. Replies come back with the same prefix, which is all the
+--		proxy needs to send them on, so the return path keeps no state at all.
+--
+--		The only state is the client table, 16 bytes per player, mapping an address to its
+--		backend. A player is mapped by its join datagram: if the join carries a match token at
+--		tokenOffset, the player goes to the backend registered with that token; a token of
+--		PROXY_ANY_MATCH goes to the least loaded backend with room. Anything else from an
+--		unmapped address is dropped. Players silent for PROXY_IDLE_SECONDS are unmapped.
+---------------------------------------------------------------------------------------*/
+#include "frontproxy.h"
+
+#define MAPPING_EMPTY				0
+#define MAPPING_LIVE				1
+#define MAPPING_REMOVED				2
+
+static uint32_t monoSeconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec;
+}
+
+FrontProxy::FrontProxy()
+{
+	memset(backends, 0, sizeof(backends));
+	backendCount = 0;
+	table = new Mapping[PROXY_TABLE_SIZE];
+	memset(table, 0, sizeof(Mapping) * PROXY_TABLE_SIZE);
+	live = 0;
+	removed = 0;
+	joinHeader = 170;
+	tokenOffset = 1;
+	lastSweep = 0;
+	lastReport = 0;
+	memset(&stats, 0, sizeof(stats));
+	memset(&reported, 0, sizeof(reported));
+	running.store(false);
+}
+
+FrontProxy::~FrontProxy()
+{
+	delete[] table;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t init(short publicPort, short internalPort)
+--								publicPort: the port players send to
+--								internalPort: the port backends send replies to, their upstream
+--
+-- RETURNS: 0 on success, or -1 if either socket could not be opened.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t FrontProxy::init(short publicPort, short internalPort)
+{
+	if (front.initializeSocket(publicPort) != 0 || back.initializeSocket(internalPort) != 0)
+	{
+		return -1;
+	}
+	if (front.setEngine(ENGINE_EPOLL) != ENGINE_EPOLL || back.setEngine(ENGINE_EPOLL) != ENGINE_EPOLL)
+	{
+		return -1;
+	}
+	return 0;
+}
+
+int32_t FrontProxy::addBackend(EndPoint backend, uint32_t token, uint32_t capacity)
+{
+	if (backendCount >= PROXY_MAX_BACKENDS)
+	{
+		return -1;
+	}
+
+	Backend &entry = backends[backendCount];
+	entry.ep = backend;
+	entry.token = token;
+	entry.capacity = capacity;
+	entry.clients = 0;
+	return backendCount++;
+}
+
+// Which datagrams map a new player, and where in them the little endian match token is
+void FrontProxy::setJoin(uint8_t header, uint32_t offset)
+{
+	joinHeader = header;
+	tokenOffset = offset;
+}
+
+uint64_t FrontProxy::keyOf(EndPoint ep)
+{
+	return ((uint64_t)ep.addr << 16) | ep.port;
+}
+
+int32_t FrontProxy::find(uint64_t key)
+{
+	uint32_t slot = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 40) & (PROXY_TABLE_SIZE - 1);
+	for (uint32_t i = 0; i < PROXY_TABLE_SIZE; i++)
+	{
+		Mapping &mapping = table[(slot + i) & (PROXY_TABLE_SIZE - 1)];
+		if (mapping.state == MAPPING_EMPTY)
+		{
+			return -1;
+		}
+		if (mapping.state == MAPPING_LIVE && mapping.key == key)
+		{
+			return (int32_t)((slot + i) & (PROXY_TABLE_SIZE - 1));
+		}
+	}
+	return -1;
+}
+
+int32_t FrontProxy::pickBackend(uint32_t token)
+{
+	int32_t best = -1;
+	for (uint32_t i = 0; i < backendCount; i++)
+	{
+		Backend &backend = backends[i];
+		if (token != PROXY_ANY_MATCH)
+		{
+			if (backend.token == token)
+			{
+				return backend.clients < backend.capacity ? (int32_t)i : -1;
+			}
+			continue;
+		}
+		if (backend.clients < backend.capacity && (best < 0 || backend.clients < backends[best].clients))
+		{
+			best = i;
+		}
+	}
+	return best;
+}
+
+int32_t FrontProxy::findBackend(EndPoint ep)
+{
+	for (uint32_t i = 0; i < backendCount; i++)
+	{
+		if (backends[i].ep.addr == ep.addr && backends[i].ep.port == ep.port)
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: route
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t route(const char *data, int32_t len, EndPoint client, uint32_t now)
+--								data, len: the player's datagram
+--								client: who sent it
+--								now: current time in seconds
+--
+-- RETURNS: the backend to forward to, or -1 to drop the datagram.
+--
+-- NOTES:
+-- 		Maps a joining player on the way. A player that joins again keeps its backend.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t FrontProxy::route(const char *data, int32_t len, EndPoint client, uint32_t now)
+{
+	uint64_t key = keyOf(client);
+	int32_t slot = find(key);
+	if (slot >= 0)
+	{
+		table[slot].lastSeen = now;
+		return table[slot].backend;
+	}
+
+	if (len < 1 || (uint8_t)data[0] != joinHeader)
+	{
+		return -1;
+	}
+
+	uint32_t token = PROXY_ANY_MATCH;
+	if ((uint32_t)len >= tokenOffset + 4)
+	{
+		const uint8_t *bytes = (const uint8_t *)data + tokenOffset;
+		token = (uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+	}
+
+	int32_t backend = pickBackend(token);
+	if (backend < 0)
+	{
+		return -1;
+	}
+
+	if ((live + removed + 1) * 4 > PROXY_TABLE_SIZE * 3)
+	{
+		rehash();
+		if ((live + 1) * 4 > PROXY_TABLE_SIZE * 3)
+		{
+			return -1;
+		}
+	}
+
+	uint32_t start = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 40) & (PROXY_TABLE_SIZE - 1);
+	for (uint32_t i = 0; i < PROXY_TABLE_SIZE; i++)
+	{
+		Mapping &mapping = table[(start + i) & (PROXY_TABLE_SIZE - 1)];
+		if (mapping.state != MAPPING_LIVE)
+		{
+			removed -= mapping.state == MAPPING_REMOVED;
+			mapping.key = key;
+			mapping.lastSeen = now;
+			mapping.backend = (uint16_t)backend;
+			mapping.state = MAPPING_LIVE;
+			break;
+		}
+	}
+
+	live++;
+	backends[backend].clients++;
+	return backend;
+}
+
+// Re-inserts the live mappings so removed slots stop lengthening the probes
+void FrontProxy::rehash()
+{
+	Mapping *old = table;
+	table = new Mapping[PROXY_TABLE_SIZE];
+	memset(table, 0, sizeof(Mapping) * PROXY_TABLE_SIZE);
+
+	for (uint32_t i = 0; i < PROXY_TABLE_SIZE; i++)
+	{
+		if (old[i].state != MAPPING_LIVE)
+		{
+			continue;
+		}
+		uint32_t slot = (uint32_t)((old[i].key * 0x9E3779B97F4A7C15ull) >> 40) & (PROXY_TABLE_SIZE - 1);
+		while (table[slot].state != MAPPING_EMPTY)
+		{
+			slot = (slot + 1) & (PROXY_TABLE_SIZE - 1);
+		}
+		table[slot] = old[i];
+	}
+
+	delete[] old;
+	removed = 0;
+}
+
+void FrontProxy::expire(uint32_t now)
+{
+	for (uint32_t i = 0; i < PROXY_TABLE_SIZE; i++)
+	{
+		Mapping &mapping = table[i];
+		if (mapping.state == MAPPING_LIVE && now - mapping.lastSeen > PROXY_IDLE_SECONDS)
+		{
+			mapping.state = MAPPING_REMOVED;
+			backends[mapping.backend].clients--;
+			live--;
+			removed++;
+			stats.expired++;
+		}
+	}
+}
+
+// Player datagrams arrive at buffer + PROXY_HEADER_SIZE so the prefix can be written in front in place
+void FrontProxy::inbound(char *buffer, uint32_t now)
+{
+	EndPoint client;
+	for (int32_t i = 0; i < PROXY_BURST; i++)
+	{
+		int32_t len = front.UdpRecvFrom(buffer + PROXY_HEADER_SIZE, SERVER_SLOT_SIZE - PROXY_HEADER_SIZE, &client);
+		if (len < 0)
+		{
+			break;
+		}
+
+		int32_t backend = route(buffer + PROXY_HEADER_SIZE, len, client, now);
+		if (backend < 0)
+		{
+			stats.unrouted++;
+			continue;
+		}
+
+		proxyEncode(buffer, client);
+		back.queueSend(backends[backend].ep, buffer, len + PROXY_HEADER_SIZE);
+		stats.forwarded++;
+	}
+	back.flushSends();
+}
+
+void FrontProxy::outbound(char *buffer)
+{
+	EndPoint from;
+	for (int32_t i = 0; i < PROXY_BURST; i++)
+	{
+		int32_t len = back.UdpRecvFrom(buffer, SERVER_SLOT_SIZE, &from);
+		if (len < 0)
+		{
+			break;
+		}
+
+		if (len < PROXY_HEADER_SIZE || findBackend(from) < 0)
+		{
+			stats.foreign++;
+			continue;
+		}
+
+		front.queueSend(proxyDecode(buffer), buffer + PROXY_HEADER_SIZE, len - PROXY_HEADER_SIZE);
+		stats.returned++;
+	}
+	front.flushSends();
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: run
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t run()
+--
+-- RETURNS: 0 once stopped, or -1 if the sockets could not be watched.
+--
+-- NOTES:
+-- 		Blocks the calling thread, alternating bursts of up to PROXY_BURST datagrams each way for as long
+--		as either socket has data, and sleeping in epoll_wait() when neither does. Once a second idle
+--		players are unmapped; every PROXY_REPORT_SECONDS the counters are printed if they moved.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t FrontProxy::run()
+{
+	int epollFd = epoll_create1(0);
+	if (epollFd < 0)
+	{
+		perror("proxy epoll failed");
+		return -1;
+	}
+
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.fd = front.getSocket();
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, front.getSocket(), &event);
+	event.data.fd = back.getSocket();
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, back.getSocket(), &event);
+
+	char buffer[SERVER_SLOT_SIZE];
+	struct epoll_event ready[2];
+	running.store(true);
+
+	while (running.load())
+	{
+		if (front.UdpPollSocket() != SOCKET_DATA_WAITING && back.UdpPollSocket() != SOCKET_DATA_WAITING)
+		{
+			epoll_wait(epollFd, ready, 2, PROXY_WAIT_MS);
+		}
+
+		uint32_t now = monoSeconds();
+		inbound(buffer, now);
+		outbound(buffer);
+
+		if (now != lastSweep)
+		{
+			expire(now);
+			lastSweep = now;
+		}
+		if (now - lastReport >= PROXY_REPORT_SECONDS)
+		{
+			report();
+			lastReport = now;
+		}
+	}
+
+	close(epollFd);
+	return 0;
+}
+
+void FrontProxy::stop()
+{
+	running.store(false);
+}
+
+void FrontProxy::report()
+{
+	getStats(&stats);
+	if (memcmp(&stats, &reported, sizeof(ProxyStats)) == 0)
+	{
+		return;
+	}
+
+	printf("proxy: %u players on %u backends, %llu forwarded, %llu returned, %llu unrouted, %llu foreign, %llu expired\n",
+		stats.mapped, stats.backends, (unsigned long long)stats.forwarded, (unsigned long long)stats.returned,
+		(unsigned long long)stats.unrouted, (unsigned long long)stats.foreign, (unsigned long long)stats.expired);
+	fflush(stdout);
+	reported = stats;
+}
+
+// From the thread in run(), or after run() has returned
+void FrontProxy::getStats(ProxyStats *out)
+{
+	stats.mapped = live;
+	stats.backends = backendCount;
+	*out = stats;
+}
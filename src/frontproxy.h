@@ -0,0 +1,86 @@
+#ifndef FRONTPROXY_DEF
+#define FRONTPROXY_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <sys/epoll.h>
+#include <atomic>
+#include "server.h"
+#include "proxyheader.h"
+
+#define PROXY_MAX_BACKENDS			64
+#define PROXY_TABLE_SIZE			8192		// client mapping slots, power of two
+#define PROXY_IDLE_SECONDS			30			// a client silent this long is unmapped
+#define PROXY_BURST					256			// datagrams moved per direction before switching
+#define PROXY_WAIT_MS				1000
+#define PROXY_REPORT_SECONDS		10
+#define PROXY_ANY_MATCH				0			// join token meaning any backend with room
+
+struct ProxyStats {
+	uint64_t forwarded;							// client to backend
+	uint64_t returned;							// backend to client
+	uint64_t unrouted;							// unknown client not joining, or no backend for the token
+	uint64_t foreign;							// on the internal port from something not a backend
+	uint64_t expired;
+	uint32_t mapped;
+	uint32_t backends;
+};
+
+class FrontProxy
+{
+  public:
+	FrontProxy();
+	~FrontProxy();
+	int32_t init(short publicPort, short internalPort);
+	int32_t addBackend(EndPoint backend, uint32_t token, uint32_t capacity);
+	void setJoin(uint8_t header, uint32_t tokenOffset);
+	int32_t run();
+	void stop();
+	void getStats(ProxyStats *stats);
+
+  private:
+	struct Backend {
+		EndPoint ep;
+		uint32_t token;
+		uint32_t capacity;
+		uint32_t clients;
+	};
+
+	// 16 bytes per mapped client
+	struct Mapping {
+		uint64_t key;							// addr << 16 | port
+		uint32_t lastSeen;						// seconds
+		uint16_t backend;
+		uint8_t state;
+	};
+
+	static uint64_t keyOf(EndPoint ep);
+	int32_t find(uint64_t key);
+	int32_t route(const char *data, int32_t len, EndPoint client, uint32_t now);
+	int32_t pickBackend(uint32_t token);
+	int32_t findBackend(EndPoint ep);
+	void inbound(char *buffer, uint32_t now);
+	void outbound(char *buffer);
+	void expire(uint32_t now);
+	void report();
+	void rehash();
+
+	Server front;								// players
+	Server back;								// backends
+	Backend backends[PROXY_MAX_BACKENDS];
+	uint32_t backendCount;
+	Mapping *table;
+	uint32_t live;
+	uint32_t removed;
+	uint8_t joinHeader;
+	uint32_t tokenOffset;
+	uint32_t lastSweep;
+	uint32_t lastReport;
+	ProxyStats reported;
+
+	ProxyStats stats;
+	std::atomic<bool> running;
+};
+
+#endif
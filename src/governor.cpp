@@ -0,0 +1,417 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	governor.cpp -   Tick scheduling, phase timing and overload degradation
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		TickGovernor();
+--					int32_t init(uint32_t budgetUs);
+--					int32_t addPhase(uint32_t lane);
+--					int32_t addStep(uint32_t engagePercent, uint32_t releasePercent);
+--					int32_t waitTick(uint32_t lane);
+--					int32_t beginTick(uint32_t lane);
+--					void mark(uint32_t phase);
+--					bool engaged(uint32_t step);
+--					uint32_t level();
+--					uint32_t drainEvents(GovernorEvent *out, uint32_t max);
+--					void getStats(GovernorStats *stats);
+--					uint64_t now();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: beginTick() for lanes whose ticks are scheduled elsewhere
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Each thread that runs once a tick is a lane. waitTick() sleeps the lane until its next
+--		deadline, and the deadlines are a fixed grid from init(), one budget apart, so a late tick
+--		is followed by an early one instead of pushing every later tick back. A lane that falls
+--		more than GOVERNOR_RESYNC_TICKS behind gives those deadlines up and reports a resync.
+--
+--		A lane whose ticks are already scheduled by something else, such as a MatchHost worker,
+--		calls beginTick() instead and is never put to sleep.
+--
+--		Between deadlines the lane's work is timed, from waking to calling waitTick() again, and
+--		broken down by the phases it marks. The load is the busiest lane's smoothed work as a
+--		percentage of the budget.
+--
+--		Degradation steps are added in the order they should be applied. While the load stays at
+--		or over the next step's engage percentage for GOVERNOR_ENGAGE_TICKS, that step is applied;
+--		while it stays under the last applied step's release percentage for GOVERNOR_RELEASE_TICKS,
+--		that step is lifted. One step moves at a time and each move is kept as an event for the
+--		owner to report. What a step does is up to the owner, which asks engaged() each tick.
+---------------------------------------------------------------------------------------*/
+#include "governor.h"
+
+TickGovernor::TickGovernor()
+{
+	budgetNs = 0;
+	epochNs = 0;
+	memset(lanes, 0, sizeof(lanes));
+	memset(phaseLane, 0, sizeof(phaseLane));
+	memset(phaseNs, 0, sizeof(phaseNs));
+	memset(phaseSmoothedUs, 0, sizeof(phaseSmoothedUs));
+	phaseCount = 0;
+	memset(steps, 0, sizeof(steps));
+	stepCount = 0;
+	applied = 0;
+	overTicks = 0;
+	underTicks = 0;
+	governedTick = 0;
+	eventHead = 0;
+	eventCount = 0;
+	memset(&stats, 0, sizeof(stats));
+}
+
+// Nanoseconds on CLOCK_MONOTONIC, the governor's time base
+uint64_t TickGovernor::now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t init(uint32_t budgetUs)
+--								budgetUs: length of a tick in microseconds
+--
+-- RETURNS: 0, or -1 for a zero budget.
+--
+-- NOTES:
+-- 		Starts the deadline grid now. Phases and steps are added after init and before any lane
+--		waits for its first tick.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TickGovernor::init(uint32_t budgetUs)
+{
+	if (budgetUs == 0)
+	{
+		return -1;
+	}
+	budgetNs = (uint64_t)budgetUs * 1000;
+	epochNs = now();
+	return 0;
+}
+
+// Returns the phase's id, timed on the given lane, or -1 if there are too many
+int32_t TickGovernor::addPhase(uint32_t lane)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (lane >= GOVERNOR_LANES || phaseCount == GOVERNOR_PHASES)
+	{
+		return -1;
+	}
+	phaseLane[phaseCount] = lane;
+	return (int32_t)phaseCount++;
+}
+
+// Returns the step's id, applied after every step added before it, or -1 if it is invalid or there are too many
+int32_t TickGovernor::addStep(uint32_t engagePercent, uint32_t releasePercent)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (stepCount == GOVERNOR_STEPS || engagePercent == 0 || releasePercent >= engagePercent)
+	{
+		return -1;
+	}
+	steps[stepCount].engagePercent = engagePercent;
+	steps[stepCount].releasePercent = releasePercent;
+	return (int32_t)stepCount++;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: waitTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t waitTick(uint32_t lane)
+--								lane: the calling thread's lane, the same one on every call
+--
+-- RETURNS: how many whole ticks late the lane woke, 0 when on time, or -1 for an invalid lane.
+--
+-- NOTES:
+-- 		Closes the tick the lane was working on, if any, and sleeps until the next deadline on the
+--		grid. A lane already past its deadline returns at once so it can catch up, unless it is
+--		more than GOVERNOR_RESYNC_TICKS behind, when it skips to the current deadline instead.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TickGovernor::waitTick(uint32_t lane)
+{
+	if (lane >= GOVERNOR_LANES || budgetNs == 0)
+	{
+		return -1;
+	}
+
+	Lane &current = lanes[lane];
+	uint64_t time = now();
+	if (current.started)
+	{
+		closeTick(lane, time);
+	}
+	else
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		current.tick = (time - epochNs) / budgetNs;
+		current.started = true;
+	}
+
+	current.tick++;
+	uint64_t due = epochNs + current.tick * budgetNs;
+	if (time > due + GOVERNOR_RESYNC_TICKS * budgetNs)
+	{
+		uint64_t behind = (time - due) / budgetNs;
+		current.tick += behind;
+		due += behind * budgetNs;
+
+		std::lock_guard<std::mutex> guard(lock);
+		stats.skipped += behind;
+		report(GOVERNOR_RESYNC, lane, (int32_t)lane, (uint32_t)behind);
+	}
+
+	if (due > time)
+	{
+		struct timespec until;
+		until.tv_sec = due / 1000000000;
+		until.tv_nsec = due % 1000000000;
+		while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &until, 0) != 0)
+		{
+		}
+	}
+
+	current.tickStart = now();
+	current.lastMark = current.tickStart;
+	return current.tickStart > due ? (int32_t)((current.tickStart - due) / budgetNs) : 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: beginTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t beginTick(uint32_t lane)
+--								lane: the calling tick's lane, the same one on every call
+--
+-- RETURNS: 0, or -1 for an invalid lane.
+--
+-- NOTES:
+-- 		Closes the tick the lane was working on, if any, and starts the next one now, on whichever deadline
+--		of the grid is current. For a lane that is woken on time by its owner; nothing is slept or skipped.
+--		The time between ticks is the owner's, not the lane's, so the closed tick's work ends at its last
+--		mark; mark the last phase when the tick's work is done.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TickGovernor::beginTick(uint32_t lane)
+{
+	if (lane >= GOVERNOR_LANES || budgetNs == 0)
+	{
+		return -1;
+	}
+
+	Lane &current = lanes[lane];
+	if (current.started)
+	{
+		closeTick(lane, current.lastMark);
+	}
+	uint64_t time = now();
+	current.started = true;
+	current.tick = (time - epochNs) / budgetNs + 1;
+	current.tickStart = time;
+	current.lastMark = time;
+	return 0;
+}
+
+// Ends the named phase: the time since the lane's previous mark, or since it woke, is counted to it
+void TickGovernor::mark(uint32_t phase)
+{
+	if (phase >= phaseCount)
+	{
+		return;
+	}
+	Lane &current = lanes[phaseLane[phase]];
+	uint64_t time = now();
+	phaseNs[phase] += time - current.lastMark;
+	current.lastMark = time;
+}
+
+bool TickGovernor::engaged(uint32_t step)
+{
+	return step < applied.load(std::memory_order_relaxed);
+}
+
+// The number of steps applied; the first that many steps are engaged
+uint32_t TickGovernor::level()
+{
+	return applied.load(std::memory_order_relaxed);
+}
+
+// Times the lane's finished tick into its load and phases, then lets the steps follow the load
+void TickGovernor::closeTick(uint32_t lane, uint64_t time)
+{
+	Lane &current = lanes[lane];
+	uint64_t work = time - current.tickStart;
+	uint32_t percent = (uint32_t)(work * 100 / budgetNs);
+
+	std::lock_guard<std::mutex> guard(lock);
+	stats.ticks++;
+	if (work > budgetNs)
+	{
+		stats.overruns++;
+	}
+	if (work / 1000 > stats.worstUs)
+	{
+		stats.worstUs = (uint32_t)(work / 1000);
+	}
+
+	current.loadPercent = (uint32_t)((int32_t)current.loadPercent + (((int32_t)percent - (int32_t)current.loadPercent) >> GOVERNOR_SMOOTHING));
+	for (uint32_t i = 0; i < phaseCount; i++)
+	{
+		if (phaseLane[i] != lane)
+		{
+			continue;
+		}
+		int32_t us = (int32_t)(phaseNs[i] / 1000);
+		phaseSmoothedUs[i] = (uint32_t)((int32_t)phaseSmoothedUs[i] + ((us - (int32_t)phaseSmoothedUs[i]) >> GOVERNOR_SMOOTHING));
+		phaseNs[i] = 0;
+	}
+
+	govern(lane);
+}
+
+// Once per tick of the grid, whichever lane closes it first: apply or lift one step if the load has called for it long enough
+void TickGovernor::govern(uint32_t lane)
+{
+	if (lanes[lane].tick <= governedTick)
+	{
+		return;
+	}
+	governedTick = lanes[lane].tick;
+
+	uint32_t load = 0;
+	for (uint32_t i = 0; i < GOVERNOR_LANES; i++)
+	{
+		if (lanes[i].started && lanes[i].loadPercent > load)
+		{
+			load = lanes[i].loadPercent;
+		}
+	}
+
+	uint32_t level = applied.load(std::memory_order_relaxed);
+	if (level < stepCount && load >= steps[level].engagePercent)
+	{
+		underTicks = 0;
+		if (++overTicks >= GOVERNOR_ENGAGE_TICKS)
+		{
+			overTicks = 0;
+			applied.store(level + 1, std::memory_order_relaxed);
+			report(GOVERNOR_ENGAGE, lane, (int32_t)level, load);
+		}
+	}
+	else if (level > 0 && load < steps[level - 1].releasePercent)
+	{
+		overTicks = 0;
+		if (++underTicks >= GOVERNOR_RELEASE_TICKS)
+		{
+			underTicks = 0;
+			applied.store(level - 1, std::memory_order_relaxed);
+			report(GOVERNOR_RELEASE, lane, (int32_t)level - 1, load);
+		}
+	}
+	else
+	{
+		overTicks = 0;
+		underTicks = 0;
+	}
+}
+
+// Keeps an event for drainEvents(); the caller holds the lock. When full the oldest is dropped.
+void TickGovernor::report(uint32_t kind, uint32_t lane, int32_t step, uint32_t value)
+{
+	if (eventCount == GOVERNOR_EVENTS)
+	{
+		eventHead = (eventHead + 1) % GOVERNOR_EVENTS;
+		eventCount--;
+		stats.eventsDropped++;
+	}
+
+	GovernorEvent &event = events[(eventHead + eventCount) % GOVERNOR_EVENTS];
+	event.kind = kind;
+	event.tick = (uint32_t)lanes[lane].tick;
+	event.step = step;
+	event.level = applied.load(std::memory_order_relaxed);
+	event.value = value;
+	eventCount++;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: drainEvents
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t drainEvents(GovernorEvent *out, uint32_t max)
+--								out: room for max events
+--								max: the most to take
+--
+-- RETURNS: the number of events copied, oldest first.
+--
+-- NOTES:
+-- 		Events past max stay for the next call.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t TickGovernor::drainEvents(GovernorEvent *out, uint32_t max)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	uint32_t count = eventCount < max ? eventCount : max;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		out[i] = events[eventHead];
+		eventHead = (eventHead + 1) % GOVERNOR_EVENTS;
+	}
+	eventCount -= count;
+	return count;
+}
+
+void TickGovernor::getStats(GovernorStats *out)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	*out = stats;
+	out->level = applied.load(std::memory_order_relaxed);
+	out->loadPercent = 0;
+	for (uint32_t i = 0; i < GOVERNOR_LANES; i++)
+	{
+		if (lanes[i].started && lanes[i].loadPercent > out->loadPercent)
+		{
+			out->loadPercent = lanes[i].loadPercent;
+		}
+	}
+	out->phases = phaseCount;
+	memcpy(out->phaseUs, phaseSmoothedUs, sizeof(out->phaseUs));
+}
@@ -0,0 +1,99 @@
+#ifndef GOVERNOR_DEF
+#define GOVERNOR_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <mutex>
+
+#define GOVERNOR_LANES				4			// threads keeping the tick, each with its own deadline
+#define GOVERNOR_PHASES				16
+#define GOVERNOR_STEPS				8
+#define GOVERNOR_EVENTS				64			// events kept until drained, oldest dropped first
+#define GOVERNOR_SMOOTHING			3			// load average weight of 1/2^3 per tick
+#define GOVERNOR_ENGAGE_TICKS		4			// ticks over a step's engage load before it is applied
+#define GOVERNOR_RELEASE_TICKS		128			// ticks under its release load before it is lifted, two seconds
+#define GOVERNOR_RESYNC_TICKS		4			// a lane further behind than this skips ahead instead of catching up
+
+#define GOVERNOR_ENGAGE				1
+#define GOVERNOR_RELEASE			2
+#define GOVERNOR_RESYNC				3
+
+// One change the governor made, as handed back by drainEvents()
+struct GovernorEvent {
+	uint32_t kind;								// GOVERNOR_ENGAGE, GOVERNOR_RELEASE or GOVERNOR_RESYNC
+	uint32_t tick;								// the lane's tick it happened on
+	int32_t step;								// step applied or lifted; the lane for a resync
+	uint32_t level;								// steps applied afterwards
+	uint32_t value;								// smoothed load percentage, or ticks skipped for a resync
+};
+
+struct GovernorStats {
+	uint64_t ticks;								// on every lane
+	uint64_t overruns;							// ticks whose work took longer than the budget
+	uint64_t skipped;							// deadlines given up by a resync
+	uint64_t eventsDropped;
+	uint32_t level;
+	uint32_t loadPercent;						// smoothed, of the busiest lane
+	uint32_t worstUs;							// longest tick of work so far
+	uint32_t phases;							// added, the entries of phaseUs in use
+	uint32_t phaseUs[GOVERNOR_PHASES];			// smoothed time per phase per tick
+};
+
+class TickGovernor
+{
+  public:
+	TickGovernor();
+	int32_t init(uint32_t budgetUs);
+	int32_t addPhase(uint32_t lane);
+	int32_t addStep(uint32_t engagePercent, uint32_t releasePercent);
+	int32_t waitTick(uint32_t lane);
+	int32_t beginTick(uint32_t lane);
+	void mark(uint32_t phase);
+	bool engaged(uint32_t step);
+	uint32_t level();
+	uint32_t drainEvents(GovernorEvent *out, uint32_t max);
+	void getStats(GovernorStats *stats);
+	static uint64_t now();
+
+  private:
+	struct Lane {
+		uint64_t tick;							// deadline count since init
+		uint64_t tickStart;						// ns; when the lane woke for this tick
+		uint64_t lastMark;						// ns; start of the phase being timed
+		uint32_t loadPercent;					// smoothed
+		bool started;
+	};
+
+	struct Step {
+		uint32_t engagePercent;
+		uint32_t releasePercent;
+	};
+
+	void closeTick(uint32_t lane, uint64_t time);
+	void govern(uint32_t lane);
+	void report(uint32_t kind, uint32_t lane, int32_t step, uint32_t value);
+
+	uint64_t budgetNs;
+	uint64_t epochNs;
+	Lane lanes[GOVERNOR_LANES];
+	uint32_t phaseLane[GOVERNOR_PHASES];
+	uint64_t phaseNs[GOVERNOR_PHASES];			// this tick, reset when the lane's tick closes
+	uint32_t phaseSmoothedUs[GOVERNOR_PHASES];
+	uint32_t phaseCount;
+	Step steps[GOVERNOR_STEPS];
+	uint32_t stepCount;
+	std::atomic<uint32_t> applied;				// the first applied steps are engaged
+	uint32_t overTicks;
+	uint32_t underTicks;
+	uint64_t governedTick;						// last grid tick the steps were decided on
+
+	GovernorEvent events[GOVERNOR_EVENTS];
+	uint32_t eventHead;
+	uint32_t eventCount;
+	GovernorStats stats;
+	std::mutex lock;
+};
+
+#endif
@@ -0,0 +1,308 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	ingress.cpp -   Receive-path filter: size validation, known endpoints, rate limits
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		IngressFilter();
+--					int32_t allow(uint8_t header, uint32_t size, int32_t idOffset);
+--					void setRates(uint32_t rate, uint32_t burst, uint32_t unknownRate, uint32_t unknownBurst);
+--					int32_t addEndpoint(EndPoint ep, uint8_t id);
+--					int32_t removeEndpoint(EndPoint ep);
+--					int32_t check(const char *data, int32_t len, EndPoint ep);
+--					void getStats(IngressStats *stats);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Once a filter is set on a Server, every datagram is checked here before UdpRecvFrom hands
+--		it back, and rejected ones are skipped without ever reaching managed code. A datagram
+--		passes when:
+--
+--		- its first byte has a rule and its length is one of the sizes allowed for that header;
+--		- for headers with an id offset, the sender is a registered endpoint and the byte at that
+--		  offset is the player id it was registered with;
+--		- the sender's token bucket has a token. Registered endpoints each have their own
+--		  bucket; everyone else shares one, so a flood from unknown addresses cannot crowd out
+--		  the players already in the game.
+--
+--		Rejections are only counted, by reason, in the stats.
+---------------------------------------------------------------------------------------*/
+#include "ingress.h"
+
+static uint64_t nowNs()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+IngressFilter::IngressFilter()
+{
+	memset(rules, 0, sizeof(rules));
+	memset(entries, 0, sizeof(entries));
+	memset(&stats, 0, sizeof(stats));
+	memset(&unknownBucket, 0, sizeof(unknownBucket));
+	setRates(128, 64, 64, 32);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: allow
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t allow(uint8_t header, uint32_t size, int32_t idOffset)
+--								header: first byte of the datagram
+--								size: a datagram length accepted for that header
+--								idOffset: offset of the sender's player id, or INGRESS_ANY_SOURCE
+--
+-- RETURNS: 0 on success, or -1 if the header already has INGRESS_SIZES sizes.
+--
+-- NOTES:
+-- 		Call once per allowed size. The id offset applies to every size of the header; the last
+--		call sets it.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t IngressFilter::allow(uint8_t header, uint32_t size, int32_t idOffset)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	Rule &rule = rules[header];
+	if (rule.sizeCount >= INGRESS_SIZES || (idOffset >= 0 && (uint32_t)idOffset >= size))
+	{
+		return -1;
+	}
+
+	rule.sizes[rule.sizeCount++] = size;
+	rule.idOffset = idOffset;
+	return 0;
+}
+
+void IngressFilter::setRates(uint32_t perEndpoint, uint32_t perBurst, uint32_t unknown, uint32_t unknownBurstSize)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	rate = perEndpoint;
+	burst = perBurst;
+	unknownRate = unknown;
+	unknownBurst = unknownBurstSize;
+}
+
+uint64_t IngressFilter::keyOf(EndPoint ep)
+{
+	return ((uint64_t)ep.addr << 16) | ep.port;
+}
+
+// Slot holding key, or -1. Probing runs past removed slots and stops at an empty one.
+int32_t IngressFilter::find(uint64_t key)
+{
+	uint32_t slot = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 56) & (INGRESS_ENDPOINTS - 1);
+	for (uint32_t i = 0; i < INGRESS_ENDPOINTS; i++)
+	{
+		Entry &entry = entries[(slot + i) & (INGRESS_ENDPOINTS - 1)];
+		if (entry.key == 0)
+		{
+			return -1;
+		}
+		if (entry.key == key && !entry.removed)
+		{
+			return (int32_t)((slot + i) & (INGRESS_ENDPOINTS - 1));
+		}
+	}
+	return -1;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: addEndpoint
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t addEndpoint(EndPoint ep, uint8_t id)
+--								ep: the player's address
+--								id: the player id its ticks must carry
+--
+-- RETURNS: 0 on success, or -1 if the table is full.
+--
+-- NOTES:
+-- 		Registering an address again only changes its id. A new endpoint starts with a full bucket.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t IngressFilter::addEndpoint(EndPoint ep, uint8_t id)
+{
+	uint64_t key = keyOf(ep);
+	std::lock_guard<std::mutex> guard(lock);
+
+	int32_t existing = find(key);
+	if (existing >= 0)
+	{
+		entries[existing].id = id;
+		return 0;
+	}
+
+	uint32_t slot = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> 56) & (INGRESS_ENDPOINTS - 1);
+	for (uint32_t i = 0; i < INGRESS_ENDPOINTS; i++)
+	{
+		Entry &entry = entries[(slot + i) & (INGRESS_ENDPOINTS - 1)];
+		if (entry.key == 0 || entry.removed)
+		{
+			entry.key = key;
+			entry.removed = false;
+			entry.id = id;
+			entry.bucket.tokens = burst;
+			entry.bucket.lastNs = nowNs();
+			return 0;
+		}
+	}
+	return -1;
+}
+
+int32_t IngressFilter::removeEndpoint(EndPoint ep)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int32_t slot = find(keyOf(ep));
+	if (slot < 0)
+	{
+		return -1;
+	}
+	entries[slot].removed = true;
+	return 0;
+}
+
+bool IngressFilter::take(Bucket &bucket, double fillRate, double size, uint64_t now)
+{
+	if (bucket.lastNs == 0)
+	{
+		bucket.tokens = size;
+	}
+	else
+	{
+		bucket.tokens += (double)(now - bucket.lastNs) * fillRate / 1e9;
+		if (bucket.tokens > size)
+		{
+			bucket.tokens = size;
+		}
+	}
+	bucket.lastNs = now;
+
+	if (bucket.tokens < 1.0)
+	{
+		return false;
+	}
+	bucket.tokens -= 1.0;
+	return true;
+}
+
+int32_t IngressFilter::reject(int32_t verdict)
+{
+	switch (verdict)
+	{
+		case INGRESS_BAD_HEADER:
+			stats.badHeader++;
+			break;
+		case INGRESS_BAD_SIZE:
+			stats.badSize++;
+			break;
+		case INGRESS_UNKNOWN_SOURCE:
+			stats.unknownSource++;
+			break;
+		case INGRESS_BAD_ID:
+			stats.badId++;
+			break;
+		case INGRESS_RATE_LIMITED:
+			stats.rateLimited++;
+			break;
+	}
+	return verdict;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: check
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t check(const char *data, int32_t len, EndPoint ep)
+--								data: the datagram
+--								len: its length
+--								ep: the sender
+--
+-- RETURNS: INGRESS_ACCEPT, or the INGRESS_ reason it was rejected.
+--
+-- NOTES:
+-- 		The cheap checks run first, so malformed traffic is turned away before it can spend a token.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t IngressFilter::check(const char *data, int32_t len, EndPoint ep)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (len <= 0)
+	{
+		return reject(INGRESS_BAD_SIZE);
+	}
+
+	const Rule &rule = rules[(uint8_t)data[0]];
+	if (rule.sizeCount == 0)
+	{
+		return reject(INGRESS_BAD_HEADER);
+	}
+
+	bool sizeOk = false;
+	for (uint32_t i = 0; i < rule.sizeCount; i++)
+	{
+		sizeOk |= rule.sizes[i] == (uint32_t)len;
+	}
+	if (!sizeOk)
+	{
+		return reject(INGRESS_BAD_SIZE);
+	}
+
+	uint64_t now = nowNs();
+	int32_t slot = find(keyOf(ep));
+
+	if (rule.idOffset >= 0)
+	{
+		if (slot < 0)
+		{
+			return reject(INGRESS_UNKNOWN_SOURCE);
+		}
+		if ((uint8_t)data[rule.idOffset] != entries[slot].id)
+		{
+			return reject(INGRESS_BAD_ID);
+		}
+	}
+
+	bool allowed = slot >= 0 ? take(entries[slot].bucket, rate, burst, now) : take(unknownBucket, unknownRate, unknownBurst, now);
+	if (!allowed)
+	{
+		return reject(INGRESS_RATE_LIMITED);
+	}
+
+	stats.accepted++;
+	return INGRESS_ACCEPT;
+}
+
+void IngressFilter::getStats(IngressStats *out)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	*out = stats;
+}
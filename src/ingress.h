@@ -0,0 +1,77 @@
+#ifndef INGRESS_DEF
+#define INGRESS_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <mutex>
+#include "EndPoint.h"
+
+#define INGRESS_ACCEPT				0
+#define INGRESS_BAD_HEADER			1			// no rule for the header byte
+#define INGRESS_BAD_SIZE			2			// header known, size not allowed for it
+#define INGRESS_UNKNOWN_SOURCE		3			// header needs a registered endpoint
+#define INGRESS_BAD_ID				4			// id byte does not match the endpoint's player
+#define INGRESS_RATE_LIMITED		5
+
+#define INGRESS_ANY_SOURCE			-1			// idOffset for headers accepted from anyone, e.g. joins
+#define INGRESS_SIZES				4			// allowed sizes per header
+#define INGRESS_ENDPOINTS			256			// hash table slots, power of two
+#define INGRESS_DRAIN_MAX			256			// rejected datagrams skipped per receive call
+
+struct IngressStats {
+	uint64_t accepted;
+	uint64_t badHeader;
+	uint64_t badSize;
+	uint64_t unknownSource;
+	uint64_t badId;
+	uint64_t rateLimited;
+};
+
+class IngressFilter
+{
+  public:
+	IngressFilter();
+	int32_t allow(uint8_t header, uint32_t size, int32_t idOffset);
+	void setRates(uint32_t rate, uint32_t burst, uint32_t unknownRate, uint32_t unknownBurst);
+	int32_t addEndpoint(EndPoint ep, uint8_t id);
+	int32_t removeEndpoint(EndPoint ep);
+	int32_t check(const char *data, int32_t len, EndPoint ep);
+	void getStats(IngressStats *stats);
+
+  private:
+	struct Rule {
+		uint32_t sizes[INGRESS_SIZES];
+		uint32_t sizeCount;
+		int32_t idOffset;
+	};
+
+	struct Bucket {
+		double tokens;
+		uint64_t lastNs;
+	};
+
+	struct Entry {
+		uint64_t key;							// addr << 16 | port, 0 for an empty slot
+		bool removed;
+		uint8_t id;
+		Bucket bucket;
+	};
+
+	static uint64_t keyOf(EndPoint ep);
+	int32_t find(uint64_t key);
+	bool take(Bucket &bucket, double rate, double burst, uint64_t now);
+	int32_t reject(int32_t verdict);
+
+	std::mutex lock;
+	Rule rules[256];
+	Entry entries[INGRESS_ENDPOINTS];
+	Bucket unknownBucket;
+	double rate;
+	double burst;
+	double unknownRate;
+	double unknownBurst;
+	IngressStats stats;
+};
+
+#endif
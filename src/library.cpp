@@ -8,12 +8,27 @@
 --					int32_t Server_PollSocket(void *serverPtr)
 --					int32_t Server_sendBytes(void *serverPtr, EndPoint ep, char *data, uint32_t len)
 --					int32_t Server_recvBytes(void *serverPtr, EndPoint *addr, char *buffer, uint32_t bufSize)
+--					int32_t Server_setEngine(void *serverPtr, int32_t engine)
+--					int32_t Server_queueSend(void *serverPtr, EndPoint ep, char *data, uint32_t len)
+--					int32_t Server_flushSends(void *serverPtr)
+--					int32_t Server_sendBuffer(void *serverPtr, void *poolPtr, int32_t handle, EndPoint ep, uint32_t len)
+--					int32_t Server_queueBuffer(void *serverPtr, void *poolPtr, int32_t handle, EndPoint ep, uint32_t len)
+--					int32_t Server_recvBuffer(void *serverPtr, void *poolPtr, int32_t handle, EndPoint *addr)
+--					int32_t Server_getSocket(void *serverPtr)
+--					void Server_setFilter(void *serverPtr, void *filterPtr)
+--					int32_t Server_setPacing(void *serverPtr, int32_t mode, uint32_t intervalUs, uint32_t percent)
+--					void Server_getPacerStats(void *serverPtr, PacerStats *stats)
+--					void Server_setUpstream(void *serverPtr, EndPoint proxy)
 --
 --                  Client* Client_CreateClient()
 --                  int32_t Client_sendBytes(void *clientPtr, char *buffer, uint32_t len)
 --                  int32_t Client_recvBytes(void *clientPtr, char *buffer, uint32_t len)
 --                  int32_t Client_PollSocket(void *clientPtr)
 --                  int32_t Client_initClient(void *clientPtr, EndPoint ep)
+--                  int32_t Client_recvLatest(void *clientPtr, char *buffer, uint32_t size, char *events,
+--                                            uint32_t eventsSize, uint32_t *eventsLen)
+--                  int32_t Client_sendTick(void *clientPtr, char *buffer, uint32_t len)
+--                  void Client_getReassemblyStats(void *clientPtr, ReassemblyStats *stats)
 --
 --                  TCPServer* TCPServer_CreateServer()
 --                  int32_t TCPServer_initServer(void * serverPtr, short port)
@@ -22,6 +37,7 @@
 --                  int32_t TCPServer_recvBytes(void * serverPtr, int32_t clientSocket, char * buffer, uint32_t bufSize)
 --                  int32_t TCPServer_closeClientSocket(void* serverPtr, int32_t clientSocket)
 --                  void TCPServer_closeListenSocket(void* serverPtr, int32_t sockfd)
+--                  int32_t TCPServer_setEngine(void* serverPtr, int32_t engine)
 --
 --                  TCPClient* TCPClient_CreateClient()
 --                  int32_t TCPClient_initClient(void *clientPtr, EndPoint ep)
@@ -29,10 +45,200 @@
 --                  int32_t TCPClient_recvBytes(void *clientPtr, char *buffer, uint32_t len)
 --                  int32_t TCPClient_closeConnection(void *clientPtr, int32_t sockfd)
 --
+--                  MatchHost* MatchHost_CreateHost()
+--                  int32_t MatchHost_initHost(void *hostPtr, short port)
+--                  Server* MatchHost_transport(void *hostPtr)
+--                  void MatchHost_setJoin(void *hostPtr, uint8_t header, uint32_t tokenOffset)
+--                  void MatchHost_setTuning(void *hostPtr, void *tuningPtr)
+--                  int32_t MatchHost_start(void *hostPtr, int32_t workers)
+--                  int32_t MatchHost_createMatch(void *hostPtr, MatchTickCallback tick, void *context,
+--                                                uint32_t tickIntervalUs, uint32_t arenaSize)
+--                  int32_t MatchHost_destroyMatch(void *hostPtr, int32_t matchId)
+--                  int32_t MatchHost_bindEndPoint(void *hostPtr, EndPoint ep, int32_t matchId)
+--                  int32_t MatchHost_unbindEndPoint(void *hostPtr, EndPoint ep)
+--                  int32_t MatchHost_recvBytes(void *hostPtr, int32_t matchId, EndPoint *addr, char *buffer, uint32_t bufSize)
+--                  int32_t MatchHost_sendBytes(void *hostPtr, EndPoint ep, char *data, uint32_t len)
+--                  int32_t MatchHost_queueSend(void *hostPtr, EndPoint ep, char *data, uint32_t len)
+--                  int32_t MatchHost_flushSends(void *hostPtr)
+--                  void MatchHost_getStats(void *hostPtr, MatchStats *stats)
+--                  void MatchHost_stop(void *hostPtr)
+--                  void MatchHost_DestroyHost(void *hostPtr)
+--
+--                  void *Arena_allocate(void *arenaPtr, uint32_t size, uint32_t align)
+--                  void Arena_reset(void *arenaPtr)
+--                  uint32_t Arena_used(void *arenaPtr)
+--
+--                  BufferPool* BufferPool_CreatePool()
+--                  int32_t BufferPool_initPool(void *poolPtr, uint32_t bufferSize, uint32_t count, uint32_t flags)
+--                  int32_t BufferPool_lease(void *poolPtr)
+--                  int32_t BufferPool_release(void *poolPtr, int32_t handle)
+--                  char *BufferPool_address(void *poolPtr, int32_t handle)
+--                  uint32_t BufferPool_available(void *poolPtr)
+--                  void BufferPool_DestroyPool(void *poolPtr)
+--
+--                  ConnStats* ConnStats_Create(uint32_t tickRate)
+--                  void ConnStats_reset(void *statsPtr, int32_t id)
+--                  uint32_t ConnStats_onSend(void *statsPtr, int32_t id, uint32_t tick)
+--                  void ConnStats_onAck(void *statsPtr, int32_t id, uint32_t ack, uint32_t ackBits)
+--                  int32_t ConnStats_shouldSend(void *statsPtr, int32_t id, uint64_t tick)
+--                  uint32_t ConnStats_budget(void *statsPtr, int32_t id)
+--                  void ConnStats_getInfo(void *statsPtr, int32_t id, ConnInfo *info)
+--                  int32_t ConnStats_ackedTick(void *statsPtr, int32_t id, uint32_t *tick)
+--                  void ConnStats_onClock(void *statsPtr, int32_t id, uint32_t ack, uint32_t clientTimeUs,
+--                                         uint32_t ackDelayUs)
+--                  int32_t ConnStats_getClock(void *statsPtr, int32_t id, ClockInfo *info)
+--                  int32_t ConnStats_clientTick(void *statsPtr, int32_t id, uint32_t clientTimeUs, uint32_t *tick)
+--                  void ConnStats_Destroy(void *statsPtr)
+--
+--                  int32_t Snapshot_pack(char *tick, uint32_t len, char *out, uint32_t outSize)
+--                  int32_t Snapshot_unpack(char *packed, uint32_t len, char *tick, uint32_t tickSize)
+--                  int32_t Snapshot_fit(char *tick, uint32_t len, uint32_t budget, uint32_t *bullets, uint32_t *weapons)
+--
+--                  uint32_t Compressor_bound(uint32_t len, uint32_t chunkSize)
+--                  int32_t Compressor_compress(char *src, uint32_t len, char *dst, uint32_t dstSize, uint32_t chunkSize,
+--                                              int32_t threads)
+--                  int32_t Compressor_size(char *src, uint32_t len)
+--                  int32_t Compressor_decompress(char *src, uint32_t len, char *dst, uint32_t dstSize, int32_t threads)
+--
+--                  SpawnSampler* SpawnSampler_Create()
+--                  int32_t SpawnSampler_init(void *samplerPtr, uint32_t width, uint32_t length, uint32_t spacing, uint64_t seed)
+--                  void SpawnSampler_blockTerrain(void *samplerPtr, uint8_t *tiles)
+--                  void SpawnSampler_setHotspots(void *samplerPtr, int32_t *xz, uint32_t count, uint32_t cluster)
+--                  void SpawnSampler_setTown(void *samplerPtr, int32_t *xz, uint32_t count)
+--                  int32_t SpawnSampler_sample(void *samplerPtr, uint32_t count, uint32_t townCount, float hotspotChance,
+--                                              int32_t firstId, char *out, uint32_t outSize)
+--                  void SpawnSampler_Destroy(void *samplerPtr)
+--
+--                  PositionHistory* PositionHistory_Create()
+--                  void PositionHistory_beginTick(void *historyPtr, uint32_t tick)
+--                  void PositionHistory_store(void *historyPtr, int32_t id, float x, float z, float r)
+--                  uint32_t PositionHistory_latest(void *historyPtr)
+--                  int32_t PositionHistory_positionAt(void *historyPtr, uint32_t tick, int32_t id, float *x, float *z, float *r)
+--                  int32_t PositionHistory_hits(void *historyPtr, uint32_t tick, float x, float z, float radius, int32_t exclude,
+--                                               uint8_t *ids, uint32_t maxIds)
+--                  void PositionHistory_Destroy(void *historyPtr)
+--
+--                  Tuning* Tuning_Create()
+--                  int32_t Tuning_load(void *tuningPtr, const char *path)
+--                  uint32_t Tuning_applyThread(void *tuningPtr, int32_t role)
+--                  uint32_t Tuning_applySocket(void *tuningPtr, int32_t kind, int32_t fd)
+--                  int32_t Tuning_describeThread(void *tuningPtr, int32_t role, char *out, uint32_t size)
+--                  int32_t Tuning_describeSocket(void *tuningPtr, int32_t kind, char *out, uint32_t size)
+--                  void Tuning_Destroy(void *tuningPtr)
+--
+--                  MatchRecorder* MatchRecorder_Create()
+--                  int32_t MatchRecorder_open(void *recorderPtr, const char *path, uint64_t capacity, uint32_t stateSize,
+--                                             uint32_t keyInterval)
+--                  int32_t MatchRecorder_record(void *recorderPtr, uint32_t tick, const char *state)
+--                  uint32_t MatchRecorder_dropped(void *recorderPtr)
+--                  void MatchRecorder_close(void *recorderPtr)
+--                  void MatchRecorder_Destroy(void *recorderPtr)
+--
+--                  MatchReader* MatchReader_Create()
+--                  int32_t MatchReader_open(void *readerPtr, const char *path)
+--                  uint32_t MatchReader_firstTick(void *readerPtr)
+--                  uint32_t MatchReader_lastTick(void *readerPtr)
+--                  uint32_t MatchReader_stateSize(void *readerPtr)
+--                  int32_t MatchReader_seek(void *readerPtr, uint32_t tick, char *state, uint32_t size, uint32_t *found)
+--                  void MatchReader_close(void *readerPtr)
+--                  void MatchReader_Destroy(void *readerPtr)
+--
+--                  IngressFilter* IngressFilter_Create()
+--                  int32_t IngressFilter_allow(void *filterPtr, uint8_t header, uint32_t size, int32_t idOffset)
+--                  void IngressFilter_setRates(void *filterPtr, uint32_t rate, uint32_t burst, uint32_t unknownRate,
+--                                              uint32_t unknownBurst)
+--                  int32_t IngressFilter_addEndpoint(void *filterPtr, EndPoint ep, uint8_t id)
+--                  int32_t IngressFilter_removeEndpoint(void *filterPtr, EndPoint ep)
+--                  void IngressFilter_getStats(void *filterPtr, IngressStats *stats)
+--                  void IngressFilter_Destroy(void *filterPtr)
+--
+--                  AsyncLog* AsyncLog_Create()
+--                  int32_t AsyncLog_start(void *logPtr, int32_t fd)
+--                  int32_t AsyncLog_addTemplate(void *logPtr, const char *format)
+--                  int32_t AsyncLog_write(void *logPtr, const uint16_t *text, uint32_t len)
+--                  int32_t AsyncLog_event(void *logPtr, int32_t id, int64_t a0, int64_t a1, int64_t a2, int64_t a3)
+--                  void AsyncLog_getStats(void *logPtr, LogStats *stats)
+--                  void AsyncLog_stop(void *logPtr)
+--                  void AsyncLog_Destroy(void *logPtr)
+--
+--                  EventQueue* EventQueue_Create()
+--                  int32_t EventQueue_init(void *queuePtr, uint32_t capacity, uint32_t recordSize)
+--                  int32_t EventQueue_push(void *queuePtr, const char *record)
+--                  uint32_t EventQueue_drain(void *queuePtr, char *out, uint32_t maxRecords)
+--                  uint64_t EventQueue_dropped(void *queuePtr)
+--                  void EventQueue_Destroy(void *queuePtr)
+--
+--                  TimerWheel* TimerWheel_Create()
+--                  int32_t TimerWheel_init(void *wheelPtr, uint32_t capacity)
+--                  int32_t TimerWheel_schedule(void *wheelPtr, uint32_t kind, uint32_t key, uint32_t delayMs)
+--                  int32_t TimerWheel_reschedule(void *wheelPtr, int32_t handle, uint32_t delayMs)
+--                  int32_t TimerWheel_cancel(void *wheelPtr, int32_t handle)
+--                  int32_t TimerWheel_advance(void *wheelPtr, TimerFired *out, uint32_t max)
+--                  uint32_t TimerWheel_pending(void *wheelPtr)
+--                  uint64_t TimerWheel_now()
+--                  void TimerWheel_Destroy(void *wheelPtr)
+--
+--                  BroadcastRing* BroadcastRing_Create()
+--                  int32_t BroadcastRing_createRing(void *ringPtr, const char *name, uint32_t slots, uint32_t slotSize)
+--                  int32_t BroadcastRing_publish(void *ringPtr, uint32_t tick, const char *data, uint32_t len)
+--                  uint64_t BroadcastRing_head(void *ringPtr)
+--                  void BroadcastRing_Destroy(void *ringPtr)
+--
+--                  TickGovernor* TickGovernor_Create()
+--                  int32_t TickGovernor_init(void *governorPtr, uint32_t budgetUs)
+--                  int32_t TickGovernor_addPhase(void *governorPtr, uint32_t lane)
+--                  int32_t TickGovernor_addStep(void *governorPtr, uint32_t engagePercent, uint32_t releasePercent)
+--                  int32_t TickGovernor_waitTick(void *governorPtr, uint32_t lane)
+--                  int32_t TickGovernor_beginTick(void *governorPtr, uint32_t lane)
+--                  void TickGovernor_mark(void *governorPtr, uint32_t phase)
+--                  uint32_t TickGovernor_level(void *governorPtr)
+--                  uint32_t TickGovernor_drainEvents(void *governorPtr, GovernorEvent *out, uint32_t max)
+--                  void TickGovernor_getStats(void *governorPtr, GovernorStats *stats)
+--                  void TickGovernor_Destroy(void *governorPtr)
+--
+--                  TerrainPack* TerrainPack_Create()
+--                  int32_t TerrainPack_build(void *packPtr, const uint8_t *tiles, uint32_t width, uint32_t length,
+--                                            const int32_t *fixedXZ, uint32_t fixedCount, const char *payload, uint32_t payloadSize)
+--                  int32_t TerrainPack_save(void *packPtr, const char *path)
+--                  int32_t TerrainPack_open(void *packPtr, const char *path)
+--                  int32_t TerrainPack_occupied(void *packPtr, int32_t x, int32_t z)
+--                  int32_t TerrainPack_expandTiles(void *packPtr, uint8_t *tiles, uint64_t size)
+--                  int32_t TerrainPack_getInfo(void *packPtr, TerrainPackHeader *info)
+--                  int32_t TerrainPack_copyPayload(void *packPtr, char *out, uint32_t size)
+--                  void TerrainPack_Destroy(void *packPtr)
+--
+--                  int32_t Sweep_bullets(void *historyPtr, void *packPtr, SweepBullet *bullets, SweepHit *hits,
+--                                        uint32_t count)
+--
 --	DATE:			March 10th, 2018
 --
 --	REVISIONS:		
 --                  March 17th, 2018: added TCP server functions - Wilson Hu
+--                  October 19th, 2026: added multi-match host and arena functions - agent
+--                  October 19th, 2026: added transport engine selection and batched sends - agent
+--                  October 19th, 2026: added buffer pool and pooled send/receive functions - agent
+--                  October 19th, 2026: added drain-to-latest client receive - agent
+--                  October 19th, 2026: added connection stats and rate control functions - agent
+--                  October 19th, 2026: added packed snapshot codec functions - agent
+--                  October 19th, 2026: added chunked compressor functions - agent
+--                  October 19th, 2026: added weapon spawn sampler functions - agent
+--                  October 19th, 2026: added position history functions, snapshot ticks in connection stats - agent
+--                  October 19th, 2026: added tuning profile functions - agent
+--                  October 19th, 2026: added match recorder and reader functions - agent
+--                  October 19th, 2026: added ingress filter functions - agent
+--                  October 19th, 2026: added asynchronous log functions - agent
+--                  October 19th, 2026: added paced send functions - agent
+--                  October 19th, 2026: added event queue functions - agent
+--                  October 19th, 2026: added upstream proxy mode - agent
+--                  October 19th, 2026: added fragment reassembly stats - agent
+--                  October 19th, 2026: added timer wheel functions - agent
+--                  October 19th, 2026: added spectator broadcast ring functions - agent
+--                  October 19th, 2026: added tick governor functions - agent
+--                  October 19th, 2026: added terrain pack functions - agent
+--                  October 19th, 2026: added client clock sync functions - agent
+--                  October 19th, 2026: added swept bullet collision - agent
+--                  October 19th, 2026: added per-connection snapshot budgets and fitting events to them - agent
+--                  October 19th, 2026: match host transport, join, tuning and queued sends; governor beginTick - agent
 --
 --	DESIGNERS:		Delan Elliot, Wilson Hu, Jeff Chou, Jeremy Lee, Matthew Shew, Calvin Lai, William Murphy
 --
@@ -61,6 +267,22 @@
 #include "client.h"
 #include "server.h"
 #include "tcpclient.h"
+#include "matchhost.h"
+#include "bufferpool.h"
+#include "connstats.h"
+#include "snapcodec.h"
+#include "compressor.h"
+#include "spawnsampler.h"
+#include "poshistory.h"
+#include "tuning.h"
+#include "recorder.h"
+#include "asynclog.h"
+#include "eventqueue.h"
+#include "timerwheel.h"
+#include "broadcast.h"
+#include "governor.h"
+#include "terrainpack.h"
+#include "sweep.h"
 
 
 
@@ -93,6 +315,81 @@ extern "C" int32_t Server_recvBytes(void *serverPtr, EndPoint *addr, char *buffe
     return result;
 }
 
+extern "C" int32_t Server_setEngine(void *serverPtr, int32_t engine)
+{
+    return ((Server *)serverPtr)->setEngine(engine);
+}
+
+extern "C" int32_t Server_queueSend(void *serverPtr, EndPoint ep, char *data, uint32_t len)
+{
+    return ((Server *)serverPtr)->queueSend(ep, data, len);
+}
+
+extern "C" int32_t Server_flushSends(void *serverPtr)
+{
+    return ((Server *)serverPtr)->flushSends();
+}
+
+// Pooled variants: the data lives in a BufferPool buffer, so the caller passes a handle instead of
+// a pinned managed array.
+extern "C" int32_t Server_sendBuffer(void *serverPtr, void *poolPtr, int32_t handle, EndPoint ep, uint32_t len)
+{
+    BufferPool *pool = (BufferPool *)poolPtr;
+    char *data = pool->address(handle);
+    if (data == 0 || len > pool->bufferSize())
+    {
+        return -1;
+    }
+    return ((Server *)serverPtr)->sendBytes(ep, data, len);
+}
+
+extern "C" int32_t Server_queueBuffer(void *serverPtr, void *poolPtr, int32_t handle, EndPoint ep, uint32_t len)
+{
+    BufferPool *pool = (BufferPool *)poolPtr;
+    char *data = pool->address(handle);
+    if (data == 0 || len > pool->bufferSize())
+    {
+        return -1;
+    }
+    return ((Server *)serverPtr)->queueSend(ep, data, len);
+}
+
+extern "C" int32_t Server_recvBuffer(void *serverPtr, void *poolPtr, int32_t handle, EndPoint *addr)
+{
+    BufferPool *pool = (BufferPool *)poolPtr;
+    char *buffer = pool->address(handle);
+    if (buffer == 0)
+    {
+        return -1;
+    }
+    return ((Server *)serverPtr)->UdpRecvFrom(buffer, pool->bufferSize(), addr);
+}
+
+extern "C" int32_t Server_getSocket(void *serverPtr)
+{
+    return ((Server *)serverPtr)->getSocket();
+}
+
+extern "C" void Server_setFilter(void *serverPtr, void *filterPtr)
+{
+    ((Server *)serverPtr)->setFilter((IngressFilter *)filterPtr);
+}
+
+extern "C" int32_t Server_setPacing(void *serverPtr, int32_t mode, uint32_t intervalUs, uint32_t percent)
+{
+    return ((Server *)serverPtr)->setPacing(mode, intervalUs, percent);
+}
+
+extern "C" void Server_getPacerStats(void *serverPtr, PacerStats *stats)
+{
+    ((Server *)serverPtr)->getPacerStats(stats);
+}
+
+extern "C" void Server_setUpstream(void *serverPtr, EndPoint proxy)
+{
+    ((Server *)serverPtr)->setUpstream(proxy);
+}
+
 
 //UDP CLIENT
 extern "C" Client *Client_CreateClient()
@@ -122,6 +419,21 @@ extern "C" int32_t Client_initClient(void *clientPtr, EndPoint ep)
     return ((Client *)clientPtr)->initializeSocket(ep);
 }
 
+extern "C" int32_t Client_recvLatest(void *clientPtr, char *buffer, uint32_t size, char *events, uint32_t eventsSize, uint32_t *eventsLen)
+{
+    return ((Client *)clientPtr)->recvLatest(buffer, size, events, eventsSize, eventsLen);
+}
+
+extern "C" int32_t Client_sendTick(void *clientPtr, char *buffer, uint32_t len)
+{
+    return ((Client *)clientPtr)->sendTick(buffer, len);
+}
+
+extern "C" void Client_getReassemblyStats(void *clientPtr, ReassemblyStats *stats)
+{
+    ((Client *)clientPtr)->getReassemblyStats(stats);
+}
+
 
 //TCP SERVER
 extern "C" TCPServer * TCPServer_CreateServer()
@@ -159,6 +471,11 @@ extern "C" int32_t TCPServer_closeListenSocket(void* serverPtr, int32_t sockfd)
     return ((TCPServer*)serverPtr)->closeListenSocket(sockfd);
 }
 
+extern "C" int32_t TCPServer_setEngine(void* serverPtr, int32_t engine)
+{
+    return ((TCPServer*)serverPtr)->setEngine(engine);
+}
+
 
 
 //TCP CLIENT
@@ -189,3 +506,727 @@ extern "C" int32_t TCPClient_closeConnection(void *clientPtr, int32_t sockfd)
 
 
 
+//MATCH HOST
+extern "C" MatchHost *MatchHost_CreateHost()
+{
+    return new MatchHost();
+}
+
+extern "C" int32_t MatchHost_initHost(void *hostPtr, short port)
+{
+    return ((MatchHost *)hostPtr)->initialize(port);
+}
+
+extern "C" Server *MatchHost_transport(void *hostPtr)
+{
+    return ((MatchHost *)hostPtr)->transport();
+}
+
+extern "C" void MatchHost_setJoin(void *hostPtr, uint8_t header, uint32_t tokenOffset)
+{
+    ((MatchHost *)hostPtr)->setJoin(header, tokenOffset);
+}
+
+extern "C" void MatchHost_setTuning(void *hostPtr, void *tuningPtr)
+{
+    ((MatchHost *)hostPtr)->setTuning((Tuning *)tuningPtr);
+}
+
+extern "C" int32_t MatchHost_start(void *hostPtr, int32_t workers)
+{
+    return ((MatchHost *)hostPtr)->start(workers);
+}
+
+extern "C" int32_t MatchHost_createMatch(void *hostPtr, MatchTickCallback tick, void *context, uint32_t tickIntervalUs, uint32_t arenaSize)
+{
+    return ((MatchHost *)hostPtr)->createMatch(tick, context, tickIntervalUs, arenaSize);
+}
+
+extern "C" int32_t MatchHost_destroyMatch(void *hostPtr, int32_t matchId)
+{
+    return ((MatchHost *)hostPtr)->destroyMatch(matchId);
+}
+
+extern "C" int32_t MatchHost_bindEndPoint(void *hostPtr, EndPoint ep, int32_t matchId)
+{
+    return ((MatchHost *)hostPtr)->bindEndPoint(ep, matchId);
+}
+
+extern "C" int32_t MatchHost_unbindEndPoint(void *hostPtr, EndPoint ep)
+{
+    return ((MatchHost *)hostPtr)->unbindEndPoint(ep);
+}
+
+extern "C" int32_t MatchHost_recvBytes(void *hostPtr, int32_t matchId, EndPoint *addr, char *buffer, uint32_t bufSize)
+{
+    return ((MatchHost *)hostPtr)->recvMatch(matchId, addr, buffer, bufSize);
+}
+
+extern "C" int32_t MatchHost_sendBytes(void *hostPtr, EndPoint ep, char *data, uint32_t len)
+{
+    return ((MatchHost *)hostPtr)->sendBytes(ep, data, len);
+}
+
+extern "C" int32_t MatchHost_queueSend(void *hostPtr, EndPoint ep, char *data, uint32_t len)
+{
+    return ((MatchHost *)hostPtr)->queueSend(ep, data, len);
+}
+
+extern "C" int32_t MatchHost_flushSends(void *hostPtr)
+{
+    return ((MatchHost *)hostPtr)->flushSends();
+}
+
+extern "C" void MatchHost_getStats(void *hostPtr, MatchStats *stats)
+{
+    ((MatchHost *)hostPtr)->getStats(stats);
+}
+
+extern "C" void MatchHost_stop(void *hostPtr)
+{
+    ((MatchHost *)hostPtr)->stop();
+}
+
+extern "C" void MatchHost_DestroyHost(void *hostPtr)
+{
+    delete (MatchHost *)hostPtr;
+}
+
+
+//MATCH ARENA
+extern "C" void *Arena_allocate(void *arenaPtr, uint32_t size, uint32_t align)
+{
+    return ((Arena *)arenaPtr)->allocate(size, align);
+}
+
+extern "C" void Arena_reset(void *arenaPtr)
+{
+    ((Arena *)arenaPtr)->reset();
+}
+
+extern "C" uint32_t Arena_used(void *arenaPtr)
+{
+    return ((Arena *)arenaPtr)->used();
+}
+
+
+//BUFFER POOL
+extern "C" BufferPool *BufferPool_CreatePool()
+{
+    return new BufferPool();
+}
+
+extern "C" int32_t BufferPool_initPool(void *poolPtr, uint32_t bufferSize, uint32_t count, uint32_t flags)
+{
+    return ((BufferPool *)poolPtr)->initialize(bufferSize, count, flags);
+}
+
+extern "C" int32_t BufferPool_lease(void *poolPtr)
+{
+    return ((BufferPool *)poolPtr)->lease();
+}
+
+extern "C" int32_t BufferPool_release(void *poolPtr, int32_t handle)
+{
+    return ((BufferPool *)poolPtr)->release(handle);
+}
+
+extern "C" char *BufferPool_address(void *poolPtr, int32_t handle)
+{
+    return ((BufferPool *)poolPtr)->address(handle);
+}
+
+extern "C" uint32_t BufferPool_available(void *poolPtr)
+{
+    return ((BufferPool *)poolPtr)->available();
+}
+
+extern "C" void BufferPool_DestroyPool(void *poolPtr)
+{
+    delete (BufferPool *)poolPtr;
+}
+
+
+//CONNECTION STATS
+extern "C" ConnStats *ConnStats_Create(uint32_t tickRate)
+{
+    return new ConnStats(tickRate);
+}
+
+extern "C" void ConnStats_reset(void *statsPtr, int32_t id)
+{
+    ((ConnStats *)statsPtr)->reset(id);
+}
+
+extern "C" uint32_t ConnStats_onSend(void *statsPtr, int32_t id, uint32_t tick)
+{
+    return ((ConnStats *)statsPtr)->onSend(id, tick);
+}
+
+extern "C" void ConnStats_onAck(void *statsPtr, int32_t id, uint32_t ack, uint32_t ackBits)
+{
+    ((ConnStats *)statsPtr)->onAck(id, ack, ackBits);
+}
+
+extern "C" int32_t ConnStats_shouldSend(void *statsPtr, int32_t id, uint64_t tick)
+{
+    return ((ConnStats *)statsPtr)->shouldSend(id, tick);
+}
+
+extern "C" uint32_t ConnStats_budget(void *statsPtr, int32_t id)
+{
+    return ((ConnStats *)statsPtr)->budget(id);
+}
+
+extern "C" void ConnStats_getInfo(void *statsPtr, int32_t id, ConnInfo *info)
+{
+    ((ConnStats *)statsPtr)->getInfo(id, info);
+}
+
+extern "C" int32_t ConnStats_ackedTick(void *statsPtr, int32_t id, uint32_t *tick)
+{
+    return ((ConnStats *)statsPtr)->ackedTick(id, tick);
+}
+
+extern "C" void ConnStats_onClock(void *statsPtr, int32_t id, uint32_t ack, uint32_t clientTimeUs, uint32_t ackDelayUs)
+{
+    ((ConnStats *)statsPtr)->onClock(id, ack, clientTimeUs, ackDelayUs);
+}
+
+extern "C" int32_t ConnStats_getClock(void *statsPtr, int32_t id, ClockInfo *info)
+{
+    return ((ConnStats *)statsPtr)->getClock(id, info);
+}
+
+extern "C" int32_t ConnStats_clientTick(void *statsPtr, int32_t id, uint32_t clientTimeUs, uint32_t *tick)
+{
+    return ((ConnStats *)statsPtr)->clientTick(id, clientTimeUs, tick);
+}
+
+extern "C" void ConnStats_Destroy(void *statsPtr)
+{
+    delete (ConnStats *)statsPtr;
+}
+
+
+//SNAPSHOT CODEC
+extern "C" int32_t Snapshot_pack(char *tick, uint32_t len, char *out, uint32_t outSize)
+{
+    return snapPack(tick, len, out, outSize);
+}
+
+extern "C" int32_t Snapshot_unpack(char *packed, uint32_t len, char *tick, uint32_t tickSize)
+{
+    return snapUnpack(packed, len, tick, tickSize);
+}
+
+extern "C" int32_t Snapshot_fit(char *tick, uint32_t len, uint32_t budget, uint32_t *bullets, uint32_t *weapons)
+{
+    return snapFit(tick, len, budget, bullets, weapons);
+}
+
+
+//COMPRESSOR
+extern "C" uint32_t Compressor_bound(uint32_t len, uint32_t chunkSize)
+{
+    return compressBound(len, chunkSize);
+}
+
+extern "C" int32_t Compressor_compress(char *src, uint32_t len, char *dst, uint32_t dstSize, uint32_t chunkSize, int32_t threads)
+{
+    return compressChunked(src, len, dst, dstSize, chunkSize, threads);
+}
+
+extern "C" int32_t Compressor_size(char *src, uint32_t len)
+{
+    return decompressedSize(src, len);
+}
+
+extern "C" int32_t Compressor_decompress(char *src, uint32_t len, char *dst, uint32_t dstSize, int32_t threads)
+{
+    return decompressChunked(src, len, dst, dstSize, threads);
+}
+
+
+//SPAWN SAMPLER
+extern "C" SpawnSampler *SpawnSampler_Create()
+{
+    return new SpawnSampler();
+}
+
+extern "C" int32_t SpawnSampler_init(void *samplerPtr, uint32_t width, uint32_t length, uint32_t spacing, uint64_t seed)
+{
+    return ((SpawnSampler *)samplerPtr)->initialize(width, length, spacing, seed);
+}
+
+extern "C" void SpawnSampler_blockTerrain(void *samplerPtr, uint8_t *tiles)
+{
+    ((SpawnSampler *)samplerPtr)->blockTerrain(tiles);
+}
+
+extern "C" void SpawnSampler_setHotspots(void *samplerPtr, int32_t *xz, uint32_t count, uint32_t cluster)
+{
+    ((SpawnSampler *)samplerPtr)->setHotspots(xz, count, cluster);
+}
+
+extern "C" void SpawnSampler_setTown(void *samplerPtr, int32_t *xz, uint32_t count)
+{
+    ((SpawnSampler *)samplerPtr)->setTown(xz, count);
+}
+
+extern "C" int32_t SpawnSampler_sample(void *samplerPtr, uint32_t count, uint32_t townCount, float hotspotChance, int32_t firstId, char *out, uint32_t outSize)
+{
+    return ((SpawnSampler *)samplerPtr)->sample(count, townCount, hotspotChance, firstId, out, outSize);
+}
+
+extern "C" void SpawnSampler_Destroy(void *samplerPtr)
+{
+    delete (SpawnSampler *)samplerPtr;
+}
+
+
+//POSITION HISTORY
+extern "C" PositionHistory *PositionHistory_Create()
+{
+    return new PositionHistory();
+}
+
+extern "C" void PositionHistory_beginTick(void *historyPtr, uint32_t tick)
+{
+    ((PositionHistory *)historyPtr)->beginTick(tick);
+}
+
+extern "C" void PositionHistory_store(void *historyPtr, int32_t id, float x, float z, float r)
+{
+    ((PositionHistory *)historyPtr)->store(id, x, z, r);
+}
+
+extern "C" uint32_t PositionHistory_latest(void *historyPtr)
+{
+    return ((PositionHistory *)historyPtr)->latest();
+}
+
+extern "C" int32_t PositionHistory_positionAt(void *historyPtr, uint32_t tick, int32_t id, float *x, float *z, float *r)
+{
+    return ((PositionHistory *)historyPtr)->positionAt(tick, id, x, z, r);
+}
+
+extern "C" int32_t PositionHistory_hits(void *historyPtr, uint32_t tick, float x, float z, float radius, int32_t exclude, uint8_t *ids, uint32_t maxIds)
+{
+    return ((PositionHistory *)historyPtr)->hits(tick, x, z, radius, exclude, ids, maxIds);
+}
+
+extern "C" void PositionHistory_Destroy(void *historyPtr)
+{
+    delete (PositionHistory *)historyPtr;
+}
+
+
+//TUNING PROFILE
+extern "C" Tuning *Tuning_Create()
+{
+    return new Tuning();
+}
+
+extern "C" int32_t Tuning_load(void *tuningPtr, const char *path)
+{
+    return ((Tuning *)tuningPtr)->load(path);
+}
+
+extern "C" uint32_t Tuning_applyThread(void *tuningPtr, int32_t role)
+{
+    return ((Tuning *)tuningPtr)->applyThread(role);
+}
+
+extern "C" uint32_t Tuning_applySocket(void *tuningPtr, int32_t kind, int32_t fd)
+{
+    return ((Tuning *)tuningPtr)->applySocket(kind, fd);
+}
+
+extern "C" int32_t Tuning_describeThread(void *tuningPtr, int32_t role, char *out, uint32_t size)
+{
+    return ((Tuning *)tuningPtr)->describeThread(role, out, size);
+}
+
+extern "C" int32_t Tuning_describeSocket(void *tuningPtr, int32_t kind, char *out, uint32_t size)
+{
+    return ((Tuning *)tuningPtr)->describeSocket(kind, out, size);
+}
+
+extern "C" void Tuning_Destroy(void *tuningPtr)
+{
+    delete (Tuning *)tuningPtr;
+}
+
+
+//MATCH RECORDER
+extern "C" MatchRecorder *MatchRecorder_Create()
+{
+    return new MatchRecorder();
+}
+
+extern "C" int32_t MatchRecorder_open(void *recorderPtr, const char *path, uint64_t capacity, uint32_t stateSize, uint32_t keyInterval)
+{
+    return ((MatchRecorder *)recorderPtr)->open(path, capacity, stateSize, keyInterval);
+}
+
+extern "C" int32_t MatchRecorder_record(void *recorderPtr, uint32_t tick, const char *state)
+{
+    return ((MatchRecorder *)recorderPtr)->record(tick, state);
+}
+
+extern "C" uint32_t MatchRecorder_dropped(void *recorderPtr)
+{
+    return ((MatchRecorder *)recorderPtr)->dropped();
+}
+
+extern "C" void MatchRecorder_close(void *recorderPtr)
+{
+    ((MatchRecorder *)recorderPtr)->close();
+}
+
+extern "C" void MatchRecorder_Destroy(void *recorderPtr)
+{
+    delete (MatchRecorder *)recorderPtr;
+}
+
+
+//MATCH READER
+extern "C" MatchReader *MatchReader_Create()
+{
+    return new MatchReader();
+}
+
+extern "C" int32_t MatchReader_open(void *readerPtr, const char *path)
+{
+    return ((MatchReader *)readerPtr)->open(path);
+}
+
+extern "C" uint32_t MatchReader_firstTick(void *readerPtr)
+{
+    return ((MatchReader *)readerPtr)->firstTick();
+}
+
+extern "C" uint32_t MatchReader_lastTick(void *readerPtr)
+{
+    return ((MatchReader *)readerPtr)->lastTick();
+}
+
+extern "C" uint32_t MatchReader_stateSize(void *readerPtr)
+{
+    return ((MatchReader *)readerPtr)->stateSize();
+}
+
+extern "C" int32_t MatchReader_seek(void *readerPtr, uint32_t tick, char *state, uint32_t size, uint32_t *found)
+{
+    return ((MatchReader *)readerPtr)->seek(tick, state, size, found);
+}
+
+extern "C" void MatchReader_close(void *readerPtr)
+{
+    ((MatchReader *)readerPtr)->close();
+}
+
+extern "C" void MatchReader_Destroy(void *readerPtr)
+{
+    delete (MatchReader *)readerPtr;
+}
+
+
+//INGRESS FILTER
+extern "C" IngressFilter *IngressFilter_Create()
+{
+    return new IngressFilter();
+}
+
+extern "C" int32_t IngressFilter_allow(void *filterPtr, uint8_t header, uint32_t size, int32_t idOffset)
+{
+    return ((IngressFilter *)filterPtr)->allow(header, size, idOffset);
+}
+
+extern "C" void IngressFilter_setRates(void *filterPtr, uint32_t rate, uint32_t burst, uint32_t unknownRate, uint32_t unknownBurst)
+{
+    ((IngressFilter *)filterPtr)->setRates(rate, burst, unknownRate, unknownBurst);
+}
+
+extern "C" int32_t IngressFilter_addEndpoint(void *filterPtr, EndPoint ep, uint8_t id)
+{
+    return ((IngressFilter *)filterPtr)->addEndpoint(ep, id);
+}
+
+extern "C" int32_t IngressFilter_removeEndpoint(void *filterPtr, EndPoint ep)
+{
+    return ((IngressFilter *)filterPtr)->removeEndpoint(ep);
+}
+
+extern "C" void IngressFilter_getStats(void *filterPtr, IngressStats *stats)
+{
+    ((IngressFilter *)filterPtr)->getStats(stats);
+}
+
+extern "C" void IngressFilter_Destroy(void *filterPtr)
+{
+    delete (IngressFilter *)filterPtr;
+}
+
+
+//ASYNC LOG
+extern "C" AsyncLog *AsyncLog_Create()
+{
+    return new AsyncLog();
+}
+
+extern "C" int32_t AsyncLog_start(void *logPtr, int32_t fd)
+{
+    return ((AsyncLog *)logPtr)->start(fd);
+}
+
+extern "C" int32_t AsyncLog_addTemplate(void *logPtr, const char *format)
+{
+    return ((AsyncLog *)logPtr)->addTemplate(format);
+}
+
+extern "C" int32_t AsyncLog_write(void *logPtr, const uint16_t *text, uint32_t len)
+{
+    return ((AsyncLog *)logPtr)->write(text, len);
+}
+
+extern "C" int32_t AsyncLog_event(void *logPtr, int32_t id, int64_t a0, int64_t a1, int64_t a2, int64_t a3)
+{
+    return ((AsyncLog *)logPtr)->event(id, a0, a1, a2, a3);
+}
+
+extern "C" void AsyncLog_getStats(void *logPtr, LogStats *stats)
+{
+    ((AsyncLog *)logPtr)->getStats(stats);
+}
+
+extern "C" void AsyncLog_stop(void *logPtr)
+{
+    ((AsyncLog *)logPtr)->stop();
+}
+
+extern "C" void AsyncLog_Destroy(void *logPtr)
+{
+    delete (AsyncLog *)logPtr;
+}
+
+
+//EVENT QUEUE
+extern "C" EventQueue *EventQueue_Create()
+{
+    return new EventQueue();
+}
+
+extern "C" int32_t EventQueue_init(void *queuePtr, uint32_t capacity, uint32_t recordSize)
+{
+    return ((EventQueue *)queuePtr)->init(capacity, recordSize);
+}
+
+extern "C" int32_t EventQueue_push(void *queuePtr, const char *record)
+{
+    return ((EventQueue *)queuePtr)->push(record);
+}
+
+extern "C" uint32_t EventQueue_drain(void *queuePtr, char *out, uint32_t maxRecords)
+{
+    return ((EventQueue *)queuePtr)->drain(out, maxRecords);
+}
+
+extern "C" uint64_t EventQueue_dropped(void *queuePtr)
+{
+    return ((EventQueue *)queuePtr)->dropped();
+}
+
+extern "C" void EventQueue_Destroy(void *queuePtr)
+{
+    delete (EventQueue *)queuePtr;
+}
+
+extern "C" TimerWheel *TimerWheel_Create()
+{
+    return new TimerWheel();
+}
+
+extern "C" int32_t TimerWheel_init(void *wheelPtr, uint32_t capacity)
+{
+    return ((TimerWheel *)wheelPtr)->init(capacity);
+}
+
+extern "C" int32_t TimerWheel_schedule(void *wheelPtr, uint32_t kind, uint32_t key, uint32_t delayMs)
+{
+    return ((TimerWheel *)wheelPtr)->schedule(kind, key, delayMs);
+}
+
+extern "C" int32_t TimerWheel_reschedule(void *wheelPtr, int32_t handle, uint32_t delayMs)
+{
+    return ((TimerWheel *)wheelPtr)->reschedule(handle, delayMs);
+}
+
+extern "C" int32_t TimerWheel_cancel(void *wheelPtr, int32_t handle)
+{
+    return ((TimerWheel *)wheelPtr)->cancel(handle);
+}
+
+extern "C" int32_t TimerWheel_advance(void *wheelPtr, TimerFired *out, uint32_t max)
+{
+    return ((TimerWheel *)wheelPtr)->advance(out, max);
+}
+
+extern "C" uint32_t TimerWheel_pending(void *wheelPtr)
+{
+    return ((TimerWheel *)wheelPtr)->pending();
+}
+
+extern "C" uint64_t TimerWheel_now()
+{
+    return TimerWheel::now();
+}
+
+extern "C" void TimerWheel_Destroy(void *wheelPtr)
+{
+    delete (TimerWheel *)wheelPtr;
+}
+
+extern "C" BroadcastRing *BroadcastRing_Create()
+{
+    return new BroadcastRing();
+}
+
+extern "C" int32_t BroadcastRing_createRing(void *ringPtr, const char *name, uint32_t slots, uint32_t slotSize)
+{
+    return ((BroadcastRing *)ringPtr)->create(name, slots, slotSize);
+}
+
+extern "C" int32_t BroadcastRing_publish(void *ringPtr, uint32_t tick, const char *data, uint32_t len)
+{
+    return ((BroadcastRing *)ringPtr)->publish(tick, data, len);
+}
+
+extern "C" uint64_t BroadcastRing_head(void *ringPtr)
+{
+    return ((BroadcastRing *)ringPtr)->head();
+}
+
+extern "C" void BroadcastRing_Destroy(void *ringPtr)
+{
+    delete (BroadcastRing *)ringPtr;
+}
+
+extern "C" TickGovernor *TickGovernor_Create()
+{
+    return new TickGovernor();
+}
+
+extern "C" int32_t TickGovernor_init(void *governorPtr, uint32_t budgetUs)
+{
+    return ((TickGovernor *)governorPtr)->init(budgetUs);
+}
+
+extern "C" int32_t TickGovernor_addPhase(void *governorPtr, uint32_t lane)
+{
+    return ((TickGovernor *)governorPtr)->addPhase(lane);
+}
+
+extern "C" int32_t TickGovernor_addStep(void *governorPtr, uint32_t engagePercent, uint32_t releasePercent)
+{
+    return ((TickGovernor *)governorPtr)->addStep(engagePercent, releasePercent);
+}
+
+extern "C" int32_t TickGovernor_waitTick(void *governorPtr, uint32_t lane)
+{
+    return ((TickGovernor *)governorPtr)->waitTick(lane);
+}
+
+extern "C" int32_t TickGovernor_beginTick(void *governorPtr, uint32_t lane)
+{
+    return ((TickGovernor *)governorPtr)->beginTick(lane);
+}
+
+extern "C" void TickGovernor_mark(void *governorPtr, uint32_t phase)
+{
+    ((TickGovernor *)governorPtr)->mark(phase);
+}
+
+extern "C" uint32_t TickGovernor_level(void *governorPtr)
+{
+    return ((TickGovernor *)governorPtr)->level();
+}
+
+extern "C" uint32_t TickGovernor_drainEvents(void *governorPtr, GovernorEvent *out, uint32_t max)
+{
+    return ((TickGovernor *)governorPtr)->drainEvents(out, max);
+}
+
+extern "C" void TickGovernor_getStats(void *governorPtr, GovernorStats *stats)
+{
+    ((TickGovernor *)governorPtr)->getStats(stats);
+}
+
+extern "C" void TickGovernor_Destroy(void *governorPtr)
+{
+    delete (TickGovernor *)governorPtr;
+}
+
+extern "C" TerrainPack *TerrainPack_Create()
+{
+    return new TerrainPack();
+}
+
+extern "C" int32_t TerrainPack_build(void *packPtr, const uint8_t *tiles, uint32_t width, uint32_t length,
+                                     const int32_t *fixedXZ, uint32_t fixedCount, const char *payload, uint32_t payloadSize)
+{
+    return ((TerrainPack *)packPtr)->create(tiles, width, length, fixedXZ, fixedCount, payload, payloadSize);
+}
+
+extern "C" int32_t TerrainPack_save(void *packPtr, const char *path)
+{
+    return ((TerrainPack *)packPtr)->save(path);
+}
+
+extern "C" int32_t TerrainPack_open(void *packPtr, const char *path)
+{
+    return ((TerrainPack *)packPtr)->open(path);
+}
+
+extern "C" int32_t TerrainPack_occupied(void *packPtr, int32_t x, int32_t z)
+{
+    return ((TerrainPack *)packPtr)->occupied(x, z) ? 1 : 0;
+}
+
+extern "C" int32_t TerrainPack_expandTiles(void *packPtr, uint8_t *tiles, uint64_t size)
+{
+    return ((TerrainPack *)packPtr)->expandTiles(tiles, size);
+}
+
+extern "C" int32_t TerrainPack_getInfo(void *packPtr, TerrainPackHeader *info)
+{
+    const TerrainPackHeader *header = ((TerrainPack *)packPtr)->info();
+    if (header == 0)
+    {
+        return -1;
+    }
+    *info = *header;
+    return 0;
+}
+
+extern "C" int32_t TerrainPack_copyPayload(void *packPtr, char *out, uint32_t size)
+{
+    TerrainPack *pack = (TerrainPack *)packPtr;
+    if (pack->info() == 0 || pack->info()->payloadSize > size)
+    {
+        return -1;
+    }
+    memcpy(out, pack->payload(), pack->info()->payloadSize);
+    return (int32_t)pack->info()->payloadSize;
+}
+
+extern "C" void TerrainPack_Destroy(void *packPtr)
+{
+    delete (TerrainPack *)packPtr;
+}
+
+extern "C" int32_t Sweep_bullets(void *historyPtr, void *packPtr, SweepBullet *bullets, SweepHit *hits, uint32_t count)
+{
+    return sweepBullets((PositionHistory *)historyPtr, (const TerrainPack *)packPtr, bullets, hits, count);
+}
@@ -0,0 +1,705 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	matchhost.cpp -   Runs many matches in one process over a shared UDP socket
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		MatchHost();
+--					int32_t initialize(short port);
+--					Server *transport();
+--					void setJoin(uint8_t header, uint32_t tokenOffset);
+--					void setTuning(Tuning *tuning);
+--					int32_t start(int32_t workers);
+--					int32_t createMatch(MatchTickCallback tick, void *context, uint32_t tickIntervalUs,
+--										size_t arenaSize);
+--					int32_t destroyMatch(int32_t matchId);
+--					int32_t bindEndPoint(EndPoint ep, int32_t matchId);
+--					int32_t unbindEndPoint(EndPoint ep);
+--					int32_t recvMatch(int32_t matchId, EndPoint *ep, char *buffer, uint32_t size);
+--					int32_t sendBytes(EndPoint ep, char *data, uint32_t len);
+--					int32_t queueSend(EndPoint ep, char *data, uint32_t len);
+--					int32_t flushSends();
+--					Arena *matchArena(int32_t matchId);
+--					void getStats(MatchStats *stats);
+--					void stop();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: a destroyed match's arena is unmapped
+--					October 19th, 2026 - agent: datagrams come in through the transport's engine and
+--						filter, the join datagram is configurable, sends are serialized, and a match's
+--						queue is reset before it can be routed to
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A MatchHost owns one UDP Server socket and any number of matches (up to MAX_MATCHES).
+--
+--		The socket is a Server, so the transport engine, ingress filter, pacing and front proxy
+--		upstream are set up through transport() before start(), the same as for a single match.
+--
+--		A single demultiplexing thread drains the shared socket through the Server and looks each
+--		sender up in the connection table. Datagrams from a bound endpoint are pushed onto that
+--		match's single-producer/single-consumer inbound queue. An unknown endpoint is bound by its
+--		join datagram, set with setJoin(): a little-endian token of the match id plus one sends it
+--		to that match, MATCH_ANY to the active match with the fewest players, and so does a token
+--		past MAX_MATCHES, from a client that carries none. Anything else from an unknown endpoint is
+--		counted and dropped. Routing, enqueueing and a match becoming active or inactive all happen
+--		under connectionLock, so a queue is never written while it is reset.
+--
+--		Matches send from their ticks on several workers at once, so every send goes through
+--		sendLock.
+--
+--		Ticks run on a fixed pool of worker threads. Every match has its own deadline in a shared
+--		schedule; whichever worker is free runs the earliest due match, so a match is only ever
+--		ticked by one thread at a time and idle matches cost nothing. The tick callback receives
+--		the match's Arena, for the state the match keeps out of its own language's heap; it is freed
+--		with the match.
+---------------------------------------------------------------------------------------*/
+#include "matchhost.h"
+
+MatchHost::MatchHost()
+{
+	for (int32_t i = 0; i < MAX_MATCHES; i++)
+	{
+		matches[i].active = false;
+		matches[i].clients = 0;
+		matches[i].tick = 0;
+		matches[i].context = 0;
+		matches[i].generation = 0;
+		matches[i].busy = false;
+		matches[i].queue = 0;
+		matches[i].head = 0;
+		matches[i].tail = 0;
+	}
+	joinHeader = PREFIX_REQUEST;
+	tokenOffset = offsetof(REQUEST_P, connect_token);
+	tuning = 0;
+	running = false;
+	routed = 0;
+	unrouted = 0;
+	queueDrops = 0;
+	ticks = 0;
+}
+
+MatchHost::~MatchHost()
+{
+	stop();
+	for (int32_t i = 0; i < MAX_MATCHES; i++)
+	{
+		delete[] matches[i].queue;
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: initialize
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: only opens the socket; the threads are started by start() - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t initialize(short port)
+--								port: the UDP port shared by every hosted match
+--
+-- RETURNS: 0 on success, or -1 if the socket could not be opened.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchHost::initialize(short port)
+{
+	return server.initializeSocket(port) == 0 ? 0 : -1;
+}
+
+// The shared socket, to set its engine, filter, pacing and upstream on before start()
+Server *MatchHost::transport()
+{
+	return &server;
+}
+
+// Which datagrams bind an unknown endpoint, and where in them the little endian match token is
+void MatchHost::setJoin(uint8_t header, uint32_t offset)
+{
+	joinHeader = header;
+	tokenOffset = offset;
+}
+
+// The demultiplexer applies the profile's recv section to itself and each worker its game section
+void MatchHost::setTuning(Tuning *profile)
+{
+	tuning = profile;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: start
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t start(int32_t workers)
+--								workers: number of tick worker threads, <= 0 uses one per core
+--
+-- RETURNS: the number of workers started, or -1 if the host is already running.
+--
+-- NOTES:
+-- 		Starts the demultiplexing thread and the worker pool. Everything set through transport(),
+--		setJoin() and setTuning() must be set before.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchHost::start(int32_t workers)
+{
+	if (running)
+	{
+		return -1;
+	}
+
+	if (workers <= 0)
+	{
+		workers = (int32_t)std::thread::hardware_concurrency();
+		if (workers <= 0)
+		{
+			workers = 1;
+		}
+	}
+
+	running = true;
+	demuxThread = std::thread(&MatchHost::demuxThreadFunc, this);
+	for (int32_t i = 0; i < workers; i++)
+	{
+		workerThreads.push_back(std::thread(&MatchHost::workerThreadFunc, this));
+	}
+
+	return workers;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: createMatch
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: the queue is reset before the match is made active - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t createMatch(MatchTickCallback tick, void *context, uint32_t tickIntervalUs, size_t arenaSize)
+--								tick: called on a worker thread once per tick of this match
+--								context: opaque pointer handed back to the tick callback
+--								tickIntervalUs: the match's tick interval in microseconds
+--								arenaSize: bytes reserved for the match's world state
+--
+-- RETURNS: the new match id, or MATCH_INVALID if no slot or memory is available.
+--
+-- NOTES:
+-- 		The first tick is scheduled one interval from now. The slot's queue is emptied under connectionLock
+--		before the match is made active, so the demultiplexer cannot route to it until it is ready.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchHost::createMatch(MatchTickCallback tick, void *context, uint32_t tickIntervalUs, size_t arenaSize)
+{
+	std::lock_guard<std::mutex> lock(scheduleLock);
+
+	for (int32_t i = 0; i < MAX_MATCHES; i++)
+	{
+		Match &match = matches[i];
+		if (match.active || match.busy)
+		{
+			continue;
+		}
+
+		if (match.arena.initialize(arenaSize) != 0)
+		{
+			return MATCH_INVALID;
+		}
+		if (match.queue == 0)
+		{
+			match.queue = new MatchDatagram[MATCH_QUEUE_DEPTH];
+		}
+
+		match.tick = tick;
+		match.context = context;
+		match.interval = std::chrono::microseconds(tickIntervalUs);
+		match.nextTick = std::chrono::steady_clock::now() + match.interval;
+		match.generation++;
+		{
+			std::lock_guard<std::mutex> routing(connectionLock);
+			match.head.store(0, std::memory_order_relaxed);
+			match.tail.store(0, std::memory_order_relaxed);
+			match.clients = 0;
+			match.active = true;
+		}
+
+		ScheduleEntry entry = {match.nextTick, i, match.generation};
+		schedule.push(entry);
+		scheduleSignal.notify_one();
+		return i;
+	}
+
+	return MATCH_INVALID;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: destroyMatch
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: unmaps the arena instead of resetting it - agent
+--		October 19th, 2026: unbinds before waiting out the tick, and frees the slot only once done - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t destroyMatch(int32_t matchId)
+--								matchId: match to tear down
+--
+-- RETURNS: 0 on success, or -1 if the id does not name an active match.
+--
+-- NOTES:
+-- 		Unbinds every endpoint routed to the match, waits for an in-flight tick of it to finish and unmaps
+--		its arena; the next match in the slot maps a fresh one. The schedule lock is held throughout, so
+--		the slot cannot be reused before all of that is done.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchHost::destroyMatch(int32_t matchId)
+{
+	if (matchId < 0 || matchId >= MAX_MATCHES)
+	{
+		return -1;
+	}
+
+	Match &match = matches[matchId];
+	std::unique_lock<std::mutex> lock(scheduleLock);
+	if (!match.active)
+	{
+		return -1;
+	}
+
+	{
+		std::lock_guard<std::mutex> routing(connectionLock);
+		match.active = false;
+		match.clients = 0;
+		for (std::unordered_map<uint64_t, int32_t>::iterator it = connections.begin(); it != connections.end();)
+		{
+			if (it->second == matchId)
+			{
+				it = connections.erase(it);
+			}
+			else
+			{
+				++it;
+			}
+		}
+	}
+
+	while (match.busy)
+	{
+		scheduleSignal.wait(lock);
+	}
+	match.arena.release();
+	return 0;
+}
+
+int32_t MatchHost::bindEndPoint(EndPoint ep, int32_t matchId)
+{
+	if (matchId < 0 || matchId >= MAX_MATCHES)
+	{
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> lock(connectionLock);
+	if (!matches[matchId].active)
+	{
+		return -1;
+	}
+	std::unordered_map<uint64_t, int32_t>::iterator it = connections.find(endPointKey(ep));
+	if (it != connections.end())
+	{
+		matches[it->second].clients--;
+		it->second = matchId;
+	}
+	else
+	{
+		connections[endPointKey(ep)] = matchId;
+	}
+	matches[matchId].clients++;
+	return 0;
+}
+
+int32_t MatchHost::unbindEndPoint(EndPoint ep)
+{
+	std::lock_guard<std::mutex> lock(connectionLock);
+	std::unordered_map<uint64_t, int32_t>::iterator it = connections.find(endPointKey(ep));
+	if (it == connections.end())
+	{
+		return -1;
+	}
+	matches[it->second].clients--;
+	connections.erase(it);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: recvMatch
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t recvMatch(int32_t matchId, EndPoint *ep, char *buffer, uint32_t size)
+--								matchId: the match whose inbound queue is read
+--								ep: filled with the sender of the datagram
+--								buffer: receives the datagram, truncated to size
+--								size: the size of buffer
+--
+-- RETURNS: the number of bytes copied, SOCKET_NODATA if the queue is empty, or -1 for a bad id.
+--
+-- NOTES:
+-- 		Must only be called from that match's tick, which is the single consumer of its queue.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchHost::recvMatch(int32_t matchId, EndPoint *ep, char *buffer, uint32_t size)
+{
+	if (matchId < 0 || matchId >= MAX_MATCHES || matches[matchId].queue == 0)
+	{
+		return -1;
+	}
+
+	Match &match = matches[matchId];
+	uint32_t head = match.head.load(std::memory_order_relaxed);
+	if (head == match.tail.load(std::memory_order_acquire))
+	{
+		return SOCKET_NODATA;
+	}
+
+	MatchDatagram &datagram = match.queue[head & (MATCH_QUEUE_DEPTH - 1)];
+	uint32_t len = datagram.len < size ? datagram.len : size;
+	*ep = datagram.ep;
+	memcpy(buffer, datagram.data, len);
+
+	match.head.store(head + 1, std::memory_order_release);
+	return len;
+}
+
+int32_t MatchHost::sendBytes(EndPoint ep, char *data, uint32_t len)
+{
+	std::lock_guard<std::mutex> lock(sendLock);
+	return server.sendBytes(ep, data, len);
+}
+
+int32_t MatchHost::queueSend(EndPoint ep, char *data, uint32_t len)
+{
+	std::lock_guard<std::mutex> lock(sendLock);
+	return server.queueSend(ep, data, len);
+}
+
+int32_t MatchHost::flushSends()
+{
+	std::lock_guard<std::mutex> lock(sendLock);
+	return server.flushSends();
+}
+
+Arena *MatchHost::matchArena(int32_t matchId)
+{
+	if (matchId < 0 || matchId >= MAX_MATCHES || !matches[matchId].active)
+	{
+		return 0;
+	}
+	return &matches[matchId].arena;
+}
+
+void MatchHost::getStats(MatchStats *stats)
+{
+	stats->routed = routed.load();
+	stats->unrouted = unrouted.load();
+	stats->queueDrops = queueDrops.load();
+	stats->ticks = ticks.load();
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: stop
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void stop()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Stops the demultiplexer and the worker pool and joins all of their threads. The demultiplexer
+--		notices within MATCH_DEMUX_IDLE_MS.
+--------------------------------------------------------------------------------------------------------------*/
+void MatchHost::stop()
+{
+	{
+		std::lock_guard<std::mutex> lock(scheduleLock);
+		if (!running)
+		{
+			return;
+		}
+		running = false;
+	}
+	scheduleSignal.notify_all();
+
+	if (demuxThread.joinable())
+	{
+		demuxThread.join();
+	}
+	for (size_t i = 0; i < workerThreads.size(); i++)
+	{
+		workerThreads[i].join();
+	}
+	workerThreads.clear();
+}
+
+uint64_t MatchHost::endPointKey(EndPoint ep)
+{
+	return ((uint64_t)ep.addr << 16) | ep.port;
+}
+
+
+// The match a join token asks for: the match id plus one, or MATCH_ANY for the active match with the fewest players.
+// A token past MAX_MATCHES is a join from a client that carries none, and counts as MATCH_ANY.
+int32_t MatchHost::pickMatch(uint32_t token)
+{
+	if (token != MATCH_ANY && token <= MAX_MATCHES)
+	{
+		return matches[token - 1].active ? (int32_t)(token - 1) : MATCH_INVALID;
+	}
+
+	int32_t best = MATCH_INVALID;
+	for (int32_t i = 0; i < MAX_MATCHES; i++)
+	{
+		if (matches[i].active && (best == MATCH_INVALID || matches[i].clients < matches[best].clients))
+		{
+			best = i;
+		}
+	}
+	return best;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: routeDatagram
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: binds by the join set with setJoin(), and enqueues under connectionLock - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t routeDatagram(const EndPoint &ep, const char *data, uint32_t len)
+--
+-- RETURNS: the match the datagram was queued for, or MATCH_INVALID if it was dropped.
+--
+-- NOTES:
+-- 		Known endpoints are routed by the connection table. A join from an unknown endpoint binds it to the
+--		match its token picks; a join too short to carry a token counts as MATCH_ANY.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchHost::routeDatagram(const EndPoint &ep, const char *data, uint32_t len)
+{
+	uint64_t key = endPointKey(ep);
+	int32_t matchId = MATCH_INVALID;
+
+	std::lock_guard<std::mutex> lock(connectionLock);
+	std::unordered_map<uint64_t, int32_t>::iterator it = connections.find(key);
+	if (it != connections.end())
+	{
+		matchId = it->second;
+	}
+	else if (len >= 1 && (uint8_t)data[0] == joinHeader)
+	{
+		uint32_t token = MATCH_ANY;
+		if (len >= tokenOffset + 4)
+		{
+			const uint8_t *bytes = (const uint8_t *)data + tokenOffset;
+			token = (uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+		}
+		matchId = pickMatch(token);
+		if (matchId != MATCH_INVALID)
+		{
+			connections[key] = matchId;
+			matches[matchId].clients++;
+		}
+	}
+
+	if (matchId == MATCH_INVALID)
+	{
+		unrouted++;
+		return MATCH_INVALID;
+	}
+
+	enqueue(matchId, ep, data, len);
+	return matchId;
+}
+
+void MatchHost::enqueue(int32_t matchId, const EndPoint &ep, const char *data, uint32_t len)
+{
+	Match &match = matches[matchId];
+	uint32_t tail = match.tail.load(std::memory_order_relaxed);
+	if (tail - match.head.load(std::memory_order_acquire) >= MATCH_QUEUE_DEPTH)
+	{
+		queueDrops++;
+		return;
+	}
+
+	MatchDatagram &datagram = match.queue[tail & (MATCH_QUEUE_DEPTH - 1)];
+	datagram.ep = ep;
+	datagram.len = len < PAYLOAD_MAX_SIZE ? len : PAYLOAD_MAX_SIZE;
+	memcpy(datagram.data, data, datagram.len);
+
+	match.tail.store(tail + 1, std::memory_order_release);
+	routed++;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: demuxThreadFunc
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: receives through the Server, so its engine, filter and upstream apply - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void demuxThreadFunc()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Routes every datagram the Server lets through. When nothing is waiting it sleeps in poll() on the
+--		socket for up to MATCH_DEMUX_IDLE_MS; the io_uring engine takes datagrams off the socket itself, so
+--		there the timeout rather than the socket wakes it.
+--------------------------------------------------------------------------------------------------------------*/
+void MatchHost::demuxThreadFunc()
+{
+	std::vector<char> buffer(SERVER_SLOT_SIZE);
+	if (tuning)
+	{
+		tuning->applyThread(TUNE_THREAD_RECV);
+	}
+
+	struct pollfd pollfds;
+	pollfds.fd = server.getSocket();
+	pollfds.events = POLLIN;
+
+	while (running)
+	{
+		if (server.UdpPollSocket() != SOCKET_DATA_WAITING)
+		{
+			poll(&pollfds, 1, MATCH_DEMUX_IDLE_MS);
+			continue;
+		}
+
+		EndPoint ep;
+		int32_t len = server.UdpRecvFrom(&buffer[0], buffer.size(), &ep);
+		if (len > 0)
+		{
+			routeDatagram(ep, &buffer[0], len);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: workerThreadFunc
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void workerThreadFunc()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Sleeps until the earliest deadline in the schedule, runs that match's tick outside the lock and then
+--		re-arms it. Deadlines advance by exactly one interval so ticks do not drift; a match that has fallen
+--		more than one interval behind skips ahead instead of bursting to catch up.
+--------------------------------------------------------------------------------------------------------------*/
+void MatchHost::workerThreadFunc()
+{
+	if (tuning)
+	{
+		tuning->applyThread(TUNE_THREAD_GAME);
+	}
+	std::unique_lock<std::mutex> lock(scheduleLock);
+
+	while (running)
+	{
+		if (schedule.empty())
+		{
+			scheduleSignal.wait(lock);
+			continue;
+		}
+
+		ScheduleEntry next = schedule.top();
+		std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+		if (now < next.when)
+		{
+			scheduleSignal.wait_until(lock, next.when);
+			continue;
+		}
+		schedule.pop();
+
+		Match &match = matches[next.matchId];
+		if (!match.active || match.generation != next.generation)
+		{
+			continue;
+		}
+
+		match.busy = true;
+		lock.unlock();
+		match.tick(next.matchId, &match.arena, match.context);
+		ticks++;
+		lock.lock();
+		match.busy = false;
+
+		if (match.active && match.generation == next.generation)
+		{
+			match.nextTick += match.interval;
+			now = std::chrono::steady_clock::now();
+			if (match.nextTick < now)
+			{
+				match.nextTick = now;
+			}
+
+			ScheduleEntry entry = {match.nextTick, next.matchId, match.generation};
+			schedule.push(entry);
+		}
+		scheduleSignal.notify_all();
+	}
+}
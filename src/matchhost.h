@@ -0,0 +1,120 @@
+#ifndef MATCHHOST_DEF
+#define MATCHHOST_DEF
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <stdint.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "EndPoint.h"
+#include "packets.h"
+#include "arena.h"
+#include "server.h"
+#include "tuning.h"
+
+#define MAX_MATCHES					64
+#define MATCH_QUEUE_DEPTH			256			// inbound datagrams buffered per match, power of two
+#define MATCH_DEMUX_IDLE_MS			1			// longest the demultiplexer sleeps when nothing is waiting
+#define MATCH_INVALID				-1
+#define MATCH_ANY					0			// join token meaning the match with the fewest players
+
+typedef void (*MatchTickCallback)(int32_t matchId, void *arena, void *context);
+
+struct MatchDatagram {
+	EndPoint ep;
+	uint32_t len;
+	char data[PAYLOAD_MAX_SIZE];
+};
+
+struct MatchStats {
+	uint64_t routed;
+	uint64_t unrouted;
+	uint64_t queueDrops;
+	uint64_t ticks;
+};
+
+class MatchHost
+{
+  public:
+	MatchHost();
+	~MatchHost();
+	int32_t initialize(short port);
+	Server *transport();
+	void setJoin(uint8_t header, uint32_t tokenOffset);
+	void setTuning(Tuning *tuning);
+	int32_t start(int32_t workers);
+	int32_t createMatch(MatchTickCallback tick, void *context, uint32_t tickIntervalUs, size_t arenaSize);
+	int32_t destroyMatch(int32_t matchId);
+	int32_t bindEndPoint(EndPoint ep, int32_t matchId);
+	int32_t unbindEndPoint(EndPoint ep);
+	int32_t recvMatch(int32_t matchId, EndPoint *ep, char *buffer, uint32_t size);
+	int32_t sendBytes(EndPoint ep, char *data, uint32_t len);
+	int32_t queueSend(EndPoint ep, char *data, uint32_t len);
+	int32_t flushSends();
+	Arena *matchArena(int32_t matchId);
+	void getStats(MatchStats *stats);
+	void stop();
+
+  private:
+	struct Match {
+		std::atomic<bool> active;				// set and cleared under connectionLock as well
+		uint32_t clients;						// endpoints bound to it, under connectionLock
+		Arena arena;
+		MatchTickCallback tick;
+		void *context;
+		std::chrono::microseconds interval;
+		std::chrono::steady_clock::time_point nextTick;
+		uint32_t generation;
+		bool busy;
+		MatchDatagram *queue;
+		std::atomic<uint32_t> head;
+		std::atomic<uint32_t> tail;
+	};
+
+	struct ScheduleEntry {
+		std::chrono::steady_clock::time_point when;
+		int32_t matchId;
+		uint32_t generation;
+		bool operator>(const ScheduleEntry &other) const { return when > other.when; }
+	};
+
+	static uint64_t endPointKey(EndPoint ep);
+	int32_t pickMatch(uint32_t token);
+	int32_t routeDatagram(const EndPoint &ep, const char *data, uint32_t len);
+	void enqueue(int32_t matchId, const EndPoint &ep, const char *data, uint32_t len);
+	void demuxThreadFunc();
+	void workerThreadFunc();
+
+	Server server;
+	Match matches[MAX_MATCHES];
+	std::unordered_map<uint64_t, int32_t> connections;
+	std::mutex connectionLock;
+	uint8_t joinHeader;
+	uint32_t tokenOffset;
+	Tuning *tuning;
+	std::mutex sendLock;
+
+	std::priority_queue<ScheduleEntry, std::vector<ScheduleEntry>, std::greater<ScheduleEntry> > schedule;
+	std::mutex scheduleLock;
+	std::condition_variable scheduleSignal;
+
+	std::thread demuxThread;
+	std::vector<std::thread> workerThreads;
+	std::atomic<bool> running;
+
+	std::atomic<uint64_t> routed;
+	std::atomic<uint64_t> unrouted;
+	std::atomic<uint64_t> queueDrops;
+	std::atomic<uint64_t> ticks;
+};
+
+#endif
@@ -0,0 +1,301 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	pacer.cpp -   Timer wheel that releases datagrams at scheduled times
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		Pacer();
+--					int32_t start(int socket);
+--					int32_t schedule(const sockaddr_in *addr, const char *data, uint32_t len, uint64_t dueNs);
+--					void getStats(PacerStats *stats);
+--					void stop();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The fallback for Server's paced sends when the socket cannot take SO_TXTIME launch times.
+--		schedule() copies a datagram into a fixed pool of entries and hangs it off the wheel slot
+--		for its due time. A sender thread walks the wheel one PACER_GRANULARITY_NS slot at a time,
+--		sleeping on an absolute CLOCK_MONOTONIC deadline between slots, and sends whatever each
+--		slot holds with one sendmmsg(). When the wheel is empty the thread parks on a condition
+--		variable instead of ticking.
+--
+--		Due times are clamped into the wheel's span, so a single level is enough: the server
+--		only ever schedules within one tick interval.
+---------------------------------------------------------------------------------------*/
+#include "pacer.h"
+
+static uint64_t monoNow()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+Pacer::Pacer()
+{
+	udpSocket = -1;
+	entries = new Entry[PACER_ENTRIES];
+	for (int32_t i = 0; i < PACER_ENTRIES; i++)
+	{
+		entries[i].next = i + 1 < PACER_ENTRIES ? i + 1 : -1;
+	}
+	freeList = 0;
+	for (uint32_t i = 0; i < PACER_SLOTS; i++)
+	{
+		wheel[i] = -1;
+	}
+	pending = 0;
+	cursor = 0;
+	memset(&stats, 0, sizeof(stats));
+	running.store(false);
+}
+
+Pacer::~Pacer()
+{
+	stop();
+	delete[] entries;
+}
+
+int32_t Pacer::start(int socket)
+{
+	if (running.load())
+	{
+		return -1;
+	}
+	udpSocket = socket;
+	running.store(true);
+	sender = std::thread(&Pacer::senderLoop, this);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: schedule
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t schedule(const sockaddr_in *addr, const char *data, uint32_t len, uint64_t dueNs)
+--								addr: destination
+--								data: the datagram, copied before this returns
+--								len: its length, at most PACER_DATAGRAM
+--								dueNs: CLOCK_MONOTONIC time to send it at
+--
+-- RETURNS: len once scheduled, or -1 if it is too long or every entry is in use.
+--
+-- NOTES:
+-- 		A due time already past goes in the next slot to be sent; one beyond the wheel's span goes in
+--		its last slot.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Pacer::schedule(const sockaddr_in *addr, const char *data, uint32_t len, uint64_t dueNs)
+{
+	if (len > PACER_DATAGRAM)
+	{
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	if (freeList < 0)
+	{
+		stats.dropped++;
+		return -1;
+	}
+
+	if (pending == 0)
+	{
+		cursor = monoNow() / PACER_GRANULARITY_NS;
+	}
+
+	uint64_t slot = dueNs / PACER_GRANULARITY_NS;
+	if (slot < cursor)
+	{
+		slot = cursor;
+	}
+	if (slot >= cursor + PACER_SLOTS)
+	{
+		slot = cursor + PACER_SLOTS - 1;
+	}
+
+	int32_t index = freeList;
+	Entry &entry = entries[index];
+	freeList = entry.next;
+
+	entry.addr = *addr;
+	entry.len = len;
+	entry.dueNs = dueNs;
+	memcpy(entry.data, data, len);
+	entry.next = wheel[slot & (PACER_SLOTS - 1)];
+	wheel[slot & (PACER_SLOTS - 1)] = index;
+
+	stats.scheduled++;
+	if (pending++ == 0)
+	{
+		wake.notify_one();
+	}
+	return len;
+}
+
+void Pacer::senderLoop()
+{
+	while (running.load())
+	{
+		std::unique_lock<std::mutex> guard(lock);
+		if (pending == 0)
+		{
+			wake.wait_for(guard, std::chrono::milliseconds(PACER_WAIT_MS));
+			continue;
+		}
+
+		uint64_t now = monoNow();
+		if (cursor * PACER_GRANULARITY_NS > now)
+		{
+			guard.unlock();
+			uint64_t deadline = cursor * PACER_GRANULARITY_NS;
+			struct timespec ts;
+			ts.tv_sec = deadline / 1000000000ull;
+			ts.tv_nsec = deadline % 1000000000ull;
+			clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, 0);
+			continue;
+		}
+
+		int32_t first = wheel[cursor & (PACER_SLOTS - 1)];
+		wheel[cursor & (PACER_SLOTS - 1)] = -1;
+		cursor++;
+		guard.unlock();
+
+		if (first >= 0)
+		{
+			sendSlot(first, now);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sendSlot
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void sendSlot(int32_t first, uint64_t now)
+--								first: head of the list taken off the wheel
+--								now: when the slot came due
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Sender thread only. The list is already off the wheel, so the entries are sent without the
+--		lock held and only go back on the free list afterwards.
+--------------------------------------------------------------------------------------------------------------*/
+void Pacer::sendSlot(int32_t first, uint64_t now)
+{
+	struct mmsghdr msgs[PACER_BATCH];
+	struct iovec iovecs[PACER_BATCH];
+	int32_t taken[PACER_BATCH];
+	uint64_t sent = 0;
+	uint64_t dropped = 0;
+	uint64_t late = 0;
+
+	int32_t index = first;
+	while (index >= 0)
+	{
+		int32_t count = 0;
+		while (index >= 0 && count < PACER_BATCH)
+		{
+			Entry &entry = entries[index];
+			iovecs[count].iov_base = entry.data;
+			iovecs[count].iov_len = entry.len;
+			memset(&msgs[count], 0, sizeof(struct mmsghdr));
+			msgs[count].msg_hdr.msg_name = &entry.addr;
+			msgs[count].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			msgs[count].msg_hdr.msg_iov = &iovecs[count];
+			msgs[count].msg_hdr.msg_iovlen = 1;
+			late += now > entry.dueNs + PACER_GRANULARITY_NS;
+			taken[count++] = index;
+			index = entry.next;
+		}
+
+		int32_t done = 0;
+		while (done < count)
+		{
+			int32_t result = sendmmsg(udpSocket, &msgs[done], count - done, 0);
+			if (result <= 0)
+			{
+				perror("paced sendmmsg failed");
+				dropped += count - done;
+				break;
+			}
+			done += result;
+		}
+		sent += done;
+
+		std::lock_guard<std::mutex> guard(lock);
+		for (int32_t i = 0; i < count; i++)
+		{
+			entries[taken[i]].next = freeList;
+			freeList = taken[i];
+		}
+		pending -= count;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	stats.sent += sent;
+	stats.dropped += dropped;
+	stats.late += late;
+}
+
+void Pacer::getStats(PacerStats *out)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	*out = stats;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: stop
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void stop()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Joins the sender thread. Datagrams still on the wheel are discarded.
+--------------------------------------------------------------------------------------------------------------*/
+void Pacer::stop()
+{
+	if (!running.load())
+	{
+		return;
+	}
+
+	running.store(false);
+	wake.notify_one();
+	if (sender.joinable())
+	{
+		sender.join();
+	}
+}
@@ -0,0 +1,66 @@
+#ifndef PACER_DEF
+#define PACER_DEF
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#define PACER_SLOTS					1024		// wheel slots, power of two
+#define PACER_GRANULARITY_NS		50000		// one slot; the wheel spans about 51 ms
+#define PACER_ENTRIES				256			// datagrams waiting at once
+#define PACER_DATAGRAM				2048		// largest datagram, matches SERVER_SLOT_SIZE
+#define PACER_BATCH					64			// datagrams per sendmmsg() from one slot
+#define PACER_WAIT_MS				10
+
+struct PacerStats {
+	uint64_t scheduled;
+	uint64_t sent;
+	uint64_t dropped;							// no free entry, or the send failed
+	uint64_t late;								// went out more than a slot after it was due
+};
+
+class Pacer
+{
+  public:
+	Pacer();
+	~Pacer();
+	int32_t start(int socket);
+	int32_t schedule(const sockaddr_in *addr, const char *data, uint32_t len, uint64_t dueNs);
+	void getStats(PacerStats *stats);
+	void stop();
+
+  private:
+	struct Entry {
+		int32_t next;
+		uint32_t len;
+		uint64_t dueNs;
+		sockaddr_in addr;
+		char data[PACER_DATAGRAM];
+	};
+
+	void senderLoop();
+	void sendSlot(int32_t first, uint64_t now);
+
+	int udpSocket;
+	Entry *entries;
+	int32_t freeList;
+	int32_t wheel[PACER_SLOTS];					// first entry in each slot, or -1
+	uint32_t pending;
+	uint64_t cursor;							// next slot to send, in PACER_GRANULARITY_NS units
+
+	PacerStats stats;
+	std::mutex lock;
+	std::condition_variable wake;
+	std::atomic<bool> running;
+	std::thread sender;
+};
+
+#endif
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdint.h>
+
 #define PREFIX_REQUEST				0x01
 #define PREFIX_RESPONSE				0x02
 #define PREFIX_CHALLENGE			0x03
@@ -14,13 +16,16 @@
 #define RESPONSE_DATA_SIZE			16
 #define CHALLENGE_DATA_SIZE			512
 
-typedef struct REQUEST_P {
+// Wire structs: no padding between the prefix and the 64 bit fields
+#pragma pack(push, 1)
+
+struct REQUEST_P {
 	char prefix;
 	char protocol[4];
 	char connect_token[CONNECT_TOKEN_SIZE];
 };
 
-typedef struct RESPONSE_P {
+struct RESPONSE_P {
 	char prefix;
 	uint64_t seq;
 	uint64_t ack;
@@ -28,13 +33,13 @@ typedef struct RESPONSE_P {
 };
 
 
-typedef struct CHALLENGE_P {
+struct CHALLENGE_P {
 	char prefix = PREFIX_CHALLENGE;
 	uint64_t seq;
 	char challenge_data[CHALLENGE_DATA_SIZE];
 };
 
-typedef struct CHALLENGE_RESPONSE_P {
+struct CHALLENGE_RESPONSE_P {
 	char prefix = PREFIX_CHALLENGE_RESPONSE;
 	uint64_t seq;
 	uint64_t ack;
@@ -42,15 +47,17 @@ typedef struct CHALLENGE_RESPONSE_P {
 };
 
 
-typedef struct KEEP_ALIVE_P {
+struct KEEP_ALIVE_P {
 	char prefix = PREFIX_KEEP_ALIVE;
 	uint64_t seq;
 	uint64_t ack;
 };
 
-typedef struct PAYLOAD {
+struct PAYLOAD {
 	char prefix = PREFIX_PAYLOAD;
 	uint64_t seq;
 	uint64_t ack;
-	char data[];//maxsize of 1200
-};
\ No newline at end of file
+	char data[PAYLOAD_MAX_SIZE];
+};
+
+#pragma pack(pop)
@@ -0,0 +1,64 @@
+#ifndef PACKETSCHEMA_DEF
+#define PACKETSCHEMA_DEF
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// C++ side of packets.def. For each packet Name:
+//	NameWire	a packed struct with the packet's exact layout, for sizeof and offsetof
+//	NameView	wraps a buffer holding the packet and reads and writes its fields in place:
+//				x() / x(value) for a field, x() for the address of an array,
+//				NameView::x_at for an offset and NameView::SIZE for the size, both constant
+
+// Fields are copied in and out, so a view works on a buffer at any alignment
+template <typename T>
+static inline T wireGet(const char *at)
+{
+	T value;
+	memcpy(&value, at, sizeof(T));
+	return value;
+}
+
+template <typename T>
+static inline void wireSet(char *at, T value)
+{
+	memcpy(at, &value, sizeof(T));
+}
+
+#define PACKET(name)						struct __attribute__((packed)) name##Wire {
+#define FIELD(name, field, type)			type field;
+#define ARRAY(name, field, type, count)		type field[count];
+#define PACKET_END(name)					};
+#include "packets.def"
+#undef PACKET
+#undef FIELD
+#undef ARRAY
+#undef PACKET_END
+
+#define PACKET(name) \
+	class name##View \
+	{ \
+	  public: \
+		typedef name##Wire Wire; \
+		enum { SIZE = sizeof(Wire) }; \
+		explicit name##View(char *buffer) : data(buffer) {} \
+		char *raw() const { return data; }
+#define FIELD(name, field, type) \
+		enum { field##_at = offsetof(Wire, field) }; \
+		type field() const { return wireGet<type>(data + field##_at); } \
+		void field(type value) { wireSet<type>(data + field##_at, value); }
+#define ARRAY(name, field, type, count) \
+		enum { field##_at = offsetof(Wire, field), field##_count = (count) }; \
+		char *field() const { return data + field##_at; }
+#define PACKET_END(name) \
+	  private: \
+		char *data; \
+	};
+#include "packets.def"
+#undef PACKET
+#undef FIELD
+#undef ARRAY
+#undef PACKET_END
+
+#endif
@@ -0,0 +1,296 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	poshistory.cpp -   Per-tick player position history for lag compensation
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		PositionHistory();
+--					void beginTick(uint32_t tick);
+--					void store(int32_t id, float x, float z, float r);
+--					uint32_t latest();
+--					int32_t resolve(uint32_t tick);
+--					int32_t positionAt(uint32_t tick, int32_t id, float *x, float *z, float *r);
+--					int32_t hits(uint32_t tick, float x, float z, float radius, int32_t exclude,
+--								 uint8_t *ids, uint32_t maxIds);
+--					int32_t sweep(uint32_t tick, float x, float z, float dx, float dz, float radius,
+--								  int32_t exclude, float *t);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: swept hit test for continuous bullet collision
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The server records every player's position each time it builds a snapshot, under the tick
+--		number of that snapshot. When a shot arrives, the shooter's newest acknowledged snapshot says
+--		which tick they were looking at, and collision is tested against the players as they were
+--		then instead of where they are now.
+--
+--		The last HISTORY_TICKS ticks are kept in a fixed ring, so nothing is allocated after
+--		construction. A tick that has already left the ring, or that has not happened yet, is
+--		clamped to the oldest or newest one kept.
+---------------------------------------------------------------------------------------*/
+#include "poshistory.h"
+
+PositionHistory::PositionHistory()
+{
+	memset(slots, 0, sizeof(slots));
+	memset(ticks, 0, sizeof(ticks));
+	newest = 0;
+	started = false;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: beginTick
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void beginTick(uint32_t tick)
+--								tick: the snapshot tick about to be recorded; must increase
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Clears the slot the tick lands in. Every player in the snapshot is then passed to store.
+--------------------------------------------------------------------------------------------------------------*/
+void PositionHistory::beginTick(uint32_t tick)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	uint32_t index = tick & (HISTORY_TICKS - 1);
+	memset(slots[index].present, 0, HISTORY_PLAYERS);
+	ticks[index] = tick;
+	newest = tick;
+	started = true;
+}
+
+void PositionHistory::store(int32_t id, float x, float z, float r)
+{
+	if (id < 0 || id >= HISTORY_PLAYERS)
+	{
+		return;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	Slot &slot = slots[newest & (HISTORY_TICKS - 1)];
+	slot.x[id] = x;
+	slot.z[id] = z;
+	slot.r[id] = r;
+	slot.present[id] = 1;
+}
+
+uint32_t PositionHistory::latest()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return newest;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: resolve
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t resolve(uint32_t tick)
+--
+-- RETURNS: the ring index holding tick, clamped into the recorded range, or -1 if nothing is recorded.
+--
+-- NOTES:
+-- 		Called with the lock held by the public queries; takes no lock itself.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t PositionHistory::resolve(uint32_t tick)
+{
+	if (!started)
+	{
+		return -1;
+	}
+
+	int32_t behind = (int32_t)(newest - tick);
+	if (behind < 0)
+	{
+		tick = newest;
+	}
+	else if (behind >= HISTORY_TICKS || behind > (int32_t)newest)
+	{
+		tick = newest - (newest < HISTORY_TICKS - 1 ? newest : HISTORY_TICKS - 1);
+	}
+
+	uint32_t index = tick & (HISTORY_TICKS - 1);
+	return ticks[index] == tick ? (int32_t)index : (int32_t)(newest & (HISTORY_TICKS - 1));
+}
+
+int32_t PositionHistory::positionAt(uint32_t tick, int32_t id, float *x, float *z, float *r)
+{
+	if (id < 0 || id >= HISTORY_PLAYERS)
+	{
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	int32_t index = resolve(tick);
+	if (index < 0 || !slots[index].present[id])
+	{
+		return -1;
+	}
+
+	*x = slots[index].x[id];
+	*z = slots[index].z[id];
+	*r = slots[index].r[id];
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: hits
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t hits(uint32_t tick, float x, float z, float radius, int32_t exclude, uint8_t *ids,
+--						   uint32_t maxIds)
+--								tick: the tick to test against
+--								x, z: centre of the bullet
+--								radius: bullet size plus player radius
+--								exclude: the shooter's id, never reported
+--								ids: receives the ids of the players hit
+--								maxIds: size of ids
+--
+-- RETURNS: the number of players hit, or 0 if nothing is recorded yet.
+--
+-- NOTES:
+-- 		Same test as Bullet.IsColliding, distance strictly less than the radius sum, without the square root.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t PositionHistory::hits(uint32_t tick, float x, float z, float radius, int32_t exclude, uint8_t *ids, uint32_t maxIds)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int32_t index = resolve(tick);
+	if (index < 0)
+	{
+		return 0;
+	}
+
+	const Slot &slot = slots[index];
+	float limit = radius * radius;
+	uint32_t count = 0;
+
+	for (int32_t id = 0; id < HISTORY_PLAYERS && count < maxIds; id++)
+	{
+		float dx = slot.x[id] - x;
+		float dz = slot.z[id] - z;
+		if (slot.present[id] && id != exclude && dx * dx + dz * dz < limit)
+		{
+			ids[count++] = (uint8_t)id;
+		}
+	}
+	return (int32_t)count;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sweep
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t sweep(uint32_t tick, float x, float z, float dx, float dz, float radius, int32_t exclude,
+--							float *t)
+--								tick: the tick the segment starts on
+--								x, z: centre of the bullet at the start of the segment
+--								dx, dz: the bullet's movement over the tick
+--								radius: bullet size plus player radius
+--								exclude: the shooter's id, never reported
+--								t: set to the fraction of the segment at which the first player is hit
+--
+-- RETURNS: the id of the first player hit, or -1 if the segment hits nobody or nothing is recorded yet.
+--
+-- NOTES:
+-- 		Each player moves in a straight line from where they were on tick to where they were on the tick
+--		after, or stands still if that is not recorded, so the test is a moving point against a circle
+--		at rest in the player's frame. A player already within radius at the start is hit at 0, the same
+--		strict test as hits.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t PositionHistory::sweep(uint32_t tick, float x, float z, float dx, float dz, float radius, int32_t exclude, float *t)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int32_t index = resolve(tick);
+	if (index < 0)
+	{
+		return -1;
+	}
+
+	const Slot &slot = slots[index];
+	const Slot &next = slots[resolve(tick + 1)];
+	float limit = radius * radius;
+	float first = 2.0f;
+	int32_t hit = -1;
+
+	for (int32_t id = 0; id < HISTORY_PLAYERS; id++)
+	{
+		if (!slot.present[id] || id == exclude)
+		{
+			continue;
+		}
+
+		// relative position w and velocity u of the bullet in the player's frame
+		float wx = x - slot.x[id];
+		float wz = z - slot.z[id];
+		float ux = next.present[id] ? dx - (next.x[id] - slot.x[id]) : dx;
+		float uz = next.present[id] ? dz - (next.z[id] - slot.z[id]) : dz;
+
+		float c = wx * wx + wz * wz - limit;
+		if (c < 0)
+		{
+			if (first > 0)
+			{
+				first = 0;
+				hit = id;
+			}
+			continue;
+		}
+
+		float a = ux * ux + uz * uz;
+		float b = wx * ux + wz * uz;
+		float disc = b * b - a * c;
+		if (b >= 0 || a <= 0 || disc <= 0)
+		{
+			continue;
+		}
+
+		float enter = (-b - sqrtf(disc)) / a;
+		if (enter <= 1.0f && enter < first)
+		{
+			first = enter;
+			hit = id;
+		}
+	}
+
+	if (hit >= 0)
+	{
+		*t = first;
+	}
+	return hit;
+}
@@ -0,0 +1,41 @@
+#ifndef POSHISTORY_DEF
+#define POSHISTORY_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include <mutex>
+
+#define HISTORY_TICKS				128			// two seconds at 64 Hz, power of two
+#define HISTORY_PLAYERS				256			// indexed by player id
+
+class PositionHistory
+{
+  public:
+	PositionHistory();
+	void beginTick(uint32_t tick);
+	void store(int32_t id, float x, float z, float r);
+	uint32_t latest();
+	int32_t resolve(uint32_t tick);
+	int32_t positionAt(uint32_t tick, int32_t id, float *x, float *z, float *r);
+	int32_t hits(uint32_t tick, float x, float z, float radius, int32_t exclude, uint8_t *ids, uint32_t maxIds);
+	int32_t sweep(uint32_t tick, float x, float z, float dx, float dz, float radius, int32_t exclude, float *t);
+
+  private:
+	// One slot per tick; within a slot each field is its own array over player ids, so a hit test
+	// sweeps three contiguous float arrays
+	struct Slot {
+		float x[HISTORY_PLAYERS];
+		float z[HISTORY_PLAYERS];
+		float r[HISTORY_PLAYERS];
+		uint8_t present[HISTORY_PLAYERS];
+	};
+
+	std::mutex lock;
+	Slot slots[HISTORY_TICKS];
+	uint32_t ticks[HISTORY_TICKS];
+	uint32_t newest;
+	bool started;
+};
+
+#endif
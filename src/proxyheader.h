@@ -0,0 +1,30 @@
+#ifndef PROXYHEADER_DEF
+#define PROXYHEADER_DEF
+
+#include <stdint.h>
+#include "EndPoint.h"
+
+// Datagrams between a FrontProxy and its backends carry the client's address in front of the
+// payload: [addr, 4 bytes big endian][port, 2 bytes big endian][payload]
+#define PROXY_HEADER_SIZE			6
+
+static inline void proxyEncode(char *out, EndPoint ep)
+{
+	out[0] = (char)(ep.addr >> 24);
+	out[1] = (char)(ep.addr >> 16);
+	out[2] = (char)(ep.addr >> 8);
+	out[3] = (char)ep.addr;
+	out[4] = (char)(ep.port >> 8);
+	out[5] = (char)ep.port;
+}
+
+static inline EndPoint proxyDecode(const char *in)
+{
+	const uint8_t *bytes = (const uint8_t *)in;
+	EndPoint ep;
+	ep.addr = (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 | (uint32_t)bytes[2] << 8 | bytes[3];
+	ep.port = (uint16_t)(bytes[4] << 8 | bytes[5]);
+	return ep;
+}
+
+#endif
@@ -0,0 +1,91 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	proxymain.cpp -   Command line entry point of the UDP front proxy
+--
+--	PROGRAM:		frontproxy
+--
+--	FUNCTIONS:		int main(int argc, char **argv)
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		frontproxy <public port> <internal port> <backend> [<backend> ...]
+--
+--		Each backend is ip:port[:token[:capacity]], the address a match server listens on. Start
+--		the match servers with PROXY_UPSTREAM set to this host and the internal port, and each
+--		with its own SERVER_PORT. A join naming a token goes to the backend given that token; one
+--		without goes to the least loaded backend with room. Capacity defaults to 30 players.
+--		SIGINT or SIGTERM stops the proxy.
+---------------------------------------------------------------------------------------*/
+#include <signal.h>
+#include <stdlib.h>
+#include "frontproxy.h"
+
+#define PROXY_DEFAULT_CAPACITY		30
+
+static FrontProxy *proxy;
+
+static void onSignal(int)
+{
+	proxy->stop();
+}
+
+static int parseBackend(const char *arg, EndPoint *ep, uint32_t *token, uint32_t *capacity)
+{
+	unsigned a, b, c, d, port;
+	unsigned t = PROXY_ANY_MATCH;
+	unsigned cap = PROXY_DEFAULT_CAPACITY;
+
+	int fields = sscanf(arg, "%u.%u.%u.%u:%u:%u:%u", &a, &b, &c, &d, &port, &t, &cap);
+	if (fields < 5 || a > 255 || b > 255 || c > 255 || d > 255 || port > 65535)
+	{
+		return -1;
+	}
+
+	ep->addr = a << 24 | b << 16 | c << 8 | d;
+	ep->port = (uint16_t)port;
+	*token = t;
+	*capacity = cap;
+	return 0;
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 4)
+	{
+		fprintf(stderr, "usage: %s <public port> <internal port> <ip:port[:token[:capacity]]> ...\n", argv[0]);
+		return 1;
+	}
+
+	proxy = new FrontProxy();
+	if (proxy->init((short)atoi(argv[1]), (short)atoi(argv[2])) != 0)
+	{
+		fprintf(stderr, "could not open ports %s and %s\n", argv[1], argv[2]);
+		return 1;
+	}
+
+	for (int i = 3; i < argc; i++)
+	{
+		EndPoint ep;
+		uint32_t token;
+		uint32_t capacity;
+		if (parseBackend(argv[i], &ep, &token, &capacity) != 0 || proxy->addBackend(ep, token, capacity) < 0)
+		{
+			fprintf(stderr, "bad backend %s\n", argv[i]);
+			return 1;
+		}
+		printf("backend %s: token %u, %u players\n", argv[i], token, capacity);
+	}
+
+	signal(SIGINT, onSignal);
+	signal(SIGTERM, onSignal);
+
+	int32_t result = proxy->run();
+	delete proxy;
+	return result == 0 ? 0 : 1;
+}
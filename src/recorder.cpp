@@ -0,0 +1,660 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	recorder.cpp -   Append-only memory-mapped match recorder and its reader
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		MatchRecorder();
+--					int32_t open(const char *path, uint64_t capacity, uint32_t stateSize, uint32_t keyInterval);
+--					int32_t record(uint32_t tick, const char *state);
+--					uint32_t dropped();
+--					void close();
+--
+--					MatchReader();
+--					int32_t open(const char *path);
+--					uint32_t firstTick();
+--					uint32_t lastTick();
+--					uint32_t stateSize();
+--					int32_t seek(uint32_t tick, char *state, uint32_t size, uint32_t *found);
+--					void close();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The recorder keeps one fixed-size world state per tick. record() is the only call the game
+--		side makes; it copies the state into a ring of staging slots and returns, dropping the tick
+--		if the ring is full rather than waiting. A writer thread drains the ring into a file that is
+--		pre-allocated and mapped, so appending is a memcpy into the page cache.
+--
+--		Every keyInterval-th record is a keyframe holding the whole state. The records between are
+--		deltas against the record before them: the state is XORed with its predecessor and written
+--		as [varint unchanged bytes][varint changed bytes][changed bytes] runs, so a tick where a
+--		handful of players moved costs a few dozen bytes. Keyframes are listed in an index after
+--		the header, which is what lets the reader seek: it binary searches the index for the last
+--		keyframe at or before the wanted tick and replays deltas forward from there.
+--
+--		The header's committed count only moves once the records it covers are complete, so a
+--		reader can open a file that is still being recorded. When the file fills, the writer grows
+--		it on its own thread; the game never waits on the disk.
+---------------------------------------------------------------------------------------*/
+#include "recorder.h"
+
+static uint32_t writeVarint(char *out, uint32_t value)
+{
+	uint32_t n = 0;
+	while (value >= 0x80)
+	{
+		out[n++] = (char)(value | 0x80);
+		value >>= 7;
+	}
+	out[n++] = (char)value;
+	return n;
+}
+
+static int32_t readVarint(const char *in, uint32_t len, uint32_t *pos, uint32_t *value)
+{
+	uint32_t result = 0;
+	for (uint32_t shift = 0; shift < 35; shift += 7)
+	{
+		if (*pos >= len)
+		{
+			return -1;
+		}
+		uint8_t byte = (uint8_t)in[(*pos)++];
+		result |= (uint32_t)(byte & 0x7F) << shift;
+		if (!(byte & 0x80))
+		{
+			*value = result;
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// Encodes state as runs against previous; see the file notes
+static uint32_t encodeDelta(const char *previous, const char *state, uint32_t size, char *out)
+{
+	uint32_t pos = 0;
+	uint32_t len = 0;
+
+	while (pos < size)
+	{
+		uint32_t same = 0;
+		while (pos + same < size && state[pos + same] == previous[pos + same])
+		{
+			same++;
+		}
+		pos += same;
+
+		// A changed run only ends at three unchanged bytes, so short gaps do not cost a run header
+		uint32_t changed = 0;
+		uint32_t quiet = 0;
+		while (pos + changed + quiet < size && quiet < 3)
+		{
+			if (state[pos + changed + quiet] == previous[pos + changed + quiet])
+			{
+				quiet++;
+			}
+			else
+			{
+				changed += quiet + 1;
+				quiet = 0;
+			}
+		}
+
+		len += writeVarint(out + len, same);
+		len += writeVarint(out + len, changed);
+		for (uint32_t i = 0; i < changed; i++)
+		{
+			out[len++] = state[pos + i] ^ previous[pos + i];
+		}
+		pos += changed;
+	}
+
+	return len;
+}
+
+static int32_t applyDelta(char *state, uint32_t size, const char *delta, uint32_t len)
+{
+	uint32_t pos = 0;
+	uint32_t in = 0;
+
+	while (in < len)
+	{
+		uint32_t same;
+		uint32_t changed;
+		if (readVarint(delta, len, &in, &same) < 0 || readVarint(delta, len, &in, &changed) < 0)
+		{
+			return -1;
+		}
+		if (same > size - pos || changed > size - pos - same || changed > len - in)
+		{
+			return -1;
+		}
+		pos += same;
+		for (uint32_t i = 0; i < changed; i++)
+		{
+			state[pos++] ^= delta[in++];
+		}
+	}
+
+	return 0;
+}
+
+
+MatchRecorder::MatchRecorder() : head(0), tail(0), droppedCount(0), running(false)
+{
+	fd = -1;
+	map = 0;
+	mapSize = 0;
+	header = 0;
+	slots = 0;
+	previous = 0;
+	scratch = 0;
+	hasPrevious = false;
+	sinceKey = 0;
+}
+
+MatchRecorder::~MatchRecorder()
+{
+	close();
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: open
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t open(const char *path, uint64_t capacity, uint32_t stateSize, uint32_t keyInterval)
+--								path: the file to record to; an existing file is replaced
+--								capacity: record bytes to pre-allocate; the file grows past this if needed
+--								stateSize: bytes in one tick's world state
+--								keyInterval: records per keyframe
+--
+-- RETURNS: 0 on success, or -1 if the file could not be created or mapped.
+--
+-- NOTES:
+-- 		Starts the writer thread. Only one thread may call record() afterwards.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchRecorder::open(const char *path, uint64_t capacity, uint32_t size, uint32_t interval)
+{
+	if (map != 0 || size == 0 || interval == 0)
+	{
+		return -1;
+	}
+
+	if ((fd = ::open(path, O_RDWR | O_CREAT | O_TRUNC, 0644)) < 0)
+	{
+		perror("recorder open failed");
+		return -1;
+	}
+
+	mapSize = RECORDER_DATA + capacity;
+	if (posix_fallocate(fd, 0, mapSize) != 0 && ftruncate(fd, mapSize) < 0)
+	{
+		perror("recorder allocate failed");
+		::close(fd);
+		fd = -1;
+		return -1;
+	}
+
+	map = (char *)mmap(0, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+	{
+		perror("recorder mmap failed");
+		map = 0;
+		::close(fd);
+		fd = -1;
+		return -1;
+	}
+
+	stateSize = size;
+	keyInterval = interval;
+	header = (RecorderHeader *)map;
+	memset(header, 0, sizeof(RecorderHeader));
+	header->stateSize = size;
+	header->keyInterval = interval;
+	header->capacity = capacity;
+	__atomic_store_n(&header->magic, RECORDER_MAGIC, __ATOMIC_RELEASE);
+
+	slots = new char[(size_t)RECORDER_SLOTS * size];
+	previous = new char[size];
+	scratch = new char[(size_t)size * 3 + 16];
+	hasPrevious = false;
+	sinceKey = 0;
+	head.store(0);
+	tail.store(0);
+	droppedCount.store(0);
+
+	running.store(true);
+	writer = std::thread(&MatchRecorder::writerLoop, this);
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: record
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t record(uint32_t tick, const char *state)
+--								tick: the server tick, increasing from call to call
+--								state: stateSize bytes of world state
+--
+-- RETURNS: 0 if the tick was staged, or -1 if it was dropped because the writer is behind.
+--
+-- NOTES:
+-- 		Never blocks: one memcpy into the staging ring and a wakeup for the writer.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchRecorder::record(uint32_t tick, const char *state)
+{
+	if (!running.load(std::memory_order_relaxed))
+	{
+		return -1;
+	}
+
+	uint32_t h = head.load(std::memory_order_relaxed);
+	if (h - tail.load(std::memory_order_acquire) >= RECORDER_SLOTS)
+	{
+		droppedCount.fetch_add(1, std::memory_order_relaxed);
+		return -1;
+	}
+
+	uint32_t slot = h & (RECORDER_SLOTS - 1);
+	memcpy(slots + (size_t)slot * stateSize, state, stateSize);
+	slotTicks[slot] = tick;
+	head.store(h + 1, std::memory_order_release);
+	wake.notify_one();
+	return 0;
+}
+
+uint32_t MatchRecorder::dropped()
+{
+	return droppedCount.load(std::memory_order_relaxed);
+}
+
+void MatchRecorder::writerLoop()
+{
+	while (true)
+	{
+		uint32_t t = tail.load(std::memory_order_relaxed);
+		if (t == head.load(std::memory_order_acquire))
+		{
+			if (!running.load())
+			{
+				break;
+			}
+			std::unique_lock<std::mutex> guard(wakeLock);
+			wake.wait_for(guard, std::chrono::milliseconds(RECORDER_WAIT_MS));
+			continue;
+		}
+
+		uint32_t slot = t & (RECORDER_SLOTS - 1);
+		append(slotTicks[slot], slots + (size_t)slot * stateSize);
+		tail.store(t + 1, std::memory_order_release);
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: append
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t append(uint32_t tick, const char *state)
+--
+-- RETURNS: 0 on success, or -1 if the file could not grow to fit the record.
+--
+-- NOTES:
+-- 		Writer thread only. The record and its index entry are written before committed moves.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchRecorder::append(uint32_t tick, const char *state)
+{
+	bool keyframe = !hasPrevious || sinceKey >= keyInterval;
+	const char *payload = state;
+	uint32_t len = stateSize;
+
+	if (!keyframe)
+	{
+		len = encodeDelta(previous, state, stateSize, scratch);
+		payload = scratch;
+	}
+
+	uint64_t offset = header->committed;
+	uint64_t needed = RECORDER_RECORD_HEADER + len;
+	if (offset + needed > header->capacity && grow(needed) < 0)
+	{
+		droppedCount.fetch_add(1, std::memory_order_relaxed);
+		header->dropped = droppedCount.load(std::memory_order_relaxed);
+		return -1;
+	}
+
+	char *out = map + RECORDER_DATA + offset;
+	*(uint32_t *)out = tick;
+	*(uint32_t *)(out + 4) = len | (keyframe ? RECORDER_KEYFRAME : 0);
+	memcpy(out + RECORDER_RECORD_HEADER, payload, len);
+
+	if (keyframe && header->keyCount < RECORDER_MAX_KEYFRAMES)
+	{
+		RecorderKey *key = (RecorderKey *)(map + RECORDER_HEADER_SIZE) + header->keyCount;
+		key->tick = tick;
+		key->offset = offset;
+		__atomic_store_n(&header->keyCount, header->keyCount + 1, __ATOMIC_RELEASE);
+	}
+
+	if (header->records == 0)
+	{
+		header->firstTick = tick;
+	}
+	header->lastTick = tick;
+	header->records++;
+	header->dropped = droppedCount.load(std::memory_order_relaxed);
+	__atomic_store_n(&header->committed, offset + needed, __ATOMIC_RELEASE);
+
+	memcpy(previous, state, stateSize);
+	hasPrevious = true;
+	sinceKey = keyframe ? 1 : sinceKey + 1;
+	return 0;
+}
+
+// Doubles the record area, or more if one record needs it. Writer thread only.
+int32_t MatchRecorder::grow(uint64_t needed)
+{
+	uint64_t capacity = header->capacity * 2;
+	if (capacity < header->committed + needed)
+	{
+		capacity = header->committed + needed;
+	}
+
+	size_t newSize = RECORDER_DATA + capacity;
+	if (posix_fallocate(fd, 0, newSize) != 0 && ftruncate(fd, newSize) < 0)
+	{
+		perror("recorder grow failed");
+		return -1;
+	}
+
+	char *moved = (char *)mremap(map, mapSize, newSize, MREMAP_MAYMOVE);
+	if (moved == MAP_FAILED)
+	{
+		perror("recorder mremap failed");
+		return -1;
+	}
+
+	map = moved;
+	mapSize = newSize;
+	header = (RecorderHeader *)map;
+	header->capacity = capacity;
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: close
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void close()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Drains whatever is still staged, then trims the unused pre-allocation off the end of the file.
+--------------------------------------------------------------------------------------------------------------*/
+void MatchRecorder::close()
+{
+	if (map == 0)
+	{
+		return;
+	}
+
+	running.store(false);
+	wake.notify_one();
+	if (writer.joinable())
+	{
+		writer.join();
+	}
+
+	uint64_t committed = header->committed;
+	header->capacity = committed;
+	msync(map, mapSize, MS_SYNC);
+	munmap(map, mapSize);
+	if (ftruncate(fd, RECORDER_DATA + committed) < 0)
+	{
+		perror("recorder trim failed");
+	}
+	::close(fd);
+
+	delete[] slots;
+	delete[] previous;
+	delete[] scratch;
+	map = 0;
+	header = 0;
+	slots = 0;
+	previous = 0;
+	scratch = 0;
+	fd = -1;
+}
+
+
+MatchReader::MatchReader()
+{
+	fd = -1;
+	map = 0;
+	mapSize = 0;
+	header = 0;
+}
+
+MatchReader::~MatchReader()
+{
+	close();
+}
+
+int32_t MatchReader::open(const char *path)
+{
+	if (map != 0)
+	{
+		return -1;
+	}
+
+	if ((fd = ::open(path, O_RDONLY)) < 0)
+	{
+		perror("reader open failed");
+		return -1;
+	}
+
+	if (remap() < 0 || header->magic != RECORDER_MAGIC)
+	{
+		close();
+		return -1;
+	}
+	return 0;
+}
+
+// Maps the whole file again if it has grown since it was last mapped
+int32_t MatchReader::remap()
+{
+	struct stat info;
+	if (fstat(fd, &info) < 0 || (size_t)info.st_size < RECORDER_DATA)
+	{
+		return -1;
+	}
+	if ((size_t)info.st_size == mapSize)
+	{
+		return 0;
+	}
+
+	if (map != 0)
+	{
+		munmap(map, mapSize);
+	}
+	map = (char *)mmap(0, info.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	if (map == MAP_FAILED)
+	{
+		map = 0;
+		header = 0;
+		mapSize = 0;
+		return -1;
+	}
+
+	mapSize = info.st_size;
+	header = (RecorderHeader *)map;
+	return 0;
+}
+
+uint32_t MatchReader::firstTick()
+{
+	return header ? header->firstTick : 0;
+}
+
+uint32_t MatchReader::lastTick()
+{
+	return header ? header->lastTick : 0;
+}
+
+uint32_t MatchReader::stateSize()
+{
+	return header ? header->stateSize : 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: seek
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t seek(uint32_t tick, char *state, uint32_t size, uint32_t *found)
+--								tick: the tick wanted
+--								state: receives the world state
+--								size: size of state, at least stateSize()
+--								found: set to the tick actually returned
+--
+-- RETURNS: 0 on success, or -1 if tick is before the first record or the file is damaged.
+--
+-- NOTES:
+-- 		Returns the last recorded tick at or before the one asked for, so a tick dropped while
+--		recording resolves to the one before it.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t MatchReader::seek(uint32_t tick, char *state, uint32_t size, uint32_t *found)
+{
+	if (header == 0 || size < header->stateSize)
+	{
+		return -1;
+	}
+
+	uint64_t committed = __atomic_load_n(&header->committed, __ATOMIC_ACQUIRE);
+	if (RECORDER_DATA + committed > mapSize && (remap() < 0 || RECORDER_DATA + committed > mapSize))
+	{
+		return -1;
+	}
+	uint32_t keyCount = __atomic_load_n(&header->keyCount, __ATOMIC_ACQUIRE);
+	const RecorderKey *keys = (const RecorderKey *)(map + RECORDER_HEADER_SIZE);
+	const char *data = map + RECORDER_DATA;
+	uint32_t stateLen = header->stateSize;
+
+	// Last indexed keyframe at or before tick and inside the committed records
+	int32_t low = 0;
+	int32_t high = (int32_t)keyCount - 1;
+	int32_t key = -1;
+	while (low <= high)
+	{
+		int32_t mid = (low + high) / 2;
+		if ((int32_t)(keys[mid].tick - tick) <= 0 && keys[mid].offset < committed)
+		{
+			key = mid;
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid - 1;
+		}
+	}
+	if (key < 0)
+	{
+		return -1;
+	}
+
+	uint64_t pos = keys[key].offset;
+	bool have = false;
+	while (pos + RECORDER_RECORD_HEADER <= committed)
+	{
+		uint32_t recordTick = *(const uint32_t *)(data + pos);
+		uint32_t word = *(const uint32_t *)(data + pos + 4);
+		uint32_t len = word & ~RECORDER_KEYFRAME;
+		if (pos + RECORDER_RECORD_HEADER + len > committed || (have && (int32_t)(recordTick - tick) > 0))
+		{
+			break;
+		}
+
+		const char *payload = data + pos + RECORDER_RECORD_HEADER;
+		if (word & RECORDER_KEYFRAME)
+		{
+			if (len != stateLen)
+			{
+				return -1;
+			}
+			memcpy(state, payload, stateLen);
+		}
+		else if (!have || applyDelta(state, stateLen, payload, len) < 0)
+		{
+			return -1;
+		}
+
+		have = true;
+		*found = recordTick;
+		pos += RECORDER_RECORD_HEADER + len;
+	}
+
+	return have ? 0 : -1;
+}
+
+void MatchReader::close()
+{
+	if (map != 0)
+	{
+		munmap(map, mapSize);
+	}
+	if (fd >= 0)
+	{
+		::close(fd);
+	}
+	map = 0;
+	header = 0;
+	mapSize = 0;
+	fd = -1;
+}
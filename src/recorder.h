@@ -0,0 +1,109 @@
+#ifndef RECORDER_DEF
+#define RECORDER_DEF
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#define RECORDER_MAGIC				0x3143524D	// "MRC1"
+#define RECORDER_HEADER_SIZE		64
+#define RECORDER_MAX_KEYFRAMES		65536		// indexed keyframes; later ones are still written, only unindexed
+#define RECORDER_INDEX_SIZE			(RECORDER_MAX_KEYFRAMES * 16)
+#define RECORDER_DATA				(RECORDER_HEADER_SIZE + RECORDER_INDEX_SIZE)
+#define RECORDER_RECORD_HEADER		8			// uint32 tick, uint32 payload length with RECORDER_KEYFRAME
+#define RECORDER_KEYFRAME			0x80000000u
+#define RECORDER_SLOTS				256			// ticks staged between the game and the writer, power of two
+#define RECORDER_WAIT_MS			5
+
+// Start of the file. committed is the number of record bytes a reader may trust; it is only
+// advanced after the records it covers have been written.
+struct RecorderHeader {
+	uint32_t magic;
+	uint32_t stateSize;
+	uint32_t keyInterval;
+	uint32_t keyCount;
+	uint64_t committed;
+	uint64_t capacity;							// record bytes the file currently has room for
+	uint32_t firstTick;
+	uint32_t lastTick;
+	uint32_t records;
+	uint32_t dropped;
+	char reserved[16];
+};
+
+struct RecorderKey {
+	uint32_t tick;
+	uint32_t unused;
+	uint64_t offset;							// from RECORDER_DATA
+};
+
+class MatchRecorder
+{
+  public:
+	MatchRecorder();
+	~MatchRecorder();
+	int32_t open(const char *path, uint64_t capacity, uint32_t stateSize, uint32_t keyInterval);
+	int32_t record(uint32_t tick, const char *state);
+	uint32_t dropped();
+	void close();
+
+  private:
+	void writerLoop();
+	int32_t append(uint32_t tick, const char *state);
+	int32_t grow(uint64_t needed);
+
+	int fd;
+	char *map;
+	size_t mapSize;
+	RecorderHeader *header;
+	uint32_t stateSize;
+	uint32_t keyInterval;
+	uint32_t sinceKey;
+
+	char *slots;
+	uint32_t slotTicks[RECORDER_SLOTS];
+	std::atomic<uint32_t> head;					// next slot the game fills
+	std::atomic<uint32_t> tail;					// next slot the writer drains
+	std::atomic<uint32_t> droppedCount;
+
+	char *previous;								// last state written, the base of the next delta
+	char *scratch;
+	bool hasPrevious;
+
+	std::atomic<bool> running;
+	std::thread writer;
+	std::mutex wakeLock;
+	std::condition_variable wake;
+};
+
+class MatchReader
+{
+  public:
+	MatchReader();
+	~MatchReader();
+	int32_t open(const char *path);
+	uint32_t firstTick();
+	uint32_t lastTick();
+	uint32_t stateSize();
+	int32_t seek(uint32_t tick, char *state, uint32_t size, uint32_t *found);
+	void close();
+
+  private:
+	int32_t remap();
+
+	int fd;
+	char *map;
+	size_t mapSize;
+	RecorderHeader *header;
+};
+
+#endif
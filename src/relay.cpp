@@ -0,0 +1,526 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	relay.cpp -   Spectator relay fanning a match's broadcast ring out over UDP
+--
+--	PROGRAM:		spectatorrelay (standalone, built from the library's Server)
+--
+--	FUNCTIONS:		SpectatorRelay();
+--					int32_t init(const char *ringName, short port, uint32_t delayTicks);
+--					int32_t run();
+--					void stop();
+--					void getStats(RelayStats *stats);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: spectators prove their address with a cookie before they are
+--					subscribed, and joins are rate limited per address
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Casters, replays and reviewers watch a match through a relay instead of the match server.
+--		The match publishes each tick's snapshot once into its BroadcastRing; the relay, its own
+--		process on the same host, reads the ring and sends every snapshot to every spectator in
+--		sendmmsg() batches from its own port. The match's cost per tick does not change with the
+--		number of spectators, or with the number of relays reading the ring.
+--
+--		Snapshots are held back delayTicks ticks before they go out, so spectators watch the
+--		match that far behind the players. The delay buffer is the relay's own; the match's ring
+--		only has to be long enough to cover a relay that falls briefly behind.
+--
+--		A spectator subscribes by sending RELAY_JOIN to the relay's port and stays subscribed
+--		for as long as it keeps sending one every few seconds. RELAY_LEAVE, or
+--		RELAY_IDLE_SECONDS of silence, unsubscribes it.
+--
+--		Joins are a reflector's dream: one spoofed datagram would otherwise point a 64 Hz
+--		stream at any address. So a join only subscribes when it echoes a cookie, a keyed hash
+--		of the sender's address, that the relay sent to that address. The first join carries
+--		zeroes and is answered with [RELAY_CHALLENGE][cookie], no longer than the join itself;
+--		the spectator sends the cookie in every join and leave after that, and takes the new
+--		one whenever the relay sends another. Joins and leaves from one address are held to
+--		RELAY_JOIN_RATE a second, so even the challenges cannot be aimed at a victim in bulk.
+---------------------------------------------------------------------------------------*/
+#include <fcntl.h>
+#include "relay.h"
+
+static uint32_t monoSeconds()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint32_t)ts.tv_sec;
+}
+
+#define SIP_ROUND(v0, v1, v2, v3) \
+	v0 += v1; v1 = (v1 << 13) | (v1 >> 51); v1 ^= v0; v0 = (v0 << 32) | (v0 >> 32); \
+	v2 += v3; v3 = (v3 << 16) | (v3 >> 48); v3 ^= v2; \
+	v0 += v3; v3 = (v3 << 21) | (v3 >> 43); v3 ^= v0; \
+	v2 += v1; v1 = (v1 << 17) | (v1 >> 47); v1 ^= v2; v2 = (v2 << 32) | (v2 >> 32);
+
+// SipHash-2-4 of two words, a MAC small enough to run on every join
+static uint64_t sipHash(const uint64_t key[2], uint64_t a, uint64_t b)
+{
+	uint64_t v0 = key[0] ^ 0x736f6d6570736575ULL;
+	uint64_t v1 = key[1] ^ 0x646f72616e646f6dULL;
+	uint64_t v2 = key[0] ^ 0x6c7967656e657261ULL;
+	uint64_t v3 = key[1] ^ 0x7465646279746573ULL;
+	uint64_t words[3] = { a, b, (uint64_t)16 << 56 };
+
+	for (int i = 0; i < 3; i++)
+	{
+		v3 ^= words[i];
+		SIP_ROUND(v0, v1, v2, v3);
+		SIP_ROUND(v0, v1, v2, v3);
+		v0 ^= words[i];
+	}
+	v2 ^= 0xff;
+	for (int i = 0; i < 4; i++)
+	{
+		SIP_ROUND(v0, v1, v2, v3);
+	}
+	return v0 ^ v1 ^ v2 ^ v3;
+}
+
+SpectatorRelay::SpectatorRelay()
+{
+	spectators = new Spectator[RELAY_MAX_SPECTATORS];
+	spectatorCount = 0;
+	sources = new Source[RELAY_SOURCE_SLOTS];
+	memset(sources, 0, sizeof(Source) * RELAY_SOURCE_SLOTS);
+	secret[0] = 0;
+	secret[1] = 0;
+	delayBuffer = 0;
+	held = 0;
+	capacity = 0;
+	delay = 0;
+	slotSize = 0;
+	next = 0;
+	sending = 0;
+	lastSweep = 0;
+	lastReport = 0;
+	memset(&stats, 0, sizeof(stats));
+	memset(&reported, 0, sizeof(reported));
+	running.store(false);
+}
+
+SpectatorRelay::~SpectatorRelay()
+{
+	delete[] spectators;
+	delete[] sources;
+	delete[] delayBuffer;
+	delete[] held;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: reads the cookie key - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t init(const char *ringName, short port, uint32_t delayTicks)
+--								ringName: the match's BroadcastRing
+--								port: the port spectators subscribe on and are sent from
+--								delayTicks: how far behind the match spectators watch, up to RELAY_MAX_DELAY
+--
+-- RETURNS: 0 on success, or -1 if the ring could not be opened, the port bound, the delay is too long or no
+--			 cookie key could be read from /dev/urandom.
+--
+-- NOTES:
+-- 		The relay starts at the ring's newest snapshot; what was published before it started is not sent.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t SpectatorRelay::init(const char *ringName, short port, uint32_t delayTicks)
+{
+	if (delayBuffer != 0 || delayTicks > RELAY_MAX_DELAY || ring.open(ringName) != 0)
+	{
+		return -1;
+	}
+	if (out.initializeSocket(port) != 0 || out.setEngine(ENGINE_EPOLL) != ENGINE_EPOLL)
+	{
+		return -1;
+	}
+
+	int random = open("/dev/urandom", O_RDONLY);
+	if (random < 0)
+	{
+		return -1;
+	}
+	ssize_t keyed = read(random, secret, sizeof(secret));
+	close(random);
+	if (keyed != (ssize_t)sizeof(secret))
+	{
+		return -1;
+	}
+
+	delay = delayTicks;
+	capacity = delayTicks + 1;
+	slotSize = ring.slotSize();
+	delayBuffer = new char[(size_t)capacity * slotSize];
+	held = new Held[capacity];
+	memset(held, 0, sizeof(Held) * capacity);
+
+	next = ring.head();
+	sending = next;
+	return 0;
+}
+
+uint64_t SpectatorRelay::keyOf(EndPoint ep)
+{
+	return ((uint64_t)ep.addr << 16) | ep.port;
+}
+
+uint64_t SpectatorRelay::cookieOf(EndPoint ep, uint32_t epoch)
+{
+	return sipHash(secret, keyOf(ep), epoch);
+}
+
+// Takes a token from the address's bucket, false when it has none left this second
+bool SpectatorRelay::admit(uint32_t addr, uint32_t now)
+{
+	Source &source = sources[sipHash(secret, addr, 0) & (RELAY_SOURCE_SLOTS - 1)];
+	if (source.addr != addr || source.last == 0)
+	{
+		source.addr = addr;
+		source.tokens = RELAY_JOIN_BURST;
+	}
+	else if (now != source.last)
+	{
+		uint64_t refilled = (uint64_t)source.tokens + (uint64_t)(now - source.last) * RELAY_JOIN_RATE;
+		source.tokens = refilled > RELAY_JOIN_BURST ? RELAY_JOIN_BURST : (uint32_t)refilled;
+	}
+	source.last = now == 0 ? 1 : now;
+
+	if (source.tokens == 0)
+	{
+		return false;
+	}
+	source.tokens--;
+	return true;
+}
+
+void SpectatorRelay::challenge(EndPoint ep, uint32_t now)
+{
+	char reply[RELAY_HANDSHAKE_SIZE];
+	uint64_t cookie = cookieOf(ep, now / RELAY_COOKIE_SECONDS);
+	reply[0] = (char)RELAY_CHALLENGE;
+	memcpy(reply + 1, &cookie, RELAY_COOKIE_SIZE);
+	if (out.queueSend(ep, reply, RELAY_HANDSHAKE_SIZE) >= 0)
+	{
+		stats.challenged++;
+	}
+}
+
+void SpectatorRelay::subscribe(EndPoint ep, uint32_t now)
+{
+	std::unordered_map<uint64_t, uint32_t>::iterator found = lookup.find(keyOf(ep));
+	if (found != lookup.end())
+	{
+		spectators[found->second].lastSeen = now;
+		return;
+	}
+	if (spectatorCount >= RELAY_MAX_SPECTATORS)
+	{
+		return;
+	}
+
+	spectators[spectatorCount].ep = ep;
+	spectators[spectatorCount].lastSeen = now;
+	lookup[keyOf(ep)] = spectatorCount;
+	spectatorCount++;
+	stats.joined++;
+}
+
+// Moves the last spectator into the gap, keeping the array dense for fanOut()
+void SpectatorRelay::unsubscribe(uint32_t index)
+{
+	lookup.erase(keyOf(spectators[index].ep));
+	spectatorCount--;
+	if (index != spectatorCount)
+	{
+		spectators[index] = spectators[spectatorCount];
+		lookup[keyOf(spectators[index].ep)] = index;
+	}
+}
+
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: listen
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void listen(char *buffer, uint32_t now)
+--								buffer: SERVER_SLOT_SIZE bytes to read spectator datagrams into
+--								now: monotonic seconds
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Reads up to RELAY_BURST joins and leaves. Anything shorter than RELAY_HANDSHAKE_SIZE, or over its
+--		address's rate, is dropped without a reply. A join or leave only counts with the cookie of this
+--		RELAY_COOKIE_SECONDS period or the last one; a join without one is challenged, and a join with last
+--		period's cookie is challenged again so the spectator moves on to the new one.
+--------------------------------------------------------------------------------------------------------------*/
+void SpectatorRelay::listen(char *buffer, uint32_t now)
+{
+	EndPoint from;
+	bool replied = false;
+	for (int32_t i = 0; i < RELAY_BURST; i++)
+	{
+		int32_t len = out.UdpRecvFrom(buffer, SERVER_SLOT_SIZE, &from);
+		if (len < 0)
+		{
+			break;
+		}
+		uint8_t header = (uint8_t)buffer[0];
+		if (len < RELAY_HANDSHAKE_SIZE || (header != RELAY_JOIN && header != RELAY_LEAVE))
+		{
+			continue;
+		}
+		if (!admit(from.addr, now))
+		{
+			stats.refused++;
+			continue;
+		}
+
+		uint64_t cookie;
+		memcpy(&cookie, buffer + 1, RELAY_COOKIE_SIZE);
+		uint32_t epoch = now / RELAY_COOKIE_SECONDS;
+		bool current = cookie == cookieOf(from, epoch);
+		bool valid = current || cookie == cookieOf(from, epoch - 1);
+
+		if (header == RELAY_JOIN)
+		{
+			if (valid)
+			{
+				subscribe(from, now);
+			}
+			if (!current)
+			{
+				challenge(from, now);
+				replied = true;
+			}
+		}
+		else if (valid)
+		{
+			std::unordered_map<uint64_t, uint32_t>::iterator found = lookup.find(keyOf(from));
+			if (found != lookup.end())
+			{
+				unsubscribe(found->second);
+				stats.left++;
+			}
+		}
+	}
+	if (replied)
+	{
+		out.flushSends();
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: pull
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void pull()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Copies newly published snapshots into the delay buffer, never past the ones still waiting to be sent.
+--		If the relay fell so far behind that the match has reused the slots, the lost snapshots are counted
+--		as lapped and held as empty so the ticks after them still go out on time.
+--------------------------------------------------------------------------------------------------------------*/
+void SpectatorRelay::pull()
+{
+	uint64_t head = ring.head();
+	uint64_t oldest = head > ring.slotCount() ? head - ring.slotCount() : 0;
+
+	while (next < head && next - sending < capacity)
+	{
+		Held &entry = held[next % capacity];
+		if (next < oldest)
+		{
+			entry.len = 0;
+			stats.lapped++;
+			next++;
+			continue;
+		}
+
+		uint32_t tick;
+		int32_t len = ring.read(next, &tick, delayBuffer + (size_t)(next % capacity) * slotSize, slotSize);
+		if (len == BROADCAST_NOT_READY)
+		{
+			break;
+		}
+		if (len < 0)
+		{
+			entry.len = 0;
+			stats.lapped++;
+		}
+		else
+		{
+			entry.tick = tick;
+			entry.len = len;
+		}
+		next++;
+	}
+}
+
+// Sends every held snapshot that has waited out the delay to every spectator, one batch per snapshot
+void SpectatorRelay::fanOut()
+{
+	while (next - sending > delay)
+	{
+		Held &entry = held[sending % capacity];
+		char *snapshot = delayBuffer + (size_t)(sending % capacity) * slotSize;
+		sending++;
+		if (entry.len == 0)
+		{
+			continue;
+		}
+
+		for (uint32_t i = 0; i < spectatorCount; i++)
+		{
+			if (out.queueSend(spectators[i].ep, snapshot, entry.len) >= 0)
+			{
+				stats.sent++;
+			}
+		}
+		out.flushSends();
+		stats.relayed++;
+	}
+}
+
+void SpectatorRelay::expire(uint32_t now)
+{
+	uint32_t i = 0;
+	while (i < spectatorCount)
+	{
+		if (now - spectators[i].lastSeen > RELAY_IDLE_SECONDS)
+		{
+			unsubscribe(i);
+			stats.expired++;
+			continue;
+		}
+		i++;
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: run
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t run()
+--
+-- RETURNS: 0 once stopped, or -1 if the socket could not be watched.
+--
+-- NOTES:
+-- 		Blocks the calling thread. The ring has no way to wake a reader, so the relay waits at most
+--		RELAY_WAIT_MS for spectator datagrams and then checks the ring, well inside a tick. Once a second
+--		silent spectators are unsubscribed; every RELAY_REPORT_SECONDS the counters are printed if they
+--		moved.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t SpectatorRelay::run()
+{
+	int epollFd = epoll_create1(0);
+	if (epollFd < 0)
+	{
+		perror("relay epoll failed");
+		return -1;
+	}
+
+	struct epoll_event event;
+	memset(&event, 0, sizeof(event));
+	event.events = EPOLLIN;
+	event.data.fd = out.getSocket();
+	epoll_ctl(epollFd, EPOLL_CTL_ADD, out.getSocket(), &event);
+
+	char buffer[SERVER_SLOT_SIZE];
+	struct epoll_event ready;
+	running.store(true);
+
+	while (running.load())
+	{
+		if (next == ring.head() && out.UdpPollSocket() != SOCKET_DATA_WAITING)
+		{
+			epoll_wait(epollFd, &ready, 1, RELAY_WAIT_MS);
+		}
+
+		uint32_t now = monoSeconds();
+		listen(buffer, now);
+		pull();
+		fanOut();
+
+		if (now != lastSweep)
+		{
+			expire(now);
+			lastSweep = now;
+		}
+		if (now - lastReport >= RELAY_REPORT_SECONDS)
+		{
+			report();
+			lastReport = now;
+		}
+	}
+
+	close(epollFd);
+	return 0;
+}
+
+void SpectatorRelay::stop()
+{
+	running.store(false);
+}
+
+void SpectatorRelay::report()
+{
+	getStats(&stats);
+	if (memcmp(&stats, &reported, sizeof(RelayStats)) == 0)
+	{
+		return;
+	}
+
+	printf("relay: %u spectators, %llu snapshots relayed, %llu sent, %llu lapped, %llu joined, %llu left, %llu expired, "
+		"%llu challenged, %llu refused\n",
+		stats.spectators, (unsigned long long)stats.relayed, (unsigned long long)stats.sent,
+		(unsigned long long)stats.lapped, (unsigned long long)stats.joined, (unsigned long long)stats.left,
+		(unsigned long long)stats.expired, (unsigned long long)stats.challenged, (unsigned long long)stats.refused);
+	fflush(stdout);
+	reported = stats;
+}
+
+// From the thread in run(), or after run() has returned
+void SpectatorRelay::getStats(RelayStats *out)
+{
+	stats.spectators = spectatorCount;
+	stats.held = (uint32_t)(next - sending);
+	*out = stats;
+}
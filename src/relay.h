@@ -0,0 +1,105 @@
+#ifndef RELAY_DEF
+#define RELAY_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <sys/epoll.h>
+#include <atomic>
+#include <unordered_map>
+#include "server.h"
+#include "broadcast.h"
+
+#define RELAY_MAX_SPECTATORS		8192
+#define RELAY_MAX_DELAY				65536		// ticks a relay can hold back
+#define RELAY_JOIN					88			// [RELAY_JOIN][cookie] subscribes, and keeps a spectator subscribed
+#define RELAY_LEAVE					7			// [RELAY_LEAVE][cookie] unsubscribes at once
+#define RELAY_CHALLENGE				89			// [RELAY_CHALLENGE][cookie], the relay's answer to a join without one
+#define RELAY_COOKIE_SIZE			8
+#define RELAY_HANDSHAKE_SIZE		(1 + RELAY_COOKIE_SIZE)	// shorter joins and leaves are dropped unanswered
+#define RELAY_COOKIE_SECONDS		30			// cookies are good for this long to twice this long
+#define RELAY_SOURCE_SLOTS			4096		// per address join buckets, a power of two
+#define RELAY_JOIN_RATE				4			// joins and leaves a second from one address
+#define RELAY_JOIN_BURST			16
+#define RELAY_IDLE_SECONDS			15			// a spectator silent this long is unsubscribed
+#define RELAY_BURST					256			// spectator datagrams read per pass
+#define RELAY_WAIT_MS				1			// how often the ring is checked when nothing arrives
+#define RELAY_REPORT_SECONDS		10
+
+struct RelayStats {
+	uint64_t relayed;							// snapshots sent on, once each whatever the audience
+	uint64_t sent;								// datagrams to spectators
+	uint64_t lapped;							// snapshots overwritten in the ring before they were read
+	uint64_t joined;
+	uint64_t left;
+	uint64_t expired;
+	uint64_t challenged;						// cookies sent to joins that lacked a current one
+	uint64_t refused;							// joins and leaves over their address's rate
+	uint32_t spectators;
+	uint32_t held;								// snapshots read and waiting out the delay
+};
+
+class SpectatorRelay
+{
+  public:
+	SpectatorRelay();
+	~SpectatorRelay();
+	int32_t init(const char *ringName, short port, uint32_t delayTicks);
+	int32_t run();
+	void stop();
+	void getStats(RelayStats *stats);
+
+  private:
+	struct Spectator {
+		EndPoint ep;
+		uint32_t lastSeen;						// seconds
+	};
+
+	struct Source {
+		uint32_t addr;
+		uint32_t last;							// seconds
+		uint32_t tokens;
+	};
+
+	struct Held {
+		uint32_t tick;
+		int32_t len;							// 0 when the snapshot was lost
+	};
+
+	static uint64_t keyOf(EndPoint ep);
+	uint64_t cookieOf(EndPoint ep, uint32_t epoch);
+	bool admit(uint32_t addr, uint32_t now);
+	void challenge(EndPoint ep, uint32_t now);
+	void listen(char *buffer, uint32_t now);
+	void subscribe(EndPoint ep, uint32_t now);
+	void unsubscribe(uint32_t index);
+	void pull();
+	void fanOut();
+	void expire(uint32_t now);
+	void report();
+
+	BroadcastRing ring;
+	Server out;
+	Spectator *spectators;
+	uint32_t spectatorCount;
+	std::unordered_map<uint64_t, uint32_t> lookup;	// endpoint key to index in spectators
+	Source *sources;							// RELAY_SOURCE_SLOTS join buckets by keyed hash of address
+	uint64_t secret[2];							// cookie key, random per relay process
+
+	char *delayBuffer;							// held snapshots, capacity slots of slotSize bytes
+	Held *held;
+	uint32_t capacity;							// delay + 1
+	uint32_t delay;
+	uint32_t slotSize;
+	uint64_t next;								// next ring index to read
+	uint64_t sending;							// next ring index to send, at most next
+
+	uint32_t lastSweep;
+	uint32_t lastReport;
+	RelayStats reported;
+
+	RelayStats stats;
+	std::atomic<bool> running;
+};
+
+#endif
@@ -0,0 +1,59 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	relaymain.cpp -   Command line entry point of the spectator relay
+--
+--	PROGRAM:		spectatorrelay
+--
+--	FUNCTIONS:		int main(int argc, char **argv)
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		spectatorrelay <ring name> <port> [<delay ticks>]
+--
+--		The ring name is the SPECTATOR_RING the match server was started with, on the same host.
+--		Spectators subscribe on port and watch delay ticks behind the match, none by default.
+--		Any number of relays may read one ring. SIGINT or SIGTERM stops the relay.
+---------------------------------------------------------------------------------------*/
+#include <signal.h>
+#include <stdlib.h>
+#include "relay.h"
+
+static SpectatorRelay *relay;
+
+static void onSignal(int)
+{
+	relay->stop();
+}
+
+int main(int argc, char **argv)
+{
+	if (argc < 3)
+	{
+		fprintf(stderr, "usage: %s <ring name> <port> [<delay ticks>]\n", argv[0]);
+		return 1;
+	}
+
+	uint32_t delay = argc > 3 ? (uint32_t)strtoul(argv[3], 0, 10) : 0;
+
+	relay = new SpectatorRelay();
+	if (relay->init(argv[1], (short)atoi(argv[2]), delay) != 0)
+	{
+		fprintf(stderr, "could not open ring %s on port %s with a delay of %u ticks\n", argv[1], argv[2], delay);
+		return 1;
+	}
+	printf("relaying %s on port %s, %u ticks behind\n", argv[1], argv[2], delay);
+	fflush(stdout);
+
+	signal(SIGINT, onSignal);
+	signal(SIGTERM, onSignal);
+
+	int32_t result = relay->run();
+	delete relay;
+	return result == 0 ? 0 : 1;
+}
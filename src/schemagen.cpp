@@ -0,0 +1,145 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	schemagen.cpp -   Writes the C# side of packets.def
+--
+--	PROGRAM:		schemagen (make schema)
+--
+--	FUNCTIONS:		int main()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Prints Packets.cs: for each packet in packets.def a class R.Packet.Name holding SIZE and
+--		the offset of every field, with GetField/SetField for scalars and Field returning the
+--		address of an array, all working in place on a byte pointer. The offsets and sizes are
+--		taken from the same packed structs the library is compiled with, so both sides agree.
+---------------------------------------------------------------------------------------*/
+#include <stdio.h>
+#include <ctype.h>
+#include <string>
+#include "packetschema.h"
+
+// weaponId -> WEAPON_ID
+static std::string constantName(const char *field)
+{
+	std::string out;
+	for (const char *c = field; *c; c++)
+	{
+		if (isupper((unsigned char)*c))
+		{
+			out += '_';
+		}
+		out += (char)toupper((unsigned char)*c);
+	}
+	return out;
+}
+
+// weaponId -> WeaponId
+static std::string methodName(const char *field)
+{
+	std::string out(field);
+	out[0] = (char)toupper((unsigned char)out[0]);
+	return out;
+}
+
+static const char *csharpType(const char *type)
+{
+	std::string name(type);
+	if (name == "uint8_t")
+	{
+		return "byte";
+	}
+	if (name == "uint16_t")
+	{
+		return "UInt16";
+	}
+	if (name == "int32_t")
+	{
+		return "Int32";
+	}
+	if (name == "uint32_t")
+	{
+		return "UInt32";
+	}
+	if (name == "float")
+	{
+		return "float";
+	}
+	fprintf(stderr, "schemagen: no C# type for %s\n", type);
+	return 0;
+}
+
+static int failed = 0;
+
+static void packet(const char *name, size_t size)
+{
+	printf("\n        public static class %s\n        {\n", name);
+	printf("            public const int SIZE = %u;\n", (unsigned)size);
+}
+
+static void field(const char *name, const char *field, const char *type, size_t offset)
+{
+	const char *cs = csharpType(type);
+	if (cs == 0)
+	{
+		failed = 1;
+		return;
+	}
+
+	std::string constant = constantName(field);
+	std::string method = methodName(field);
+	printf("\n            public const int %s = %u;\n", constant.c_str(), (unsigned)offset);
+	printf("            public static %s Get%s(byte* packet) { return *(%s*)(packet + %s); }\n",
+		cs, method.c_str(), cs, constant.c_str());
+	printf("            public static void Set%s(byte* packet, %s value) { *(%s*)(packet + %s) = value; }\n",
+		method.c_str(), cs, cs, constant.c_str());
+}
+
+static void array(const char *name, const char *field, const char *type, size_t offset, size_t count)
+{
+	const char *cs = csharpType(type);
+	if (cs == 0)
+	{
+		failed = 1;
+		return;
+	}
+
+	std::string constant = constantName(field);
+	printf("\n            public const int %s = %u;\n", constant.c_str(), (unsigned)offset);
+	printf("            public const int %s_COUNT = %u;\n", constant.c_str(), (unsigned)count);
+	printf("            public static %s* %s(byte* packet) { return (%s*)(packet + %s); }\n",
+		cs, methodName(field).c_str(), cs, constant.c_str());
+}
+
+int main()
+{
+	printf("/*---------------------------------------------------------------------------------------\n");
+	printf("--\tSOURCE FILE:\tPackets.cs -   Packet layouts generated from src/packets.def\n");
+	printf("--\n");
+	printf("--\tPROGRAM:\t\tserver\n");
+	printf("--\n");
+	printf("--\tNOTES:\n");
+	printf("--\t\tWritten by src/schemagen (make schema). Do not edit; change src/packets.def and\n");
+	printf("--\t\tregenerate. The accessors read and write in place through a byte pointer, so they\n");
+	printf("--\t\twork straight on pooled receive and send buffers.\n");
+	printf("---------------------------------------------------------------------------------------*/\n");
+	printf("using System;\n\nnamespace R\n{\n    public static unsafe class Packet\n    {");
+
+#define PACKET(name)						packet(#name, sizeof(name##Wire));
+#define FIELD(name, field_, type)			field(#name, #field_, #type, offsetof(name##Wire, field_));
+#define ARRAY(name, field_, type, count)	array(#name, #field_, #type, offsetof(name##Wire, field_), (count));
+#define PACKET_END(name)					printf("        }\n");
+#include "packets.def"
+#undef PACKET
+#undef FIELD
+#undef ARRAY
+#undef PACKET_END
+
+	printf("    }\n}\n");
+	return failed;
+}
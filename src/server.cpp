@@ -8,11 +8,30 @@
 --					int32_t sendBytes(EndPoint ep, char *data, unsigned len);
 --					int32_t UdpPollSocket();
 --					int32_t UdpRecvFrom(char *buffer, uint32_t size, EndPoint *addr);
+--					int getSocket();
+--					int32_t setEngine(int32_t engine);
+--					int32_t queueSend(EndPoint ep, char *data, unsigned len);
+--					int32_t flushSends();
+--					void setFilter(IngressFilter *ingress);
+--					int32_t setPacing(int32_t mode, uint32_t intervalUs, uint32_t percent);
+--					void getPacerStats(PacerStats *stats);
+--					void setUpstream(EndPoint proxy);
 --		
 --	DATE:			February 27th, 2018
 --
 --	REVISIONS:		March 17th, 2018
 --						Delan Elliot: fixed issue with Select causing seg fault - moved back to Poll
+--					October 19th, 2026
+--						agent: selectable transport engine (poll, epoll/recvmmsg, io_uring) and
+--						batched sends
+--					October 19th, 2026
+--						agent: optional ingress filter on the receive path
+--					October 19th, 2026
+--						agent: paced flushes, through SO_TXTIME or the Pacer timer wheel
+--					October 19th, 2026
+--						agent: upstream mode for running behind a FrontProxy
+--					October 19th, 2026
+--						agent: datagrams over FRAG_MTU are sent as fragments
 --                  
 --
 --	DESIGNERS:		Delan Elliot, Wilson Hu, Jeff Chou, Jeremy Lee, Matthew Shew, Calvin Lai, William Murphy
@@ -21,6 +40,23 @@
 --
 --	NOTES:
 --		This class provides UDP server functionality. 
+--
+--		By default every call maps to one syscall, as it always has. setEngine() switches the
+--		server to a batched engine: ENGINE_EPOLL stages datagrams and moves them with
+--		recvmmsg()/sendmmsg(), and ENGINE_URING hands the socket to a UringEngine. When
+--		io_uring is not available the server falls back to ENGINE_EPOLL on its own.
+--
+--		setPacing() stops a flush from going out as one burst. The queued datagrams are given
+--		launch times spread over a fraction of the tick interval, and the order is rotated every
+--		flush so no client is always last. PACING_TXTIME attaches the times to the datagrams and
+--		lets the fq qdisc hold them; PACING_WHEEL hands them to a Pacer thread instead.
+--
+--		setUpstream() puts the server behind a FrontProxy. Every datagram then arrives from the
+--		proxy with the client's address in a PROXY_HEADER_SIZE prefix, and leaves for the proxy
+--		with one. The prefix is added and removed here, so callers still see client endpoints.
+--
+--		A datagram longer than FRAG_MTU is cut into fragments (see fragment.cpp) by sendBytes()
+--		and queueSend(), each numbered with the server's next message id. Clients reassemble them.
 --		
 ---------------------------------------------------------------------------------------*/
 #ifndef SERVER_DEF
@@ -31,6 +67,23 @@
 Server::Server()
 {
 	poll_events = new pollfd;
+	engine = ENGINE_POLL;
+	uring = 0;
+	filter = 0;
+	proxied = false;
+	upstream.addr = 0;
+	upstream.port = 0;
+	fragmentId = 0;
+	epollFd = -1;
+	recvStaging = 0;
+	sendStaging = 0;
+	recvCount = 0;
+	recvIndex = 0;
+	sendCount = 0;
+	pacing = PACING_OFF;
+	pacingSpreadNs = 0;
+	pacingRotation = 0;
+	pacer = 0;
 }
 
 
@@ -108,8 +161,48 @@ int32_t Server::initializeSocket(short port)
 -- NOTES:
 -- 		Sends bytes of length len to the address specified by the EndPoint struct. The endpoint is host byte order.
 --		The EndPoint struct is filled in C# and the binary data is interpreted reliably because of fixed width types. 
+--		Behind a proxy the datagram goes to the proxy, prefixed with ep. One longer than FRAG_MTU goes
+--		as fragments.
 --------------------------------------------------------------------------------------------------------------*/
 int32_t Server::sendBytes(EndPoint ep, char *data, unsigned len)
+{
+	if (len > FRAG_MTU)
+	{
+		return sendFragments(ep, data, len, false);
+	}
+
+	if (!proxied)
+	{
+		return sendRaw(ep, data, len);
+	}
+
+	char header[PROXY_HEADER_SIZE];
+	proxyEncode(header, ep);
+
+	struct sockaddr_in temp;
+	memset(&temp, 0, sizeof(sockaddr_in));
+	temp.sin_family = AF_INET;
+	temp.sin_addr.s_addr = htonl(upstream.addr);
+	temp.sin_port = htons(upstream.port);
+
+	struct iovec parts[2];
+	parts[0].iov_base = header;
+	parts[0].iov_len = PROXY_HEADER_SIZE;
+	parts[1].iov_base = data;
+	parts[1].iov_len = len;
+
+	struct msghdr msg;
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_name = &temp;
+	msg.msg_namelen = sizeof(sockaddr_in);
+	msg.msg_iov = parts;
+	msg.msg_iovlen = 2;
+
+	int32_t result = sendmsg(udpSocket, &msg, 0);
+	return result < 0 ? result : result - PROXY_HEADER_SIZE;
+}
+
+int32_t Server::sendRaw(EndPoint ep, char *data, unsigned len)
 {
 	struct sockaddr_in temp;
 
@@ -127,6 +220,11 @@ sockaddr_in Server::getServerAddr()
 	return serverAddr;
 }
 
+int Server::getSocket()
+{
+	return udpSocket;
+}
+
 
 /*------------------------------------------------------------------------------------------------------------
 -- FUNCTION: UdpRecvFrom
@@ -149,10 +247,51 @@ sockaddr_in Server::getServerAddr()
 --
 -- NOTES:
 -- 		Receives datagram of max size "size". The address of the client that sent the datagram is saved into the 
---		EndPoint referenced by addr. 
+--		EndPoint referenced by addr. With a batched engine the datagram comes from the engine's staging area
+--		and the call returns -1 instead of blocking when nothing is waiting.
+--
+--		With a filter set, rejected datagrams are skipped here and the next waiting one is tried, up to
+--		INGRESS_DRAIN_MAX of them; -1 is returned if nothing acceptable was waiting. Behind a proxy, the
+--		prefix is stripped first and addr is the client it names; datagrams from anyone but the proxy
+--		are skipped the same way.
 --------------------------------------------------------------------------------------------------------------*/
 int32_t Server::UdpRecvFrom(char *buffer, uint32_t size, EndPoint *addr)
 {
+	for (int32_t skipped = 0; skipped < INGRESS_DRAIN_MAX; skipped++)
+	{
+		int32_t result = receiveOne(buffer, size, addr);
+		if (result < 0)
+		{
+			return result;
+		}
+		if (proxied)
+		{
+			result = unwrap(buffer, result, addr);
+		}
+		if (result >= 0 && (filter == 0 || filter->check(buffer, result, *addr) == INGRESS_ACCEPT))
+		{
+			return result;
+		}
+		if (UdpPollSocket() != SOCKET_DATA_WAITING)
+		{
+			break;
+		}
+	}
+	return -1;
+}
+
+int32_t Server::receiveOne(char *buffer, uint32_t size, EndPoint *addr)
+{
+	if (engine == ENGINE_URING)
+	{
+		return uring->recvFrom(buffer, size, addr);
+	}
+
+	if (engine == ENGINE_EPOLL)
+	{
+		return batchRecvFrom(buffer, size, addr);
+	}
+
 	sockaddr_in clientAddr;
 	socklen_t addrSize = sizeof(clientAddr);
 	memset(&clientAddr, 0, addrSize);
@@ -196,6 +335,21 @@ void Server::setEndPointIp(EndPoint *ep, char zero, char one, char two, char thr
 --------------------------------------------------------------------------------------------------------------*/
 int32_t Server::UdpPollSocket()
 {
+	if (engine == ENGINE_URING)
+	{
+		return uring->pollRecv() ? SOCKET_DATA_WAITING : SOCKET_NODATA;
+	}
+
+	if (engine == ENGINE_EPOLL)
+	{
+		struct epoll_event event;
+		if (recvIndex < recvCount || epoll_wait(epollFd, &event, 1, 0) > 0)
+		{
+			return SOCKET_DATA_WAITING;
+		}
+		return SOCKET_NODATA;
+	}
+
 	int numfds = 1;
 	struct pollfd pollfds;
 	pollfds.fd = udpSocket;
@@ -217,3 +371,528 @@ int32_t Server::UdpPollSocket()
 }
 
 
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: setEngine
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t setEngine(int32_t requested)
+--								requested: ENGINE_POLL, ENGINE_EPOLL or ENGINE_URING
+--
+-- RETURNS: the engine actually in use.
+--
+-- NOTES:
+-- 		Must be called after initializeSocket and before the send and receive threads start. An io_uring
+--		engine that cannot be created, or whose multishot receive is rejected by the kernel, is discarded
+--		and the server drops to the epoll/recvmmsg path instead.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::setEngine(int32_t requested)
+{
+	if (requested == ENGINE_POLL)
+	{
+		engine = ENGINE_POLL;
+		return engine;
+	}
+
+	if (recvStaging == 0)
+	{
+		recvStaging = new char[SERVER_BATCH * SERVER_SLOT_SIZE];
+	}
+	if (sendStaging == 0)
+	{
+		sendStaging = new char[SERVER_BATCH * SERVER_SLOT_SIZE];
+	}
+
+	if (requested == ENGINE_URING && uring == 0)
+	{
+		uring = new UringEngine();
+		if (uring->initialize(SERVER_URING_DEPTH, SERVER_URING_DEPTH, SERVER_SLOT_SIZE, SERVER_URING_DEPTH, 1, false) != 0
+			|| uring->registerFile(SERVER_URING_FILE, udpSocket) != 0
+			|| uring->armRecv(SERVER_URING_FILE) != 0
+			|| uring->failed())
+		{
+			delete uring;
+			uring = 0;
+		}
+	}
+
+	if (requested == ENGINE_URING && uring != 0)
+	{
+		engine = ENGINE_URING;
+		return engine;
+	}
+
+	if (epollFd < 0)
+	{
+		struct epoll_event event;
+		memset(&event, 0, sizeof(event));
+		event.events = EPOLLIN;
+		event.data.fd = udpSocket;
+
+		if ((epollFd = epoll_create1(0)) == -1 || epoll_ctl(epollFd, EPOLL_CTL_ADD, udpSocket, &event) == -1)
+		{
+			perror("epoll setup failed");
+			engine = ENGINE_POLL;
+			return engine;
+		}
+	}
+
+	engine = ENGINE_EPOLL;
+	return engine;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: queueSend
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t queueSend(EndPoint ep, char *data, unsigned len)
+--								ep: EndPoint struct with the address and port of the receiving client
+--								data: array of binary data to send
+--								len: length of data to send in bytes
+--
+-- RETURNS: len once queued, or -1 if the datagram could not be queued or sent.
+--
+-- NOTES:
+-- 		Copies the datagram into the engine's staging area; nothing is sent until flushSends(). Under
+--		ENGINE_POLL this is just sendBytes(). A full batch is flushed early. With pacing on, every
+--		engine stages here so the flush can schedule the batch. Behind a proxy the prefixed datagram is
+--		what gets queued. One longer than FRAG_MTU is queued as fragments.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::queueSend(EndPoint ep, char *data, unsigned len)
+{
+	if (len > FRAG_MTU)
+	{
+		return sendFragments(ep, data, len, true);
+	}
+
+	if (!proxied)
+	{
+		return stage(ep, data, len);
+	}
+
+	char wrapped[SERVER_SLOT_SIZE];
+	if (len > SERVER_SLOT_SIZE - PROXY_HEADER_SIZE)
+	{
+		return -1;
+	}
+	proxyEncode(wrapped, ep);
+	memcpy(wrapped + PROXY_HEADER_SIZE, data, len);
+
+	int32_t result = stage(upstream, wrapped, len + PROXY_HEADER_SIZE);
+	return result < 0 ? result : (int32_t)len;
+}
+
+int32_t Server::stage(EndPoint ep, char *data, unsigned len)
+{
+	if (len > SERVER_SLOT_SIZE || (pacing == PACING_OFF && engine == ENGINE_POLL))
+	{
+		return sendRaw(ep, data, len);
+	}
+
+	if (pacing == PACING_OFF && engine == ENGINE_URING)
+	{
+		if (uring->queueSendTo(SERVER_URING_FILE, ep, data, len) == URING_NO_SLOT)
+		{
+			uring->submit();
+			if (uring->queueSendTo(SERVER_URING_FILE, ep, data, len) == URING_NO_SLOT)
+			{
+				return -1;
+			}
+		}
+		return len;
+	}
+
+	if (sendCount == SERVER_BATCH)
+	{
+		flushSends();
+	}
+
+	char *slot = sendStaging + sendCount * SERVER_SLOT_SIZE;
+	memcpy(slot, data, len);
+
+	memset(&sendAddrs[sendCount], 0, sizeof(sockaddr_in));
+	sendAddrs[sendCount].sin_family = AF_INET;
+	sendAddrs[sendCount].sin_addr.s_addr = htonl(ep.addr);
+	sendAddrs[sendCount].sin_port = htons(ep.port);
+
+	sendIovecs[sendCount].iov_base = slot;
+	sendIovecs[sendCount].iov_len = len;
+	memset(&sendMsgs[sendCount], 0, sizeof(struct mmsghdr));
+	sendMsgs[sendCount].msg_hdr.msg_name = &sendAddrs[sendCount];
+	sendMsgs[sendCount].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+	sendMsgs[sendCount].msg_hdr.msg_iov = &sendIovecs[sendCount];
+	sendMsgs[sendCount].msg_hdr.msg_iovlen = 1;
+
+	sendCount++;
+	return len;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: flushSends
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t flushSends()
+--
+-- RETURNS: the number of datagrams handed to the kernel, or -1 on error.
+--
+-- NOTES:
+-- 		Sends everything queued since the last flush: one io_uring_enter() under ENGINE_URING, or as few
+--		sendmmsg() calls as it takes under ENGINE_EPOLL. With pacing on, see pacedFlush().
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::flushSends()
+{
+	if (pacing != PACING_OFF)
+	{
+		return pacedFlush();
+	}
+
+	if (engine == ENGINE_URING)
+	{
+		return uring->submit();
+	}
+
+	int32_t sent = 0;
+	while (sent < sendCount)
+	{
+		int32_t result = sendmmsg(udpSocket, &sendMsgs[sent], sendCount - sent, 0);
+		if (result <= 0)
+		{
+			perror("sendmmsg failed");
+			break;
+		}
+		sent += result;
+	}
+
+	sendCount = 0;
+	return sent;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: batchRecvFrom
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t batchRecvFrom(char *buffer, uint32_t size, EndPoint *addr)
+--
+-- RETURNS: the number of bytes received, or -1 if no datagram is waiting.
+--
+-- NOTES:
+-- 		Hands out staged datagrams one at a time, refilling the stage with a single non-blocking
+--		recvmmsg() once it is empty.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::batchRecvFrom(char *buffer, uint32_t size, EndPoint *addr)
+{
+	if (recvIndex >= recvCount)
+	{
+		for (int32_t i = 0; i < SERVER_BATCH; i++)
+		{
+			recvIovecs[i].iov_base = recvStaging + i * SERVER_SLOT_SIZE;
+			recvIovecs[i].iov_len = SERVER_SLOT_SIZE;
+			memset(&recvMsgs[i], 0, sizeof(struct mmsghdr));
+			recvMsgs[i].msg_hdr.msg_name = &recvAddrs[i];
+			recvMsgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_in);
+			recvMsgs[i].msg_hdr.msg_iov = &recvIovecs[i];
+			recvMsgs[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		recvIndex = 0;
+		recvCount = recvmmsg(udpSocket, recvMsgs, SERVER_BATCH, MSG_DONTWAIT, 0);
+		if (recvCount <= 0)
+		{
+			recvCount = 0;
+			return -1;
+		}
+	}
+
+	uint32_t len = recvMsgs[recvIndex].msg_len < size ? recvMsgs[recvIndex].msg_len : size;
+	memcpy(buffer, recvStaging + recvIndex * SERVER_SLOT_SIZE, len);
+	addr->port = ntohs(recvAddrs[recvIndex].sin_port);
+	addr->addr = ntohl(recvAddrs[recvIndex].sin_addr.s_addr);
+
+	recvIndex++;
+	return len;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: setFilter
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void setFilter(IngressFilter *ingress)
+--								ingress: the filter every received datagram must pass, or 0 for none
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Set before the receive thread starts. The server does not own the filter.
+--------------------------------------------------------------------------------------------------------------*/
+void Server::setFilter(IngressFilter *ingress)
+{
+	filter = ingress;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: setPacing
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t setPacing(int32_t mode, uint32_t intervalUs, uint32_t percent)
+--								mode: PACING_OFF, PACING_TXTIME or PACING_WHEEL
+--								intervalUs: the tick interval flushes are made at
+--								percent: how much of the interval one flush is spread across
+--
+-- RETURNS: the pacing mode actually in use.
+--
+-- NOTES:
+-- 		Must be called after initializeSocket and before the send thread starts. PACING_TXTIME falls back
+--		to PACING_WHEEL when the socket refuses SO_TXTIME. The kernel only honours launch times on an
+--		interface with the fq qdisc; elsewhere the datagrams go out at once, so use PACING_WHEEL unless
+--		fq is set up.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::setPacing(int32_t mode, uint32_t intervalUs, uint32_t percent)
+{
+	if (mode == PACING_OFF)
+	{
+		pacing = PACING_OFF;
+		return pacing;
+	}
+
+	if (sendStaging == 0)
+	{
+		sendStaging = new char[SERVER_BATCH * SERVER_SLOT_SIZE];
+	}
+	pacingSpreadNs = (uint64_t)intervalUs * 1000 * (percent < 100 ? percent : 100) / 100;
+
+	if (mode == PACING_TXTIME)
+	{
+		struct sock_txtime config;
+		config.clockid = CLOCK_MONOTONIC;
+		config.flags = 0;
+		if (setsockopt(udpSocket, SOL_SOCKET, SO_TXTIME, &config, sizeof(config)) == 0)
+		{
+			pacing = PACING_TXTIME;
+			return pacing;
+		}
+		perror("SO_TXTIME unavailable, pacing with the timer wheel");
+	}
+
+	if (pacer == 0)
+	{
+		pacer = new Pacer();
+		pacer->start(udpSocket);
+	}
+	pacing = PACING_WHEEL;
+	return pacing;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: pacedFlush
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t pacedFlush()
+--
+-- RETURNS: the number of datagrams handed to the kernel or the pacer.
+--
+-- NOTES:
+-- 		The queued datagrams get evenly spaced launch times across the spread, the first due now. Which
+--		datagram takes the first place moves along by one every flush; the send thread queues clients
+--		in the same order each tick, so over a run every client spends as many ticks at the front as
+--		at the back.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::pacedFlush()
+{
+	if (sendCount == 0)
+	{
+		return 0;
+	}
+
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	uint64_t start = (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	uint64_t step = pacingSpreadNs / sendCount;
+	int32_t sent = 0;
+
+	for (int32_t i = 0; i < sendCount; i++)
+	{
+		uint64_t launch = start + (uint64_t)((i + pacingRotation) % sendCount) * step;
+
+		if (pacing == PACING_WHEEL)
+		{
+			if (pacer->schedule(&sendAddrs[i], (char *)sendIovecs[i].iov_base, sendIovecs[i].iov_len, launch) >= 0)
+			{
+				sent++;
+			}
+			continue;
+		}
+
+		struct msghdr *msg = &sendMsgs[i].msg_hdr;
+		msg->msg_control = sendControl[i];
+		msg->msg_controllen = sizeof(sendControl[i]);
+		struct cmsghdr *cmsg = CMSG_FIRSTHDR(msg);
+		cmsg->cmsg_level = SOL_SOCKET;
+		cmsg->cmsg_type = SCM_TXTIME;
+		cmsg->cmsg_len = CMSG_LEN(sizeof(uint64_t));
+		memcpy(CMSG_DATA(cmsg), &launch, sizeof(uint64_t));
+	}
+
+	while (pacing == PACING_TXTIME && sent < sendCount)
+	{
+		int32_t result = sendmmsg(udpSocket, &sendMsgs[sent], sendCount - sent, 0);
+		if (result <= 0)
+		{
+			perror("paced sendmmsg failed");
+			break;
+		}
+		sent += result;
+	}
+
+	pacingRotation++;
+	sendCount = 0;
+	return sent;
+}
+
+void Server::getPacerStats(PacerStats *stats)
+{
+	if (pacer == 0)
+	{
+		memset(stats, 0, sizeof(PacerStats));
+		return;
+	}
+	pacer->getStats(stats);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: setUpstream
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void setUpstream(EndPoint proxy)
+--								proxy: the FrontProxy's internal address, which this server sends to and
+--									   accepts datagrams from
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Set before the send and receive threads start. There is no way back to direct mode.
+--------------------------------------------------------------------------------------------------------------*/
+void Server::setUpstream(EndPoint proxy)
+{
+	upstream = proxy;
+	proxied = true;
+}
+
+// Strips the proxy prefix in place and reports the client it names; -1 if the datagram is not from the proxy
+int32_t Server::unwrap(char *buffer, int32_t len, EndPoint *addr)
+{
+	if (len < PROXY_HEADER_SIZE || addr->addr != upstream.addr || addr->port != upstream.port)
+	{
+		return -1;
+	}
+
+	*addr = proxyDecode(buffer);
+	memmove(buffer, buffer + PROXY_HEADER_SIZE, len - PROXY_HEADER_SIZE);
+	return len - PROXY_HEADER_SIZE;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sendFragments
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t sendFragments(EndPoint ep, char *data, unsigned len, bool queued)
+--								ep: EndPoint struct with the address and port of the receiving client
+--								data, len: the message, longer than FRAG_MTU
+--								queued: queue the fragments with queueSend() instead of sending them
+--
+-- RETURNS: len once every fragment is sent or queued, or -1 if the message is over FRAG_MAX_MESSAGE or a
+--			fragment failed.
+--
+-- NOTES:
+-- 		A failed fragment stops the rest, since the client cannot complete the message without it.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Server::sendFragments(EndPoint ep, char *data, unsigned len, bool queued)
+{
+	int32_t count = fragCount(len);
+	if (count < 0)
+	{
+		return -1;
+	}
+
+	uint32_t id = fragmentId++;
+	char fragment[FRAG_MTU];
+	for (int32_t i = 0; i < count; i++)
+	{
+		int32_t size = fragWrite(fragment, id, i, data, len);
+		int32_t result = queued ? queueSend(ep, fragment, size) : sendBytes(ep, fragment, size);
+		if (result < 0)
+		{
+			return -1;
+		}
+	}
+	return len;
+}
@@ -8,7 +8,15 @@
 #include <poll.h>
 #include <iostream>
 #include <string.h>
+#include <sys/epoll.h>
 #include "EndPoint.h"
+#include "uringengine.h"
+#include "ingress.h"
+#include "pacer.h"
+#include "proxyheader.h"
+#include "fragment.h"
+#include <linux/net_tstamp.h>
+#include <time.h>
 #ifndef SOCK_NONBLOCK
 #include <fcntl.h>
 #define SOCK_NONBLOCK O_NONBLOCK
@@ -19,6 +27,19 @@
 #define SOCKET_NODATA 0
 #define SOCKET_DATA_WAITING 1
 
+#define ENGINE_POLL			0		// one poll()/recvfrom()/sendto() per operation
+#define ENGINE_EPOLL		1		// epoll readiness with recvmmsg()/sendmmsg() batches
+#define ENGINE_URING		2		// io_uring with multishot receive and batched submission
+
+#define SERVER_BATCH		64		// datagrams per recvmmsg()/sendmmsg() batch
+#define SERVER_SLOT_SIZE	2048	// staging size of one batched datagram
+#define SERVER_URING_DEPTH	256
+#define SERVER_URING_FILE	0
+
+#define PACING_OFF			0		// a flush sends everything at once
+#define PACING_TXTIME		1		// SO_TXTIME launch times, held back by the fq qdisc
+#define PACING_WHEEL		2		// launch times kept by the library's Pacer thread
+
 class Server
 {
   public:
@@ -28,12 +49,55 @@ class Server
 	int32_t UdpPollSocket();
 	int32_t UdpRecvFrom(char *buffer, uint32_t size, EndPoint *addr);
 	sockaddr_in getServerAddr();
+	int getSocket();
 	void setEndPointIp(EndPoint *ep, char zero, char one, char two, char three);
+	int32_t setEngine(int32_t engine);
+	int32_t queueSend(EndPoint ep, char *data, unsigned len);
+	int32_t flushSends();
+	void setFilter(IngressFilter *ingress);
+	int32_t setPacing(int32_t mode, uint32_t intervalUs, uint32_t percent);
+	void getPacerStats(PacerStats *stats);
+	void setUpstream(EndPoint proxy);
 
   private:
+	int32_t batchRecvFrom(char *buffer, uint32_t size, EndPoint *addr);
+	int32_t receiveOne(char *buffer, uint32_t size, EndPoint *addr);
+	int32_t pacedFlush();
+	int32_t sendRaw(EndPoint ep, char *data, unsigned len);
+	int32_t stage(EndPoint ep, char *data, unsigned len);
+	int32_t unwrap(char *buffer, int32_t len, EndPoint *addr);
+	int32_t sendFragments(EndPoint ep, char *data, unsigned len, bool queued);
+
 	int udpSocket;
 	sockaddr_in serverAddr;
 	struct pollfd *poll_events;
+
+	int32_t engine;
+	UringEngine *uring;
+	int epollFd;
+	IngressFilter *filter;
+	bool proxied;
+	EndPoint upstream;
+	uint32_t fragmentId;
+
+	char *recvStaging;
+	struct mmsghdr recvMsgs[SERVER_BATCH];
+	struct iovec recvIovecs[SERVER_BATCH];
+	sockaddr_in recvAddrs[SERVER_BATCH];
+	int32_t recvCount;
+	int32_t recvIndex;
+
+	char *sendStaging;
+	struct mmsghdr sendMsgs[SERVER_BATCH];
+	struct iovec sendIovecs[SERVER_BATCH];
+	sockaddr_in sendAddrs[SERVER_BATCH];
+	int32_t sendCount;
+
+	int32_t pacing;
+	uint64_t pacingSpreadNs;
+	uint32_t pacingRotation;
+	Pacer *pacer;
+	char sendControl[SERVER_BATCH][CMSG_SPACE(sizeof(uint64_t))];
 };
 
 #endif
@@ -0,0 +1,642 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	snapcodec.cpp -   Bit-packed, quantized encoding of tick snapshots
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		int32_t snapPack(const char *tick, uint32_t len, char *out, uint32_t outSize);
+--					int32_t snapUnpack(const char *packed, uint32_t len, char *tick, uint32_t tickSize);
+--					int32_t tickLayout(const char *tick, uint32_t len, TickLayout *layout);
+--					int32_t snapFit(const char *tick, uint32_t len, uint32_t budget, uint32_t *bullets,
+--									uint32_t *weapons);
+--
+--					BitWriter(char *out, uint32_t size);
+--					void write(uint32_t value, uint32_t bits);
+--					void writeVarint(uint32_t value);
+--					int32_t finish();
+--
+--					BitReader(const char *in, uint32_t len);
+--					uint32_t read(uint32_t bits);
+--					uint32_t readVarint();
+--					bool failed();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026
+--						agent: wide snapshots, for more players than the fixed layout holds
+--					October 19th, 2026
+--						agent: snapFit, how many events fit a packed byte budget
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The fixed tick layout in tickpacket.h is always TICK_SIZE bytes with raw floats, whatever it
+--		holds. snapPack turns it into a packed datagram that carries only what the header says is
+--		there:
+--
+--			[SNAP_PACKED][tick header]
+--			if wide: player count as a varint
+--			danger zone x, z, radius as positions, timer as a raw float
+--			health, 5 inventory bytes
+--			per player: id, x, z as positions, r in SNAP_ROT_BITS, weapon byte
+--			if bullets: count, per bullet owner, varint id, type, change
+--			if weapons: count, per weapon player, varint id
+--			sequence number
+--
+--		Positions are map relative fixed point (SNAP_POS_BITS at 1/SNAP_POS_SCALE of a unit) and the
+--		rotation is quantized over a full turn. Everything else is carried exactly. snapUnpack expands
+--		a packed datagram back into the fixed layout, so code that reads snapshots by offset does not
+--		change; Client does this on receive.
+--
+--		A wide snapshot (TICK_WIDE in the header) packs the same way and unpacks back into the wide
+--		layout. tickLayout() finds the sections of either layout for code that walks them.
+---------------------------------------------------------------------------------------*/
+#include "snapcodec.h"
+
+BitWriter::BitWriter(char *o, uint32_t s)
+{
+	out = (uint8_t *)o;
+	size = s;
+	pos = 0;
+	acc = 0;
+	accBits = 0;
+	overflow = false;
+}
+
+void BitWriter::write(uint32_t value, uint32_t bits)
+{
+	if (bits < 32)
+	{
+		value &= (1u << bits) - 1;
+	}
+	acc |= (uint64_t)value << accBits;
+	accBits += bits;
+
+	while (accBits >= 8)
+	{
+		if (pos < size)
+		{
+			out[pos++] = (uint8_t)acc;
+		}
+		else
+		{
+			overflow = true;
+		}
+		acc >>= 8;
+		accBits -= 8;
+	}
+}
+
+// 7 bits per group, low group first, high bit set when another group follows
+void BitWriter::writeVarint(uint32_t value)
+{
+	while (value >= 0x80)
+	{
+		write((value & 0x7F) | 0x80, 8);
+		value >>= 7;
+	}
+	write(value, 8);
+}
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: finish
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t finish()
+--
+-- RETURNS: the number of bytes written, or -1 if the output buffer was too small.
+--
+-- NOTES:
+-- 		Flushes the last partial byte, padded with zero bits.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t BitWriter::finish()
+{
+	if (accBits > 0)
+	{
+		write(0, 8 - accBits);
+	}
+	return overflow ? -1 : (int32_t)pos;
+}
+
+BitReader::BitReader(const char *i, uint32_t l)
+{
+	in = (const uint8_t *)i;
+	len = l;
+	pos = 0;
+	acc = 0;
+	accBits = 0;
+	underflow = false;
+}
+
+uint32_t BitReader::read(uint32_t bits)
+{
+	while (accBits < bits)
+	{
+		if (pos < len)
+		{
+			acc |= (uint64_t)in[pos++] << accBits;
+		}
+		else
+		{
+			underflow = true;
+		}
+		accBits += 8;
+	}
+
+	uint32_t value = (uint32_t)(bits < 32 ? acc & ((1u << bits) - 1) : acc);
+	acc >>= bits;
+	accBits -= bits;
+	return value;
+}
+
+uint32_t BitReader::readVarint()
+{
+	uint32_t value = 0;
+	for (uint32_t shift = 0; shift < 35; shift += 7)
+	{
+		uint32_t group = read(8);
+		value |= (group & 0x7F) << shift;
+		if (!(group & 0x80))
+		{
+			break;
+		}
+	}
+	return value;
+}
+
+bool BitReader::failed()
+{
+	return underflow;
+}
+
+
+
+static uint32_t quantizePos(float value)
+{
+	float scaled = floorf((value - SNAP_POS_MIN) * SNAP_POS_SCALE + 0.5f);
+	float top = (float)((1u << SNAP_POS_BITS) - 1);
+	if (!(scaled > 0))
+	{
+		return 0;
+	}
+	return (uint32_t)(scaled < top ? scaled : top);
+}
+
+static float dequantizePos(uint32_t value)
+{
+	return value / SNAP_POS_SCALE + SNAP_POS_MIN;
+}
+
+static uint32_t quantizeRot(float degrees)
+{
+	float turn = fmodf(degrees, 360.0f);
+	if (turn < 0)
+	{
+		turn += 360.0f;
+	}
+	return (uint32_t)floorf(turn * (1u << SNAP_ROT_BITS) / 360.0f + 0.5f) & ((1u << SNAP_ROT_BITS) - 1);
+}
+
+static float dequantizeRot(uint32_t value)
+{
+	return value * 360.0f / (1u << SNAP_ROT_BITS);
+}
+
+static float getFloat(const char *p)
+{
+	float f;
+	memcpy(&f, p, sizeof(f));
+	return f;
+}
+
+static void putFloat(char *p, float f)
+{
+	memcpy(p, &f, sizeof(f));
+}
+
+static uint32_t getInt(const char *p)
+{
+	uint32_t v;
+	memcpy(&v, p, sizeof(v));
+	return v;
+}
+
+static void putInt(char *p, uint32_t v)
+{
+	memcpy(p, &v, sizeof(v));
+}
+
+#define SNAP_MAX_PLAYERS	((TICK_BULLETS - TICK_PLAYERS) / TICK_PLAYER_SIZE)
+#define SNAP_MAX_BULLETS	((TICK_WEAPONS - TICK_BULLETS - 1) / TICK_BULLET_SIZE)
+#define SNAP_MAX_WEAPONS	((TICK_SEQ - TICK_WEAPONS - 1) / TICK_WEAPON_SIZE)
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: tickLayout
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t tickLayout(const char *tick, uint32_t len, TickLayout *layout)
+--								tick: a snapshot in the fixed or the wide layout
+--								len: the bytes available at tick
+--								layout: receives where each section is
+--
+-- RETURNS: 0, or -1 if tick is not a snapshot or is shorter than its layout says.
+--
+-- NOTES:
+-- 		Counts in the fixed layout are clamped to what its sections hold, as a client reading it by offset
+--		would. A wide snapshot's counts decide its size, so one that overruns len is rejected instead.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t tickLayout(const char *tick, uint32_t len, TickLayout *layout)
+{
+	if (len < 1 || !((uint8_t)tick[0] & TICK_HAS_PLAYERS))
+	{
+		return -1;
+	}
+
+	uint32_t players = (uint8_t)tick[0] & 0x1F;
+	if (players != TICK_WIDE)
+	{
+		if (len < TICK_SIZE)
+		{
+			return -1;
+		}
+		uint32_t bullets = (uint8_t)tick[TICK_BULLETS];
+		uint32_t weapons = (uint8_t)tick[TICK_WEAPONS];
+		layout->players = players < SNAP_MAX_PLAYERS ? players : SNAP_MAX_PLAYERS;
+		layout->playersAt = TICK_PLAYERS;
+		layout->bullets = bullets < SNAP_MAX_BULLETS ? bullets : SNAP_MAX_BULLETS;
+		layout->bulletsAt = TICK_BULLETS;
+		layout->weapons = weapons < SNAP_MAX_WEAPONS ? weapons : SNAP_MAX_WEAPONS;
+		layout->weaponsAt = TICK_WEAPONS;
+		layout->seqAt = TICK_SEQ;
+		layout->size = TICK_SIZE;
+		return 0;
+	}
+
+	if (len < TICK_WIDE_PLAYERS)
+	{
+		return -1;
+	}
+	uint16_t count;
+	memcpy(&count, tick + TICK_WIDE_COUNT, sizeof(uint16_t));
+	if (count > TICK_WIDE_MAX_PLAYERS)
+	{
+		return -1;
+	}
+
+	layout->players = count;
+	layout->playersAt = TICK_WIDE_PLAYERS;
+	layout->bulletsAt = TICK_WIDE_PLAYERS + count * TICK_PLAYER_SIZE;
+	if (len <= layout->bulletsAt)
+	{
+		return -1;
+	}
+	layout->bullets = (uint8_t)tick[layout->bulletsAt];
+	layout->weaponsAt = layout->bulletsAt + 1 + layout->bullets * TICK_BULLET_SIZE;
+	if (len <= layout->weaponsAt)
+	{
+		return -1;
+	}
+	layout->weapons = (uint8_t)tick[layout->weaponsAt];
+	layout->seqAt = layout->weaponsAt + 1 + layout->weapons * TICK_WEAPON_SIZE;
+	layout->size = layout->seqAt + 4;
+	return len < layout->size ? -1 : 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: snapPack
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: wide snapshots
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t snapPack(const char *tick, uint32_t len, char *out, uint32_t outSize)
+--								tick: a snapshot in the fixed or the wide layout
+--								len: its length
+--								out: receives the packed snapshot
+--								outSize: size of out; SNAP_MAX_PACKED is always enough for a fixed snapshot
+--
+-- RETURNS: the length of the packed snapshot, or -1 if tick is not a snapshot or out is too small.
+--
+-- NOTES:
+-- 		Only the number of players in the header's low five bits is carried, which is what a client
+--		reads out of the fixed layout as well. A wide snapshot carries its player count as a varint
+--		after the header instead.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t snapPack(const char *tick, uint32_t len, char *out, uint32_t outSize)
+{
+	TickLayout layout;
+	if (tickLayout(tick, len, &layout) < 0 || outSize < 2)
+	{
+		return -1;
+	}
+
+	uint8_t header = (uint8_t)tick[0];
+	out[0] = SNAP_PACKED;
+	out[1] = header;
+	BitWriter bits(out + 2, outSize - 2);
+
+	if ((header & 0x1F) == TICK_WIDE)
+	{
+		bits.writeVarint(layout.players);
+	}
+
+	bits.write(quantizePos(getFloat(tick + TICK_DANGER_ZONE)), SNAP_POS_BITS);
+	bits.write(quantizePos(getFloat(tick + TICK_DANGER_ZONE + 4)), SNAP_POS_BITS);
+	bits.write(quantizePos(getFloat(tick + TICK_DANGER_ZONE + 8)), SNAP_POS_BITS);
+	bits.write(getInt(tick + TICK_TIME), 32);
+
+	bits.write((uint8_t)tick[TICK_HEALTH], 8);
+	for (int32_t i = 0; i < TICK_PLAYERS - TICK_INVENTORY; i++)
+	{
+		bits.write((uint8_t)tick[TICK_INVENTORY + i], 8);
+	}
+
+	for (uint32_t i = 0; i < layout.players; i++)
+	{
+		const char *p = tick + layout.playersAt + i * TICK_PLAYER_SIZE;
+		bits.write((uint8_t)p[0], 8);
+		bits.write(quantizePos(getFloat(p + 1)), SNAP_POS_BITS);
+		bits.write(quantizePos(getFloat(p + 5)), SNAP_POS_BITS);
+		bits.write(quantizeRot(getFloat(p + 9)), SNAP_ROT_BITS);
+		bits.write((uint8_t)p[13], 8);
+	}
+
+	if (header & TICK_HAS_BULLETS)
+	{
+		bits.write(layout.bullets, 8);
+		for (uint32_t i = 0; i < layout.bullets; i++)
+		{
+			const char *b = tick + layout.bulletsAt + 1 + i * TICK_BULLET_SIZE;
+			bits.write((uint8_t)b[0], 8);
+			bits.writeVarint(getInt(b + 1));
+			bits.write((uint8_t)b[5], 8);
+			bits.write((uint8_t)b[6], 8);
+		}
+	}
+
+	if (header & TICK_HAS_WEAPONS)
+	{
+		bits.write(layout.weapons, 8);
+		for (uint32_t i = 0; i < layout.weapons; i++)
+		{
+			const char *w = tick + layout.weaponsAt + 1 + i * TICK_WEAPON_SIZE;
+			bits.write((uint8_t)w[0], 8);
+			bits.writeVarint(getInt(w + 1));
+		}
+	}
+
+	bits.write(getInt(tick + layout.seqAt), 32);
+
+	int32_t packed = bits.finish();
+	return packed < 0 ? -1 : packed + 2;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: snapUnpack
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: wide snapshots
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t snapUnpack(const char *packed, uint32_t len, char *tick, uint32_t tickSize)
+--								packed: a datagram starting with SNAP_PACKED
+--								len: its length
+--								tick: receives the snapshot in the layout it was packed from
+--								tickSize: size of tick, at least TICK_SIZE, or TICK_WIDE_MAX_SIZE for any
+--										  wide snapshot
+--
+-- RETURNS: the length of the snapshot in tick, or -1 if the datagram is not a packed snapshot, is
+--			truncated, or tick is too small.
+--
+-- NOTES:
+-- 		Sections absent from the packed snapshot are left zeroed. tick must not overlap packed.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t snapUnpack(const char *packed, uint32_t len, char *tick, uint32_t tickSize)
+{
+	if (len < 2 || (uint8_t)packed[0] != SNAP_PACKED)
+	{
+		return -1;
+	}
+
+	uint8_t header = (uint8_t)packed[1];
+	BitReader bits(packed + 2, len - 2);
+	bool wide = (header & 0x1F) == TICK_WIDE;
+
+	uint32_t players;
+	uint32_t playersAt;
+	uint32_t bulletsAt;
+	if (wide)
+	{
+		players = bits.readVarint();
+		if (players > TICK_WIDE_MAX_PLAYERS || tickSize < TICK_WIDE_SIZE(players, 0, 0))
+		{
+			return -1;
+		}
+		playersAt = TICK_WIDE_PLAYERS;
+		bulletsAt = TICK_WIDE_PLAYERS + players * TICK_PLAYER_SIZE;
+		memset(tick, 0, TICK_WIDE_SIZE(players, 0, 0));
+		uint16_t count = (uint16_t)players;
+		memcpy(tick + TICK_WIDE_COUNT, &count, sizeof(uint16_t));
+	}
+	else
+	{
+		if (tickSize < TICK_SIZE)
+		{
+			return -1;
+		}
+		players = header & 0x1F;
+		players = players < SNAP_MAX_PLAYERS ? players : SNAP_MAX_PLAYERS;
+		playersAt = TICK_PLAYERS;
+		bulletsAt = TICK_BULLETS;
+		memset(tick, 0, TICK_SIZE);
+	}
+	tick[0] = header;
+
+	putFloat(tick + TICK_DANGER_ZONE, dequantizePos(bits.read(SNAP_POS_BITS)));
+	putFloat(tick + TICK_DANGER_ZONE + 4, dequantizePos(bits.read(SNAP_POS_BITS)));
+	putFloat(tick + TICK_DANGER_ZONE + 8, dequantizePos(bits.read(SNAP_POS_BITS)));
+	putInt(tick + TICK_TIME, bits.read(32));
+
+	tick[TICK_HEALTH] = (char)bits.read(8);
+	for (int32_t i = 0; i < TICK_PLAYERS - TICK_INVENTORY; i++)
+	{
+		tick[TICK_INVENTORY + i] = (char)bits.read(8);
+	}
+
+	for (uint32_t i = 0; i < players; i++)
+	{
+		char *p = tick + playersAt + i * TICK_PLAYER_SIZE;
+		p[0] = (char)bits.read(8);
+		putFloat(p + 1, dequantizePos(bits.read(SNAP_POS_BITS)));
+		putFloat(p + 5, dequantizePos(bits.read(SNAP_POS_BITS)));
+		putFloat(p + 9, dequantizeRot(bits.read(SNAP_ROT_BITS)));
+		p[13] = (char)bits.read(8);
+	}
+
+	uint32_t bullets = 0;
+	if (header & TICK_HAS_BULLETS)
+	{
+		bullets = bits.read(8);
+		if (wide ? tickSize < TICK_WIDE_SIZE(players, bullets, 0) : bullets > SNAP_MAX_BULLETS)
+		{
+			return -1;
+		}
+		tick[bulletsAt] = (char)bullets;
+		for (uint32_t i = 0; i < bullets; i++)
+		{
+			char *b = tick + bulletsAt + 1 + i * TICK_BULLET_SIZE;
+			b[0] = (char)bits.read(8);
+			putInt(b + 1, bits.readVarint());
+			b[5] = (char)bits.read(8);
+			b[6] = (char)bits.read(8);
+		}
+	}
+
+	uint32_t weaponsAt = wide ? bulletsAt + 1 + bullets * TICK_BULLET_SIZE : TICK_WEAPONS;
+	uint32_t weapons = 0;
+	if (header & TICK_HAS_WEAPONS)
+	{
+		weapons = bits.read(8);
+		if (wide ? tickSize < TICK_WIDE_SIZE(players, bullets, weapons) : weapons > SNAP_MAX_WEAPONS)
+		{
+			return -1;
+		}
+		for (uint32_t i = 0; i < weapons; i++)
+		{
+			char *w = tick + weaponsAt + 1 + i * TICK_WEAPON_SIZE;
+			w[0] = (char)bits.read(8);
+			putInt(w + 1, bits.readVarint());
+		}
+	}
+
+	tick[weaponsAt] = (char)weapons;
+
+	uint32_t size = wide ? TICK_WIDE_SIZE(players, bullets, weapons) : TICK_SIZE;
+	putInt(tick + size - 4, bits.read(32));
+
+	return bits.failed() ? -1 : (int32_t)size;
+}
+
+
+// Bytes writeVarint() takes for value
+static uint32_t varintSize(uint32_t value)
+{
+	uint32_t size = 1;
+	while (value >= 0x80)
+	{
+		value >>= 7;
+		size++;
+	}
+	return size;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: snapFit
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t snapFit(const char *tick, uint32_t len, uint32_t budget, uint32_t *bullets, uint32_t *weapons)
+--								tick: a snapshot in the fixed or the wide layout
+--								len: its length
+--								budget: the most bytes its packed form may take
+--								bullets: set to how many of its bullet events fit, oldest first
+--								weapons: set to how many of its weapon events fit, oldest first
+--
+-- RETURNS: 0, or -1 if tick is not a snapshot.
+--
+-- NOTES:
+-- 		Counts exactly what snapPack() would write. Weapon events are fitted before bullets, since there are
+--		few of them and each changes what is on the map. The first event is always let through even over
+--		budget, so a backlog drains however many players the fixed part carries.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t snapFit(const char *tick, uint32_t len, uint32_t budget, uint32_t *bullets, uint32_t *weapons)
+{
+	TickLayout layout;
+	if (tickLayout(tick, len, &layout) < 0)
+	{
+		return -1;
+	}
+
+	uint8_t header = (uint8_t)tick[0];
+	uint64_t bits = 3 * SNAP_POS_BITS + 32 + 8 * (TICK_PLAYERS - TICK_HEALTH) + 32;
+	if ((header & 0x1F) == TICK_WIDE)
+	{
+		bits += 8 * varintSize(layout.players);
+	}
+	bits += (uint64_t)layout.players * (8 + 2 * SNAP_POS_BITS + SNAP_ROT_BITS + 8);
+	bits += (header & TICK_HAS_BULLETS) ? 8 : 0;
+	bits += (header & TICK_HAS_WEAPONS) ? 8 : 0;
+	uint64_t room = budget > 2 ? (uint64_t)(budget - 2) * 8 : 0;
+
+	uint32_t fitted = 0;
+	uint32_t total = 0;
+	if (header & TICK_HAS_WEAPONS)
+	{
+		for (; fitted < layout.weapons; fitted++)
+		{
+			const char *w = tick + layout.weaponsAt + 1 + fitted * TICK_WEAPON_SIZE;
+			uint64_t cost = 8 + 8 * varintSize(getInt(w + 1));
+			if (total > 0 && bits + cost > room)
+			{
+				break;
+			}
+			bits += cost;
+			total++;
+		}
+	}
+	*weapons = fitted;
+
+	fitted = 0;
+	if (header & TICK_HAS_BULLETS)
+	{
+		for (; fitted < layout.bullets; fitted++)
+		{
+			const char *b = tick + layout.bulletsAt + 1 + fitted * TICK_BULLET_SIZE;
+			uint64_t cost = 8 + 8 * varintSize(getInt(b + 1)) + 16;
+			if (total > 0 && bits + cost > room)
+			{
+				break;
+			}
+			bits += cost;
+			total++;
+		}
+	}
+	*bullets = fitted;
+
+	return 0;
+}
@@ -0,0 +1,70 @@
+#ifndef SNAPCODEC_DEF
+#define SNAPCODEC_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+#include "tickpacket.h"
+
+#define SNAP_PACKED					86			// first byte of a packed snapshot; ticks always have 0x80 set
+
+// Positions are fixed point over [SNAP_POS_MIN, SNAP_POS_MIN + 2^SNAP_POS_BITS / SNAP_POS_SCALE)
+#define SNAP_POS_MIN				-2048.0f
+#define SNAP_POS_SCALE				64.0f		// 1/64 of a unit
+#define SNAP_POS_BITS				18
+#define SNAP_ROT_BITS				10			// degrees, 0.35 degree steps
+
+#define SNAP_MAX_PACKED				TICK_SIZE	// a packed snapshot is never larger than the fixed one
+
+class BitWriter
+{
+  public:
+	BitWriter(char *out, uint32_t size);
+	void write(uint32_t value, uint32_t bits);
+	void writeVarint(uint32_t value);
+	int32_t finish();
+
+  private:
+	uint8_t *out;
+	uint32_t size;
+	uint32_t pos;
+	uint64_t acc;
+	uint32_t accBits;
+	bool overflow;
+};
+
+class BitReader
+{
+  public:
+	BitReader(const char *in, uint32_t len);
+	uint32_t read(uint32_t bits);
+	uint32_t readVarint();
+	bool failed();
+
+  private:
+	const uint8_t *in;
+	uint32_t len;
+	uint32_t pos;
+	uint64_t acc;
+	uint32_t accBits;
+	bool underflow;
+};
+
+// Where the sections of a snapshot are; the *At offsets of bullets and weapons are their count bytes
+struct TickLayout {
+	uint32_t players;
+	uint32_t playersAt;
+	uint32_t bullets;
+	uint32_t bulletsAt;
+	uint32_t weapons;
+	uint32_t weaponsAt;
+	uint32_t seqAt;
+	uint32_t size;
+};
+
+int32_t tickLayout(const char *tick, uint32_t len, TickLayout *layout);
+int32_t snapPack(const char *tick, uint32_t len, char *out, uint32_t outSize);
+int32_t snapUnpack(const char *packed, uint32_t len, char *tick, uint32_t tickSize);
+int32_t snapFit(const char *tick, uint32_t len, uint32_t budget, uint32_t *bullets, uint32_t *weapons);
+
+#endif
@@ -0,0 +1,335 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	spawnsampler.cpp -   Grid-accelerated weapon spawn placement
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		SpawnSampler();
+--					int32_t initialize(uint32_t width, uint32_t length, uint32_t spacing, uint64_t seed);
+--					void blockTerrain(const uint8_t *tiles);
+--					void setHotspots(const int32_t *xz, uint32_t count, uint32_t cluster);
+--					void setTown(const int32_t *xz, uint32_t count);
+--					int32_t sample(uint32_t count, uint32_t townCount, float hotspotChance, int32_t firstId,
+--								   char *out, uint32_t outSize);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Places weapons the way InitRandomGuns does: the first townCount from the fixed town spots,
+--		the rest around a random hotspot with probability hotspotChance or anywhere on the map
+--		otherwise. A candidate is kept only if no weapon lies within spacing of it on either axis
+--		(the OCCURANCESQUARE box) and the terrain under it is clear.
+--
+--		Weapons are binned into a grid of spacing-sized cells. Two weapons can never share a cell,
+--		so a candidate is checked against at most nine cells and placement is linear in the number
+--		of weapons rather than quadratic. Terrain is rasterized once into a byte per tile, with the
+--		same clearance around buildings, cacti and bushes that TerrainController uses.
+---------------------------------------------------------------------------------------*/
+#include "spawnsampler.h"
+
+SpawnSampler::SpawnSampler()
+{
+	width = 0;
+	length = 0;
+	spacing = 1;
+	gridWidth = 0;
+	gridLength = 0;
+	state = 1;
+	cluster = 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: initialize
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t initialize(uint32_t width, uint32_t length, uint32_t spacing, uint64_t seed)
+--								width, length: size of the map in tiles; weapons are placed in [0, width) x [0, length)
+--								spacing: minimum distance between weapons on either axis
+--								seed: random seed
+--
+-- RETURNS: 0 on success, -1 if a dimension is zero.
+--
+-- NOTES:
+-- 		Clears any terrain, hotspots, town spots and weapons from an earlier use.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t SpawnSampler::initialize(uint32_t w, uint32_t l, uint32_t s, uint64_t seed)
+{
+	if (w == 0 || l == 0 || s == 0)
+	{
+		return -1;
+	}
+
+	width = (int32_t)w;
+	length = (int32_t)l;
+	spacing = (int32_t)s;
+	gridWidth = (width + spacing - 1) / spacing;
+	gridLength = (length + spacing - 1) / spacing;
+	state = seed ? seed : 0x9E3779B97F4A7C15ull;
+
+	blocked.assign((size_t)width * length, 0);
+	grid.assign((size_t)gridWidth * gridLength, -1);
+	placed.clear();
+	hotspots.clear();
+	town.clear();
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: blockTerrain
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void blockTerrain(const uint8_t *tiles)
+--								tiles: width * length tile types, laid out like TerrainController's byte[x, z]
+--
+-- RETURNS: void
+--------------------------------------------------------------------------------------------------------------*/
+void SpawnSampler::blockTerrain(const uint8_t *tiles)
+{
+	for (int32_t x = 0; x < width; x++)
+	{
+		for (int32_t z = 0; z < length; z++)
+		{
+			switch (tiles[(size_t)x * length + z])
+			{
+				case SPAWN_TILE_BUILDING:
+					block(x, z, SPAWN_BUILDING_RADIUS);
+					break;
+				case SPAWN_TILE_CACTUS:
+					block(x, z, SPAWN_CACTUS_RADIUS);
+					break;
+				case SPAWN_TILE_BUSH:
+					block(x, z, SPAWN_BUSH_RADIUS);
+					break;
+				default:
+					break;
+			}
+		}
+	}
+}
+
+void SpawnSampler::setHotspots(const int32_t *xz, uint32_t count, uint32_t c)
+{
+	hotspots.assign(xz, xz + count * 2);
+	cluster = (int32_t)c;
+}
+
+void SpawnSampler::setTown(const int32_t *xz, uint32_t count)
+{
+	town.assign(xz, xz + count * 2);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sample
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t sample(uint32_t count, uint32_t townCount, float hotspotChance, int32_t firstId,
+--							 char *out, uint32_t outSize)
+--								count: weapons to place
+--								townCount: how many of them to try on town spots first
+--								hotspotChance: chance each remaining weapon is clustered around a hotspot
+--								firstId: id of the first weapon, the rest follow in order
+--								out: receives SPAWN_RECORD_SIZE byte records as [type][id][x][z]
+--								outSize: size of out
+--
+-- RETURNS: the number of weapons placed; fewer than count if the map ran out of room.
+--
+-- NOTES:
+-- 		Town spots are used in random order and each is tried once. A town spot that is taken falls back
+--		to a random position, like InitRandomGuns. Every weapon gets SPAWN_ATTEMPTS candidates.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t SpawnSampler::sample(uint32_t count, uint32_t townCount, float hotspotChance, int32_t firstId, char *out, uint32_t outSize)
+{
+	if (width == 0)
+	{
+		return 0;
+	}
+
+	if (count > outSize / SPAWN_RECORD_SIZE)
+	{
+		count = outSize / SPAWN_RECORD_SIZE;
+	}
+
+	std::vector<int32_t> spots(town);
+	uint32_t done = 0;
+
+	for (uint32_t i = 0; i < count; i++)
+	{
+		int32_t x = 0;
+		int32_t z = 0;
+		bool ok = false;
+
+		if (i < townCount && spots.size() > 0)
+		{
+			uint32_t pick = (uint32_t)range(0, (int32_t)(spots.size() / 2)) * 2;
+			x = spots[pick];
+			z = spots[pick + 1];
+			spots.erase(spots.begin() + pick, spots.begin() + pick + 2);
+			ok = place(x, z);
+		}
+
+		for (int32_t attempt = 0; !ok && attempt < SPAWN_ATTEMPTS; attempt++)
+		{
+			bool clustered = i >= townCount && hotspots.size() > 0
+				&& (float)(next() >> 40) / (float)(1 << 24) < hotspotChance;
+			if (clustered)
+			{
+				uint32_t spot = (uint32_t)range(0, (int32_t)(hotspots.size() / 2)) * 2;
+				x = range(hotspots[spot] - cluster, hotspots[spot] + cluster);
+				z = range(hotspots[spot + 1] - cluster, hotspots[spot + 1] + cluster);
+			}
+			else
+			{
+				x = range(0, width);
+				z = range(0, length);
+			}
+			ok = place(x, z);
+		}
+
+		if (!ok)
+		{
+			continue;
+		}
+
+		char *record = out + done * SPAWN_RECORD_SIZE;
+		int32_t id = firstId + (int32_t)done;
+		record[0] = (char)gunType();
+		memcpy(record + 1, &id, sizeof(int32_t));
+		memcpy(record + 5, &x, sizeof(int32_t));
+		memcpy(record + 9, &z, sizeof(int32_t));
+		done++;
+	}
+
+	return (int32_t)done;
+}
+
+// xorshift64*
+uint64_t SpawnSampler::next()
+{
+	state ^= state >> 12;
+	state ^= state << 25;
+	state ^= state >> 27;
+	return state * 2685821657736338717ull;
+}
+
+// Uniform in [low, high), like Random.Next
+int32_t SpawnSampler::range(int32_t low, int32_t high)
+{
+	if (high <= low)
+	{
+		return low;
+	}
+	return low + (int32_t)((next() >> 32) % (uint32_t)(high - low));
+}
+
+// Same odds as WeaponSpell.GenGunType: 35% guns (1-3 at 50/35/15), 65% spells (4-13 evenly)
+uint8_t SpawnSampler::gunType()
+{
+	uint32_t roll = (uint32_t)((next() >> 32) % 1000);
+	if (roll < 350)
+	{
+		uint32_t gun = (uint32_t)((next() >> 32) % 100);
+		return gun < 50 ? 1 : (gun < 85 ? 2 : 3);
+	}
+	return (uint8_t)(4 + (next() >> 32) % 10);
+}
+
+void SpawnSampler::block(int32_t x, int32_t z, int32_t radius)
+{
+	for (int32_t i = x - radius; i <= x + radius; i++)
+	{
+		for (int32_t j = z - radius; j <= z + radius; j++)
+		{
+			if (i >= 0 && i < width && j >= 0 && j < length)
+			{
+				blocked[(size_t)i * length + j] = 1;
+			}
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: place
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool place(int32_t x, int32_t z)
+--
+-- RETURNS: true if the candidate was accepted and recorded.
+--
+-- NOTES:
+-- 		Rejects candidates off the map, on blocked terrain, or within spacing of a placed weapon on both
+--		axes. Any such weapon sits in the candidate's cell or one of its eight neighbours.
+--------------------------------------------------------------------------------------------------------------*/
+bool SpawnSampler::place(int32_t x, int32_t z)
+{
+	if (x < 0 || x >= width || z < 0 || z >= length || blocked[(size_t)x * length + z])
+	{
+		return false;
+	}
+
+	int32_t cx = x / spacing;
+	int32_t cz = z / spacing;
+
+	for (int32_t i = cx - 1; i <= cx + 1; i++)
+	{
+		for (int32_t j = cz - 1; j <= cz + 1; j++)
+		{
+			if (i < 0 || i >= gridWidth || j < 0 || j >= gridLength)
+			{
+				continue;
+			}
+			int32_t other = grid[(size_t)i * gridLength + j];
+			if (other < 0)
+			{
+				continue;
+			}
+			int32_t dx = placed[other * 2] - x;
+			int32_t dz = placed[other * 2 + 1] - z;
+			if (dx > -spacing && dx < spacing && dz > -spacing && dz < spacing)
+			{
+				return false;
+			}
+		}
+	}
+
+	grid[(size_t)cx * gridLength + cz] = (int32_t)(placed.size() / 2);
+	placed.push_back(x);
+	placed.push_back(z);
+	return true;
+}
@@ -0,0 +1,51 @@
+#ifndef SPAWNSAMPLER_DEF
+#define SPAWNSAMPLER_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+#define SPAWN_RECORD_SIZE			13			// type, id, x, z; R.Init.INDWPNPCKT
+#define SPAWN_ATTEMPTS				64			// candidates tried per weapon before giving up
+
+// Tile types from TerrainController.TileTypes and the clearance each keeps around it
+#define SPAWN_TILE_CACTUS			1
+#define SPAWN_TILE_BUSH				2
+#define SPAWN_TILE_BUILDING			3
+#define SPAWN_CACTUS_RADIUS			1
+#define SPAWN_BUSH_RADIUS			2
+#define SPAWN_BUILDING_RADIUS		5
+
+class SpawnSampler
+{
+  public:
+	SpawnSampler();
+	int32_t initialize(uint32_t width, uint32_t length, uint32_t spacing, uint64_t seed);
+	void blockTerrain(const uint8_t *tiles);
+	void setHotspots(const int32_t *xz, uint32_t count, uint32_t cluster);
+	void setTown(const int32_t *xz, uint32_t count);
+	int32_t sample(uint32_t count, uint32_t townCount, float hotspotChance, int32_t firstId, char *out, uint32_t outSize);
+
+  private:
+	uint64_t next();
+	int32_t range(int32_t low, int32_t high);
+	uint8_t gunType();
+	void block(int32_t x, int32_t z, int32_t radius);
+	bool place(int32_t x, int32_t z);
+
+	int32_t width;
+	int32_t length;
+	int32_t spacing;
+	int32_t gridWidth;
+	int32_t gridLength;
+	uint64_t state;
+	int32_t cluster;
+
+	std::vector<uint8_t> blocked;				// width * length, 1 where terrain is in the way
+	std::vector<int32_t> grid;					// one cell per spacing square, index into placed or -1
+	std::vector<int32_t> placed;				// x, z pairs
+	std::vector<int32_t> hotspots;
+	std::vector<int32_t> town;
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	sweep.cpp -   Continuous bullet collision against players and terrain
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		int32_t sweepBullets(PositionHistory *history, const TerrainPack *pack,
+--										 const SweepBullet *bullets, SweepHit *hits, uint32_t count);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A bullet moves its whole speed every tick, and testing only where it lands lets a fast one
+--		step over a player or a cactus between two ticks. Here each bullet is tested along the
+--		segment it covers in the tick instead: against the players as its shooter saw them (see
+--		poshistory.cpp) and against the terrain pack's occupancy grid, and the earliest contact
+--		is reported. Hits no longer depend on how far a bullet moves in a tick, so they do not
+--		depend on the tick rate either.
+--
+--		The game thread hands over every bullet of a tick in one call.
+---------------------------------------------------------------------------------------*/
+#include "sweep.h"
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sweepBullets
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t sweepBullets(PositionHistory *history, const TerrainPack *pack, const SweepBullet *bullets,
+--								   SweepHit *hits, uint32_t count)
+--								history: player positions by tick
+--								pack: the match's terrain, or null for none
+--								bullets: the bullets to test
+--								hits: receives what each bullet hit first, in the same order
+--								count: entries in bullets and hits
+--
+-- RETURNS: the number of bullets that hit something.
+--
+-- NOTES:
+-- 		A player hit at the same point as the terrain wins; the old end point tests applied both.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t sweepBullets(PositionHistory *history, const TerrainPack *pack, const SweepBullet *bullets, SweepHit *hits,
+					 uint32_t count)
+{
+	int32_t hitCount = 0;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		const SweepBullet &bullet = bullets[i];
+		SweepHit &hit = hits[i];
+		hit.kind = SWEEP_NONE;
+		hit.id = -1;
+		hit.t = 1.0f;
+
+		float t;
+		if ((bullet.targets & SWEEP_TERRAIN) && pack != 0 && pack->sweep(bullet.x, bullet.z, bullet.dx, bullet.dz, &t))
+		{
+			hit.kind = SWEEP_TERRAIN;
+			hit.t = t;
+		}
+
+		if (bullet.targets & SWEEP_PLAYER)
+		{
+			int32_t id = history->sweep(bullet.tick, bullet.x, bullet.z, bullet.dx, bullet.dz, bullet.radius,
+										bullet.shooter, &t);
+			if (id >= 0 && t <= hit.t)
+			{
+				hit.kind = SWEEP_PLAYER;
+				hit.id = id;
+				hit.t = t;
+			}
+		}
+
+		hit.x = bullet.x + bullet.dx * hit.t;
+		hit.z = bullet.z + bullet.dz * hit.t;
+		if (hit.kind != SWEEP_NONE)
+		{
+			hitCount++;
+		}
+	}
+	return hitCount;
+}
@@ -0,0 +1,37 @@
+#ifndef SWEEP_DEF
+#define SWEEP_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include "poshistory.h"
+#include "terrainpack.h"
+
+// What a bullet hit; also the bits of SweepBullet::targets
+#define SWEEP_NONE					0
+#define SWEEP_PLAYER				1
+#define SWEEP_TERRAIN				2
+
+// One bullet's movement over a tick
+struct SweepBullet {
+	float x;									// position at the start of the tick
+	float z;
+	float dx;									// movement over the tick
+	float dz;
+	float radius;								// bullet size plus player radius
+	uint32_t tick;								// snapshot tick the players are rewound to
+	int32_t shooter;							// never hit
+	uint32_t targets;							// SWEEP_PLAYER and/or SWEEP_TERRAIN
+};
+
+struct SweepHit {
+	uint32_t kind;								// SWEEP_NONE, SWEEP_PLAYER or SWEEP_TERRAIN
+	int32_t id;									// the player hit, or -1
+	float t;									// fraction of the tick's movement made before the hit
+	float x;									// bullet position at the hit
+	float z;
+};
+
+int32_t sweepBullets(PositionHistory *history, const TerrainPack *pack, const SweepBullet *bullets, SweepHit *hits,
+					 uint32_t count);
+
+#endif
@@ -10,12 +10,14 @@
  *				int32_t receiveBytes(int clientSocket, char * buffer, unsigned len);
  *				int32_t closeClientSocket(int32_t clientSocket);
  *				int32_t closeListenSocket(int32_t sockfd);
+ *				int32_t setEngine(int32_t engine);
  *
  * DATE:		Apr. 10, 2018
  *
  * REVISIONS:	Feb.
  * 				March.
  * 				Apr.
+ * 				Oct. 19, 2026 (optional io_uring engine for sends)
  *
  * DESIGNER:	Delan Elliot, Wilson Hu, Matthew Shew
  *
@@ -25,6 +27,10 @@
  * This class contains the C TCP/IP socket calls used by the game's networking
  * library.
  *
+ * With setEngine(TCP_ENGINE_URING) every accepted client socket is registered
+ * with a UringEngine and the large init transfers go out as fixed-buffer writes
+ * instead of send() calls.
+ *
  */
 
 #include "tcpserver.h"
@@ -60,7 +66,8 @@
  */
 TCPServer::TCPServer()
 {
-
+	uring = 0;
+	memset(fileUsed, 0, sizeof(fileUsed));
 }
 
 /**
@@ -196,6 +203,23 @@ int32_t TCPServer::acceptConnection(EndPoint* ep)
 	ep->port = ntohs(clientAddr.sin_port);
 	ep->addr = ntohl(clientAddr.sin_addr.s_addr);
 
+	if (uring)
+	{
+		std::lock_guard<std::mutex> guard(filesLock);
+		for (int32_t i = 0; i < MAX_NUM_CLIENTS; i++)
+		{
+			if (!fileUsed[i])
+			{
+				if (uring->registerFile(i, clientSocket) == 0)
+				{
+					fileUsed[i] = true;
+					uringFiles[clientSocket] = i;
+				}
+				break;
+			}
+		}
+	}
+
 	return clientSocket;
 }
 
@@ -219,9 +243,29 @@ int32_t TCPServer::acceptConnection(EndPoint* ep)
  *
  * NOTES:
  * This function is the send() wrapper for the game's networking library.
+ *
+ * When the io_uring engine is on and the socket was registered at accept
+ * time, the data is written through the ring in slot sized chunks instead.
  */
 int32_t TCPServer::sendBytes(int clientSocket, char* data, unsigned len)
 {
+	if (uring)
+	{
+		int32_t fileIndex = -1;
+		{
+			std::lock_guard<std::mutex> guard(filesLock);
+			std::map<int, int32_t>::iterator it = uringFiles.find(clientSocket);
+			if (it != uringFiles.end())
+			{
+				fileIndex = it->second;
+			}
+		}
+		if (fileIndex >= 0)
+		{
+			return uring->writeAll(fileIndex, data, len);
+		}
+	}
+
 	return send(clientSocket, data, len, 0);
 }
 
@@ -284,6 +328,17 @@ int32_t TCPServer::receiveBytes(int clientSocket, char * buffer, unsigned len)
  */
 int32_t TCPServer::closeClientSocket(int32_t clientSocket)
 {
+	if (uring)
+	{
+		std::lock_guard<std::mutex> guard(filesLock);
+		std::map<int, int32_t>::iterator it = uringFiles.find(clientSocket);
+		if (it != uringFiles.end())
+		{
+			uring->registerFile(it->second, -1);
+			fileUsed[it->second] = false;
+			uringFiles.erase(it);
+		}
+	}
 	return close(clientSocket);
 }
 
@@ -313,3 +368,44 @@ int32_t TCPServer::closeListenSocket(int32_t sockfd)
 	int32_t result = close(sockfd);
 	return result;
 }
+
+/**
+ * FUNCTION:	setEngine
+ *
+ * DATE:		Oct. 19, 2026
+ *
+ * REVISIONS:
+ *
+ * DESIGNER:	agent
+ *
+ * PROGRAMMER:	agent
+ *
+ * INTERFACE:	int32_t TCPServer::setEngine(int32_t engine)
+ * 					int32_t engine: TCP_ENGINE_SYSCALL or TCP_ENGINE_URING
+ *
+ * RETURNS:		Returns the engine actually in use.
+ *
+ * NOTES:
+ * This function should be called before the first acceptConnection. If the
+ * ring cannot be created the server keeps using plain send() calls.
+ */
+int32_t TCPServer::setEngine(int32_t engine)
+{
+	if (engine != TCP_ENGINE_URING)
+	{
+		return uring ? TCP_ENGINE_URING : TCP_ENGINE_SYSCALL;
+	}
+
+	if (uring == 0)
+	{
+		uring = new UringEngine();
+		if (uring->initialize(TCP_URING_DEPTH, TCP_URING_SLOTS, TCP_URING_SLOT_SIZE, 0, MAX_NUM_CLIENTS, true) != 0)
+		{
+			delete uring;
+			uring = 0;
+			return TCP_ENGINE_SYSCALL;
+		}
+	}
+
+	return TCP_ENGINE_URING;
+}
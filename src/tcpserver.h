@@ -14,8 +14,10 @@
 #include <stdio.h>
 #include <netdb.h>
 #include <errno.h>
+#include <mutex>
 
 #include "EndPoint.h"
+#include "uringengine.h"
 
 #ifndef SOCK_NONBLOCK
 #include <fcntl.h>
@@ -30,6 +32,12 @@
 #define TRUE					1
 #define FALSE 					0
 
+#define TCP_ENGINE_SYSCALL		0
+#define TCP_ENGINE_URING		2
+#define TCP_URING_DEPTH			128
+#define TCP_URING_SLOTS			64
+#define TCP_URING_SLOT_SIZE		8192
+
 
 
 class TCPServer {
@@ -42,6 +50,7 @@ public:
 	int32_t receiveBytes(int clientSocket, char * buffer, unsigned len);
 	int32_t closeClientSocket(int32_t clientSocket);
 	int32_t closeListenSocket(int32_t sockfd);
+	int32_t setEngine(int32_t engine);
 
 
 
@@ -49,6 +58,10 @@ private:
 	int tcpSocket;
 	sockaddr_in serverAddr;
 	struct pollfd* poll_events;
+	UringEngine *uring;
+	std::mutex filesLock;
+	std::map<int, int32_t> uringFiles;
+	bool fileUsed[MAX_NUM_CLIENTS];
 
 };
 
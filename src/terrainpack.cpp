@@ -0,0 +1,501 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	terrainpack.cpp -   Prebuilt terrain, mapped straight from disk
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		TerrainPack();
+--					int32_t create(const uint8_t *tiles, uint32_t width, uint32_t length,
+--								   const int32_t *fixedXZ, uint32_t fixedCount,
+--								   const char *payload, uint32_t payloadSize);
+--					int32_t save(const char *path);
+--					int32_t open(const char *path);
+--					bool occupied(int32_t x, int32_t z);
+--					bool sweep(float x, float z, float dx, float dz, float *t);
+--					int32_t expandTiles(uint8_t *tiles, uint64_t size);
+--					const TerrainPackHeader *info();
+--					const TerrainObstacle *obstacles();
+--					const char *payload();
+--					void close();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: swept occupancy test for continuous bullet collision
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Everything a match needs from its terrain, in the form it is used in, so a match that opens
+--		a pack has nothing left to build:
+--
+--			the obstacles, every tile that is not ground, as a sparse list; a 1000 x 1000 map is
+--			around 99.9% ground, so this is a few kilobytes where the grid is a megabyte
+--			the occupancy grid, one bit per world unit, set wherever TerrainController's clearance
+--			around an obstacle reaches and at the fixed points (the town) it was given
+--			the compressed terrain payload sent to clients, exactly as it goes on the wire
+--
+--		World positions are tile indices less half the map, as in TerrainController. The grid
+--		covers the map plus TERRAIN_MAX_RADIUS of clearance on every side, rounded up to whole
+--		uint64 words per row.
+--
+--		create() lays a pack out in anonymous memory and save() writes it to a temporary file
+--		renamed over the path, so a match opening the path sees an old pack or a new one, never
+--		half of one. open() maps a saved pack read only and shared: every match process on the
+--		host uses the same page cache pages, and nothing is parsed or copied. A pack whose magic,
+--		version, layout or checksum is wrong is refused.
+---------------------------------------------------------------------------------------*/
+#include "terrainpack.h"
+
+TerrainPack::TerrainPack()
+{
+	map = 0;
+	mapSize = 0;
+	header = 0;
+	bits = 0;
+}
+
+TerrainPack::~TerrainPack()
+{
+	close();
+}
+
+uint64_t TerrainPack::align(uint64_t offset)
+{
+	return (offset + TERRAIN_PACK_ALIGN - 1) & ~(uint64_t)(TERRAIN_PACK_ALIGN - 1);
+}
+
+// 64 bit FNV-1a
+uint64_t TerrainPack::checksum(const char *data, uint64_t size)
+{
+	uint64_t hash = 14695981039346656037ULL;
+	for (uint64_t i = 0; i < size; i++)
+	{
+		hash ^= (uint8_t)data[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+void TerrainPack::occupy(uint64_t *grid, int32_t x, int32_t z)
+{
+	uint32_t column = (uint32_t)(x - header->originX);
+	uint32_t row = (uint32_t)(z - header->originZ);
+	if (column >= header->side || row >= header->side)
+	{
+		return;
+	}
+	uint64_t cell = (uint64_t)row * header->side + column;
+	grid[cell >> 6] |= (uint64_t)1 << (cell & 63);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: create
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t create(const uint8_t *tiles, uint32_t width, uint32_t length, const int32_t *fixedXZ,
+--							 uint32_t fixedCount, const char *payload, uint32_t payloadSize)
+--								tiles: width * length tile types, laid out like TerrainController's byte[x, z]
+--								fixedXZ: fixedCount world x, z pairs that are always occupied, or null
+--								payload, payloadSize: the compressed terrain as sent to clients
+--
+-- RETURNS: 0, or -1 if the pack already holds terrain, the sizes are out of range or memory ran out.
+--
+-- NOTES:
+-- 		The pack is usable straight away, and can be saved for later matches to open.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TerrainPack::create(const uint8_t *tiles, uint32_t width, uint32_t length, const int32_t *fixedXZ,
+							uint32_t fixedCount, const char *payload, uint32_t payloadSize)
+{
+	if (map != 0 || tiles == 0 || width == 0 || length == 0 || width > TERRAIN_PACK_MAX_SIDE
+		|| length > TERRAIN_PACK_MAX_SIDE || payloadSize > TERRAIN_PACK_MAX_PAYLOAD)
+	{
+		return -1;
+	}
+
+	uint64_t tileCount = (uint64_t)width * length;
+	uint32_t obstacleCount = 0;
+	for (uint64_t i = 0; i < tileCount; i++)
+	{
+		obstacleCount += tiles[i] != TERRAIN_GROUND;
+	}
+
+	uint32_t span = (width > length ? width : length) + 2 * TERRAIN_MAX_RADIUS;
+	uint32_t side = (span + 63) & ~63u;
+	uint64_t obstacleOffset = TERRAIN_PACK_ALIGN;
+	uint64_t occupancyOffset = align(obstacleOffset + (uint64_t)obstacleCount * sizeof(TerrainObstacle));
+	uint64_t payloadOffset = align(occupancyOffset + (uint64_t)side * side / 8);
+	uint64_t fileSize = payloadOffset + payloadSize;
+
+	char *image = (char *)mmap(0, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (image == MAP_FAILED)
+	{
+		perror("terrain pack mmap failed");
+		return -1;
+	}
+
+	// The mapping is zero filled, so the grid starts empty and the padding is zero for the checksum
+	TerrainPackHeader *created = (TerrainPackHeader *)image;
+	created->magic = TERRAIN_PACK_MAGIC;
+	created->version = TERRAIN_PACK_VERSION;
+	created->width = width;
+	created->length = length;
+	created->originX = -(int32_t)(width / 2) - TERRAIN_MAX_RADIUS;
+	created->originZ = -(int32_t)(length / 2) - TERRAIN_MAX_RADIUS;
+	created->side = side;
+	created->obstacleCount = obstacleCount;
+	created->obstacleOffset = obstacleOffset;
+	created->occupancyOffset = occupancyOffset;
+	created->payloadOffset = payloadOffset;
+	created->payloadSize = payloadSize;
+	created->fileSize = fileSize;
+	header = created;
+
+	TerrainObstacle *obstacle = (TerrainObstacle *)(image + obstacleOffset);
+	uint64_t *grid = (uint64_t *)(image + occupancyOffset);
+	for (uint32_t x = 0; x < width; x++)
+	{
+		for (uint32_t z = 0; z < length; z++)
+		{
+			uint8_t type = tiles[(uint64_t)x * length + z];
+			int32_t radius;
+			switch (type)
+			{
+				case TERRAIN_GROUND:
+					continue;
+				case TERRAIN_CACTUS:
+					radius = TERRAIN_CACTUS_RADIUS;
+					break;
+				case TERRAIN_BUSH:
+					radius = TERRAIN_BUSH_RADIUS;
+					break;
+				case TERRAIN_BUILDING:
+					radius = TERRAIN_BUILDING_RADIUS;
+					break;
+				default:
+					radius = 0;
+					break;
+			}
+
+			obstacle->x = (uint16_t)x;
+			obstacle->z = (uint16_t)z;
+			obstacle->type = type;
+			obstacle->radius = (uint8_t)radius;
+			obstacle++;
+
+			// Other tile types are listed but, as in TerrainController, block nothing
+			if (type > TERRAIN_BUILDING)
+			{
+				continue;
+			}
+			int32_t worldX = (int32_t)x - (int32_t)(width / 2);
+			int32_t worldZ = (int32_t)z - (int32_t)(length / 2);
+			for (int32_t k = worldX - radius; k <= worldX + radius; k++)
+			{
+				for (int32_t m = worldZ - radius; m <= worldZ + radius; m++)
+				{
+					occupy(grid, k, m);
+				}
+			}
+		}
+	}
+
+	for (uint32_t i = 0; fixedXZ != 0 && i < fixedCount; i++)
+	{
+		occupy(grid, fixedXZ[i * 2], fixedXZ[i * 2 + 1]);
+	}
+
+	if (payloadSize > 0)
+	{
+		memcpy(image + payloadOffset, payload, payloadSize);
+	}
+	created->checksum = checksum(image + TERRAIN_PACK_ALIGN, fileSize - TERRAIN_PACK_ALIGN);
+
+	mprotect(image, fileSize, PROT_READ);
+	map = image;
+	mapSize = fileSize;
+	bits = grid;
+	return 0;
+}
+
+// Writes the pack to path by way of a temporary file, so the path is never seen half written
+int32_t TerrainPack::save(const char *path)
+{
+	if (map == 0)
+	{
+		return -1;
+	}
+
+	char temporary[4096];
+	if (snprintf(temporary, sizeof(temporary), "%s.%d.tmp", path, (int)getpid()) >= (int)sizeof(temporary))
+	{
+		return -1;
+	}
+
+	int fd = ::open(temporary, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0)
+	{
+		perror("terrain pack open failed");
+		return -1;
+	}
+
+	uint64_t written = 0;
+	while (written < mapSize)
+	{
+		ssize_t n = write(fd, map + written, mapSize - written);
+		if (n <= 0)
+		{
+			perror("terrain pack write failed");
+			::close(fd);
+			unlink(temporary);
+			return -1;
+		}
+		written += n;
+	}
+
+	if (fsync(fd) != 0 || ::close(fd) != 0 || rename(temporary, path) != 0)
+	{
+		perror("terrain pack save failed");
+		unlink(temporary);
+		return -1;
+	}
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: open
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t open(const char *path)
+--								path: a pack written by save()
+--
+-- RETURNS: 0, or -1 if the pack already holds terrain or the file is missing or not a valid pack.
+--
+-- NOTES:
+-- 		The file is mapped read only and shared, and its pages are faulted in up front, so lookups
+--		during the match never wait on the disk.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TerrainPack::open(const char *path)
+{
+	if (map != 0)
+	{
+		return -1;
+	}
+
+	int fd = ::open(path, O_RDONLY);
+	if (fd < 0)
+	{
+		return -1;
+	}
+
+	struct stat status;
+	if (fstat(fd, &status) != 0 || (uint64_t)status.st_size < TERRAIN_PACK_ALIGN)
+	{
+		::close(fd);
+		return -1;
+	}
+
+	char *mapping = (char *)mmap(0, status.st_size, PROT_READ, MAP_SHARED | MAP_POPULATE, fd, 0);
+	::close(fd);
+	if (mapping == MAP_FAILED)
+	{
+		perror("terrain pack mmap failed");
+		return -1;
+	}
+	map = mapping;
+	mapSize = status.st_size;
+	header = (const TerrainPackHeader *)map;
+
+	if (!valid(mapSize))
+	{
+		close();
+		return -1;
+	}
+	bits = (const uint64_t *)(map + header->occupancyOffset);
+	return 0;
+}
+
+// Checks a mapped pack's header against its size and its contents against the checksum
+bool TerrainPack::valid(uint64_t size) const
+{
+	if (header->magic != TERRAIN_PACK_MAGIC || header->version != TERRAIN_PACK_VERSION || header->fileSize != size
+		|| header->width == 0 || header->length == 0 || header->width > TERRAIN_PACK_MAX_SIDE
+		|| header->length > TERRAIN_PACK_MAX_SIDE || header->side % 64 != 0
+		|| header->side > TERRAIN_PACK_MAX_SIDE + 64 + 2 * TERRAIN_MAX_RADIUS)
+	{
+		return false;
+	}
+
+	if (header->obstacleOffset != TERRAIN_PACK_ALIGN
+		|| header->occupancyOffset != align(header->obstacleOffset + (uint64_t)header->obstacleCount * sizeof(TerrainObstacle))
+		|| header->payloadOffset != align(header->occupancyOffset + (uint64_t)header->side * header->side / 8)
+		|| header->payloadOffset + header->payloadSize != size)
+	{
+		return false;
+	}
+
+	return checksum(map + TERRAIN_PACK_ALIGN, size - TERRAIN_PACK_ALIGN) == header->checksum;
+}
+
+// Whether world position x, z is blocked; anywhere off the grid is open
+bool TerrainPack::occupied(int32_t x, int32_t z) const
+{
+	if (bits == 0)
+	{
+		return false;
+	}
+	uint32_t column = (uint32_t)(x - header->originX);
+	uint32_t row = (uint32_t)(z - header->originZ);
+	if (column >= header->side || row >= header->side)
+	{
+		return false;
+	}
+	uint64_t cell = (uint64_t)row * header->side + column;
+	return (bits[cell >> 6] >> (cell & 63)) & 1;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: sweep
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: bool sweep(float x, float z, float dx, float dz, float *t) const
+--								x, z: world position at the start of the segment
+--								dx, dz: movement along the segment
+--								t: set to the fraction of the segment at which it first enters an occupied cell
+--
+-- RETURNS: true if the segment enters an occupied cell, false if not or no pack is loaded.
+--
+-- NOTES:
+-- 		Walks the unit cells the segment crosses in order (Amanatides and Woo), so a segment of any length
+--		costs one lookup per cell and cannot skip one. Each point is looked up the way IsOccupied does,
+--		truncated toward zero, so a cell with a negative floor f is the one at f + 1, and the start is
+--		looked up exactly as IsOccupied would.
+--------------------------------------------------------------------------------------------------------------*/
+bool TerrainPack::sweep(float x, float z, float dx, float dz, float *t) const
+{
+	if (bits == 0 || !(fabsf(x) < TERRAIN_SWEEP_MAX && fabsf(z) < TERRAIN_SWEEP_MAX &&
+					   fabsf(dx) < TERRAIN_SWEEP_MAX && fabsf(dz) < TERRAIN_SWEEP_MAX))
+	{
+		return false;
+	}
+
+	if (occupied((int32_t)x, (int32_t)z))
+	{
+		*t = 0;
+		return true;
+	}
+
+	// the cell the segment runs through first; from a cell edge that is the one behind it when moving back
+	int64_t cellX = (int64_t)floor(x);
+	int64_t cellZ = (int64_t)floor(z);
+	int32_t stepX = dx > 0 ? 1 : (dx < 0 ? -1 : 0);
+	int32_t stepZ = dz > 0 ? 1 : (dz < 0 ? -1 : 0);
+	if (stepX < 0 && cellX == x)
+	{
+		cellX--;
+	}
+	if (stepZ < 0 && cellZ == z)
+	{
+		cellZ--;
+	}
+
+	// fraction of the segment at which it crosses into the next column and row, and per column and row after
+	double nextX = stepX > 0 ? (cellX + 1 - (double)x) / dx : (stepX < 0 ? ((double)x - cellX) / -dx : INFINITY);
+	double nextZ = stepZ > 0 ? (cellZ + 1 - (double)z) / dz : (stepZ < 0 ? ((double)z - cellZ) / -dz : INFINITY);
+	double perX = stepX != 0 ? 1.0 / fabs((double)dx) : INFINITY;
+	double perZ = stepZ != 0 ? 1.0 / fabs((double)dz) : INFINITY;
+	double at = 0;
+
+	while (at <= 1.0)
+	{
+		if (occupied((int32_t)(cellX < 0 ? cellX + 1 : cellX), (int32_t)(cellZ < 0 ? cellZ + 1 : cellZ)))
+		{
+			*t = (float)at;
+			return true;
+		}
+
+		if (nextX < nextZ)
+		{
+			at = nextX;
+			nextX += perX;
+			cellX += stepX;
+		}
+		else
+		{
+			at = nextZ;
+			nextZ += perZ;
+			cellZ += stepZ;
+		}
+	}
+	return false;
+}
+
+// Fills a width * length grid from the obstacle list, for code that still wants TerrainController's byte[x, z]
+int32_t TerrainPack::expandTiles(uint8_t *tiles, uint64_t size) const
+{
+	if (map == 0 || size != (uint64_t)header->width * header->length)
+	{
+		return -1;
+	}
+	memset(tiles, TERRAIN_GROUND, size);
+	const TerrainObstacle *obstacle = obstacles();
+	for (uint32_t i = 0; i < header->obstacleCount; i++)
+	{
+		if (obstacle[i].x < header->width && obstacle[i].z < header->length)
+		{
+			tiles[(uint64_t)obstacle[i].x * header->length + obstacle[i].z] = obstacle[i].type;
+		}
+	}
+	return (int32_t)header->obstacleCount;
+}
+
+const TerrainPackHeader *TerrainPack::info() const
+{
+	return header;
+}
+
+const TerrainObstacle *TerrainPack::obstacles() const
+{
+	return map != 0 ? (const TerrainObstacle *)(map + header->obstacleOffset) : 0;
+}
+
+const char *TerrainPack::payload() const
+{
+	return map != 0 ? map + header->payloadOffset : 0;
+}
+
+void TerrainPack::close()
+{
+	if (map != 0)
+	{
+		munmap(map, mapSize);
+	}
+	map = 0;
+	mapSize = 0;
+	header = 0;
+	bits = 0;
+}
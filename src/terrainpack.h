@@ -0,0 +1,87 @@
+#ifndef TERRAINPACK_DEF
+#define TERRAINPACK_DEF
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <math.h>
+
+#define TERRAIN_PACK_MAGIC			0x4B505254	// "TRPK"
+#define TERRAIN_PACK_VERSION		1
+#define TERRAIN_PACK_ALIGN			4096		// sections start on a page, so each maps on its own pages
+#define TERRAIN_PACK_MAX_SIDE		8192		// tiles either way
+#define TERRAIN_PACK_MAX_PAYLOAD	(64 * 1024 * 1024)
+#define TERRAIN_SWEEP_MAX			1048576.0f	// positions and moves beyond this are never swept
+
+// Tile types, as in TerrainController.TileTypes, and the clearance kept around each
+#define TERRAIN_GROUND				0
+#define TERRAIN_CACTUS				1
+#define TERRAIN_BUSH				2
+#define TERRAIN_BUILDING			3
+#define TERRAIN_CACTUS_RADIUS		1
+#define TERRAIN_BUSH_RADIUS			2
+#define TERRAIN_BUILDING_RADIUS		5
+#define TERRAIN_MAX_RADIUS			TERRAIN_BUILDING_RADIUS
+
+// Start of a pack. Offsets are from the start of the file, each a multiple of TERRAIN_PACK_ALIGN.
+struct TerrainPackHeader {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t width;								// tiles
+	uint32_t length;
+	int32_t originX;							// world position of the occupancy grid's first cell
+	int32_t originZ;
+	uint32_t side;								// occupancy cells either way, a multiple of 64
+	uint32_t obstacleCount;
+	uint64_t obstacleOffset;
+	uint64_t occupancyOffset;					// side * side bits, row z then column x, one uint64 per 64 cells
+	uint64_t payloadOffset;
+	uint32_t payloadSize;
+	uint32_t reserved;
+	uint64_t fileSize;
+	uint64_t checksum;							// FNV-1a over everything after the header page
+};
+
+// A tile that is not ground
+struct __attribute__((packed)) TerrainObstacle {
+	uint16_t x;									// tile index, the first index of TerrainController's byte[x, z]
+	uint16_t z;
+	uint8_t type;
+	uint8_t radius;								// clearance kept around it, in tiles
+};
+
+class TerrainPack
+{
+  public:
+	TerrainPack();
+	~TerrainPack();
+	int32_t create(const uint8_t *tiles, uint32_t width, uint32_t length, const int32_t *fixedXZ, uint32_t fixedCount,
+				   const char *payload, uint32_t payloadSize);
+	int32_t save(const char *path);
+	int32_t open(const char *path);
+	bool occupied(int32_t x, int32_t z) const;
+	bool sweep(float x, float z, float dx, float dz, float *t) const;
+	int32_t expandTiles(uint8_t *tiles, uint64_t size) const;
+	const TerrainPackHeader *info() const;
+	const TerrainObstacle *obstacles() const;
+	const char *payload() const;
+	void close();
+
+  private:
+	static uint64_t checksum(const char *data, uint64_t size);
+	static uint64_t align(uint64_t offset);
+	bool valid(uint64_t size) const;
+	void occupy(uint64_t *bits, int32_t x, int32_t z);
+
+	char *map;
+	uint64_t mapSize;
+	const TerrainPackHeader *header;
+	const uint64_t *bits;
+};
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef CHECK_DEF
+#define CHECK_DEF
+
+#include <stdio.h>
+
+// Counts a failed expectation and says where it was; main() returns checkFailures() != 0
+static int checkFailed = 0;
+
+#define CHECK(condition, ...) \
+	do \
+	{ \
+		if (!(condition)) \
+		{ \
+			checkFailed++; \
+			fprintf(stderr, "%s:%d: %s: ", __FILE__, __LINE__, #condition); \
+			fprintf(stderr, __VA_ARGS__); \
+			fprintf(stderr, "\n"); \
+		} \
+	} while (0)
+
+static int checkFailures(const char *name)
+{
+	printf("%s: %s\n", name, checkFailed == 0 ? "ok" : "FAILED");
+	return checkFailed;
+}
+
+#endif
@@ -0,0 +1,151 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	fragmenttest.cpp -   Checks of fragmenting and reassembling large messages
+--
+--	PROGRAM:		fragmenttest (make test)
+--
+--	FUNCTIONS:		int main()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Messages at the fragment boundaries are cut with fragWrite and fed back through a
+--		Reassembler in order and in reverse, and must come back byte for byte. Duplicates, late
+--		fragments, malformed fragments and more incomplete messages than there are slots must
+--		each be dropped and counted in the matching ReassemblyStats field.
+---------------------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <vector>
+#include "../fragment.h"
+#include "check.h"
+
+#define NOW							1000000000ull
+#define LATER						(NOW + FRAG_TIMEOUT_NS + 1)
+
+// Cuts message into fragments, each its own datagram
+static std::vector<std::vector<char> > cut(uint32_t id, const std::vector<char> &message)
+{
+	std::vector<std::vector<char> > fragments;
+	int32_t count = fragCount(message.size());
+	for (int32_t i = 0; i < count; i++)
+	{
+		std::vector<char> fragment(FRAG_MTU);
+		int32_t len = fragWrite(&fragment[0], id, i, message.empty() ? 0 : &message[0], message.size());
+		CHECK(len > FRAG_HEADER_SIZE && len <= FRAG_MTU, "fragment %d of %u bytes is %d", i,
+			(uint32_t)message.size(), len);
+		fragment.resize(len < 0 ? 0 : len);
+		fragments.push_back(fragment);
+	}
+	return fragments;
+}
+
+static void roundTrips()
+{
+	const uint32_t lengths[] = { 1, FRAG_PAYLOAD, FRAG_PAYLOAD + 1, FRAG_PAYLOAD * 3 - 7, FRAG_MAX_MESSAGE };
+	Reassembler reassembler;
+	uint32_t id = 1;
+
+	for (uint32_t l = 0; l < sizeof(lengths) / sizeof(lengths[0]); l++)
+	{
+		for (int32_t reverse = 0; reverse < 2; reverse++, id++)
+		{
+			std::vector<char> message(lengths[l]);
+			for (uint32_t i = 0; i < message.size(); i++)
+			{
+				message[i] = (char)rand();
+			}
+			std::vector<std::vector<char> > fragments = cut(id, message);
+
+			int32_t len = 0;
+			char *got = 0;
+			for (uint32_t i = 0; i < fragments.size(); i++)
+			{
+				std::vector<char> &fragment = fragments[reverse ? fragments.size() - 1 - i : i];
+				len = reassembler.add(&fragment[0], fragment.size(), NOW, &got);
+				if (i + 1 < fragments.size())
+				{
+					CHECK(len == 0, "%u bytes: fragment %u gave %d", lengths[l], i, len);
+				}
+			}
+			CHECK(len == (int32_t)lengths[l] && memcmp(got, &message[0], lengths[l]) == 0,
+				"%u bytes%s: came back as %d bytes", lengths[l], reverse ? " reversed" : "", len);
+		}
+	}
+
+	CHECK(fragCount(FRAG_MAX_MESSAGE) == FRAG_MAX_FRAGMENTS, "%d fragments for the largest message",
+		fragCount(FRAG_MAX_MESSAGE));
+	CHECK(fragCount(FRAG_MAX_MESSAGE + 1) == -1, "a message over FRAG_MAX_MESSAGE is cut");
+
+	ReassemblyStats stats;
+	reassembler.getStats(&stats);
+	CHECK(stats.completed == id - 1, "%llu completed, want %u", (unsigned long long)stats.completed, id - 1);
+	CHECK(stats.duplicates + stats.expired + stats.evicted + stats.malformed == 0, "drops on clean round trips");
+}
+
+static void drops()
+{
+	Reassembler reassembler;
+	ReassemblyStats stats;
+	char *got = 0;
+	std::vector<char> message(FRAG_PAYLOAD * 2 + 10, 'm');
+
+	// A fragment of a message already put back together
+	std::vector<std::vector<char> > done = cut(1, message);
+	for (uint32_t i = 0; i < done.size(); i++)
+	{
+		reassembler.add(&done[i][0], done[i].size(), NOW, &got);
+	}
+	CHECK(reassembler.add(&done[1][0], done[1].size(), NOW, &got) < 0, "late duplicate accepted");
+	std::vector<std::vector<char> > twice = cut(2, message);
+	reassembler.add(&twice[0][0], twice[0].size(), NOW, &got);
+	CHECK(reassembler.add(&twice[0][0], twice[0].size(), NOW, &got) == 0, "duplicate while assembling");
+	reassembler.getStats(&stats);
+	CHECK(stats.duplicates == 2, "%llu duplicates, want 2", (unsigned long long)stats.duplicates);
+
+	// Message 2 is still incomplete once FRAG_TIMEOUT_NS has passed; its last fragment starts it again
+	CHECK(reassembler.add(&twice[2][0], twice[2].size(), LATER, &got) == 0,
+		"expired message completed");
+	reassembler.getStats(&stats);
+	CHECK(stats.expired == 1, "%llu expired, want 1", (unsigned long long)stats.expired);
+
+	// Malformed: header only, index past count, a short fragment that is not the last, a foreign datagram
+	std::vector<char> bad = done[0];
+	CHECK(reassembler.add(&bad[0], FRAG_HEADER_SIZE, LATER, &got) < 0, "empty fragment accepted");
+	FragmentView view(&bad[0]);
+	view.id(3);
+	view.index(view.count());
+	CHECK(reassembler.add(&bad[0], bad.size(), LATER, &got) < 0, "index past count accepted");
+	view.index(0);
+	CHECK(reassembler.add(&bad[0], bad.size() - 1, LATER, &got) < 0, "short middle fragment accepted");
+	bad[0] = FRAG_HEADER + 1;
+	CHECK(reassembler.add(&bad[0], bad.size(), LATER, &got) < 0, "foreign datagram accepted");
+	reassembler.getStats(&stats);
+	CHECK(stats.malformed == 4, "%llu malformed, want 4", (unsigned long long)stats.malformed);
+
+	// One more incomplete message than there are slots; 2 holds one already and is the oldest
+	for (uint32_t id = 10; id < 10 + FRAG_SLOTS; id++)
+	{
+		std::vector<std::vector<char> > fragments = cut(id, message);
+		reassembler.add(&fragments[0][0], fragments[0].size(), LATER + id, &got);
+	}
+	reassembler.getStats(&stats);
+	CHECK(stats.evicted == 1, "%llu evicted, want 1", (unsigned long long)stats.evicted);
+	CHECK(reassembler.add(&twice[0][0], twice[0].size(), LATER + 100, &got) == 0
+		&& reassembler.add(&twice[1][0], twice[1].size(), LATER + 100, &got) == 0,
+		"evicted message completed without its last fragment");
+	reassembler.getStats(&stats);
+	CHECK(stats.completed == 1, "%llu completed, want 1", (unsigned long long)stats.completed);
+}
+
+int main()
+{
+	srand(13);
+	roundTrips();
+	drops();
+	return checkFailures("fragmenttest") == 0 ? 0 : 1;
+}
@@ -0,0 +1,286 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	snapcodectest.cpp -   Round trips of fixed and wide snapshots through snapcodec
+--
+--	PROGRAM:		snapcodectest (make test)
+--
+--	FUNCTIONS:		int main()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Random snapshots in both layouts are packed and unpacked again. Everything but the
+--		positions and rotations must come back exactly; those must be within half a step of what
+--		was packed. Fixed snapshots must pack into SNAP_MAX_PACKED, and truncated or foreign
+--		datagrams must not unpack. Snapshots trimmed to the events snapFit lets through must pack
+--		within the budget it was given, and one more bullet must not.
+---------------------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include "../snapcodec.h"
+#include "check.h"
+
+#define CODEC_CASES					2000
+#define CODEC_POS_TOLERANCE			(0.5f / SNAP_POS_SCALE + 1e-4f)
+#define CODEC_ROT_TOLERANCE			(180.0f / (1 << SNAP_ROT_BITS) + 1e-3f)
+
+#define MAX_PLAYERS					((TICK_BULLETS - TICK_PLAYERS) / TICK_PLAYER_SIZE)
+#define MAX_BULLETS					((TICK_WEAPONS - TICK_BULLETS - 1) / TICK_BULLET_SIZE)
+#define MAX_WEAPONS					((TICK_SEQ - TICK_WEAPONS - 1) / TICK_WEAPON_SIZE)
+
+static float randomPos()
+{
+	return (rand() % 400000) / 100.0f - 2000;
+}
+
+static void randomBytes(char *p, uint32_t len)
+{
+	for (uint32_t i = 0; i < len; i++)
+	{
+		p[i] = (char)rand();
+	}
+}
+
+static void putFloat(char *p, float f)
+{
+	memcpy(p, &f, sizeof(f));
+}
+
+static float getFloat(const char *p)
+{
+	float f;
+	memcpy(&f, p, sizeof(f));
+	return f;
+}
+
+// Fills tick with a random snapshot of the given counts; absent sections are zero, as snapUnpack leaves them
+static uint32_t randomTick(std::vector<char> &tick, bool wide, uint32_t players, uint32_t bullets, uint32_t weapons)
+{
+	uint8_t header = TICK_HAS_PLAYERS | (wide ? TICK_WIDE : players);
+	header |= bullets > 0 || rand() % 4 == 0 ? TICK_HAS_BULLETS : 0;
+	header |= weapons > 0 || rand() % 4 == 0 ? TICK_HAS_WEAPONS : 0;
+
+	uint32_t size = wide ? TICK_WIDE_SIZE(players, bullets, weapons) : TICK_SIZE;
+	memset(&tick[0], 0, tick.size());
+	tick[0] = (char)header;
+	putFloat(&tick[TICK_DANGER_ZONE], randomPos());
+	putFloat(&tick[TICK_DANGER_ZONE + 4], randomPos());
+	putFloat(&tick[TICK_DANGER_ZONE + 8], (rand() % 200000) / 100.0f);
+	randomBytes(&tick[TICK_TIME], 4);
+	randomBytes(&tick[TICK_HEALTH], TICK_PLAYERS - TICK_HEALTH);
+
+	uint32_t playersAt = TICK_PLAYERS;
+	if (wide)
+	{
+		uint16_t count = (uint16_t)players;
+		memcpy(&tick[TICK_WIDE_COUNT], &count, sizeof(uint16_t));
+		playersAt = TICK_WIDE_PLAYERS;
+	}
+	for (uint32_t i = 0; i < players; i++)
+	{
+		PlayerRecordView p(&tick[playersAt + i * TICK_PLAYER_SIZE]);
+		p.id((uint8_t)rand());
+		p.x(randomPos());
+		p.z(randomPos());
+		p.r((rand() % 72000) / 100.0f - 360);
+		p.weapon((uint8_t)rand());
+	}
+
+	uint32_t bulletsAt = wide ? playersAt + players * TICK_PLAYER_SIZE : TICK_BULLETS;
+	tick[bulletsAt] = (char)bullets;
+	randomBytes(&tick[bulletsAt + 1], bullets * TICK_BULLET_SIZE);
+
+	uint32_t weaponsAt = wide ? bulletsAt + 1 + bullets * TICK_BULLET_SIZE : TICK_WEAPONS;
+	tick[weaponsAt] = (char)weapons;
+	randomBytes(&tick[weaponsAt + 1], weapons * TICK_WEAPON_SIZE);
+
+	randomBytes(&tick[size - 4], 4);
+	return size;
+}
+
+static bool near(float a, float b, float tolerance)
+{
+	return fabsf(a - b) <= tolerance;
+}
+
+static bool nearAngle(float a, float b)
+{
+	float d = fmodf(fabsf(a - b), 360.0f);
+	return d <= CODEC_ROT_TOLERANCE || 360.0f - d <= CODEC_ROT_TOLERANCE;
+}
+
+// Compares what came back against what was packed; returns false after reporting the first difference
+static bool compare(const std::vector<char> &sent, const std::vector<char> &got, uint32_t size)
+{
+	TickLayout layout;
+	tickLayout(&sent[0], size, &layout);
+
+	if (memcmp(&sent[0], &got[0], TICK_DANGER_ZONE) != 0 || memcmp(&sent[TICK_TIME], &got[TICK_TIME],
+		layout.playersAt - TICK_TIME) != 0)
+	{
+		CHECK(false, "header, time, health or inventory differ");
+		return false;
+	}
+	for (int32_t i = 0; i < 3; i++)
+	{
+		float a = getFloat(&sent[TICK_DANGER_ZONE + i * 4]);
+		float b = getFloat(&got[TICK_DANGER_ZONE + i * 4]);
+		if (!near(a, b, CODEC_POS_TOLERANCE))
+		{
+			CHECK(false, "danger zone %d: %f came back as %f", i, a, b);
+			return false;
+		}
+	}
+
+	for (uint32_t i = 0; i < layout.players; i++)
+	{
+		PlayerRecordView a((char *)&sent[layout.playersAt + i * TICK_PLAYER_SIZE]);
+		PlayerRecordView b((char *)&got[layout.playersAt + i * TICK_PLAYER_SIZE]);
+		if (a.id() != b.id() || a.weapon() != b.weapon() || !near(a.x(), b.x(), CODEC_POS_TOLERANCE)
+			|| !near(a.z(), b.z(), CODEC_POS_TOLERANCE) || !nearAngle(a.r(), b.r()))
+		{
+			CHECK(false, "player %u: %u (%f, %f) %f %u came back as %u (%f, %f) %f %u", i, a.id(), a.x(), a.z(),
+				a.r(), a.weapon(), b.id(), b.x(), b.z(), b.r(), b.weapon());
+			return false;
+		}
+	}
+
+	uint32_t rest = layout.bulletsAt;
+	if (memcmp(&sent[rest], &got[rest], size - rest) != 0)
+	{
+		CHECK(false, "bullets, weapons or sequence differ");
+		return false;
+	}
+	return true;
+}
+
+static void roundTrips(bool wide)
+{
+	std::vector<char> tick(TICK_WIDE_MAX_SIZE);
+	std::vector<char> back(TICK_WIDE_MAX_SIZE);
+	std::vector<char> packed(TICK_WIDE_MAX_SIZE);
+
+	for (int32_t i = 0; i < CODEC_CASES; i++)
+	{
+		uint32_t players = wide ? rand() % (TICK_WIDE_MAX_PLAYERS + 1) : rand() % (MAX_PLAYERS + 1);
+		uint32_t bullets = wide ? rand() % (TICK_WIDE_MAX_EVENTS + 1) : rand() % (MAX_BULLETS + 1);
+		uint32_t weapons = wide ? rand() % (TICK_WIDE_MAX_EVENTS + 1) : rand() % (MAX_WEAPONS + 1);
+		if (i == 0)
+		{
+			players = wide ? TICK_WIDE_MAX_PLAYERS : MAX_PLAYERS;
+			bullets = wide ? TICK_WIDE_MAX_EVENTS : MAX_BULLETS;
+			weapons = wide ? TICK_WIDE_MAX_EVENTS : MAX_WEAPONS;
+		}
+		uint32_t size = randomTick(tick, wide, players, bullets, weapons);
+
+		int32_t len = snapPack(&tick[0], size, &packed[0], packed.size());
+		if (len < 0)
+		{
+			CHECK(false, "%u players, %u bullets, %u weapons: not packed", players, bullets, weapons);
+			return;
+		}
+		if (!wide && len > SNAP_MAX_PACKED)
+		{
+			CHECK(false, "%u players, %u bullets, %u weapons: packed to %d, over %d", players, bullets, weapons,
+				len, SNAP_MAX_PACKED);
+			return;
+		}
+
+		int32_t got = snapUnpack(&packed[0], len, &back[0], back.size());
+		if (got != (int32_t)size)
+		{
+			CHECK(false, "%u players, %u bullets, %u weapons: unpacked to %d, want %u", players, bullets, weapons,
+				got, size);
+			return;
+		}
+		if (!compare(tick, back, size))
+		{
+			return;
+		}
+
+		CHECK(snapUnpack(&packed[0], len - 1, &back[0], back.size()) < 0, "truncated snapshot unpacked");
+	}
+}
+
+static void rejects()
+{
+	std::vector<char> tick(TICK_WIDE_MAX_SIZE);
+	std::vector<char> back(TICK_WIDE_MAX_SIZE);
+	char packed[SNAP_MAX_PACKED];
+
+	uint32_t size = randomTick(tick, false, 4, 2, 2);
+	int32_t len = snapPack(&tick[0], size, packed, sizeof(packed));
+	CHECK(len > 0, "not packed");
+	CHECK(snapUnpack(packed, len, &back[0], TICK_SIZE - 1) < 0, "unpacked into a short buffer");
+	CHECK(snapPack(&tick[0], size - 1, packed, sizeof(packed)) < 0, "short fixed snapshot packed");
+	CHECK(snapPack(&tick[0], size, packed, 8) < 0, "packed into 8 bytes");
+
+	packed[0] = SNAP_PACKED + 1;
+	CHECK(snapUnpack(packed, len, &back[0], back.size()) < 0, "foreign datagram unpacked");
+
+	size = randomTick(tick, true, 40, 0, 0);
+	CHECK(snapPack(&tick[0], size - 1, packed, sizeof(packed)) < 0, "short wide snapshot packed");
+	uint16_t count = TICK_WIDE_MAX_PLAYERS + 1;
+	memcpy(&tick[TICK_WIDE_COUNT], &count, sizeof(uint16_t));
+	CHECK(snapPack(&tick[0], tick.size(), packed, sizeof(packed)) < 0, "%u players packed", count);
+}
+
+// Trims random snapshots to what snapFit says fits a random budget; one more bullet must not fit
+static void fits()
+{
+	std::vector<char> tick(TICK_WIDE_MAX_SIZE);
+	char packed[SNAP_MAX_PACKED];
+
+	for (int32_t i = 0; i < CODEC_CASES; i++)
+	{
+		uint32_t players = rand() % (MAX_PLAYERS + 1);
+		uint32_t bullets = rand() % (MAX_BULLETS + 1);
+		uint32_t size = randomTick(tick, false, players, bullets, rand() % (MAX_WEAPONS + 1));
+		uint32_t budget = 200 + rand() % 700;
+
+		uint32_t fitBullets;
+		uint32_t fitWeapons;
+		if (snapFit(&tick[0], size, budget, &fitBullets, &fitWeapons) < 0)
+		{
+			CHECK(false, "not fitted");
+			return;
+		}
+		tick[TICK_BULLETS] = (char)fitBullets;
+		tick[TICK_WEAPONS] = (char)fitWeapons;
+		int32_t len = snapPack(&tick[0], size, packed, sizeof(packed));
+		if (len > (int32_t)budget && fitBullets + fitWeapons > 1)
+		{
+			CHECK(false, "%u players, %u bullets, %u weapons: packed to %d, over %u", players, fitBullets,
+				fitWeapons, len, budget);
+			return;
+		}
+
+		if (fitBullets < bullets)
+		{
+			tick[TICK_BULLETS] = (char)(fitBullets + 1);
+			len = snapPack(&tick[0], size, packed, sizeof(packed));
+			if (len <= (int32_t)budget)
+			{
+				CHECK(false, "%u players: %u of %u bullets fitted in %u, but %u pack to %d", players, fitBullets,
+					bullets, budget, fitBullets + 1, len);
+				return;
+			}
+		}
+	}
+}
+
+int main()
+{
+	srand(11);
+	roundTrips(false);
+	roundTrips(true);
+	rejects();
+	fits();
+	return checkFailures("snapcodectest") == 0 ? 0 : 1;
+}
@@ -0,0 +1,135 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	sweeptest.cpp -   Checks of the swept bullet tests against players and terrain
+--
+--	PROGRAM:		sweeptest (make test)
+--
+--	FUNCTIONS:		int main()
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Player sweeps are checked against hand worked cases: a bullet that crosses a player inside
+--		one tick with both ends clear of them, the shooter being skipped, the nearer of two players,
+--		a player walking into the bullet's path and a bullet that starts inside a player.
+--
+--		Terrain sweeps are checked against brute force: SWEEP_SAMPLES points along each of
+--		SWEEP_CASES random moves over random obstacles, the first one occupied() reports being
+--		where the sweep should stop.
+---------------------------------------------------------------------------------------*/
+#include <stdlib.h>
+#include <math.h>
+#include <vector>
+#include "../sweep.h"
+#include "check.h"
+
+#define SWEEP_CASES					5000
+#define SWEEP_SAMPLES				100000
+#define SWEEP_TOLERANCE				1e-4f
+
+static void playerCases()
+{
+	PositionHistory history;
+	history.beginTick(10);
+	history.store(1, 0, 0, 0);
+	history.store(2, 5, 5, 0);
+	history.store(3, 20, 0, 0);
+	history.store(4, 6, 0.5f, 0);
+	history.beginTick(11);
+	history.store(1, 0, 0, 0);
+	history.store(2, 5, 5, 0);
+	history.store(3, 20, 4, 0);
+	history.store(4, 6, 0.5f, 0);
+
+	SweepBullet bullets[5] = {
+		{ -3, 0.5f, 6, 0, 1.1f, 10, 9, SWEEP_PLAYER },		// through player 1, both ends clear of them
+		{ -3, 0.5f, 6, 0, 1.1f, 10, 1, SWEEP_PLAYER },		// the same, fired by player 1; 4 is past its end
+		{ 20, 3, 0.01f, 0, 1.1f, 10, 9, SWEEP_PLAYER },		// player 3 walks into it
+		{ 5, 5.5f, 1, 0, 1.1f, 10, 9, SWEEP_PLAYER },		// starts inside player 2
+		{ -3, 0.5f, 10, 0, 1.1f, 10, 9, SWEEP_PLAYER },		// players 1 and 4 on the way, 1 first
+	};
+	SweepHit hits[5];
+	int32_t hitCount = sweepBullets(&history, 0, bullets, hits, 5);
+
+	float crossing = (3 - sqrtf(1.1f * 1.1f - 0.25f)) / 6;
+	CHECK(hits[0].kind == SWEEP_PLAYER && hits[0].id == 1, "tunnelling bullet: kind %u id %d", hits[0].kind, hits[0].id);
+	CHECK(fabsf(hits[0].t - crossing) < SWEEP_TOLERANCE, "tunnelling bullet: t %f, want %f", hits[0].t, crossing);
+	CHECK(hits[1].kind == SWEEP_NONE && hits[1].id == -1 && hits[1].t == 1, "shooter: kind %u id %d t %f",
+		hits[1].kind, hits[1].id, hits[1].t);
+	CHECK(hits[2].kind == SWEEP_PLAYER && hits[2].id == 3, "moving player: kind %u id %d", hits[2].kind, hits[2].id);
+	CHECK(fabsf(hits[2].t - 1.9f / 4) < 1e-3f, "moving player: t %f, want %f", hits[2].t, 1.9f / 4);
+	CHECK(hits[3].kind == SWEEP_PLAYER && hits[3].id == 2 && hits[3].t == 0, "inside: kind %u id %d t %f",
+		hits[3].kind, hits[3].id, hits[3].t);
+	CHECK(hits[4].kind == SWEEP_PLAYER && hits[4].id == 1, "nearest: id %d", hits[4].id);
+	CHECK(hitCount == 4, "%d hits, want 4", hitCount);
+}
+
+static void terrainCases()
+{
+	const uint32_t width = 200;
+	const uint32_t length = 200;
+	std::vector<uint8_t> tiles(width * length, TERRAIN_GROUND);
+	srand(7);
+	for (int32_t i = 0; i < 300; i++)
+	{
+		tiles[(rand() % width) * length + rand() % length] = (uint8_t)(1 + rand() % 3);
+	}
+
+	TerrainPack pack;
+	CHECK(pack.create(&tiles[0], width, length, 0, 0, "x", 1) == 0, "pack not created");
+
+	int32_t hitCount = 0;
+	int32_t mismatches = 0;
+	for (int32_t i = 0; i < SWEEP_CASES; i++)
+	{
+		float x = (rand() % 20000) / 100.0f - 100;
+		float z = (rand() % 20000) / 100.0f - 100;
+		float dx = (rand() % 800) / 100.0f - 4;
+		float dz = (rand() % 800) / 100.0f - 4;
+
+		float t;
+		bool hit = pack.sweep(x, z, dx, dz, &t);
+
+		float first = -1;
+		for (int32_t s = 0; s <= SWEEP_SAMPLES; s++)
+		{
+			double f = (double)s / SWEEP_SAMPLES;
+			if (pack.occupied((int32_t)(x + dx * f), (int32_t)(z + dz * f)))
+			{
+				first = (float)f;
+				break;
+			}
+		}
+
+		hitCount += hit ? 1 : 0;
+		if (hit != (first >= 0) || (hit && fabsf(t - first) > SWEEP_TOLERANCE))
+		{
+			if (++mismatches <= 5)
+			{
+				fprintf(stderr, "(%f, %f) by (%f, %f): sweep %d at %f, sampled %f\n", x, z, dx, dz, hit,
+					hit ? t : -1, first);
+			}
+		}
+	}
+	CHECK(mismatches == 0, "%d of %d terrain sweeps disagree with sampling", mismatches, SWEEP_CASES);
+	CHECK(hitCount > 0 && hitCount < SWEEP_CASES, "%d of %d terrain sweeps hit", hitCount, SWEEP_CASES);
+
+	PositionHistory history;
+	history.beginTick(10);
+	SweepBullet outside = { -100.5f, 0.5f, 0.6f, 0, 1.1f, 10, 9, SWEEP_TERRAIN | SWEEP_PLAYER };
+	SweepHit hit;
+	sweepBullets(&history, &pack, &outside, &hit, 1);
+	CHECK(hit.kind == SWEEP_NONE, "off the map: kind %u", hit.kind);
+}
+
+int main()
+{
+	playerCases();
+	terrainCases();
+	return checkFailures("sweeptest") == 0 ? 0 : 1;
+}
@@ -0,0 +1,53 @@
+#ifndef TICKPACKET_DEF
+#define TICKPACKET_DEF
+
+#include "packetschema.h"
+
+// Layout of the tick packets in both directions, from packets.def like R.Net.Offset and R.Net.Size in R.cs
+
+#define TICK_DANGER_ZONE			ServerTickView::zoneX_at
+#define TICK_TIME					ServerTickView::time_at
+#define TICK_HEALTH					ServerTickView::health_at
+#define TICK_INVENTORY				ServerTickView::inventory_at
+#define TICK_PLAYERS				ServerTickView::players_at
+#define TICK_BULLETS				ServerTickView::bullets_at
+#define TICK_WEAPONS				ServerTickView::weapons_at
+#define TICK_SEQ					ServerTickView::seq_at			// uint32 sequence number, see connstats.cpp
+#define TICK_SIZE					ServerTickView::SIZE
+
+#define TICK_PLAYER_SIZE			PlayerRecordView::SIZE
+#define TICK_BULLET_SIZE			BulletRecordView::SIZE
+#define TICK_WEAPON_SIZE			WeaponRecordView::SIZE
+
+// Header byte flags; the low five bits carry the player count
+#define TICK_HAS_PLAYERS			0x80
+#define TICK_HAS_BULLETS			0x40
+#define TICK_HAS_WEAPONS			0x20
+
+// A player count of TICK_WIDE in the header marks the wide layout, for more players than the fixed
+// one holds. It matches the fixed layout up to TICK_PLAYERS, then sizes each section to its contents:
+//	[uint16 player count][players][bullet count][bullets][weapon count][weapons][uint32 sequence]
+// A wide snapshot larger than one datagram is sent in fragments, see fragment.cpp.
+#define TICK_WIDE					0x1F
+#define TICK_WIDE_COUNT				TICK_PLAYERS
+#define TICK_WIDE_PLAYERS			(TICK_WIDE_COUNT + 2)
+#define TICK_WIDE_MAX_PLAYERS		255			// player ids are one byte
+#define TICK_WIDE_MAX_EVENTS		255			// section counts are one byte
+#define TICK_WIDE_SIZE(players, bullets, weapons) \
+	(TICK_WIDE_PLAYERS + (players) * TICK_PLAYER_SIZE + 1 + (bullets) * TICK_BULLET_SIZE + 1 + (weapons) * TICK_WEAPON_SIZE + 4)
+#define TICK_WIDE_MAX_SIZE			TICK_WIDE_SIZE(TICK_WIDE_MAX_PLAYERS, TICK_WIDE_MAX_EVENTS, TICK_WIDE_MAX_EVENTS)
+
+// Client to server tick; the ack fields echo the snapshot sequence numbers received and the clock
+// fields time them on the client, see ConnStats::onClock
+#define CLIENT_TICK_ACK				ClientTickView::ack_at
+#define CLIENT_TICK_ACK_BITS		ClientTickView::ackBits_at
+#define CLIENT_TICK_CLIENT_TIME		ClientTickView::clientTime_at
+#define CLIENT_TICK_ACK_DELAY		ClientTickView::ackDelay_at
+#define CLIENT_TICK_NO_CLOCK		CLIENT_TICK_CLIENT_TIME		// size of a tick from before the clock fields
+#define CLIENT_TICK_SIZE			ClientTickView::SIZE
+
+// Event section types written by Client::recvLatest, laid out as [type][count][count records]
+#define TICK_EVENT_BULLETS			1
+#define TICK_EVENT_WEAPONS			2
+
+#endif
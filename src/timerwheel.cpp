@@ -0,0 +1,365 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	timerwheel.cpp -   Hierarchical timer wheel for per-connection timers
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		TimerWheel();
+--					int32_t init(uint32_t capacity);
+--					int32_t schedule(uint32_t kind, uint32_t key, uint32_t delayMs);
+--					int32_t reschedule(int32_t handle, uint32_t delayMs);
+--					int32_t cancel(int32_t handle);
+--					int32_t advance(TimerFired *out, uint32_t max);
+--					uint32_t pending();
+--					uint64_t now();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		Keepalives, idle timeouts and retransmits for every connection, each a one-shot timer
+--		naming a kind and a key (a player id, say) that the owner acts on when it expires.
+--
+--		TIMER_LEVELS levels of TIMER_SLOTS slots at 1 ms. A timer goes in the lowest level whose
+--		span covers its delay, in the slot for its due time; when a level's index wraps, the next
+--		level's current slot is cascaded down. Each slot is an intrusive doubly linked list through
+--		a pool of timers allocated by init(), so scheduling, rescheduling and cancelling are O(1)
+--		and nothing is allocated after init().
+--
+--		A handle is a pool index with a generation count above it, so a handle kept after its
+--		timer expired or was cancelled is refused instead of touching the timer that reused the
+--		entry. Handles are always positive; 0 is never a valid handle.
+--
+--		Everything takes the wheel's lock, so timers can be scheduled from the receive thread
+--		while the send thread advances.
+---------------------------------------------------------------------------------------*/
+#include "timerwheel.h"
+
+TimerWheel::TimerWheel()
+{
+	timers = 0;
+	capacity = 0;
+	freeList = TIMER_NONE;
+	active = 0;
+	for (int32_t i = 0; i < TIMER_LEVELS * TIMER_SLOTS; i++)
+	{
+		buckets[i] = TIMER_NONE;
+	}
+	cursor = 0;
+	cascaded = false;
+}
+
+TimerWheel::~TimerWheel()
+{
+	delete[] timers;
+}
+
+// Milliseconds on CLOCK_MONOTONIC, the wheel's time base
+uint64_t TimerWheel::now()
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000 + ts.tv_nsec / 1000000;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: init
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t init(uint32_t capacity)
+--								capacity: timers pending at once, at most TIMER_MAX_CAPACITY
+--
+-- RETURNS: 0 on success, or -1 if capacity is out of range or the wheel is already initialised.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TimerWheel::init(uint32_t count)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (timers != 0 || count == 0 || count > TIMER_MAX_CAPACITY)
+	{
+		return -1;
+	}
+
+	timers = new Timer[count];
+	capacity = count;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		timers[i].next = i + 1 < count ? (int32_t)i + 1 : TIMER_NONE;
+		timers[i].prev = TIMER_NONE;
+		timers[i].generation = 1;
+		timers[i].bucket = TIMER_NONE;
+	}
+	freeList = 0;
+	cursor = now();
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: schedule
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t schedule(uint32_t kind, uint32_t key, uint32_t delayMs)
+--								kind, key: handed back by advance() when the timer expires
+--								delayMs: how long from now
+--
+-- RETURNS: a handle for the timer, or -1 if every timer in the pool is pending.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TimerWheel::schedule(uint32_t kind, uint32_t key, uint32_t delayMs)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	if (freeList == TIMER_NONE)
+	{
+		return -1;
+	}
+
+	int32_t index = freeList;
+	Timer &timer = timers[index];
+	freeList = timer.next;
+
+	timer.kind = kind;
+	timer.key = key;
+	timer.due = now() + delayMs;
+	link(index);
+	active++;
+	return (int32_t)timer.generation << 16 | index;
+}
+
+// Moves a pending timer to delayMs from now, keeping its handle
+int32_t TimerWheel::reschedule(int32_t handle, uint32_t delayMs)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int32_t index = lookup(handle);
+	if (index < 0)
+	{
+		return -1;
+	}
+
+	unlink(index);
+	timers[index].due = now() + delayMs;
+	link(index);
+	return 0;
+}
+
+int32_t TimerWheel::cancel(int32_t handle)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	int32_t index = lookup(handle);
+	if (index < 0)
+	{
+		return -1;
+	}
+
+	unlink(index);
+	Timer &timer = timers[index];
+	timer.bucket = TIMER_NONE;
+	timer.generation = timer.generation % 0x7FFF + 1;
+	timer.next = freeList;
+	freeList = index;
+	active--;
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: advance
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t advance(TimerFired *out, uint32_t max)
+--								out: receives the timers that expired, in due order
+--								max: room in out
+--
+-- RETURNS: the number of timers written to out.
+--
+-- NOTES:
+-- 		Expires everything due up to now. When out fills first, the rest stay pending for the next call,
+--		so a caller loops while the count comes back equal to max. An expired timer's handle is dead.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t TimerWheel::advance(TimerFired *out, uint32_t max)
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return expireUntil(now(), out, max);
+}
+
+uint32_t TimerWheel::pending()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	return active;
+}
+
+int32_t TimerWheel::expireUntil(uint64_t nowMs, TimerFired *out, uint32_t max)
+{
+	uint32_t fired = 0;
+
+	while (cursor <= nowMs)
+	{
+		if (active == 0)
+		{
+			cursor = nowMs + 1;
+			cascaded = false;
+			break;
+		}
+
+		if (!cascaded)
+		{
+			for (uint32_t level = 1; level < TIMER_LEVELS; level++)
+			{
+				if ((cursor & ((1ull << (TIMER_SLOT_BITS * level)) - 1)) != 0)
+				{
+					break;
+				}
+				cascade(level);
+			}
+			cascaded = true;
+		}
+
+		int32_t *head = &buckets[cursor & (TIMER_SLOTS - 1)];
+		while (*head != TIMER_NONE)
+		{
+			if (fired == max)
+			{
+				return fired;
+			}
+
+			int32_t index = *head;
+			Timer &timer = timers[index];
+			unlink(index);
+			out[fired].kind = timer.kind;
+			out[fired].key = timer.key;
+			fired++;
+
+			timer.bucket = TIMER_NONE;
+			timer.generation = timer.generation % 0x7FFF + 1;
+			timer.next = freeList;
+			freeList = index;
+			active--;
+		}
+
+		cursor++;
+		cascaded = false;
+	}
+	return fired;
+}
+
+int32_t TimerWheel::lookup(int32_t handle)
+{
+	int32_t index = handle & 0xFFFF;
+	if (handle <= 0 || (uint32_t)index >= capacity)
+	{
+		return -1;
+	}
+
+	Timer &timer = timers[index];
+	if (timer.bucket == TIMER_NONE || timer.generation != (uint16_t)(handle >> 16))
+	{
+		return -1;
+	}
+	return index;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: link
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void link(int32_t index)
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Puts a timer at the head of the slot for its due time, in the lowest level whose span covers the
+--		time left. A timer already due goes in the slot expired next; one beyond the top level's span
+--		goes in the top level's furthest slot and is placed again when that slot cascades.
+--------------------------------------------------------------------------------------------------------------*/
+void TimerWheel::link(int32_t index)
+{
+	Timer &timer = timers[index];
+	uint64_t due = timer.due > cursor ? timer.due : cursor;
+	uint64_t delta = due - cursor;
+
+	uint32_t level = 0;
+	while (level < TIMER_LEVELS - 1 && delta >= 1ull << (TIMER_SLOT_BITS * (level + 1)))
+	{
+		level++;
+	}
+	if (delta >= 1ull << (TIMER_SLOT_BITS * TIMER_LEVELS))
+	{
+		due = cursor + (1ull << (TIMER_SLOT_BITS * TIMER_LEVELS)) - 1;
+	}
+
+	uint32_t slot = (uint32_t)(due >> (TIMER_SLOT_BITS * level)) & (TIMER_SLOTS - 1);
+	int16_t bucket = (int16_t)(level * TIMER_SLOTS + slot);
+
+	timer.bucket = bucket;
+	timer.prev = TIMER_NONE;
+	timer.next = buckets[bucket];
+	if (timer.next != TIMER_NONE)
+	{
+		timers[timer.next].prev = index;
+	}
+	buckets[bucket] = index;
+}
+
+void TimerWheel::unlink(int32_t index)
+{
+	Timer &timer = timers[index];
+	if (timer.prev != TIMER_NONE)
+	{
+		timers[timer.prev].next = timer.next;
+	}
+	else
+	{
+		buckets[timer.bucket] = timer.next;
+	}
+	if (timer.next != TIMER_NONE)
+	{
+		timers[timer.next].prev = timer.prev;
+	}
+}
+
+// Re-places every timer in level's current slot; they all land in lower levels
+void TimerWheel::cascade(uint32_t level)
+{
+	int32_t bucket = level * TIMER_SLOTS + ((cursor >> (TIMER_SLOT_BITS * level)) & (TIMER_SLOTS - 1));
+	int32_t index = buckets[bucket];
+	buckets[bucket] = TIMER_NONE;
+
+	while (index != TIMER_NONE)
+	{
+		int32_t next = timers[index].next;
+		link(index);
+		index = next;
+	}
+}
@@ -0,0 +1,61 @@
+#ifndef TIMERWHEEL_DEF
+#define TIMERWHEEL_DEF
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <mutex>
+
+#define TIMER_LEVELS				4
+#define TIMER_SLOT_BITS				6
+#define TIMER_SLOTS					(1 << TIMER_SLOT_BITS)		// per level; four levels reach about 4.6 hours
+#define TIMER_MAX_CAPACITY			65535		// the pool index is the low 16 bits of a handle
+#define TIMER_NONE					-1
+
+// One expired timer, as handed back by advance()
+struct TimerFired {
+	uint32_t kind;
+	uint32_t key;
+};
+
+class TimerWheel
+{
+  public:
+	TimerWheel();
+	~TimerWheel();
+	int32_t init(uint32_t capacity);
+	int32_t schedule(uint32_t kind, uint32_t key, uint32_t delayMs);
+	int32_t reschedule(int32_t handle, uint32_t delayMs);
+	int32_t cancel(int32_t handle);
+	int32_t advance(TimerFired *out, uint32_t max);
+	uint32_t pending();
+	static uint64_t now();
+
+  private:
+	struct Timer {
+		int32_t next;
+		int32_t prev;
+		uint64_t due;							// in ms
+		uint32_t kind;
+		uint32_t key;
+		uint16_t generation;					// bumped on every reuse, so stale handles miss
+		int16_t bucket;							// level * TIMER_SLOTS + slot, or TIMER_NONE when free
+	};
+
+	int32_t lookup(int32_t handle);
+	void link(int32_t index);
+	void unlink(int32_t index);
+	void cascade(uint32_t level);
+	int32_t expireUntil(uint64_t nowMs, TimerFired *out, uint32_t max);
+
+	Timer *timers;
+	uint32_t capacity;
+	int32_t freeList;
+	uint32_t active;
+	int32_t buckets[TIMER_LEVELS * TIMER_SLOTS];	// first timer in each slot, or TIMER_NONE
+	uint64_t cursor;							// next ms to expire
+	bool cascaded;								// cursor's cascade is done, its slot partly expired
+	std::mutex lock;
+};
+
+#endif
@@ -0,0 +1,536 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	tuning.cpp -   Thread placement, scheduling and socket option profile
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		Tuning();
+--					int32_t load(const char *path);
+--					uint32_t applyThread(int32_t role);
+--					uint32_t applySocket(int32_t kind, int fd);
+--					int32_t describeThread(int32_t role, char *out, uint32_t size);
+--					int32_t describeSocket(int32_t kind, char *out, uint32_t size);
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		A profile is a plain text file of "key = value" lines; '#' starts a comment. Thread keys
+--		are prefixed by the role (recv, send, game, tcp):
+--
+--			<role>.cpus		 cpu list, e.g. "2", "2,3" or "4-7"
+--			<role>.policy	 "other" or "fifo"
+--			<role>.priority	 SCHED_FIFO priority, 1 to 99
+--			<role>.nice		 nice level, -20 to 19
+--
+--		Socket keys are prefixed by udp or tcp: rcvbuf, sndbuf, busy_poll (microseconds),
+--		priority (SO_PRIORITY) and dscp (0 to 63, written to IP_TOS).
+--
+--		Nothing is applied at load time. Each thread calls applyThread() for its own role, since
+--		affinity and scheduling are per thread, and each socket is passed to applySocket() once
+--		it exists. Every setting is attempted on its own, so an unprivileged run that cannot get
+--		SCHED_FIFO still gets its affinity and buffers. What actually took effect, including the
+--		buffer sizes the kernel granted, is kept for describeThread()/describeSocket().
+---------------------------------------------------------------------------------------*/
+#include "tuning.h"
+
+static const char *threadNames[TUNE_THREADS] = {"recv", "send", "game", "tcp"};
+static const char *socketNames[TUNE_SOCKETS] = {"udp", "tcp"};
+static const char *optionNames[5] = {"rcvbuf", "sndbuf", "busy_poll", "priority", "dscp"};
+
+// Trims leading and trailing whitespace in place
+static char *trim(char *s)
+{
+	while (*s == ' ' || *s == '\t')
+	{
+		s++;
+	}
+	char *end = s + strlen(s);
+	while (end > s && (end[-1] == ' ' || end[-1] == '\t' || end[-1] == '\r' || end[-1] == '\n'))
+	{
+		*--end = 0;
+	}
+	return s;
+}
+
+Tuning::Tuning()
+{
+	for (int32_t i = 0; i < TUNE_THREADS; i++)
+	{
+		memset(&threads[i], 0, sizeof(ThreadProfile));
+		CPU_ZERO(&threads[i].cpus);
+		threads[i].policy = TUNE_UNSET;
+	}
+	for (int32_t i = 0; i < TUNE_SOCKETS; i++)
+	{
+		memset(&sockets[i], 0, sizeof(SocketProfile));
+		for (int32_t j = 0; j < 5; j++)
+		{
+			sockets[i].want[j] = TUNE_UNSET;
+			sockets[i].got[j] = TUNE_UNSET;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: load
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t load(const char *path)
+--								path: the profile file
+--
+-- RETURNS: the number of settings read, or -1 if the file could not be opened.
+--
+-- NOTES:
+-- 		Lines that do not parse are reported on stderr with their line number and skipped.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Tuning::load(const char *path)
+{
+	FILE *file = fopen(path, "r");
+	if (file == NULL)
+	{
+		perror("tuning profile open failed");
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	char line[TUNE_LINE_SIZE];
+	int32_t lineNo = 0;
+	int32_t count = 0;
+
+	while (fgets(line, sizeof(line), file) != NULL)
+	{
+		lineNo++;
+		char *hash = strchr(line, '#');
+		if (hash != NULL)
+		{
+			*hash = 0;
+		}
+
+		char *text = trim(line);
+		if (*text == 0)
+		{
+			continue;
+		}
+
+		char *eq = strchr(text, '=');
+		if (eq == NULL)
+		{
+			fprintf(stderr, "tuning profile line %d: expected key = value\n", lineNo);
+			continue;
+		}
+		*eq = 0;
+
+		if (set(trim(text), trim(eq + 1)) < 0)
+		{
+			fprintf(stderr, "tuning profile line %d: bad setting %s\n", lineNo, trim(text));
+			continue;
+		}
+		count++;
+	}
+
+	fclose(file);
+	return count;
+}
+
+int32_t Tuning::set(const char *key, const char *value)
+{
+	const char *dot = strchr(key, '.');
+	if (dot == NULL || *value == 0)
+	{
+		return -1;
+	}
+
+	size_t prefixLen = dot - key;
+	const char *name = dot + 1;
+	char *end;
+	long number = strtol(value, &end, 10);
+	bool isNumber = *end == 0;
+
+	// Socket options are tried first so "tcp.rcvbuf" is not taken for a thread key
+	for (int32_t i = 0; i < TUNE_SOCKETS; i++)
+	{
+		if (strlen(socketNames[i]) != prefixLen || strncmp(key, socketNames[i], prefixLen) != 0)
+		{
+			continue;
+		}
+		for (int32_t j = 0; j < 5; j++)
+		{
+			if (strcmp(name, optionNames[j]) == 0)
+			{
+				if (!isNumber || number < 0 || (j == 4 && number > 63))
+				{
+					return -1;
+				}
+				sockets[i].want[j] = (int32_t)number;
+				return 0;
+			}
+		}
+	}
+
+	for (int32_t i = 0; i < TUNE_THREADS; i++)
+	{
+		if (strlen(threadNames[i]) != prefixLen || strncmp(key, threadNames[i], prefixLen) != 0)
+		{
+			continue;
+		}
+
+		ThreadProfile &thread = threads[i];
+		if (strcmp(name, "cpus") == 0)
+		{
+			if (parseCpus(value, &thread.cpus) < 0)
+			{
+				return -1;
+			}
+			thread.hasCpus = true;
+			return 0;
+		}
+		if (strcmp(name, "policy") == 0)
+		{
+			if (strcmp(value, "fifo") == 0)
+			{
+				thread.policy = SCHED_FIFO;
+			}
+			else if (strcmp(value, "other") == 0)
+			{
+				thread.policy = SCHED_OTHER;
+			}
+			else
+			{
+				return -1;
+			}
+			return 0;
+		}
+		if (strcmp(name, "priority") == 0 && isNumber && number >= 1 && number <= 99)
+		{
+			thread.priority = (int32_t)number;
+			return 0;
+		}
+		if (strcmp(name, "nice") == 0 && isNumber && number >= -20 && number <= 19)
+		{
+			thread.nice = (int32_t)number;
+			thread.hasNice = true;
+			return 0;
+		}
+		return -1;
+	}
+
+	return -1;
+}
+
+int32_t Tuning::parseCpus(const char *value, cpu_set_t *cpus)
+{
+	CPU_ZERO(cpus);
+	const char *p = value;
+
+	while (*p)
+	{
+		char *end;
+		long first = strtol(p, &end, 10);
+		if (end == p || first < 0 || first >= CPU_SETSIZE)
+		{
+			return -1;
+		}
+		long last = first;
+		p = end;
+
+		if (*p == '-')
+		{
+			p++;
+			last = strtol(p, &end, 10);
+			if (end == p || last < first || last >= CPU_SETSIZE)
+			{
+				return -1;
+			}
+			p = end;
+		}
+
+		for (long cpu = first; cpu <= last; cpu++)
+		{
+			CPU_SET(cpu, cpus);
+		}
+
+		while (*p == ' ' || *p == ',')
+		{
+			p++;
+		}
+	}
+
+	return CPU_COUNT(cpus) > 0 ? 0 : -1;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: applyThread
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t applyThread(int32_t role)
+--								role: one of the TUNE_THREAD_ roles
+--
+-- RETURNS: TUNE_AFFINITY, TUNE_SCHED and TUNE_NICE bits for the settings that took effect.
+--
+-- NOTES:
+-- 		Applies to the calling thread only. A nice level is set on the thread id, which Linux honours
+--		per thread, and is skipped when the thread was moved to SCHED_FIFO.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t Tuning::applyThread(int32_t role)
+{
+	if (role < 0 || role >= TUNE_THREADS)
+	{
+		return 0;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	ThreadProfile &thread = threads[role];
+	uint32_t applied = 0;
+
+	if (thread.hasCpus)
+	{
+		thread.affinityErr = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &thread.cpus);
+		applied |= thread.affinityErr == 0 ? TUNE_AFFINITY : 0;
+	}
+
+	if (thread.policy != TUNE_UNSET)
+	{
+		struct sched_param param;
+		memset(&param, 0, sizeof(param));
+		param.sched_priority = thread.policy == SCHED_FIFO ? (thread.priority > 0 ? thread.priority : 1) : 0;
+		thread.schedErr = pthread_setschedparam(pthread_self(), thread.policy, &param);
+		applied |= thread.schedErr == 0 ? TUNE_SCHED : 0;
+	}
+
+	if (thread.hasNice && !(applied & TUNE_SCHED && thread.policy == SCHED_FIFO))
+	{
+		thread.niceErr = setpriority(PRIO_PROCESS, (id_t)syscall(SYS_gettid), thread.nice) == 0 ? 0 : errno;
+		applied |= thread.niceErr == 0 ? TUNE_NICE : 0;
+	}
+
+	thread.applied = applied;
+	thread.applyCount++;
+	return applied;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: applySocket
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: uint32_t applySocket(int32_t kind, int fd)
+--								kind: TUNE_SOCKET_UDP or TUNE_SOCKET_TCP
+--								fd: the socket
+--
+-- RETURNS: TUNE_RCVBUF, TUNE_SNDBUF, TUNE_BUSY_POLL, TUNE_PRIORITY and TUNE_DSCP bits for the options set.
+--
+-- NOTES:
+-- 		Buffer sizes are first forced past net.core.rmem_max/wmem_max, which needs CAP_NET_ADMIN, and
+--		otherwise set normally and capped by the kernel. Every option is read back afterwards, so
+--		the report shows what the socket ended up with rather than what was asked for.
+--------------------------------------------------------------------------------------------------------------*/
+uint32_t Tuning::applySocket(int32_t kind, int fd)
+{
+	if (kind < 0 || kind >= TUNE_SOCKETS || fd < 0)
+	{
+		return 0;
+	}
+
+	static const int levels[5] = {SOL_SOCKET, SOL_SOCKET, SOL_SOCKET, SOL_SOCKET, IPPROTO_IP};
+	static const int names[5] = {SO_RCVBUF, SO_SNDBUF, SO_BUSY_POLL, SO_PRIORITY, IP_TOS};
+	static const int forced[5] = {SO_RCVBUFFORCE, SO_SNDBUFFORCE, 0, 0, 0};
+
+	std::lock_guard<std::mutex> guard(lock);
+	SocketProfile &sock = sockets[kind];
+	uint32_t applied = 0;
+
+	for (int32_t i = 0; i < 5; i++)
+	{
+		if (sock.want[i] == TUNE_UNSET)
+		{
+			continue;
+		}
+
+		int value = i == 4 ? sock.want[i] << 2 : sock.want[i];
+		int result = -1;
+		if (forced[i] != 0)
+		{
+			result = setsockopt(fd, levels[i], forced[i], &value, sizeof(value));
+		}
+		if (result != 0)
+		{
+			result = setsockopt(fd, levels[i], names[i], &value, sizeof(value));
+		}
+
+		sock.err[i] = result == 0 ? 0 : errno;
+		applied |= result == 0 ? (1u << i) : 0;
+
+		int actual = 0;
+		socklen_t len = sizeof(actual);
+		if (getsockopt(fd, levels[i], names[i], &actual, &len) == 0)
+		{
+			// The kernel doubles buffer sizes for bookkeeping; DSCP is the top six bits of the TOS byte
+			sock.got[i] = i < 2 ? actual / 2 : (i == 4 ? actual >> 2 : actual);
+		}
+	}
+
+	sock.applied = applied;
+	sock.applyCount++;
+	return applied;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: describeThread
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t describeThread(int32_t role, char *out, uint32_t size)
+--								role: one of the TUNE_THREAD_ roles
+--								out: receives one line of text, NUL terminated
+--								size: size of out
+--
+-- RETURNS: the length written, or -1 for an unknown role.
+--
+-- NOTES:
+-- 		Lists each configured setting as applied or failed with the error; settings the profile does
+--		not mention are left out.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Tuning::describeThread(int32_t role, char *out, uint32_t size)
+{
+	if (role < 0 || role >= TUNE_THREADS || size == 0)
+	{
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	ThreadProfile &thread = threads[role];
+	char text[TUNE_REPORT_SIZE];
+	int32_t len = snprintf(text, sizeof(text), "%s thread (%u applied):", threadNames[role], thread.applyCount);
+
+	if (thread.hasCpus)
+	{
+		len += snprintf(text + len, sizeof(text) - len, " cpus");
+		for (int32_t cpu = 0; cpu < CPU_SETSIZE && len < (int32_t)sizeof(text) - 8; cpu++)
+		{
+			if (CPU_ISSET(cpu, &thread.cpus))
+			{
+				len += snprintf(text + len, sizeof(text) - len, " %d", cpu);
+			}
+		}
+		len += snprintf(text + len, sizeof(text) - len, " %s%s;", thread.applied & TUNE_AFFINITY ? "ok" : "failed ",
+						thread.applied & TUNE_AFFINITY ? "" : strerror(thread.affinityErr));
+	}
+	if (thread.policy != TUNE_UNSET && len < (int32_t)sizeof(text))
+	{
+		len += snprintf(text + len, sizeof(text) - len, " policy %s/%d %s%s;",
+						thread.policy == SCHED_FIFO ? "fifo" : "other", thread.priority,
+						thread.applied & TUNE_SCHED ? "ok" : "failed ",
+						thread.applied & TUNE_SCHED ? "" : strerror(thread.schedErr));
+	}
+	if (thread.hasNice && len < (int32_t)sizeof(text))
+	{
+		len += snprintf(text + len, sizeof(text) - len, " nice %d %s%s;", thread.nice,
+						thread.applied & TUNE_NICE ? "ok" : "skipped ",
+						thread.applied & TUNE_NICE ? "" : (thread.niceErr ? strerror(thread.niceErr) : "under fifo"));
+	}
+	if (!thread.hasCpus && thread.policy == TUNE_UNSET && !thread.hasNice)
+	{
+		snprintf(text + len, sizeof(text) - len, " defaults");
+	}
+	else if (thread.applyCount == 0)
+	{
+		snprintf(text, sizeof(text), "%s thread: not started", threadNames[role]);
+	}
+
+	snprintf(out, size, "%s", text);
+	return (int32_t)strlen(out);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: describeSocket
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t describeSocket(int32_t kind, char *out, uint32_t size)
+--								kind: TUNE_SOCKET_UDP or TUNE_SOCKET_TCP
+--								out: receives one line of text, NUL terminated
+--								size: size of out
+--
+-- RETURNS: the length written, or -1 for an unknown kind.
+--
+-- NOTES:
+-- 		Each configured option is shown as requested -> value read back from the last socket tuned.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t Tuning::describeSocket(int32_t kind, char *out, uint32_t size)
+{
+	if (kind < 0 || kind >= TUNE_SOCKETS || size == 0)
+	{
+		return -1;
+	}
+
+	std::lock_guard<std::mutex> guard(lock);
+	SocketProfile &sock = sockets[kind];
+	char text[TUNE_REPORT_SIZE];
+	int32_t len = snprintf(text, sizeof(text), "%s sockets (%u applied):", socketNames[kind], sock.applyCount);
+	bool any = false;
+
+	for (int32_t i = 0; i < 5 && len < (int32_t)sizeof(text); i++)
+	{
+		if (sock.want[i] == TUNE_UNSET)
+		{
+			continue;
+		}
+		any = true;
+		len += snprintf(text + len, sizeof(text) - len, " %s %d -> %d%s%s;", optionNames[i], sock.want[i], sock.got[i],
+						sock.applied & (1u << i) ? "" : " failed ",
+						sock.applied & (1u << i) ? "" : strerror(sock.err[i]));
+	}
+	if (!any)
+	{
+		snprintf(text + len, sizeof(text) - len, " defaults");
+	}
+	else if (sock.applyCount == 0)
+	{
+		snprintf(text, sizeof(text), "%s sockets: none opened", socketNames[kind]);
+	}
+
+	snprintf(out, size, "%s", text);
+	return (int32_t)strlen(out);
+}
@@ -0,0 +1,92 @@
+#ifndef TUNING_DEF
+#define TUNING_DEF
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <netinet/in.h>
+#include <netinet/ip.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <mutex>
+
+#ifndef SO_BUSY_POLL
+#define SO_BUSY_POLL				46
+#endif
+
+// Thread roles, each configured by "<role>.<key>" lines in the profile
+#define TUNE_THREAD_RECV			0
+#define TUNE_THREAD_SEND			1
+#define TUNE_THREAD_GAME			2
+#define TUNE_THREAD_TCP				3			// the per-client transmit threads
+#define TUNE_THREADS				4
+
+// Socket kinds, configured by "udp.<key>" and "tcp.<key>"
+#define TUNE_SOCKET_UDP				0
+#define TUNE_SOCKET_TCP				1
+#define TUNE_SOCKETS				2
+
+// Bits returned by applyThread()/applySocket() for each setting that took effect
+#define TUNE_AFFINITY				0x01
+#define TUNE_SCHED					0x02
+#define TUNE_NICE					0x04
+#define TUNE_RCVBUF					0x01
+#define TUNE_SNDBUF					0x02
+#define TUNE_BUSY_POLL				0x04
+#define TUNE_PRIORITY				0x08
+#define TUNE_DSCP					0x10
+
+#define TUNE_UNSET					-1
+#define TUNE_LINE_SIZE				256
+#define TUNE_REPORT_SIZE			512
+
+class Tuning
+{
+  public:
+	Tuning();
+	int32_t load(const char *path);
+	uint32_t applyThread(int32_t role);
+	uint32_t applySocket(int32_t kind, int fd);
+	int32_t describeThread(int32_t role, char *out, uint32_t size);
+	int32_t describeSocket(int32_t kind, char *out, uint32_t size);
+
+  private:
+	struct ThreadProfile {
+		cpu_set_t cpus;
+		bool hasCpus;
+		int32_t policy;							// SCHED_OTHER, SCHED_FIFO or TUNE_UNSET
+		int32_t priority;						// SCHED_FIFO priority
+		int32_t nice;
+		bool hasNice;
+
+		uint32_t applied;
+		int affinityErr;
+		int schedErr;
+		int niceErr;
+		uint32_t applyCount;
+	};
+
+	struct SocketProfile {
+		int32_t want[5];						// rcvbuf, sndbuf, busy_poll, priority, dscp
+		int32_t got[5];							// read back from the kernel after setting
+		int err[5];
+		uint32_t applied;
+		uint32_t applyCount;
+	};
+
+	int32_t set(const char *key, const char *value);
+	static int32_t parseCpus(const char *value, cpu_set_t *cpus);
+
+	std::mutex lock;
+	ThreadProfile threads[TUNE_THREADS];
+	SocketProfile sockets[TUNE_SOCKETS];
+};
+
+#endif
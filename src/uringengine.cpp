@@ -0,0 +1,854 @@
+/*---------------------------------------------------------------------------------------
+--	SOURCE FILE:	uringengine.cpp -   io_uring transport engine for the UDP and TCP servers
+--
+--	PROGRAM:		libNetwork.so (dynamically loaded networking library)
+--
+--	FUNCTIONS:		UringEngine();
+--					int32_t initialize(uint32_t entries, uint32_t sendSlots, uint32_t slotSize,
+--									   uint32_t recvBuffers, uint32_t files, bool fixedWrites);
+--					int32_t registerFile(uint32_t fileIndex, int fd);
+--					int32_t armRecv(uint32_t fileIndex);
+--					int32_t queueSendTo(uint32_t fileIndex, EndPoint ep, const char *data, uint32_t len);
+--					int32_t queueWrite(uint32_t fileIndex, const char *data, uint32_t len);
+--					int32_t submit();
+--					int32_t waitFor(int32_t slot);
+--					int32_t writeAll(uint32_t fileIndex, const char *data, uint32_t len);
+--					int32_t pollRecv();
+--					int32_t recvFrom(char *buffer, uint32_t size, EndPoint *ep);
+--					bool failed();
+--
+--	DATE:			October 19th, 2026
+--
+--	REVISIONS:		October 19th, 2026 - agent: only engines doing fixed writes register their send slab
+--					October 19th, 2026 - agent: re-arming the receive no longer flushes queued sends, waitFor() is bounded
+--
+--	DESIGNERS:		agent
+--
+--	PROGRAMMER:		agent
+--
+--	NOTES:
+--		The engine drives a raw io_uring instance (no liburing dependency) with:
+--
+--		- a registered file table, so sockets are referenced by index instead of being looked
+--		  up on every operation;
+--		- a slab of send buffers. Outgoing data is copied into a free slot and queued, and
+--		  nothing reaches the kernel until submit(), so a whole tick of snapshots goes out in a
+--		  single io_uring_enter(). UDP datagrams go out as IORING_OP_SENDMSG, which cannot use
+--		  registered buffers, so only an engine initialized for fixed writes (the TCP one, with
+--		  IORING_OP_WRITE_FIXED) registers its slab;
+--		- a provided-buffer ring feeding one multishot recvmsg on the UDP socket. The receive
+--		  stays posted across datagrams and is only re-armed if the kernel terminates it.
+--
+--		Every public method takes the engine lock; the only blocking call, the wait inside
+--		waitFor(), is made without it.
+--
+--		initialize() fails cleanly on kernels that lack any of the features used here, and
+--		failed() reports a receive that the kernel rejected after arming, so callers can fall
+--		back to the epoll/recvmmsg path.
+---------------------------------------------------------------------------------------*/
+#include "uringengine.h"
+
+static int uringSetup(unsigned entries, struct io_uring_params *p)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+static int uringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags, void *arg, size_t argSize)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize);
+}
+
+static int uringRegister(int fd, unsigned opcode, void *arg, unsigned nrArgs)
+{
+	return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nrArgs);
+}
+
+static uint64_t uringTag(uint32_t op, uint32_t index)
+{
+	return ((uint64_t)op << 32) | index;
+}
+
+UringEngine::UringEngine()
+{
+	ringFd = -1;
+	broken = false;
+	sqRing = MAP_FAILED;
+	cqRing = MAP_FAILED;
+	sqes = (struct io_uring_sqe *)MAP_FAILED;
+	sqRingSize = cqRingSize = sqesSize = 0;
+	sqLocalTail = 0;
+	sendSlab = (char *)MAP_FAILED;
+	sendSlabSize = 0;
+	slotSize = 0;
+	fixedBuffers = false;
+	pendingSubmit = 0;
+	bufRing = (struct io_uring_buf_ring *)MAP_FAILED;
+	bufRingSize = 0;
+	recvSlab = (char *)MAP_FAILED;
+	recvSlabSize = 0;
+	recvBuffers = 0;
+	recvBufferSize = 0;
+	bufTail = 0;
+	recvFile = 0;
+	recvArmed = false;
+	readyHead = readyTail = 0;
+	memset(&recvMsg, 0, sizeof(recvMsg));
+}
+
+UringEngine::~UringEngine()
+{
+	release();
+}
+
+void UringEngine::release()
+{
+	if (ringFd >= 0)
+	{
+		close(ringFd);
+		ringFd = -1;
+	}
+	if (sqes != MAP_FAILED)
+	{
+		munmap(sqes, sqesSize);
+		sqes = (struct io_uring_sqe *)MAP_FAILED;
+	}
+	if (cqRing != MAP_FAILED && cqRing != sqRing)
+	{
+		munmap(cqRing, cqRingSize);
+	}
+	cqRing = MAP_FAILED;
+	if (sqRing != MAP_FAILED)
+	{
+		munmap(sqRing, sqRingSize);
+		sqRing = MAP_FAILED;
+	}
+	if (sendSlab != MAP_FAILED)
+	{
+		munmap(sendSlab, sendSlabSize);
+		sendSlab = (char *)MAP_FAILED;
+	}
+	if (bufRing != MAP_FAILED)
+	{
+		munmap(bufRing, bufRingSize);
+		bufRing = (struct io_uring_buf_ring *)MAP_FAILED;
+	}
+	if (recvSlab != MAP_FAILED)
+	{
+		munmap(recvSlab, recvSlabSize);
+		recvSlab = (char *)MAP_FAILED;
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: initialize
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: fixedWrites, the slab is only registered when queueWrite() will use it - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t initialize(uint32_t entries, uint32_t sendSlots, uint32_t slotSize, uint32_t recvBuffers,
+--								 uint32_t files, bool fixedWrites)
+--								entries: submission queue depth
+--								sendSlots: number of send buffers
+--								slotSize: size of each send buffer in bytes
+--								recvBuffers: provided receive buffers (power of two), 0 for a send-only engine
+--								files: size of the registered file table
+--								fixedWrites: register the send buffers for queueWrite(); queueSendTo() does
+--											 not need them registered
+--
+-- RETURNS: 0 on success, or -1 if io_uring or one of the required features is unavailable.
+--
+-- NOTES:
+-- 		On failure every resource acquired so far is released and the engine must not be used.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::initialize(uint32_t entries, uint32_t sendSlots, uint32_t size, uint32_t buffers, uint32_t files,
+								bool fixedWrites)
+{
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+
+	if ((ringFd = uringSetup(entries, &params)) < 0)
+	{
+		ringFd = -1;
+		return -1;
+	}
+
+	sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+	cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (singleMap)
+	{
+		sqRingSize = cqRingSize = (sqRingSize > cqRingSize ? sqRingSize : cqRingSize);
+	}
+
+	sqRing = mmap(0, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+	if (sqRing == MAP_FAILED)
+	{
+		release();
+		return -1;
+	}
+	cqRing = singleMap ? sqRing
+					   : mmap(0, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+	sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+	sqes = (struct io_uring_sqe *)mmap(0, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+	if (cqRing == MAP_FAILED || sqes == MAP_FAILED)
+	{
+		release();
+		return -1;
+	}
+
+	char *sq = (char *)sqRing;
+	char *cq = (char *)cqRing;
+	sqHead = (unsigned *)(sq + params.sq_off.head);
+	sqTail = (unsigned *)(sq + params.sq_off.tail);
+	sqMask = (unsigned *)(sq + params.sq_off.ring_mask);
+	sqArray = (unsigned *)(sq + params.sq_off.array);
+	sqLocalTail = *sqTail;
+	cqHead = (unsigned *)(cq + params.cq_off.head);
+	cqTail = (unsigned *)(cq + params.cq_off.tail);
+	cqMask = (unsigned *)(cq + params.cq_off.ring_mask);
+	cqes = (struct io_uring_cqe *)(cq + params.cq_off.cqes);
+
+	// Send buffers, registered only for fixed writes
+	slotSize = size;
+	sendSlabSize = (size_t)sendSlots * slotSize;
+	sendSlab = (char *)mmap(0, sendSlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (sendSlab == MAP_FAILED)
+	{
+		release();
+		return -1;
+	}
+
+	std::vector<struct iovec> iovecs(sendSlots);
+	slots.resize(sendSlots);
+	freeSlots.clear();
+	for (uint32_t i = 0; i < sendSlots; i++)
+	{
+		iovecs[i].iov_base = sendSlab + (size_t)i * slotSize;
+		iovecs[i].iov_len = slotSize;
+		memset(&slots[i], 0, sizeof(SendSlot));
+		freeSlots.push_back(sendSlots - 1 - i);
+	}
+	if (fixedWrites && uringRegister(ringFd, IORING_REGISTER_BUFFERS, &iovecs[0], sendSlots) < 0)
+	{
+		perror("io_uring register buffers");
+		release();
+		return -1;
+	}
+	fixedBuffers = fixedWrites;
+
+	// Sparse registered file table, filled in by registerFile()
+	std::vector<int> table(files, -1);
+	if (uringRegister(ringFd, IORING_REGISTER_FILES, &table[0], files) < 0)
+	{
+		perror("io_uring register files");
+		release();
+		return -1;
+	}
+
+	// Provided buffer ring for multishot receives
+	recvBuffers = buffers;
+	if (recvBuffers > 0)
+	{
+		recvBufferSize = sizeof(struct io_uring_recvmsg_out) + sizeof(sockaddr_in) + slotSize;
+		bufRingSize = recvBuffers * sizeof(struct io_uring_buf);
+		bufRing = (struct io_uring_buf_ring *)mmap(0, bufRingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		recvSlabSize = (size_t)recvBuffers * recvBufferSize;
+		recvSlab = (char *)mmap(0, recvSlabSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (bufRing == MAP_FAILED || recvSlab == MAP_FAILED)
+		{
+			release();
+			return -1;
+		}
+
+		struct io_uring_buf_reg reg;
+		memset(&reg, 0, sizeof(reg));
+		reg.ring_addr = (uint64_t)(uintptr_t)bufRing;
+		reg.ring_entries = recvBuffers;
+		reg.bgid = URING_BUFFER_GROUP;
+		if (uringRegister(ringFd, IORING_REGISTER_PBUF_RING, &reg, 1) < 0)
+		{
+			release();
+			return -1;
+		}
+
+		bufTail = 0;
+		for (uint32_t i = 0; i < recvBuffers; i++)
+		{
+			recycleBuffer((uint16_t)i);
+		}
+
+		ready.resize(recvBuffers);
+		readyHead = readyTail = 0;
+	}
+
+	return 0;
+}
+
+int32_t UringEngine::registerFile(uint32_t fileIndex, int fd)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	struct io_uring_files_update update;
+	memset(&update, 0, sizeof(update));
+	update.offset = fileIndex;
+	update.fds = (uint64_t)(uintptr_t)&fd;
+
+	return uringRegister(ringFd, IORING_REGISTER_FILES_UPDATE, &update, 1) < 0 ? -1 : 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: armRecv
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t armRecv(uint32_t fileIndex)
+--								fileIndex: registered index of the UDP socket
+--
+-- RETURNS: 0 on success, or -1 if the engine has no receive buffers.
+--
+-- NOTES:
+-- 		Posts a multishot recvmsg that picks its buffers from the provided buffer ring, and submits it.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::armRecv(uint32_t fileIndex)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (recvBuffers == 0)
+	{
+		return -1;
+	}
+
+	recvFile = fileIndex;
+	memset(&recvMsg, 0, sizeof(recvMsg));
+	recvMsg.msg_namelen = sizeof(sockaddr_in);
+	postRecv();
+	return 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: queueSendTo
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t queueSendTo(uint32_t fileIndex, EndPoint ep, const char *data, uint32_t len)
+--								fileIndex: registered index of the UDP socket
+--								ep: destination, host byte order
+--								data: datagram to send
+--								len: its length, at most the slot size
+--
+-- RETURNS: the send slot used, or URING_NO_SLOT if the datagram is too large or all slots are busy.
+--
+-- NOTES:
+-- 		The datagram is copied into a send slot and a sendmsg is queued but not submitted. The slot
+--		is returned to the free list as soon as its completion is reaped.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::queueSendTo(uint32_t fileIndex, EndPoint ep, const char *data, uint32_t len)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (len > slotSize)
+	{
+		return URING_NO_SLOT;
+	}
+
+	int32_t slot = takeSlot();
+	if (slot == URING_NO_SLOT)
+	{
+		return URING_NO_SLOT;
+	}
+
+	SendSlot &s = slots[slot];
+	char *buffer = sendSlab + (size_t)slot * slotSize;
+	memcpy(buffer, data, len);
+
+	memset(&s.addr, 0, sizeof(s.addr));
+	s.addr.sin_family = AF_INET;
+	s.addr.sin_addr.s_addr = htonl(ep.addr);
+	s.addr.sin_port = htons(ep.port);
+	s.iov.iov_base = buffer;
+	s.iov.iov_len = len;
+	memset(&s.msg, 0, sizeof(s.msg));
+	s.msg.msg_name = &s.addr;
+	s.msg.msg_namelen = sizeof(s.addr);
+	s.msg.msg_iov = &s.iov;
+	s.msg.msg_iovlen = 1;
+	s.done = false;
+
+	struct io_uring_sqe *sqe = nextSqe();
+	sqe->opcode = IORING_OP_SENDMSG;
+	sqe->fd = fileIndex;
+	sqe->flags = IOSQE_FIXED_FILE;
+	sqe->addr = (uint64_t)(uintptr_t)&s.msg;
+	sqe->len = 1;
+	sqe->user_data = uringTag(URING_OP_SEND, slot);
+	s.busy = false;
+
+	return slot;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: queueWrite
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t queueWrite(uint32_t fileIndex, const char *data, uint32_t len)
+--								fileIndex: registered index of a connected TCP socket
+--								data: bytes to write
+--								len: number of bytes, at most the slot size
+--
+-- RETURNS: the send slot used, or URING_NO_SLOT, always for an engine not initialized for fixed writes.
+--
+-- NOTES:
+-- 		Queues a write from a registered buffer. Unlike UDP sends the slot stays reserved until the caller
+--		collects the result with waitFor().
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::queueWrite(uint32_t fileIndex, const char *data, uint32_t len)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (!fixedBuffers || len > slotSize)
+	{
+		return URING_NO_SLOT;
+	}
+
+	int32_t slot = takeSlot();
+	if (slot == URING_NO_SLOT)
+	{
+		return URING_NO_SLOT;
+	}
+
+	SendSlot &s = slots[slot];
+	char *buffer = sendSlab + (size_t)slot * slotSize;
+	memcpy(buffer, data, len);
+	s.done = false;
+	s.busy = true;
+
+	struct io_uring_sqe *sqe = nextSqe();
+	sqe->opcode = IORING_OP_WRITE_FIXED;
+	sqe->fd = fileIndex;
+	sqe->flags = IOSQE_FIXED_FILE;
+	sqe->addr = (uint64_t)(uintptr_t)buffer;
+	sqe->len = len;
+	sqe->buf_index = (uint16_t)slot;
+	sqe->user_data = uringTag(URING_OP_SEND, slot);
+
+	return slot;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: submit
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t submit()
+--
+-- RETURNS: the number of operations handed to the kernel, or -1 on error.
+--
+-- NOTES:
+-- 		Publishes everything queued since the last submit with one io_uring_enter() and reaps whatever has
+--		already completed, which frees the send slots of the previous batch.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::submit()
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	int32_t submitted = 0;
+	if (pendingSubmit > 0)
+	{
+		__atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+		submitted = uringEnter(ringFd, pendingSubmit, 0, 0, 0, 0);
+		if (submitted < 0)
+		{
+			return -1;
+		}
+		pendingSubmit -= submitted;
+	}
+
+	reap();
+	return submitted;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: waitFor
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--		October 19th, 2026: gives up after URING_WAIT_MS or when the ring fails - agent
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t waitFor(int32_t slot)
+--								slot: a slot returned by queueWrite() that has been submitted
+--
+-- RETURNS: the result of the write (bytes written or -errno), -ETIMEDOUT if it has not completed within
+--			URING_WAIT_MS, or -errno if the ring can no longer be waited on.
+--
+-- NOTES:
+-- 		Several threads may wait at once. Each reaps under the lock and then sleeps in the kernel for up to
+--		a millisecond without it, so a completion reaped by another thread is still seen promptly.
+--
+--		A slot given up on stays out of the free list until its completion is reaped, since the kernel
+--		may still be reading from it.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::waitFor(int32_t slot)
+{
+	std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now()
+		+ std::chrono::milliseconds(URING_WAIT_MS);
+
+	struct __kernel_timespec timeout;
+	timeout.tv_sec = 0;
+	timeout.tv_nsec = 1000000;
+
+	struct io_uring_getevents_arg arg;
+	memset(&arg, 0, sizeof(arg));
+	arg.ts = (uint64_t)(uintptr_t)&timeout;
+
+	int32_t error = 0;
+	while (true)
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			reap();
+			if (slots[slot].done)
+			{
+				int32_t result = slots[slot].result;
+				slots[slot].busy = false;
+				freeSlots.push_back(slot);
+				return result;
+			}
+			if (error != 0 || std::chrono::steady_clock::now() >= deadline)
+			{
+				slots[slot].busy = false;
+				return error != 0 ? error : -ETIMEDOUT;
+			}
+		}
+		if (uringEnter(ringFd, 0, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg)) < 0
+			&& errno != ETIME && errno != EINTR && errno != EAGAIN && errno != EBUSY)
+		{
+			error = -errno;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: writeAll
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t writeAll(uint32_t fileIndex, const char *data, uint32_t len)
+--
+-- RETURNS: the number of bytes written, which is less than len only on error.
+--
+-- NOTES:
+-- 		Streams len bytes through slot sized writes, resubmitting the remainder after a short write.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::writeAll(uint32_t fileIndex, const char *data, uint32_t len)
+{
+	uint32_t written = 0;
+
+	while (written < len)
+	{
+		uint32_t chunk = len - written < slotSize ? len - written : slotSize;
+		int32_t slot = queueWrite(fileIndex, data + written, chunk);
+		if (slot == URING_NO_SLOT)
+		{
+			break;
+		}
+		submit();
+
+		int32_t result = waitFor(slot);
+		if (result <= 0)
+		{
+			break;
+		}
+		written += result;
+	}
+
+	return written;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: pollRecv
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t pollRecv()
+--
+-- RETURNS: 1 if a datagram is waiting, 0 if not.
+--
+-- NOTES:
+-- 		Reaps completions without entering the kernel unless the multishot receive has to be re-armed.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::pollRecv()
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	reap();
+	if (!recvArmed && !broken && recvBuffers > 0)
+	{
+		postRecv();
+	}
+
+	return readyHead != readyTail ? 1 : 0;
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: recvFrom
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: int32_t recvFrom(char *buffer, uint32_t size, EndPoint *ep)
+--								buffer: receives the datagram, truncated to size
+--								size: the size of buffer
+--								ep: filled with the sender
+--
+-- RETURNS: the datagram length, or -1 if nothing is waiting.
+--
+-- NOTES:
+-- 		Copies the oldest received datagram out and gives its provided buffer straight back to the kernel.
+--------------------------------------------------------------------------------------------------------------*/
+int32_t UringEngine::recvFrom(char *buffer, uint32_t size, EndPoint *ep)
+{
+	std::lock_guard<std::mutex> guard(lock);
+
+	if (readyHead == readyTail)
+	{
+		reap();
+		if (readyHead == readyTail)
+		{
+			return -1;
+		}
+	}
+
+	ReadyDatagram &datagram = ready[readyHead % recvBuffers];
+	uint32_t len = datagram.len < size ? datagram.len : size;
+	memcpy(buffer, recvSlab + (size_t)datagram.bid * recvBufferSize + datagram.offset, len);
+	*ep = datagram.ep;
+
+	recycleBuffer(datagram.bid);
+	readyHead++;
+	return len;
+}
+
+bool UringEngine::failed()
+{
+	std::lock_guard<std::mutex> guard(lock);
+	reap();
+	return broken;
+}
+
+void UringEngine::postRecv()
+{
+	struct io_uring_sqe *sqe = nextSqe();
+	sqe->opcode = IORING_OP_RECVMSG;
+	sqe->fd = recvFile;
+	sqe->flags = IOSQE_FIXED_FILE | IOSQE_BUFFER_SELECT;
+	sqe->addr = (uint64_t)(uintptr_t)&recvMsg;
+	sqe->ioprio = IORING_RECV_MULTISHOT;
+	sqe->buf_group = URING_BUFFER_GROUP;
+	sqe->user_data = uringTag(URING_OP_RECV, 0);
+	recvArmed = true;
+
+	// Sends queued this tick stay queued until submit(); the receive only goes in on its own
+	if (pendingSubmit == 1)
+	{
+		__atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+		if (uringEnter(ringFd, 1, 0, 0, 0, 0) > 0)
+		{
+			pendingSubmit--;
+		}
+	}
+}
+
+struct io_uring_sqe *UringEngine::nextSqe()
+{
+	unsigned entries = *sqMask + 1;
+	if (sqLocalTail - __atomic_load_n(sqHead, __ATOMIC_ACQUIRE) >= entries)
+	{
+		__atomic_store_n(sqTail, sqLocalTail, __ATOMIC_RELEASE);
+		int32_t submitted = uringEnter(ringFd, pendingSubmit, 0, 0, 0, 0);
+		if (submitted > 0)
+		{
+			pendingSubmit -= submitted;
+		}
+	}
+
+	unsigned index = sqLocalTail & *sqMask;
+	sqArray[index] = index;
+	struct io_uring_sqe *sqe = &sqes[index];
+	memset(sqe, 0, sizeof(*sqe));
+	sqLocalTail++;
+	pendingSubmit++;
+	return sqe;
+}
+
+int32_t UringEngine::takeSlot()
+{
+	if (freeSlots.empty())
+	{
+		reap();
+		if (freeSlots.empty())
+		{
+			return URING_NO_SLOT;
+		}
+	}
+
+	int32_t slot = freeSlots.back();
+	freeSlots.pop_back();
+	return slot;
+}
+
+void UringEngine::recycleBuffer(uint16_t bid)
+{
+	// The uapi header declares bufs as a flexible array behind an empty struct, which C++ gives a
+	// non-zero size; index the ring as a plain array so entry 0 starts where the kernel expects it.
+	struct io_uring_buf *buf = (struct io_uring_buf *)bufRing + (bufTail & (recvBuffers - 1));
+	buf->addr = (uint64_t)(uintptr_t)(recvSlab + (size_t)bid * recvBufferSize);
+	buf->len = recvBufferSize;
+	buf->bid = bid;
+	bufTail++;
+	__atomic_store_n(&bufRing->tail, bufTail, __ATOMIC_RELEASE);
+}
+
+
+/*------------------------------------------------------------------------------------------------------------
+-- FUNCTION: reap
+--
+-- DATE: October 19th, 2026
+--
+-- REVISIONS:
+--
+-- DESIGNER: agent
+--
+-- PROGRAMMER: agent
+--
+-- INTERFACE: void reap()
+--
+-- RETURNS: void
+--
+-- NOTES:
+-- 		Consumes every completion in the CQ ring. Receive completions are parsed in place and queued for
+--		recvFrom(); a receive the kernel rejects outright (EINVAL) marks the engine broken. Send completions
+--		record their result and free UDP slots immediately. Must be called with the engine lock held.
+--------------------------------------------------------------------------------------------------------------*/
+void UringEngine::reap()
+{
+	unsigned head = *cqHead;
+	unsigned tail = __atomic_load_n(cqTail, __ATOMIC_ACQUIRE);
+
+	while (head != tail)
+	{
+		struct io_uring_cqe *cqe = &cqes[head & *cqMask];
+		uint32_t op = (uint32_t)(cqe->user_data >> 32);
+		uint32_t index = (uint32_t)(cqe->user_data & 0xffffffff);
+
+		if (op == URING_OP_RECV)
+		{
+			if (cqe->res < 0 && cqe->res != -ENOBUFS)
+			{
+				broken = broken || cqe->res == -EINVAL || cqe->res == -EOPNOTSUPP;
+			}
+			if (cqe->res >= 0 && (cqe->flags & IORING_CQE_F_BUFFER))
+			{
+				uint16_t bid = (uint16_t)(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+				char *buffer = recvSlab + (size_t)bid * recvBufferSize;
+				struct io_uring_recvmsg_out *out = (struct io_uring_recvmsg_out *)buffer;
+				uint32_t offset = sizeof(struct io_uring_recvmsg_out) + recvMsg.msg_namelen + recvMsg.msg_controllen;
+
+				if (readyTail - readyHead < recvBuffers)
+				{
+					ReadyDatagram &datagram = ready[readyTail % recvBuffers];
+					sockaddr_in *addr = (sockaddr_in *)(buffer + sizeof(struct io_uring_recvmsg_out));
+					datagram.bid = bid;
+					datagram.offset = offset;
+					datagram.len = out->payloadlen < recvBufferSize - offset ? out->payloadlen : recvBufferSize - offset;
+					datagram.ep.addr = ntohl(addr->sin_addr.s_addr);
+					datagram.ep.port = ntohs(addr->sin_port);
+					readyTail++;
+				}
+				else
+				{
+					recycleBuffer(bid);
+				}
+			}
+			if (!(cqe->flags & IORING_CQE_F_MORE))
+			{
+				recvArmed = false;
+			}
+		}
+		else if (op == URING_OP_SEND && index < slots.size())
+		{
+			SendSlot &s = slots[index];
+			s.result = cqe->res;
+			s.done = true;
+			if (!s.busy)
+			{
+				freeSlots.push_back(index);
+			}
+		}
+
+		head++;
+	}
+
+	__atomic_store_n(cqHead, head, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,115 @@
+#ifndef URINGENGINE_DEF
+#define URINGENGINE_DEF
+
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <linux/io_uring.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "EndPoint.h"
+
+#define URING_BUFFER_GROUP			1
+#define URING_OP_RECV				1
+#define URING_OP_SEND				2
+#define URING_NO_SLOT				-1
+#define URING_WAIT_MS				1000		// longest waitFor() waits on one write
+
+class UringEngine
+{
+  public:
+	UringEngine();
+	~UringEngine();
+	int32_t initialize(uint32_t entries, uint32_t sendSlots, uint32_t slotSize, uint32_t recvBuffers, uint32_t files,
+					   bool fixedWrites);
+	int32_t registerFile(uint32_t fileIndex, int fd);
+	int32_t armRecv(uint32_t fileIndex);
+	int32_t queueSendTo(uint32_t fileIndex, EndPoint ep, const char *data, uint32_t len);
+	int32_t queueWrite(uint32_t fileIndex, const char *data, uint32_t len);
+	int32_t submit();
+	int32_t waitFor(int32_t slot);
+	int32_t writeAll(uint32_t fileIndex, const char *data, uint32_t len);
+	int32_t pollRecv();
+	int32_t recvFrom(char *buffer, uint32_t size, EndPoint *ep);
+	bool failed();
+
+  private:
+	struct SendSlot {
+		struct msghdr msg;
+		struct iovec iov;
+		sockaddr_in addr;
+		bool busy;
+		bool done;
+		int32_t result;
+	};
+
+	struct ReadyDatagram {
+		uint16_t bid;
+		uint32_t offset;
+		uint32_t len;
+		EndPoint ep;
+	};
+
+	struct io_uring_sqe *nextSqe();
+	void postRecv();
+	int32_t takeSlot();
+	void reap();
+	void recycleBuffer(uint16_t bid);
+	void release();
+
+	std::mutex lock;
+	int ringFd;
+	bool broken;
+
+	void *sqRing;
+	void *cqRing;
+	size_t sqRingSize;
+	size_t cqRingSize;
+	struct io_uring_sqe *sqes;
+	size_t sqesSize;
+	unsigned *sqHead;
+	unsigned *sqTail;
+	unsigned *sqMask;
+	unsigned *sqArray;
+	unsigned sqLocalTail;
+	unsigned *cqHead;
+	unsigned *cqTail;
+	unsigned *cqMask;
+	struct io_uring_cqe *cqes;
+
+	char *sendSlab;
+	size_t sendSlabSize;
+	uint32_t slotSize;
+	bool fixedBuffers;							// the slab is registered, for queueWrite() only
+	std::vector<SendSlot> slots;
+	std::vector<int32_t> freeSlots;
+	uint32_t pendingSubmit;
+
+	struct io_uring_buf_ring *bufRing;
+	size_t bufRingSize;
+	char *recvSlab;
+	size_t recvSlabSize;
+	uint32_t recvBuffers;
+	uint32_t recvBufferSize;
+	uint16_t bufTail;
+	struct msghdr recvMsg;
+	uint32_t recvFile;
+	bool recvArmed;
+
+	std::vector<ReadyDatagram> ready;
+	uint32_t readyHead;
+	uint32_t readyTail;
+};
+
+#endif
@@ -0,0 +1,24 @@
+# Example tuning profile, loaded when TUNING_PROFILE points at it:
+#   TUNING_PROFILE=./tuning.profile mono server.exe
+# Remove or comment out anything the host cannot honour; the server logs each setting as ok or failed.
+
+# Keep the tick threads on their own cores, away from core 0 and its interrupts. recv is the
+# host's receive thread and game every match worker, so give game as many cores as MATCH_WORKERS
+recv.cpus = 1
+game.cpus = 2-3
+tcp.cpus = 0
+
+# SCHED_FIFO needs CAP_SYS_NICE or an rtprio limit; a negative nice needs the same
+#recv.policy = fifo
+#recv.priority = 10
+game.nice = -5
+
+# Buffers above net.core.rmem_max/wmem_max need CAP_NET_ADMIN, otherwise the kernel caps them
+udp.rcvbuf = 4194304
+udp.sndbuf = 4194304
+udp.busy_poll = 50
+udp.priority = 6
+udp.dscp = 46
+
+tcp.sndbuf = 1048576
+tcp.dscp = 10